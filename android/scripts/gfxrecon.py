@@ -89,6 +89,8 @@ def CreateReplayParser():
     parser.add_argument('--offscreen-swapchain-frame-boundary', action='store_true', default=False, help='Should only be used with offscreen swapchain. Activates the extension VK_EXT_frame_boundary (always supported if trimming, checks for driver support otherwise) and inserts command buffer submission with VkFrameBoundaryEXT where vkQueuePresentKHR was called in the original capture. This allows preserving frames when capturing a replay that uses. offscreen swapchain. (forwarded to replay tool)')
     parser.add_argument('--mfr', '--measurement-frame-range', metavar='START-END', help='Custom framerange to measure FPS for. This range will include the start frame but not the end frame. The measurement frame range defaults to all frames except the loading frame but can be configured for any range. If the end frame is past the last frame in the trace it will be clamped to the frame after the last (so in that case the results would include the last frame). (forwarded to replay tool)')
     parser.add_argument('--measurement-file', metavar='DEVICE_FILE', help='Write measurements to a file at the specified path. Default is: \'/sdcard/gfxrecon-measurements.json\' on android and \'./gfxrecon-measurements.json\' on desktop. (forwarded to replay tool)')
+    parser.add_argument('--frame-time-file', metavar='DEVICE_FILE', help='Write the duration of every measured frame to a file at the specified path, as CSV for files with a .csv extension and as JSON with frame time percentiles otherwise. (forwarded to replay tool)')
+    parser.add_argument('--loop-measurement-range', metavar='COUNT', help='Preload the measurement frame range into memory and replay it COUNT times before continuing with the rest of the file. (forwarded to replay tool)')
     parser.add_argument('--quit-after-measurement-range', action='store_true', default=False, help='If this is specified the replayer will abort when it reaches the <end_frame> specified in the --measurement-frame-range argument. (forwarded to replay tool)')
     parser.add_argument('--flush-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at the start and end of the measurement range. (forwarded to replay tool)')
     parser.add_argument('--flush-inside-measurement-range', action='store_true', default=False, help='If this is specified the replayer will flush and wait for all current GPU work to finish at end of each frame inside the measurement range. (forwarded to replay tool)')
@@ -113,12 +115,18 @@ def CreateReplayParser():
     parser.add_argument('--dump-resources-dump-all-image-subresources', action='store_true', default=False, help= 'Dump all available mip levels and layers when dumping images.')
     parser.add_argument('--dump-resources-dump-raw-images', action='store_true', default=False, help= 'Dump images verbatim as raw binary files.')
     parser.add_argument('--dump-resources-dump-separate-alpha', action='store_true', default=False, help= 'Dump image alpha in a separate image file.')
+    parser.add_argument('--dump-resources-archive', action='store_true', default=False, help= 'Store dumped resources in a single indexed archive file.')
+    parser.add_argument('--dump-resources-skip-unchanged', action='store_true', default=False, help= 'Skip the readback of resources that did not change since they were last dumped.')
     parser.add_argument('--pbi-all', action='store_true', default=False, help='Print all block information.')
     parser.add_argument('--pbis', metavar='RANGES', default=False, help='Print block information between block index1 and block index2')
     parser.add_argument('--pcj', '--pipeline-creation-jobs', action='store_true', default=False, help='Specify the number of pipeline-creation-jobs or background-threads.')
     parser.add_argument('--save-pipeline-cache', metavar='DEVICE_FILE', help='If set, produces pipeline caches at replay time instead of using the one saved at capture time and save those caches in DEVICE_FILE. (forwarded to replay tool)')
     parser.add_argument('--load-pipeline-cache', metavar='DEVICE_FILE', help='If set, loads data created by the `--save-pipeline-cache` option in DEVICE_FILE and uses it to create the pipelines instead of the pipeline caches saved at capture time. (forwarded to replay tool)')
     parser.add_argument('--add-new-pipeline-caches', action='store_true', default=False, help='If set, allows gfxreconstruct to create new vkPipelineCache objects when it encounters a pipeline created without cache. This option can be used in coordination with `--save-pipeline-cache` and `--load-pipeline-cache`. (forwarded to replay tool)')
+    parser.add_argument('--cpu-profile-trace', metavar='DEVICE_FILE', help='Record CPU timings for the read, decompress, and decode/dispatch stages of every replayed block and write them to DEVICE_FILE in the Chrome trace event format. (forwarded to replay tool)')
+    parser.add_argument('--cpu-profile-histograms', metavar='DEVICE_FILE', help='Write per stage and API call ID CPU duration statistics and histograms to DEVICE_FILE in JSON format. (forwarded to replay tool)')
+    parser.add_argument('--memory-report', metavar='DEVICE_FILE', help='Write the overall and per frame peaks of the host memory held by each replay subsystem to DEVICE_FILE in JSON format. (forwarded to replay tool)')
+    parser.add_argument('--memory-soft-limit', metavar='MIB', help='Release reusable decode and file read buffers at the end of any frame where they hold more than MIB. They are not released again until a frame ends with them at or below 3/4 of MIB. (forwarded to replay tool)')
     parser.add_argument('--quit-after-frame', metavar='FRAME', help='Specify a frame after which replay will terminate.')
     return parser
 
@@ -205,6 +213,14 @@ def MakeExtrasString(args):
         arg_list.append('--measurement-file')
         arg_list.append('{}'.format(args.measurement_file))
 
+    if args.frame_time_file:
+        arg_list.append('--frame-time-file')
+        arg_list.append('{}'.format(args.frame_time_file))
+
+    if args.loop_measurement_range:
+        arg_list.append('--loop-measurement-range')
+        arg_list.append('{}'.format(args.loop_measurement_range))
+
     if args.quit_after_measurement_range:
         arg_list.append('--quit-after-measurement-range')
 
@@ -283,6 +299,12 @@ def MakeExtrasString(args):
     if args.dump_resources_dump_separate_alpha:
         arg_list.append('--dump-resources-dump-separate-alpha')
 
+    if args.dump_resources_archive:
+        arg_list.append('--dump-resources-archive')
+
+    if args.dump_resources_skip_unchanged:
+        arg_list.append('--dump-resources-skip-unchanged')
+
     if args.pbi_all:
         arg_list.append('--pbi-all')
 
@@ -305,6 +327,22 @@ def MakeExtrasString(args):
     if args.add_new_pipeline_caches:
         arg_list.append('--add-new-pipeline-caches')
 
+    if args.cpu_profile_trace:
+        arg_list.append('--cpu-profile-trace')
+        arg_list.append('{}'.format(args.cpu_profile_trace))
+
+    if args.cpu_profile_histograms:
+        arg_list.append('--cpu-profile-histograms')
+        arg_list.append('{}'.format(args.cpu_profile_histograms))
+
+    if args.memory_report:
+        arg_list.append('--memory-report')
+        arg_list.append('{}'.format(args.memory_report))
+
+    if args.memory_soft_limit:
+        arg_list.append('--memory-soft-limit')
+        arg_list.append('{}'.format(args.memory_soft_limit))
+
     if args.quit_after_frame:
         arg_list.append('--quit-after-frame')
         arg_list.append('{}'.format(args.quit_after_frame))
@@ -23,6 +23,8 @@
 
 #include "decode/decode_allocator.h"
 
+#include "decode/replay_memory_tracker.h"
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -43,7 +45,19 @@ void DecodeAllocator::End()
     assert((instance_ != nullptr) && instance_->can_allocate_);
     if (instance_->end_can_clear_)
     {
-        instance_->allocator_.Clear(false);
+        // Report usage before and after the clear, which releases the oversized allocations made since Begin.
+        if (ReplayMemoryTracker::IsEnabled())
+        {
+            ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena,
+                                          instance_->allocator_.GetSystemMemorySize());
+            instance_->allocator_.Clear(false);
+            ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena,
+                                          instance_->allocator_.GetSystemMemorySize());
+        }
+        else
+        {
+            instance_->allocator_.Clear(false);
+        }
     }
     instance_->can_allocate_ = false;
 }
@@ -58,10 +72,21 @@ void DecodeAllocator::TurnOffEndCanClear()
     instance_->end_can_clear_ = false;
 }
 
+bool DecodeAllocator::GetEndCanClear()
+{
+    return (instance_ == nullptr) || instance_->end_can_clear_;
+}
+
 void DecodeAllocator::FreeSystemMemory()
 {
     assert((instance_ != nullptr) && !instance_->can_allocate_);
     instance_->allocator_.Clear(true);
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, instance_->allocator_.GetSystemMemorySize());
+}
+
+size_t DecodeAllocator::GetSystemMemorySize()
+{
+    return (instance_ != nullptr) ? instance_->allocator_.GetSystemMemorySize() : 0;
 }
 
 void DecodeAllocator::DestroyInstance()
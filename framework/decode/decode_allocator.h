@@ -52,9 +52,16 @@ class DecodeAllocator
 
     static void TurnOffEndCanClear();
 
-    // Free system memory blocks. Must not be called between Begin and End
+    // Returns false while End is not allowed to clear allocations, because they still hold data for deferred
+    // operations.
+    static bool GetEndCanClear();
+
+    // Free system memory blocks. Must not be called between Begin and End, or while GetEndCanClear returns false.
     static void FreeSystemMemory();
 
+    // Returns the number of bytes of system memory currently held by the allocator.
+    static size_t GetSystemMemorySize();
+
     // Destroy the allocator instance. This will also frees all allocated memory.
     static void DestroyInstance();
 
@@ -25,15 +25,19 @@
 #include "decode/file_processor.h"
 
 #include "decode/decode_allocator.h"
+#include "decode/replay_memory_tracker.h"
 #include "format/format.h"
 #include "format/format_util.h"
+#include "generated/generated_api_call_id_to_string.h"
 #include "util/compressor.h"
 #include "util/file_path.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -44,6 +48,9 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 // TODO GH #1195: frame numbering should be 1-based.
 const uint32_t kFirstFrame = 0;
 
+// Size of the reads performed by ScanBlocks.  Payloads that extend past the data read are skipped with a seek.
+const size_t kScanBufferSize = 4 * 1024 * 1024;
+
 FileProcessor::FileProcessor() :
     current_frame_number_(kFirstFrame), error_state_(kErrorInvalidFileDescriptor), bytes_read_(0),
     annotation_handler_(nullptr), compressor_(nullptr), block_index_(0), api_call_index_(0), block_limit_(0),
@@ -141,7 +148,27 @@ bool FileProcessor::ProcessNextFrame()
 
     if (success)
     {
+        if (call_profiler_ != nullptr)
+        {
+            call_profiler_->SetCurrentFrame(current_frame_number_);
+        }
+
+        // All frames share one statistics entry; trace events record the frame number separately.
+        util::ScopedCallTimer frame_timer(call_profiler_, kProfilerStageFrame, 0);
+
+        const uint64_t frame_number = current_frame_number_;
+
         success = ProcessBlocks();
+
+        if (ReplayMemoryTracker::IsEnabled())
+        {
+            ReportFileBufferUsage();
+
+            if (ReplayMemoryTracker::EndFrame(frame_number))
+            {
+                ReleaseReusableMemory();
+            }
+        }
     }
     else
     {
@@ -176,6 +203,179 @@ bool FileProcessor::ProcessAllFrames()
     return (error_state_ == kErrorNone);
 }
 
+bool FileProcessor::ScanBlocks(BlockScanResult* result)
+{
+    assert(result != nullptr);
+
+    *result = BlockScanResult{};
+
+    if (file_stack_.empty() || (error_state_ != kErrorNone))
+    {
+        return false;
+    }
+
+    auto file_entry = active_files_.find(file_stack_.back().filename);
+    assert(file_entry != active_files_.end());
+
+    FILE* fd = file_entry->second.fd;
+
+    // The file size bounds the reads, and identifies an incomplete block at the end of the file.
+    const int64_t first_block_offset = util::platform::FileTell(fd);
+    int64_t       file_end           = -1;
+    bool          success            = (first_block_offset >= 0);
+
+    if (success && util::platform::FileSeek(fd, 0, util::platform::FileSeekEnd))
+    {
+        file_end = util::platform::FileTell(fd);
+    }
+
+    success = success && (file_end >= first_block_offset) &&
+              util::platform::FileSeek(fd, first_block_offset, util::platform::FileSeekSet);
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingFile, "Failed to determine the size of the capture file");
+        return false;
+    }
+
+    const uint64_t file_size         = static_cast<uint64_t>(file_end);
+    const size_t   block_prefix_size = sizeof(format::BlockHeader) + sizeof(uint32_t);
+
+    // Both kinds of frame delimiters are recorded, as the kind that is used is only known once the whole file has been
+    // scanned.
+    std::vector<uint64_t> marker_offsets;
+    std::vector<uint64_t> present_offsets;
+    std::vector<uint8_t>  buffer(kScanBufferSize);
+
+    // The buffer holds the file data from offset to read_offset, at positions buffer_start to buffer_end.
+    size_t   buffer_start = 0;
+    size_t   buffer_end   = 0;
+    uint64_t offset       = static_cast<uint64_t>(first_block_offset);
+    uint64_t read_offset  = offset;
+
+    result->first_block_offset = offset;
+
+    while (offset < file_size)
+    {
+        // Refill the buffer when it does not hold the header and ID of the next block.
+        if (((buffer_end - buffer_start) < block_prefix_size) && (read_offset < file_size))
+        {
+            const size_t remaining = buffer_end - buffer_start;
+            std::memmove(buffer.data(), buffer.data() + buffer_start, remaining);
+
+            const size_t read_size =
+                static_cast<size_t>(std::min<uint64_t>(buffer.size() - remaining, file_size - read_offset));
+
+            if (!util::platform::FileRead(buffer.data() + remaining, read_size, fd))
+            {
+                success = false;
+                break;
+            }
+
+            buffer_start = 0;
+            buffer_end   = remaining + read_size;
+            read_offset += read_size;
+        }
+
+        const size_t        available = buffer_end - buffer_start;
+        format::BlockHeader block_header{};
+
+        if (available >= sizeof(block_header))
+        {
+            util::platform::MemoryCopy(
+                &block_header, sizeof(block_header), buffer.data() + buffer_start, sizeof(block_header));
+        }
+
+        const uint64_t block_size = sizeof(block_header) + block_header.size;
+        const uint64_t block_end  = offset + block_size;
+
+        if ((available < sizeof(block_header)) || (block_end > file_size))
+        {
+            GFXRECON_LOG_WARNING("Incomplete block at end of file");
+            break;
+        }
+
+        BlockScanCount& type_count = result->block_types[block_header.type];
+        ++type_count.count;
+        type_count.bytes += block_size;
+        ++result->block_count;
+
+        if (block_header.size >= sizeof(uint32_t))
+        {
+            // The call ID, meta-data ID, or marker type is the first field of the block.  The buffer holds the entire
+            // block prefix here, as it is only short of it when the remainder of the file has been read.
+            const format::BlockType block_type = format::RemoveCompressedBlockBit(block_header.type);
+            uint32_t                block_id   = 0;
+
+            util::platform::MemoryCopy(
+                &block_id, sizeof(block_id), buffer.data() + buffer_start + sizeof(block_header), sizeof(block_id));
+
+            if ((block_type == format::BlockType::kFunctionCallBlock) ||
+                (block_type == format::BlockType::kMethodCallBlock))
+            {
+                BlockScanCount& call_count = result->api_calls[block_id];
+                ++call_count.count;
+                call_count.bytes += block_size;
+
+                if (IsFrameEndCall(static_cast<format::ApiCallId>(block_id)))
+                {
+                    present_offsets.push_back(block_end);
+                }
+            }
+            else if (block_type == format::BlockType::kMetaDataBlock)
+            {
+                BlockScanCount& meta_data_count = result->meta_data[block_id];
+                ++meta_data_count.count;
+                meta_data_count.bytes += block_size;
+            }
+            else if ((block_type == format::BlockType::kFrameMarkerBlock) &&
+                     IsFrameDelimiter(block_type, static_cast<format::MarkerType>(block_id)))
+            {
+                marker_offsets.push_back(block_end);
+            }
+            else if ((block_type == format::BlockType::kStateMarkerBlock) &&
+                     (block_id == format::MarkerType::kEndMarker))
+            {
+                result->state_end_offset = block_end;
+            }
+        }
+
+        offset = block_end;
+
+        if (block_size <= available)
+        {
+            buffer_start += static_cast<size_t>(block_size);
+        }
+        else
+        {
+            // Skip the remainder of the payload without reading it.
+            buffer_start = 0;
+            buffer_end   = 0;
+            read_offset  = block_end;
+
+            if (!util::platform::FileSeek(fd, static_cast<int64_t>(block_end), util::platform::FileSeekSet))
+            {
+                success = false;
+                break;
+            }
+        }
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read block header");
+        return false;
+    }
+
+    // A capture file with frame markers has a frame marker for every frame ending call.
+    result->uses_frame_markers = !marker_offsets.empty();
+    result->frame_end_offsets  = result->uses_frame_markers ? std::move(marker_offsets) : std::move(present_offsets);
+    result->blocks_end_offset  = offset;
+    result->file_size          = file_size;
+
+    return true;
+}
+
 bool FileProcessor::ContinueDecoding()
 {
     bool early_exit = false;
@@ -493,10 +693,9 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
 bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
 {
-    if (buffer_size > parameter_buffer_.size())
-    {
-        parameter_buffer_.resize(buffer_size);
-    }
+    util::ScopedCallTimer read_timer(call_profiler_, kProfilerStageRead, profiler_block_id_);
+
+    ResizeBlockBuffer(&parameter_buffer_, &parameter_buffer_usage_, buffer_size);
 
     return ReadBytes(parameter_buffer_.data(), buffer_size);
 }
@@ -508,20 +707,23 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
     // This should only be null if initialization failed.
     assert(compressor_ != nullptr);
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    ResizeBlockBuffer(&compressed_parameter_buffer_, &compressed_parameter_buffer_usage_, compressed_buffer_size);
+
+    bool read_success = false;
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        util::ScopedCallTimer read_timer(call_profiler_, kProfilerStageRead, profiler_block_id_);
+        read_success = ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size);
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    if (read_success)
     {
-        if (parameter_buffer_.size() < expected_uncompressed_size)
-        {
-            parameter_buffer_.resize(expected_uncompressed_size);
-        }
+        util::ScopedCallTimer decompress_timer(call_profiler_, kProfilerStageDecompress, profiler_block_id_);
+
+        ResizeBlockBuffer(&parameter_buffer_, &parameter_buffer_usage_, expected_uncompressed_size);
 
         size_t uncompressed_size = compressor_->Decompress(
             compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
             *uncompressed_buffer_size = uncompressed_size;
@@ -636,6 +838,8 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
     ApiCallInfo call_info{ block_index_ };
     bool        success = ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
+    profiler_block_id_ = call_id;
+
     if (success)
     {
         parameter_buffer_size -= sizeof(call_info.thread_id);
@@ -682,6 +886,8 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            util::ScopedCallTimer decode_timer(call_profiler_, kProfilerStageDecode, call_id);
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -722,6 +928,8 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
     bool success = ReadBytes(&object_id, sizeof(object_id));
     success      = success && ReadBytes(&call_info.thread_id, sizeof(call_info.thread_id));
 
+    profiler_block_id_ = call_id;
+
     if (success)
     {
         parameter_buffer_size -= (sizeof(object_id) + sizeof(call_info.thread_id));
@@ -768,6 +976,8 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
 
         if (success)
         {
+            util::ScopedCallTimer decode_timer(call_profiler_, kProfilerStageDecode, call_id);
+
             for (auto decoder : decoders_)
             {
                 if (decoder->SupportsApiCall(call_id))
@@ -803,9 +1013,23 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 {
     bool success = false;
 
+    profiler_block_id_ = meta_data_id;
+    util::ScopedCallTimer meta_data_timer(call_profiler_, kProfilerStageMetaData, meta_data_id);
+
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
 
-    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    if (IsResourceDataCommand(meta_data_type) && !IsMetaDataSupported(meta_data_id))
+    {
+        // No decoder uses the resource data, so the payload is skipped without being read or decompressed.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_data_id));
+
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip resource data meta-data block");
+        }
+    }
+    else if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
 
@@ -2083,6 +2307,10 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             HandleBlockReadError(kErrorReadingBlockData, "Failed to read runtime info meta-data block");
         }
     }
+    else if (meta_data_type == format::MetaDataType::kDataReferenceCommand)
+    {
+        success = ProcessDataReference(block_header);
+    }
     else
     {
         if ((meta_data_type == format::MetaDataType::kReserved23) ||
@@ -2251,11 +2479,304 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
     return success;
 }
 
+bool FileProcessor::ProcessDataReference(const format::BlockHeader& block_header)
+{
+    format::DataReferenceCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.command_id, sizeof(header.command_id));
+    success      = success && ReadBytes(&header.data_offset, sizeof(header.data_offset));
+    success      = success && ReadBytes(&header.stored_size, sizeof(header.stored_size));
+    success      = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+    success      = success && ReadBytes(&header.compressed, sizeof(header.compressed));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read data reference meta-data block header");
+        return false;
+    }
+
+    format::MetaDataType command_type = format::GetMetaDataType(header.command_id);
+    const uint8_t*       data         = nullptr;
+
+    if (!IsMetaDataSupported(header.command_id))
+    {
+        // No decoder uses the resource data, so the referenced data is not read.
+        uint64_t unread_bytes = block_header.size - (sizeof(header) - sizeof(header.meta_header.block_header));
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, unread_bytes);
+        success = SkipBytes(static_cast<size_t>(unread_bytes));
+    }
+    else if (command_type == format::MetaDataType::kFillMemoryCommand)
+    {
+        format::FillMemoryCommandHeader command;
+
+        success = ReadBytes(&command.memory_id, sizeof(command.memory_id));
+        success = success && ReadBytes(&command.memory_offset, sizeof(command.memory_offset));
+        success = success && ReadBytes(&command.memory_size, sizeof(command.memory_size));
+        success = success && ReadReferencedData(header, &data);
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                if (decoder->SupportsMetaDataId(header.command_id))
+                {
+                    decoder->DispatchFillMemoryCommand(
+                        header.thread_id, command.memory_id, command.memory_offset, command.memory_size, data);
+                }
+            }
+        }
+    }
+    else if (command_type == format::MetaDataType::kInitBufferCommand)
+    {
+        format::InitBufferCommandHeader command;
+
+        success = ReadBytes(&command.device_id, sizeof(command.device_id));
+        success = success && ReadBytes(&command.buffer_id, sizeof(command.buffer_id));
+        success = success && ReadBytes(&command.data_size, sizeof(command.data_size));
+        success = success && ReadReferencedData(header, &data);
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                if (decoder->SupportsMetaDataId(header.command_id))
+                {
+                    decoder->DispatchInitBufferCommand(
+                        header.thread_id, command.device_id, command.buffer_id, command.data_size, data);
+                }
+            }
+        }
+    }
+    else if (command_type == format::MetaDataType::kInitImageCommand)
+    {
+        format::InitImageCommandHeader command;
+        std::vector<uint64_t>          level_sizes;
+
+        success = ReadBytes(&command.device_id, sizeof(command.device_id));
+        success = success && ReadBytes(&command.image_id, sizeof(command.image_id));
+        success = success && ReadBytes(&command.data_size, sizeof(command.data_size));
+        success = success && ReadBytes(&command.aspect, sizeof(command.aspect));
+        success = success && ReadBytes(&command.layout, sizeof(command.layout));
+        success = success && ReadBytes(&command.level_count, sizeof(command.level_count));
+
+        if (success && (command.level_count > 0))
+        {
+            level_sizes.resize(command.level_count);
+            success = ReadBytes(level_sizes.data(), command.level_count * sizeof(level_sizes[0]));
+        }
+
+        success = success && ReadReferencedData(header, &data);
+
+        if (success)
+        {
+            for (auto decoder : decoders_)
+            {
+                if (decoder->SupportsMetaDataId(header.command_id))
+                {
+                    decoder->DispatchInitImageCommand(header.thread_id,
+                                                      command.device_id,
+                                                      command.image_id,
+                                                      command.data_size,
+                                                      command.aspect,
+                                                      command.layout,
+                                                      level_sizes,
+                                                      data);
+                }
+            }
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Skipping data reference to unsupported meta-data command type %u",
+                             static_cast<uint32_t>(command_type));
+
+        uint64_t unread_bytes = block_header.size - (sizeof(header) - sizeof(header.meta_header.block_header));
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, unread_bytes);
+        success = SkipBytes(static_cast<size_t>(unread_bytes));
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read data reference meta-data block");
+    }
+
+    return success;
+}
+
+bool FileProcessor::ReadReferencedData(const format::DataReferenceCommandHeader& header, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    // References to the same data tend to repeat, so recently referenced data is kept in memory and handed to the
+    // decoders in place.  The first copy of the data is not retained while it is decoded, so the first reference to it
+    // still has to read it back from the file.
+    auto cache_entry = referenced_data_cache_.find(header.data_offset);
+    if (cache_entry != referenced_data_cache_.end())
+    {
+        *data = cache_entry->second.data();
+        return true;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.data_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.stored_size);
+
+    size_t data_size   = static_cast<size_t>(header.data_size);
+    size_t stored_size = static_cast<size_t>(header.stored_size);
+
+    std::vector<uint8_t>* destination = &parameter_buffer_;
+    if (data_size <= kReferencedDataCacheSize)
+    {
+        if ((referenced_data_cache_size_ + data_size) > kReferencedDataCacheSize)
+        {
+            referenced_data_cache_.clear();
+            referenced_data_cache_size_ = 0;
+        }
+
+        destination = &referenced_data_cache_[header.data_offset];
+        referenced_data_cache_size_ += data_size;
+    }
+
+    if (destination == &parameter_buffer_)
+    {
+        ResizeBlockBuffer(&parameter_buffer_, &parameter_buffer_usage_, data_size);
+    }
+    else if (destination->size() < data_size)
+    {
+        destination->resize(data_size);
+        ReportFileBufferUsage();
+    }
+
+    // The referenced data is read directly from the file, restoring the current position afterwards, so that the
+    // read does not count as processed blocks.
+    FILE*   fd       = GetFileDescriptor();
+    int64_t position = util::platform::FileTell(fd);
+    bool    success  = util::platform::FileSeek(fd, header.data_offset, util::platform::FileSeekSet);
+
+    if (success)
+    {
+        if (header.compressed != 0)
+        {
+            ResizeBlockBuffer(&compressed_parameter_buffer_, &compressed_parameter_buffer_usage_, stored_size);
+
+            success = (compressor_ != nullptr) &&
+                      util::platform::FileRead(compressed_parameter_buffer_.data(), stored_size, fd) &&
+                      (compressor_->Decompress(stored_size, compressed_parameter_buffer_, data_size, destination) ==
+                       data_size);
+        }
+        else
+        {
+            success = util::platform::FileRead(destination->data(), data_size, fd);
+        }
+    }
+
+    success = util::platform::FileSeek(fd, position, util::platform::FileSeekSet) && success;
+
+    if (success)
+    {
+        *data = destination->data();
+    }
+    else if (destination != &parameter_buffer_)
+    {
+        referenced_data_cache_.erase(header.data_offset);
+        referenced_data_cache_size_ -= data_size;
+    }
+
+    return success;
+}
+
+void FileProcessor::ResizeBlockBuffer(std::vector<uint8_t>* buffer, BlockBufferUsage* usage, size_t size)
+{
+    assert((buffer != nullptr) && (usage != nullptr));
+
+    // The data from the previous request is no longer in use, so an oversized buffer can be replaced when the requests
+    // made over the last interval needed much less memory than the buffer holds.
+    if (++usage->request_count > kBlockBufferReleaseInterval)
+    {
+        const size_t retained_size = std::max(usage->max_request_size, size);
+
+        if ((buffer->capacity() > kRetainedBlockBufferSize) && (buffer->capacity() > (retained_size * 2)))
+        {
+            std::vector<uint8_t>(retained_size).swap(*buffer);
+            ReportFileBufferUsage();
+        }
+
+        usage->request_count    = 0;
+        usage->max_request_size = 0;
+    }
+
+    usage->max_request_size = std::max(usage->max_request_size, size);
+
+    if (buffer->size() < size)
+    {
+        buffer->resize(size);
+        ReportFileBufferUsage();
+    }
+}
+
+size_t FileProcessor::GetFileBufferSize() const
+{
+    return parameter_buffer_.capacity() + compressed_parameter_buffer_.capacity() + referenced_data_cache_size_;
+}
+
+void FileProcessor::ReportFileBufferUsage() const
+{
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kFileBuffers, GetFileBufferSize());
+}
+
+void FileProcessor::ReleaseReusableMemory()
+{
+    const size_t decode_arena_size = DecodeAllocator::GetSystemMemorySize();
+    const size_t file_buffer_size  = GetFileBufferSize();
+
+    // Called between blocks, where no decoded data or referenced data pointers are in use. The buffers grow back to
+    // the size required by the blocks that are processed next. Decode allocator blocks that still hold data for
+    // deferred operations are kept.
+    if ((decode_arena_size > 0) && DecodeAllocator::GetEndCanClear())
+    {
+        DecodeAllocator::FreeSystemMemory();
+    }
+
+    std::vector<uint8_t>().swap(parameter_buffer_);
+    std::vector<uint8_t>().swap(compressed_parameter_buffer_);
+    parameter_buffer_usage_            = {};
+    compressed_parameter_buffer_usage_ = {};
+    referenced_data_cache_.clear();
+    referenced_data_cache_size_ = 0;
+
+    ReportFileBufferUsage();
+
+    ReplayMemoryTracker::RecordTrim((decode_arena_size - DecodeAllocator::GetSystemMemorySize()) +
+                                    (file_buffer_size - GetFileBufferSize()));
+}
+
 bool FileProcessor::IsFrameDelimiter(format::BlockType block_type, format::MarkerType marker_type) const
 {
     return ((block_type == format::BlockType::kFrameMarkerBlock) && (marker_type == format::MarkerType::kEndMarker));
 }
 
+bool FileProcessor::IsResourceDataCommand(format::MetaDataType meta_data_type)
+{
+    return ((meta_data_type == format::MetaDataType::kFillMemoryCommand) ||
+            (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand) ||
+            (meta_data_type == format::MetaDataType::kInitBufferCommand) ||
+            (meta_data_type == format::MetaDataType::kInitImageCommand) ||
+            (meta_data_type == format::MetaDataType::kInitSubresourceCommand));
+}
+
+bool FileProcessor::IsMetaDataSupported(format::MetaDataId meta_data_id) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataId(meta_data_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
 {
     if (capture_uses_frame_markers_)
@@ -2264,15 +2785,20 @@ bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
     }
     else
     {
-        // This code is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
-        // the file processor's frame count.
-        return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
-                (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+        return IsFrameEndCall(call_id);
     }
 }
 
+bool FileProcessor::IsFrameEndCall(format::ApiCallId call_id)
+{
+    // This code is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
+    // the file processor's frame count.
+    return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
+            (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+}
+
 void FileProcessor::PrintBlockInfo() const
 {
     if (enable_print_block_info_ && ((block_index_from_ < 0 || block_index_to_ < 0) ||
@@ -2283,5 +2809,45 @@ void FileProcessor::PrintBlockInfo() const
     }
 }
 
+std::vector<std::string> FileProcessor::GetProfilerStageNames()
+{
+    return { "frame", "read", "decompress", "decode", "meta_data" };
+}
+
+std::string FileProcessor::GetProfilerEventName(uint16_t stage, uint32_t id)
+{
+    char name[64];
+
+    if (stage == kProfilerStageFrame)
+    {
+        snprintf(name, sizeof(name), "Frame");
+    }
+    else if (stage == kProfilerStageMetaData)
+    {
+        snprintf(name, sizeof(name), "MetaDataType_%u", static_cast<uint32_t>(format::GetMetaDataType(id)));
+    }
+    else
+    {
+        // Read and decompress stages are shared by API calls and meta-data commands, which are distinguished by API
+        // call IDs starting at 0x1000 within their API family.
+        if ((stage != kProfilerStageDecode) && ((id & 0x0000ffff) < 0x1000))
+        {
+            snprintf(name, sizeof(name), "MetaDataType_%u", static_cast<uint32_t>(format::GetMetaDataType(id)));
+        }
+        else
+        {
+            const char* call_name = util::GetApiCallIdString(static_cast<format::ApiCallId>(id));
+            if (call_name != nullptr)
+            {
+                return call_name;
+            }
+
+            snprintf(name, sizeof(name), "ApiCall_0x%08x", id);
+        }
+    }
+
+    return name;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -28,6 +28,7 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "util/call_profiler.h"
 #include "util/compressor.h"
 #include "util/defines.h"
 
@@ -68,6 +69,47 @@ class FileProcessor
         kBreak   = 2,
     };
 
+    // Processing stages timed by the optional CPU call profiler.
+    enum ProfilerStage : uint16_t
+    {
+        kProfilerStageFrame      = 0, // Processing of all blocks for a frame; id is always 0.
+        kProfilerStageRead       = 1, // Reading block payload from file; id is the call or meta-data ID.
+        kProfilerStageDecompress = 2, // Decompressing block payload; id is the call or meta-data ID.
+        kProfilerStageDecode     = 3, // Decoding and dispatching an API call to the consumers; id is the call ID.
+        kProfilerStageMetaData   = 4, // Reading and dispatching a meta-data command; id is the meta-data ID.
+        kProfilerStageCount
+    };
+
+    // Number of blocks of one kind found by ScanBlocks, and their total size including the block headers.
+    struct BlockScanCount
+    {
+        uint64_t count{ 0 };
+        uint64_t bytes{ 0 };
+    };
+
+    struct BlockScanResult
+    {
+        // Block counts by format::BlockType, including the compressed bit.
+        std::unordered_map<uint32_t, BlockScanCount> block_types;
+
+        // Function and method call counts by format::ApiCallId.
+        std::unordered_map<uint32_t, BlockScanCount> api_calls;
+
+        // Meta-data command counts by format::MetaDataId.
+        std::unordered_map<uint32_t, BlockScanCount> meta_data;
+
+        // File offsets that follow the last block of each frame, and the state end marker (0 without trimmed state).
+        // The blocks end offset follows the last complete block, and is less than the file size when the file ends
+        // with an incomplete block.
+        std::vector<uint64_t> frame_end_offsets;
+        uint64_t              state_end_offset{ 0 };
+        uint64_t              first_block_offset{ 0 };
+        uint64_t              blocks_end_offset{ 0 };
+        uint64_t              file_size{ 0 };
+        uint64_t              block_count{ 0 };
+        bool                  uses_frame_markers{ false };
+    };
+
   public:
     FileProcessor();
 
@@ -95,6 +137,13 @@ class FileProcessor
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
     bool ProcessAllFrames();
 
+    // Collects block statistics and frame boundaries for the file opened by Initialize, without decoding.  Only the
+    // block headers and the call, meta-data, or marker ID that starts each block are read, through large sequential
+    // reads, and large payloads are skipped with seeks.  Frames are delimited as counted by ProcessNextFrame, but
+    // blocks referenced by kExecuteBlocksFromFile commands are not scanned.  Must be called instead of the frame
+    // processing functions.  Returns false if scanning failed; use GetErrorState() to determine the error condition.
+    bool ScanBlocks(BlockScanResult* result);
+
     const std::vector<format::FileOptionPair>& GetFileOptions() const { return file_options_; }
 
     uint64_t GetCurrentFrameNumber() const { return current_frame_number_; }
@@ -129,6 +178,17 @@ class FileProcessor
         block_index_to_          = block_index_to;
     }
 
+    // Enables CPU timing of the processing stages listed by ProfilerStage. The profiler must outlive the processor.
+    void SetCallProfiler(util::CallProfiler* profiler) { call_profiler_ = profiler; }
+
+    static std::vector<std::string> GetProfilerStageNames();
+
+    static std::string GetProfilerEventName(uint16_t stage, uint32_t id);
+
+    // Returns true for meta-data commands that only carry resource or memory content, whose payload can be skipped
+    // when no decoder supports the command.
+    static bool IsResourceDataCommand(format::MetaDataType meta_data_type);
+
   protected:
     bool ContinueDecoding();
 
@@ -144,10 +204,22 @@ class FileProcessor
 
     bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    bool ProcessDataReference(const format::BlockHeader& block_header);
+
+    // Resolves the data of an earlier block referenced by a kDataReferenceCommand block.  Data that is still in the
+    // referenced data cache is returned without being copied.  Otherwise it is read from the file once, directly into
+    // its cache entry, or into the parameter buffer when it is larger than the cache.
+    bool ReadReferencedData(const format::DataReferenceCommandHeader& header, const uint8_t** data);
+
     bool IsFrameDelimiter(format::BlockType block_type, format::MarkerType marker_type) const;
 
     bool IsFrameDelimiter(format::ApiCallId call_id) const;
 
+    // Returns true for the API calls that end a frame in captures written without frame end markers.
+    static bool IsFrameEndCall(format::ApiCallId call_id);
+
+    bool IsMetaDataSupported(format::MetaDataId meta_data_id) const;
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     bool
@@ -159,6 +231,29 @@ class FileProcessor
 
     void PrintBlockInfo() const;
 
+    util::Compressor* GetCompressor() const { return compressor_; }
+
+    // Sizes of the block data requested from a reusable buffer over the current release interval.
+    struct BlockBufferUsage
+    {
+        size_t   max_request_size{ 0 };
+        uint32_t request_count{ 0 };
+    };
+
+    // Grows a reusable block data buffer to hold at least size bytes. Buffers larger than kRetainedBlockBufferSize
+    // shrink to the largest size requested over the last kBlockBufferReleaseInterval requests, so that a single large
+    // block does not pin its memory for the rest of replay, while a run of large blocks, such as the resource
+    // initialization commands of a trimmed capture's state snapshot, reuses the buffer.
+    void ResizeBlockBuffer(std::vector<uint8_t>* buffer, BlockBufferUsage* usage, size_t size);
+
+    // Returns the number of bytes held by the block read, decompression, and referenced data buffers.
+    size_t GetFileBufferSize() const;
+
+    void ReportFileBufferUsage() const;
+
+    // Releases the decode allocator blocks and the file buffers when the replay memory soft limit is exceeded.
+    void ReleaseReusableMemory();
+
   protected:
     uint64_t                 current_frame_number_;
     std::vector<ApiDecoder*> decoders_;
@@ -169,6 +264,9 @@ class FileProcessor
     /// @brief Incremented at the end of every block successfully processed.
     uint64_t block_index_;
 
+    util::CallProfiler* call_profiler_{ nullptr };
+    uint32_t            profiler_block_id_{ 0 };
+
   protected:
     FILE* GetFileDescriptor()
     {
@@ -235,6 +333,8 @@ class FileProcessor
     format::EnabledOptions              enabled_options_;
     std::vector<uint8_t>                parameter_buffer_;
     std::vector<uint8_t>                compressed_parameter_buffer_;
+    BlockBufferUsage                    parameter_buffer_usage_;
+    BlockBufferUsage                    compressed_parameter_buffer_usage_;
     util::Compressor*                   compressor_;
     uint64_t                            api_call_index_;
     uint64_t                            block_limit_;
@@ -245,6 +345,15 @@ class FileProcessor
     int64_t                             block_index_to_{ 0 };
     bool                                loading_trimmed_capture_state_;
 
+    // Block data buffer release policy; see ResizeBlockBuffer.
+    static constexpr size_t   kRetainedBlockBufferSize    = 64 * 1024 * 1024;
+    static constexpr uint32_t kBlockBufferReleaseInterval = 128;
+
+    // Data resolved for kDataReferenceCommand blocks, keyed by file offset.
+    static constexpr size_t                           kReferencedDataCacheSize = 64 * 1024 * 1024;
+    std::unordered_map<int64_t, std::vector<uint8_t>> referenced_data_cache_;
+    size_t                                            referenced_data_cache_size_{ 0 };
+
     struct ActiveFiles
     {
         ActiveFiles() {}
@@ -33,11 +33,13 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 FileTransformer::FileTransformer() :
     input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
-    error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
+    error_state_(kErrorInvalidFileDescriptor), loading_state_(false), writer_(1)
 {}
 
 FileTransformer::~FileTransformer()
 {
+    FlushOutput();
+
     if (input_file_ != nullptr)
     {
         fclose(input_file_);
@@ -47,6 +49,11 @@ FileTransformer::~FileTransformer()
     {
         fclose(output_file_);
     }
+
+    if (output_read_file_ != nullptr)
+    {
+        fclose(output_read_file_);
+    }
 }
 
 bool FileTransformer::Initialize(const std::string& input_filename,
@@ -147,6 +154,11 @@ bool FileTransformer::Process()
         block_index_++;
     }
 
+    if (!FlushOutput() && (error_state_ == kErrorNone))
+    {
+        HandleBlockWriteError(kErrorWritingFile, "Failed to write output file");
+    }
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
@@ -401,12 +413,79 @@ bool FileTransformer::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileTransformer::WriteBytes(const void* buffer, size_t buffer_size)
 {
-    if (util::platform::FileWrite(buffer, buffer_size, output_file_))
+    if (write_failed_ || (output_file_ == nullptr))
     {
-        bytes_written_ += buffer_size;
-        return true;
+        return false;
     }
-    return false;
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(buffer);
+    write_buffer_.insert(write_buffer_.end(), bytes, bytes + buffer_size);
+    bytes_written_ += buffer_size;
+
+    if (write_buffer_.size() >= kWriteBufferSize)
+    {
+        return FlushWriteBuffer();
+    }
+
+    return true;
+}
+
+bool FileTransformer::FlushWriteBuffer()
+{
+    if (output_file_ == nullptr)
+    {
+        write_buffer_.clear();
+    }
+    else if (!write_buffer_.empty())
+    {
+        // Limit the amount of output that is waiting to be written when the output file is slower than the input.
+        if (!WaitForPendingWrites(kMaxPendingWriteBuffers - 1))
+        {
+            return false;
+        }
+
+        auto  data = std::make_shared<std::vector<uint8_t>>(std::move(write_buffer_));
+        FILE* file = output_file_;
+
+        pending_writes_.emplace_back(
+            writer_.post([data, file]() { return util::platform::FileWrite(data->data(), data->size(), file); }));
+
+        write_buffer_ = std::vector<uint8_t>();
+        write_buffer_.reserve(kWriteBufferSize);
+    }
+
+    return true;
+}
+
+bool FileTransformer::WaitForPendingWrites(size_t max_pending_writes)
+{
+    while (pending_writes_.size() > max_pending_writes)
+    {
+        if (!pending_writes_.front().get())
+        {
+            write_failed_ = true;
+        }
+
+        pending_writes_.pop_front();
+    }
+
+    if (write_failed_)
+    {
+        // Drain the remaining writes, so that the file error state can be safely queried.
+        while (!pending_writes_.empty())
+        {
+            pending_writes_.front().wait();
+            pending_writes_.pop_front();
+        }
+    }
+
+    return !write_failed_;
+}
+
+bool FileTransformer::FlushOutput()
+{
+    bool success = FlushWriteBuffer();
+    return WaitForPendingWrites(0) && success;
 }
 
 bool FileTransformer::SkipBytes(uint64_t skip_size)
@@ -436,6 +515,120 @@ bool FileTransformer::CopyBytes(uint64_t copy_size)
     return false;
 }
 
+bool FileTransformer::ReadOutputBytes(uint64_t offset, void* buffer, size_t buffer_size)
+{
+    if ((output_file_ == nullptr) || ((offset + buffer_size) > bytes_written_))
+    {
+        return false;
+    }
+
+    if ((offset + buffer_size) > bytes_flushed_)
+    {
+        if (!FlushOutput() || (util::platform::FileFlush(output_file_) != 0))
+        {
+            return false;
+        }
+
+        bytes_flushed_ = bytes_written_;
+    }
+
+    if (output_read_file_ == nullptr)
+    {
+        int32_t result = util::platform::FileOpen(&output_read_file_, output_filename_.c_str(), "rb");
+
+        if ((result != 0) || (output_read_file_ == nullptr))
+        {
+            GFXRECON_LOG_ERROR("Failed to open output file %s for reading", output_filename_.c_str());
+            output_read_file_ = nullptr;
+            return false;
+        }
+    }
+
+    return util::platform::FileSeek(output_read_file_, static_cast<int64_t>(offset), util::platform::FileSeekSet) &&
+           util::platform::FileRead(buffer, buffer_size, output_read_file_);
+}
+
+bool FileTransformer::ReadDataReference(const format::BlockHeader&          block_header,
+                                        format::DataReferenceCommandHeader* header,
+                                        std::vector<uint8_t>*               command_data)
+{
+    assert((header != nullptr) && (command_data != nullptr));
+
+    bool success = ReadBytes(&header->thread_id, sizeof(header->thread_id));
+    success      = success && ReadBytes(&header->command_id, sizeof(header->command_id));
+    success      = success && ReadBytes(&header->data_offset, sizeof(header->data_offset));
+    success      = success && ReadBytes(&header->stored_size, sizeof(header->stored_size));
+    success      = success && ReadBytes(&header->data_size, sizeof(header->data_size));
+    success      = success && ReadBytes(&header->compressed, sizeof(header->compressed));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read data reference meta-data block header");
+        return false;
+    }
+
+    // The fields of the referenced command, excluding its thread ID, make up the rest of the block.
+    uint64_t command_data_size = block_header.size - (sizeof(*header) - sizeof(header->meta_header.block_header));
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, command_data_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header->stored_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header->data_size);
+
+    command_data->resize(static_cast<size_t>(command_data_size));
+    if (!ReadBytes(command_data->data(), command_data->size()))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read data reference meta-data block data");
+        return false;
+    }
+
+    // Read the referenced data and return to the current block.  The bytes are read directly from the file so that
+    // they are not counted as processed input.
+    int64_t position = util::platform::FileTell(input_file_);
+    success          = util::platform::FileSeek(input_file_, header->data_offset, util::platform::FileSeekSet);
+
+    if (success)
+    {
+        size_t stored_size = static_cast<size_t>(header->stored_size);
+        size_t data_size   = static_cast<size_t>(header->data_size);
+
+        if (header->compressed != 0)
+        {
+            if (compressed_parameter_buffer_.size() < stored_size)
+            {
+                compressed_parameter_buffer_.resize(stored_size);
+            }
+
+            if (parameter_buffer_.size() < data_size)
+            {
+                parameter_buffer_.resize(data_size);
+            }
+
+            success =
+                (compressor_ != nullptr) &&
+                util::platform::FileRead(compressed_parameter_buffer_.data(), stored_size, input_file_) &&
+                (compressor_->Decompress(stored_size, compressed_parameter_buffer_, data_size, &parameter_buffer_) ==
+                 data_size);
+        }
+        else
+        {
+            if (parameter_buffer_.size() < data_size)
+            {
+                parameter_buffer_.resize(data_size);
+            }
+
+            success = util::platform::FileRead(parameter_buffer_.data(), data_size, input_file_);
+        }
+    }
+
+    success = util::platform::FileSeek(input_file_, position, util::platform::FileSeekSet) && success;
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read data for data reference meta-data block");
+    }
+
+    return success;
+}
+
 void FileTransformer::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
@@ -458,7 +651,7 @@ void FileTransformer::HandleBlockWriteError(Error error_code, const char* error_
 
 void FileTransformer::HandleBlockCopyError(Error error_code, const char* error_message)
 {
-    if (ferror(output_file_))
+    if (!WaitForPendingWrites(0) || ferror(output_file_))
     {
         HandleBlockWriteError(error_code, error_message);
     }
@@ -554,6 +747,13 @@ bool FileTransformer::ProcessMethodCall(const format::BlockHeader& block_header,
 
 bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
+    if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kDataReferenceCommand)
+    {
+        // Data references contain absolute offsets into the input file, so they are expanded to the referenced
+        // command instead of being copied.
+        return ProcessDataReference(block_header);
+    }
+
     // Copy block data from old file to new file.
     if (!WriteBlockHeader(block_header))
     {
@@ -611,5 +811,35 @@ bool FileTransformer::ProcessStateMarker(const format::BlockHeader& block_header
     return true;
 }
 
+bool FileTransformer::ProcessDataReference(const format::BlockHeader& block_header)
+{
+    format::DataReferenceCommandHeader header;
+    std::vector<uint8_t>               command_data;
+
+    if (!ReadDataReference(block_header, &header, &command_data))
+    {
+        return false;
+    }
+
+    // Write the referenced command with uncompressed data.
+    format::BlockHeader command_block_header;
+    command_block_header.type = format::BlockType::kMetaDataBlock;
+    command_block_header.size =
+        sizeof(header.command_id) + sizeof(header.thread_id) + command_data.size() + header.data_size;
+
+    bool success = WriteBlockHeader(command_block_header);
+    success      = success && WriteBytes(&header.command_id, sizeof(header.command_id));
+    success      = success && WriteBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && WriteBytes(command_data.data(), command_data.size());
+    success      = success && WriteBytes(parameter_buffer_.data(), static_cast<size_t>(header.data_size));
+
+    if (!success)
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write expanded data reference meta-data block");
+    }
+
+    return success;
+}
+
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -26,8 +26,11 @@
 #include "format/format.h"
 #include "util/defines.h"
 #include "util/compressor.h"
+#include "util/threadpool.h"
 
 #include <cstdio>
+#include <deque>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -115,6 +118,16 @@ class FileTransformer
 
     bool CopyBytes(uint64_t copy_size);
 
+    // Reads back bytes that were previously written to the output file, starting at the specified output file offset.
+    // Buffered output is written to the file first when it contains part of the requested range.
+    bool ReadOutputBytes(uint64_t offset, void* buffer, size_t buffer_size);
+
+    // Reads a kDataReferenceCommand block, storing the fields of the referenced command in command_data and the
+    // uncompressed data of the referenced block in the parameter buffer.
+    bool ReadDataReference(const format::BlockHeader&          block_header,
+                           format::DataReferenceCommandHeader* header,
+                           std::vector<uint8_t>*               command_data);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     void HandleBlockWriteError(Error error_code, const char* error_message);
@@ -134,21 +147,38 @@ class FileTransformer
 
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    bool ProcessDataReference(const format::BlockHeader& block_header);
+
     uint64_t GetCurrentBlockIndex() { return block_index_; }
 
   private:
+    // Output is collected into buffers of kWriteBufferSize bytes, which are written to the file by a background thread
+    // while the following blocks are read and processed.
+    static constexpr size_t kWriteBufferSize        = 4 * 1024 * 1024;
+    static constexpr size_t kMaxPendingWriteBuffers = 4;
+
     bool ProcessFileHeader();
 
     bool ProcessNextBlock();
 
     bool ReadBlockHeader(format::BlockHeader* block_header);
 
+    // Hands the content of the write buffer to the writer thread.
+    bool FlushWriteBuffer();
+
+    // Waits until no more than max_pending_writes buffers are waiting to be written.  Returns false if a write failed.
+    bool WaitForPendingWrites(size_t max_pending_writes);
+
+    // Writes all buffered output to the file.  Returns false if a write failed.
+    bool FlushOutput();
+
   private:
     std::string                         input_filename_;
     std::string                         output_filename_;
     std::string                         tool_;
     FILE*                               input_file_;
     FILE*                               output_file_;
+    FILE*                               output_read_file_{ nullptr };
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
     uint64_t                            bytes_read_;
@@ -159,6 +189,11 @@ class FileTransformer
     std::vector<uint8_t>                compressed_parameter_buffer_;
     std::unique_ptr<util::Compressor>   compressor_;
     uint64_t                            block_index_{ 0 };
+    std::vector<uint8_t>                write_buffer_;
+    std::deque<std::future<bool>>       pending_writes_;
+    bool                                write_failed_{ false };
+    uint64_t                            bytes_flushed_{ 0 };
+    util::ThreadPool                    writer_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -22,6 +22,8 @@
 */
 
 #include "decode/preload_file_processor.h"
+#include "decode/replay_memory_tracker.h"
+#include "util/compressor.h"
 #include "util/logging.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -32,11 +34,82 @@ PreloadFileProcessor::PreloadFileProcessor() : status_(PreloadStatus::kInactive)
 void PreloadFileProcessor::PreloadNextFrames(size_t count)
 {
     status_ = PreloadStatus::kRecord;
-    while (--count != 0U)
+    for (size_t i = 0; i < count; ++i)
     {
-        ProcessNextFrame();
+        if (!ProcessNextFrame())
+        {
+            break;
+        }
     }
     status_ = PreloadStatus::kReplay;
+
+    ReportPreloadUsage();
+
+    loop_iteration_   = 0;
+    loop_start_frame_ = current_frame_number_;
+
+    if (loop_callback_)
+    {
+        loop_callback_(loop_iteration_);
+    }
+}
+
+bool PreloadFileProcessor::PreloadCallBlock(format::BlockHeader& block_header,
+                                            format::ApiCallId    call_id,
+                                            size_t               prefix_size)
+{
+    if (!format::IsBlockCompressed(block_header.type) || (GetCompressor() == nullptr))
+    {
+        return ReadParameterBytes(block_header, call_id, preload_buffer_);
+    }
+
+    // Object ID and thread ID for method calls, thread ID for function calls.
+    uint8_t  prefix[sizeof(format::HandleId) + sizeof(format::ThreadId)];
+    uint64_t uncompressed_size = 0;
+    size_t   compressed_size   = static_cast<size_t>(block_header.size) - sizeof(call_id) - prefix_size;
+
+    assert(prefix_size <= sizeof(prefix));
+
+    bool success = ReadBytes(prefix, prefix_size) && ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
+
+    if (success)
+    {
+        compressed_size -= sizeof(uncompressed_size);
+        compressed_buffer_.resize(compressed_size);
+        success = ReadBytes(compressed_buffer_.data(), compressed_size);
+    }
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+        size_t data_size = static_cast<size_t>(uncompressed_size);
+
+        uncompressed_buffer_.resize(data_size);
+        success = (GetCompressor()->Decompress(compressed_size, compressed_buffer_, data_size, &uncompressed_buffer_) ==
+                   data_size);
+
+        if (success)
+        {
+            format::BlockHeader uncompressed_header = block_header;
+            uncompressed_header.type                = format::RemoveCompressedBlockBit(block_header.type);
+            uncompressed_header.size                = sizeof(call_id) + prefix_size + data_size;
+
+            preload_buffer_.Reserve(sizeof(uncompressed_header) + static_cast<size_t>(uncompressed_header.size));
+            preload_buffer_.Add(&uncompressed_header);
+            preload_buffer_.Add(&call_id);
+            memcpy(preload_buffer_.Add(prefix_size), prefix, prefix_size);
+            memcpy(preload_buffer_.Add(data_size), uncompressed_buffer_.data(), data_size);
+        }
+    }
+
+    return success;
+}
+
+void PreloadFileProcessor::ReportPreloadUsage() const
+{
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kPreloadBuffers,
+                                  preload_buffer_.GetCapacity() + compressed_buffer_.capacity() +
+                                      uncompressed_buffer_.capacity());
 }
 
 PreloadFileProcessor::PreloadBuffer::PreloadBuffer() : replay_offset_(0) {}
@@ -67,6 +140,20 @@ bool PreloadFileProcessor::ProcessBlocks()
     format::BlockHeader block_header;
     bool                success = true;
 
+    if ((status_ == PreloadStatus::kReplay) && preload_buffer_.ReplayFinished())
+    {
+        // The preloaded frames have been replayed, but loop iterations remain.  Start over from the first preloaded
+        // frame, restoring the frame number so that frame based options apply to each iteration.
+        ++loop_iteration_;
+        preload_buffer_.Rewind();
+        current_frame_number_ = loop_start_frame_;
+
+        if (loop_callback_)
+        {
+            loop_callback_(loop_iteration_);
+        }
+    }
+
     while (success)
     {
         PrintBlockInfo();
@@ -98,7 +185,7 @@ bool PreloadFileProcessor::ProcessBlocks()
                         const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
                         if (status_ == PreloadStatus::kRecord)
                         {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
+                            success = PreloadCallBlock(block_header, api_call_id, sizeof(format::ThreadId));
                             if (!success)
                             {
                                 HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
@@ -135,7 +222,8 @@ bool PreloadFileProcessor::ProcessBlocks()
                         const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
                         if (status_ == PreloadStatus::kRecord)
                         {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
+                            success = PreloadCallBlock(
+                                block_header, api_call_id, sizeof(format::HandleId) + sizeof(format::ThreadId));
                             if (!success)
                             {
                                 HandleBlockReadError(kErrorReadingBlockData,
@@ -327,9 +415,12 @@ bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
     if (status_ == PreloadStatus::kReplay)
     {
         bytes_read = preload_buffer_.Read(buffer, buffer_size);
-        if (preload_buffer_.ReplayFinished())
+        if (preload_buffer_.ReplayFinished() && ((loop_iteration_ + 1) >= loop_count_))
         {
+            // The data has been copied to the destination, so the preloaded frames are no longer needed.
             status_ = PreloadStatus::kInactive;
+            preload_buffer_.Reset();
+            ReportPreloadUsage();
         }
     }
     else
@@ -27,17 +27,33 @@
 #include "decode/file_processor.h"
 #include "format/format_util.h"
 
+#include <functional>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 class PreloadFileProcessor : public FileProcessor
 {
+  public:
+    // Called with the iteration index before each replay of the preloaded frames.  Iteration 0 is the initial replay,
+    // and later iterations repeat the preloaded frames when a loop count greater than one has been set.
+    typedef std::function<void(uint32_t iteration)> ReplayLoopCallback;
+
   public:
     PreloadFileProcessor();
 
     // Preloads *count* frames to continuous, expandable memory buffer
     void PreloadNextFrames(size_t count);
 
+    // Replays the preloaded frames *loop_count* times before continuing with the rest of the file
+    void SetReplayLoop(uint32_t loop_count, ReplayLoopCallback callback)
+    {
+        loop_count_    = (loop_count > 0) ? loop_count : 1;
+        loop_callback_ = std::move(callback);
+    }
+
+    uint32_t GetReplayLoopIteration() const { return loop_iteration_; }
+
   private:
     class PreloadBuffer
     {
@@ -67,9 +83,15 @@ class PreloadFileProcessor : public FileProcessor
         // Indicates whether the preloaded calls have been replayed in full
         inline bool ReplayFinished() { return !container_.empty() && replay_offset_ >= container_.size(); }
 
+        // Moves the replay position back to the first preloaded call
+        inline void Rewind() { replay_offset_ = 0; }
+
         // Clears the preload buffer, resets internal state
         void Reset();
 
+        // Returns the number of bytes of memory held by the buffer
+        size_t GetCapacity() const { return container_.capacity(); }
+
       private:
         std::vector<char> container_;
         size_t            replay_offset_;
@@ -103,9 +125,24 @@ class PreloadFileProcessor : public FileProcessor
         return ReadBytes(parameter_buffer, parameters_size);
     }
 
+    // Preloads a function or method call block, storing compressed parameter data uncompressed so that
+    // repeated replay of the preloaded frames does not decompress it again.  *prefix_size* is the size of the
+    // uncompressed fields that precede the parameter data.
+    bool PreloadCallBlock(format::BlockHeader& block_header, format::ApiCallId call_id, size_t prefix_size);
+
     bool ProcessBlocks() override;
 
     bool ReadBytes(void* buffer, size_t buffer_size) override;
+
+    void ReportPreloadUsage() const;
+
+  private:
+    std::vector<uint8_t> compressed_buffer_;
+    std::vector<uint8_t> uncompressed_buffer_;
+    uint32_t             loop_count_{ 1 };
+    uint32_t             loop_iteration_{ 0 };
+    uint64_t             loop_start_frame_{ 0 };
+    ReplayLoopCallback   loop_callback_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,320 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/replay_memory_tracker.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const int    kJsonIndentWidth = 2;
+const double kBytesPerMiB     = 1024.0 * 1024.0;
+
+ReplayMemoryTracker* ReplayMemoryTracker::instance_{ nullptr };
+
+ReplayMemoryTracker::ReplayMemoryTracker(uint64_t soft_limit) :
+    soft_limit_(soft_limit), low_water_mark_((soft_limit / kLowWaterMarkDenominator) * kLowWaterMarkNumerator),
+    soft_limit_armed_(true), total_current_(0), total_frame_peak_(0), overall_peak_{}, overall_total_peak_(0),
+    overall_total_peak_frame_(0), trim_count_(0), trimmed_bytes_(0)
+{
+    for (uint32_t i = 0; i < kCategoryCount; ++i)
+    {
+        current_[i].store(0);
+        frame_peak_[i].store(0);
+    }
+}
+
+void ReplayMemoryTracker::CreateInstance(uint64_t soft_limit)
+{
+    if (instance_ == nullptr)
+    {
+        instance_ = new ReplayMemoryTracker(soft_limit);
+    }
+}
+
+void ReplayMemoryTracker::DestroyInstance()
+{
+    delete instance_;
+    instance_ = nullptr;
+}
+
+void ReplayMemoryTracker::UpdateUsage(Category category, uint64_t bytes, UpdateMode mode)
+{
+    assert(category < kCategoryCount);
+
+    uint64_t previous = 0;
+    uint64_t value    = 0;
+
+    switch (mode)
+    {
+        case kSet:
+            previous = current_[category].exchange(bytes);
+            value    = bytes;
+            break;
+        case kAdd:
+            previous = current_[category].fetch_add(bytes);
+            value    = previous + bytes;
+            break;
+        case kRemove:
+            previous = current_[category].fetch_sub(bytes);
+            assert(previous >= bytes);
+            value = previous - bytes;
+            break;
+    }
+
+    uint64_t total = 0;
+    if (value >= previous)
+    {
+        total = total_current_.fetch_add(value - previous) + (value - previous);
+    }
+    else
+    {
+        total = total_current_.fetch_sub(previous - value) - (previous - value);
+    }
+
+    UpdatePeak(&frame_peak_[category], value);
+    UpdatePeak(&total_frame_peak_, total);
+}
+
+void ReplayMemoryTracker::UpdatePeak(std::atomic<uint64_t>* peak, uint64_t value)
+{
+    uint64_t current_peak = peak->load(std::memory_order_relaxed);
+    while ((value > current_peak) && !peak->compare_exchange_weak(current_peak, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t ReplayMemoryTracker::GetOverallPeak(uint32_t category) const
+{
+    // Include the peak of a final frame that was not ended by a frame delimiter.
+    return std::max(overall_peak_[category], frame_peak_[category].load());
+}
+
+uint64_t ReplayMemoryTracker::GetOverallTotalPeak() const
+{
+    return std::max(overall_total_peak_, total_frame_peak_.load());
+}
+
+uint64_t ReplayMemoryTracker::GetTrimmableUsage() const
+{
+    uint64_t usage = 0;
+    for (uint32_t i = 0; i < kCategoryCount; ++i)
+    {
+        if (IsTrimmable(static_cast<Category>(i)))
+        {
+            usage += current_[i].load();
+        }
+    }
+    return usage;
+}
+
+bool ReplayMemoryTracker::EndFrame(uint64_t frame)
+{
+    if (instance_ == nullptr)
+    {
+        return false;
+    }
+
+    FrameRange frame_peaks;
+    frame_peaks.first_frame = frame;
+    frame_peaks.last_frame  = frame;
+
+    // The peaks for the next frame start from the current usage.
+    for (uint32_t i = 0; i < kCategoryCount; ++i)
+    {
+        const uint64_t peak           = instance_->frame_peak_[i].exchange(instance_->current_[i].load());
+        frame_peaks.category_peaks[i] = peak;
+        instance_->overall_peak_[i]   = std::max(instance_->overall_peak_[i], peak);
+    }
+
+    frame_peaks.total_peak = instance_->total_frame_peak_.exchange(instance_->total_current_.load());
+
+    if (frame_peaks.total_peak > instance_->overall_total_peak_)
+    {
+        instance_->overall_total_peak_       = frame_peaks.total_peak;
+        instance_->overall_total_peak_frame_ = frame;
+    }
+
+    // Consecutive frames with identical peaks are merged into a single range to bound the size of the history.
+    auto& frame_ranges = instance_->frame_ranges_;
+    if (!frame_ranges.empty() && (frame_ranges.back().last_frame + 1 == frame) &&
+        (frame_ranges.back().total_peak == frame_peaks.total_peak) &&
+        std::equal(std::begin(frame_peaks.category_peaks),
+                   std::end(frame_peaks.category_peaks),
+                   std::begin(frame_ranges.back().category_peaks)))
+    {
+        frame_ranges.back().last_frame = frame;
+    }
+    else
+    {
+        frame_ranges.push_back(frame_peaks);
+    }
+
+    if (instance_->soft_limit_ == 0)
+    {
+        return false;
+    }
+
+    const uint64_t trimmable_usage = instance_->GetTrimmableUsage();
+    if (trimmable_usage <= instance_->low_water_mark_)
+    {
+        instance_->soft_limit_armed_ = true;
+    }
+    else if (instance_->soft_limit_armed_ && (trimmable_usage > instance_->soft_limit_))
+    {
+        instance_->soft_limit_armed_ = false;
+        return true;
+    }
+
+    return false;
+}
+
+void ReplayMemoryTracker::RecordTrim(uint64_t released_bytes)
+{
+    if (instance_ != nullptr)
+    {
+        ++instance_->trim_count_;
+        instance_->trimmed_bytes_ += released_bytes;
+    }
+}
+
+bool ReplayMemoryTracker::WriteReport(const std::string& filename)
+{
+    if (instance_ == nullptr)
+    {
+        return false;
+    }
+
+    nlohmann::json overall_peaks;
+    for (uint32_t i = 0; i < kCategoryCount; ++i)
+    {
+        overall_peaks[GetCategoryName(static_cast<Category>(i))] = instance_->GetOverallPeak(i);
+    }
+    overall_peaks["total"]            = instance_->GetOverallTotalPeak();
+    overall_peaks["total_peak_frame"] = instance_->overall_total_peak_frame_;
+
+    nlohmann::json frames = nlohmann::json::array();
+    for (const auto& range : instance_->frame_ranges_)
+    {
+        nlohmann::json peaks;
+        for (uint32_t i = 0; i < kCategoryCount; ++i)
+        {
+            peaks[GetCategoryName(static_cast<Category>(i))] = range.category_peaks[i];
+        }
+        peaks["total"] = range.total_peak;
+
+        frames.push_back(
+            { { "first_frame", range.first_frame }, { "last_frame", range.last_frame }, { "peaks", peaks } });
+    }
+
+    nlohmann::json file_content = { { "units", "bytes" },
+                                    { "soft_limit", instance_->soft_limit_ },
+                                    { "trim_count", instance_->trim_count_ },
+                                    { "trimmed_bytes", instance_->trimmed_bytes_ },
+                                    { "overall_peaks", overall_peaks },
+                                    { "frames", frames } };
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open memory report file '%s' (Error %i).", filename.c_str(), result);
+        return false;
+    }
+
+    const std::string json_string = file_content.dump(kJsonIndentWidth);
+    bool              success     = util::platform::FileWrite(json_string.data(), json_string.size(), file);
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write memory report file '%s'.", filename.c_str());
+    }
+
+    return success;
+}
+
+void ReplayMemoryTracker::LogSummary()
+{
+    if (instance_ == nullptr)
+    {
+        return;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Replay memory usage:");
+    GFXRECON_WRITE_CONSOLE("  %-20s %14s %14s", "category", "current (MiB)", "peak (MiB)");
+
+    for (uint32_t i = 0; i < kCategoryCount; ++i)
+    {
+        GFXRECON_WRITE_CONSOLE("  %-20s %14.2f %14.2f",
+                               GetCategoryName(static_cast<Category>(i)),
+                               instance_->current_[i].load() / kBytesPerMiB,
+                               instance_->GetOverallPeak(i) / kBytesPerMiB);
+    }
+
+    GFXRECON_WRITE_CONSOLE("  %-20s %14.2f %14.2f (frame %" PRIu64 ")",
+                           "total",
+                           instance_->total_current_.load() / kBytesPerMiB,
+                           instance_->GetOverallTotalPeak() / kBytesPerMiB,
+                           instance_->overall_total_peak_frame_);
+
+    if (instance_->soft_limit_ > 0)
+    {
+        GFXRECON_WRITE_CONSOLE("  Soft limit of %.2f MiB was exceeded %" PRIu64 " times, releasing %.2f MiB",
+                               instance_->soft_limit_ / kBytesPerMiB,
+                               instance_->trim_count_,
+                               instance_->trimmed_bytes_ / kBytesPerMiB);
+    }
+}
+
+const char* ReplayMemoryTracker::GetCategoryName(Category category)
+{
+    switch (category)
+    {
+        case kDecodeArena:
+            return "decode_arena";
+        case kFileBuffers:
+            return "file_buffers";
+        case kPreloadBuffers:
+            return "preload_buffers";
+        case kObjectInfoTables:
+            return "object_info_tables";
+        case kResourceStaging:
+            return "resource_staging";
+        case kDumpResources:
+            return "dump_resources";
+        default:
+            return "unknown";
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
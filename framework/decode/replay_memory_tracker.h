@@ -0,0 +1,195 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_REPLAY_MEMORY_TRACKER_H
+#define GFXRECON_DECODE_REPLAY_MEMORY_TRACKER_H
+
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Tracks the host memory held by the replay subsystems and records the peak usage of each subsystem per frame.  An
+// optional soft limit is checked at frame boundaries, where the file processor releases reusable memory when the
+// usage of the categories that it can release exceeds the limit.
+//
+// Like DecodeAllocator, the tracker is a process wide instance.  It is only created when a report or limit is
+// requested, and the static update functions return immediately when there is no instance, so instrumented code
+// only pays for a branch when tracking is disabled.
+class ReplayMemoryTracker
+{
+  public:
+    enum Category : uint32_t
+    {
+        kDecodeArena      = 0, // DecodeAllocator memory blocks and oversized allocations.
+        kFileBuffers      = 1, // FileProcessor read, decompression, and referenced data buffers.
+        kPreloadBuffers   = 2, // Block data held by PreloadFileProcessor.
+        kObjectInfoTables = 3, // Estimated size of the replay object info tables.
+        kResourceStaging  = 4, // Host staging memory used to initialize resource content for trimmed captures.
+        kDumpResources    = 5, // Host copies of resources read back for dump resources.
+        kCategoryCount
+    };
+
+    // Peak usage for a range of consecutive frames with identical peaks.
+    struct FrameRange
+    {
+        uint64_t first_frame{ 0 };
+        uint64_t last_frame{ 0 };
+        uint64_t category_peaks[kCategoryCount]{};
+        uint64_t total_peak{ 0 };
+    };
+
+  public:
+    // Creates the tracker instance. A soft limit of 0 disables the limit.
+    static void CreateInstance(uint64_t soft_limit);
+
+    static void DestroyInstance();
+
+    static bool IsEnabled() { return instance_ != nullptr; }
+
+    // Sets the number of bytes currently held by a subsystem.
+    static void SetUsage(Category category, uint64_t bytes)
+    {
+        if (instance_ != nullptr)
+        {
+            instance_->UpdateUsage(category, bytes, kSet);
+        }
+    }
+
+    static void AddUsage(Category category, uint64_t bytes)
+    {
+        if (instance_ != nullptr)
+        {
+            instance_->UpdateUsage(category, bytes, kAdd);
+        }
+    }
+
+    static void RemoveUsage(Category category, uint64_t bytes)
+    {
+        if (instance_ != nullptr)
+        {
+            instance_->UpdateUsage(category, bytes, kRemove);
+        }
+    }
+
+    // Records the peaks of the frame that just ended and starts tracking peaks for the next frame.  Returns true when
+    // the usage of the trimmable categories exceeds the soft limit, indicating that the caller should release reusable
+    // memory.  After a release, the limit is not checked again until the trimmable usage has ended a frame at or below
+    // the low-water mark, so that a working set larger than the limit is not released and reallocated every frame.
+    static bool EndFrame(uint64_t frame);
+
+    // Notifies the tracker that reusable memory was released in response to the soft limit being exceeded.
+    static void RecordTrim(uint64_t released_bytes);
+
+    // Writes the overall and per frame peaks to a JSON file.
+    static bool WriteReport(const std::string& filename);
+
+    static void LogSummary();
+
+    static const char* GetCategoryName(Category category);
+
+    // Returns true for the categories that are released when the soft limit is exceeded.
+    static bool IsTrimmable(Category category) { return (category == kDecodeArena) || (category == kFileBuffers); }
+
+  private:
+    enum UpdateMode
+    {
+        kSet,
+        kAdd,
+        kRemove
+    };
+
+    ReplayMemoryTracker(uint64_t soft_limit);
+
+    void UpdateUsage(Category category, uint64_t bytes, UpdateMode mode);
+
+    static void UpdatePeak(std::atomic<uint64_t>* peak, uint64_t value);
+
+    uint64_t GetOverallPeak(uint32_t category) const;
+
+    uint64_t GetOverallTotalPeak() const;
+
+    uint64_t GetTrimmableUsage() const;
+
+  private:
+    // The soft limit is checked again once the trimmable usage is at or below this fraction of the limit.
+    static const uint64_t kLowWaterMarkNumerator   = 3;
+    static const uint64_t kLowWaterMarkDenominator = 4;
+
+    static ReplayMemoryTracker* instance_;
+
+    const uint64_t          soft_limit_;
+    const uint64_t          low_water_mark_;
+    bool                    soft_limit_armed_;
+    std::atomic<uint64_t>   current_[kCategoryCount];
+    std::atomic<uint64_t>   frame_peak_[kCategoryCount];
+    std::atomic<uint64_t>   total_current_;
+    std::atomic<uint64_t>   total_frame_peak_;
+    uint64_t                overall_peak_[kCategoryCount];
+    uint64_t                overall_total_peak_;
+    uint64_t                overall_total_peak_frame_;
+    std::vector<FrameRange> frame_ranges_;
+    uint64_t                trim_count_;
+    uint64_t                trimmed_bytes_;
+};
+
+// Reports the size of a temporary host allocation, such as a resource readback buffer, for the lifetime of the scope.
+class ScopedReplayMemoryUsage
+{
+  public:
+    ScopedReplayMemoryUsage(ReplayMemoryTracker::Category category) : category_(category), bytes_(0) {}
+
+    ~ScopedReplayMemoryUsage() { Set(0); }
+
+    void Set(uint64_t bytes)
+    {
+        if (bytes > bytes_)
+        {
+            ReplayMemoryTracker::AddUsage(category_, bytes - bytes_);
+        }
+        else if (bytes < bytes_)
+        {
+            ReplayMemoryTracker::RemoveUsage(category_, bytes_ - bytes);
+        }
+
+        bytes_ = bytes;
+    }
+
+    ScopedReplayMemoryUsage(const ScopedReplayMemoryUsage&) = delete;
+
+    ScopedReplayMemoryUsage& operator=(const ScopedReplayMemoryUsage&) = delete;
+
+  private:
+    ReplayMemoryTracker::Category category_;
+    uint64_t                      bytes_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_REPLAY_MEMORY_TRACKER_H
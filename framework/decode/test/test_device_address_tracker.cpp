@@ -0,0 +1,148 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include "decode/vulkan_device_address_tracker.h"
+#include "decode/vulkan_object_info.h"
+#include "decode/vulkan_object_info_table.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan.h"
+
+#include <vector>
+
+using gfxrecon::decode::VulkanBufferInfo;
+using gfxrecon::decode::VulkanDeviceAddressTracker;
+using gfxrecon::decode::VulkanObjectInfoTable;
+
+static const VulkanBufferInfo* AddBuffer(VulkanObjectInfoTable&     info_table,
+                                         gfxrecon::format::HandleId capture_id,
+                                         VkDeviceAddress            capture_address,
+                                         VkDeviceAddress            replay_address,
+                                         VkDeviceSize               size)
+{
+    VulkanBufferInfo info;
+    info.capture_id      = capture_id;
+    info.handle          = gfxrecon::format::FromHandleId<VkBuffer>(capture_id + 0x1000);
+    info.capture_address = capture_address;
+    info.replay_address  = replay_address;
+    info.size            = size;
+
+    info_table.AddVkBufferInfo(std::move(info));
+    return info_table.GetVkBufferInfo(capture_id);
+}
+
+TEST_CASE("VulkanDeviceAddressTracker - buffer lookup at range boundaries", "[address_tracker]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    VulkanObjectInfoTable      info_table;
+    VulkanDeviceAddressTracker tracker(info_table);
+
+    // Buffers are tracked out of order, with a gap between the second and third buffer.
+    const VulkanBufferInfo* second = AddBuffer(info_table, 2, 0x20000, 0x90000, 0x1000);
+    const VulkanBufferInfo* first  = AddBuffer(info_table, 1, 0x10000, 0x80000, 0x10000);
+    const VulkanBufferInfo* third  = AddBuffer(info_table, 3, 0x30000, 0xa0000, 0x100);
+    tracker.TrackBuffer(second);
+    tracker.TrackBuffer(first);
+    tracker.TrackBuffer(third);
+
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0xffff) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x10000) == first);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x1ffff) == first);
+
+    // The end of the first buffer is the start of the second buffer.
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x20000) == second);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x20fff) == second);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x21000) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x2ffff) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x30000) == third);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x300ff) == third);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x30100) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(UINT64_MAX) == nullptr);
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("VulkanDeviceAddressTracker - buffer lookup after removal", "[address_tracker]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    VulkanObjectInfoTable      info_table;
+    VulkanDeviceAddressTracker tracker(info_table);
+
+    const VulkanBufferInfo* first  = AddBuffer(info_table, 1, 0x10000, 0x80000, 0x1000);
+    const VulkanBufferInfo* second = AddBuffer(info_table, 2, 0x20000, 0x90000, 0x1000);
+    const VulkanBufferInfo* third  = AddBuffer(info_table, 3, 0x30000, 0xa0000, 0x1000);
+    tracker.TrackBuffer(first);
+    tracker.TrackBuffer(second);
+    tracker.TrackBuffer(third);
+
+    tracker.RemoveBuffer(second);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x10000) == first);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x20000) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x20fff) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x30000) == third);
+
+    // Removing an untracked buffer has no effect.
+    tracker.RemoveBuffer(second);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x30000) == third);
+
+    tracker.RemoveBuffer(first);
+    tracker.RemoveBuffer(third);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x10000) == nullptr);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x30000) == nullptr);
+
+    // Tracking a buffer again after removal makes it visible again.
+    tracker.TrackBuffer(second);
+    REQUIRE(tracker.GetBufferByCaptureDeviceAddress(0x20800) == second);
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("VulkanDeviceAddressTracker - batched address translation", "[address_tracker]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    VulkanObjectInfoTable      info_table;
+    VulkanDeviceAddressTracker tracker(info_table);
+
+    const VulkanBufferInfo* first  = AddBuffer(info_table, 1, 0x10000, 0x80000, 0x1000);
+    const VulkanBufferInfo* second = AddBuffer(info_table, 2, 0x11000, 0x70000, 0x1000);
+    tracker.TrackBuffer(first);
+    tracker.TrackBuffer(second);
+
+    std::vector<VkDeviceAddress>         addresses = { 0x10000, 0x10ff8, 0x11000, 0x11010, 0x12000, 0 };
+    std::vector<const VulkanBufferInfo*> buffer_infos(addresses.size());
+
+    REQUIRE(tracker.TranslateCaptureDeviceAddresses(addresses.data(), addresses.size(), buffer_infos.data()) == 4);
+
+    REQUIRE(addresses == std::vector<VkDeviceAddress>{ 0x80000, 0x80ff8, 0x70000, 0x70010, 0x12000, 0 });
+    REQUIRE(buffer_infos == std::vector<const VulkanBufferInfo*>{ first, first, second, second, nullptr, nullptr });
+
+    gfxrecon::util::Log::Release();
+}
@@ -0,0 +1,370 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include "decode/vulkan_replay_dump_resources_hasher_shaders.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using gfxrecon::decode::ComputeDumpResourcesHashLanes;
+using gfxrecon::decode::g_dump_resources_hash_comp;
+
+namespace
+{
+
+// Minimal interpreter for the subset of SPIR-V used by g_dump_resources_hash_comp, so the shader module can be checked
+// against the CPU reference without a Vulkan device.
+class HashShaderInterpreter
+{
+  public:
+    static constexpr uint32_t kOpExecutionMode     = 16;
+    static constexpr uint32_t kOpConstant          = 43;
+    static constexpr uint32_t kOpFunction          = 54;
+    static constexpr uint32_t kOpFunctionEnd       = 56;
+    static constexpr uint32_t kOpVariable          = 59;
+    static constexpr uint32_t kOpLoad              = 61;
+    static constexpr uint32_t kOpStore             = 62;
+    static constexpr uint32_t kOpAccessChain       = 65;
+    static constexpr uint32_t kOpDecorate          = 71;
+    static constexpr uint32_t kOpCompositeExtract  = 81;
+    static constexpr uint32_t kOpIAdd              = 128;
+    static constexpr uint32_t kOpIMul              = 132;
+    static constexpr uint32_t kOpULessThan         = 176;
+    static constexpr uint32_t kOpShiftRightLogical = 194;
+    static constexpr uint32_t kOpShiftLeftLogical  = 196;
+    static constexpr uint32_t kOpBitwiseOr         = 197;
+    static constexpr uint32_t kOpBitwiseXor        = 198;
+    static constexpr uint32_t kOpPhi               = 245;
+    static constexpr uint32_t kOpLoopMerge         = 246;
+    static constexpr uint32_t kOpLabel             = 248;
+    static constexpr uint32_t kOpBranch            = 249;
+    static constexpr uint32_t kOpBranchConditional = 250;
+    static constexpr uint32_t kOpReturn            = 253;
+
+    static constexpr uint32_t kExecutionModeLocalSize = 17;
+    static constexpr uint32_t kDecorationBuiltIn      = 11;
+    static constexpr uint32_t kDecorationBinding      = 33;
+    static constexpr uint32_t kBuiltInNumWorkgroups   = 24;
+    static constexpr uint32_t kBuiltInGlobalId        = 28;
+    static constexpr uint32_t kStorageClassInput      = 1;
+    static constexpr uint32_t kStorageClassPush       = 9;
+
+    HashShaderInterpreter(const uint8_t* code, size_t size) : words_(size / sizeof(uint32_t))
+    {
+        std::memcpy(words_.data(), code, words_.size() * sizeof(uint32_t));
+
+        // Skip the five word module header.
+        for (size_t offset = 5; offset < words_.size();)
+        {
+            const uint32_t opcode = words_[offset] & 0xffff;
+            const uint32_t count  = words_[offset] >> 16;
+            REQUIRE(count > 0);
+
+            const uint32_t* operands = &words_[offset + 1];
+            if ((opcode == kOpExecutionMode) && (operands[1] == kExecutionModeLocalSize))
+            {
+                local_size_ = operands[2];
+            }
+            else if (opcode == kOpDecorate)
+            {
+                if (operands[1] == kDecorationBuiltIn)
+                {
+                    builtins_[operands[0]] = operands[2];
+                }
+                else if (operands[1] == kDecorationBinding)
+                {
+                    bindings_[operands[0]] = operands[2];
+                }
+            }
+            else if (opcode == kOpConstant)
+            {
+                constants_[operands[1]] = operands[2];
+            }
+            else if (opcode == kOpVariable)
+            {
+                storage_classes_[operands[1]] = operands[2];
+            }
+            else if (opcode == kOpFunction)
+            {
+                entry_offset_ = offset + count;
+            }
+            else if (opcode == kOpLabel)
+            {
+                labels_[operands[0]] = offset;
+            }
+
+            offset += count;
+        }
+    }
+
+    uint32_t GetLocalSize() const { return local_size_; }
+
+    // Runs every invocation of a dispatch of group_count workgroups and returns the hashes buffer.
+    std::vector<uint32_t> Dispatch(const std::vector<uint32_t>& data, uint32_t word_count, uint32_t group_count)
+    {
+        data_        = &data;
+        word_count_  = word_count;
+        group_count_ = group_count;
+        hashes_.assign(group_count * local_size_, 0);
+
+        for (uint32_t id = 0; id < group_count * local_size_; ++id)
+        {
+            Invoke(id);
+        }
+
+        return hashes_;
+    }
+
+  private:
+    struct Pointer
+    {
+        uint32_t variable{ 0 };
+        uint32_t index{ 0 };
+    };
+
+    uint32_t GetValue(uint32_t id) const
+    {
+        auto constant = constants_.find(id);
+        if (constant != constants_.end())
+        {
+            return constant->second;
+        }
+
+        auto value = values_.find(id);
+        REQUIRE(value != values_.end());
+        return value->second;
+    }
+
+    uint32_t& GetStorage(const Pointer& pointer)
+    {
+        auto binding = bindings_.find(pointer.variable);
+        REQUIRE(binding != bindings_.end());
+        REQUIRE(binding->second == 1);
+        REQUIRE(pointer.index < hashes_.size());
+        return hashes_[pointer.index];
+    }
+
+    uint32_t Load(const Pointer& pointer) const
+    {
+        const uint32_t storage_class = storage_classes_.at(pointer.variable);
+        if (storage_class == kStorageClassPush)
+        {
+            return word_count_;
+        }
+
+        REQUIRE(bindings_.at(pointer.variable) == 0);
+        REQUIRE(pointer.index < word_count_);
+        return (*data_)[pointer.index];
+    }
+
+    void Invoke(uint32_t global_id)
+    {
+        values_.clear();
+        pointers_.clear();
+
+        uint32_t current_label  = 0;
+        uint32_t previous_label = 0;
+
+        for (size_t offset = entry_offset_; offset < words_.size();)
+        {
+            const uint32_t  opcode   = words_[offset] & 0xffff;
+            const uint32_t  count    = words_[offset] >> 16;
+            const uint32_t* operands = &words_[offset + 1];
+            size_t          next     = offset + count;
+
+            switch (opcode)
+            {
+                case kOpLabel:
+                    previous_label = current_label;
+                    current_label  = operands[0];
+                    break;
+                case kOpLoad:
+                {
+                    auto builtin = builtins_.find(operands[2]);
+                    if (builtin != builtins_.end())
+                    {
+                        REQUIRE(storage_classes_.at(operands[2]) == kStorageClassInput);
+
+                        // Only the x component of the vector built-ins is read by the shader.
+                        vectors_[operands[1]] = (builtin->second == kBuiltInGlobalId) ? global_id : group_count_;
+                        REQUIRE(((builtin->second == kBuiltInGlobalId) || (builtin->second == kBuiltInNumWorkgroups)));
+                    }
+                    else
+                    {
+                        values_[operands[1]] = Load(pointers_.at(operands[2]));
+                    }
+                    break;
+                }
+                case kOpStore:
+                    GetStorage(pointers_.at(operands[0])) = GetValue(operands[1]);
+                    break;
+                case kOpAccessChain:
+                {
+                    // The buffer blocks hold a single runtime array, so the last index selects the element.
+                    Pointer pointer;
+                    pointer.variable       = operands[2];
+                    pointer.index          = GetValue(operands[count - 2]);
+                    pointers_[operands[1]] = pointer;
+                    break;
+                }
+                case kOpCompositeExtract:
+                    REQUIRE(operands[3] == 0);
+                    values_[operands[1]] = vectors_.at(operands[2]);
+                    break;
+                case kOpIAdd:
+                    values_[operands[1]] = GetValue(operands[2]) + GetValue(operands[3]);
+                    break;
+                case kOpIMul:
+                    values_[operands[1]] = GetValue(operands[2]) * GetValue(operands[3]);
+                    break;
+                case kOpULessThan:
+                    values_[operands[1]] = (GetValue(operands[2]) < GetValue(operands[3])) ? 1 : 0;
+                    break;
+                case kOpShiftRightLogical:
+                    values_[operands[1]] = GetValue(operands[2]) >> GetValue(operands[3]);
+                    break;
+                case kOpShiftLeftLogical:
+                    values_[operands[1]] = GetValue(operands[2]) << GetValue(operands[3]);
+                    break;
+                case kOpBitwiseOr:
+                    values_[operands[1]] = GetValue(operands[2]) | GetValue(operands[3]);
+                    break;
+                case kOpBitwiseXor:
+                    values_[operands[1]] = GetValue(operands[2]) ^ GetValue(operands[3]);
+                    break;
+                case kOpPhi:
+                {
+                    bool found = false;
+                    for (uint32_t i = 2; (i + 1) < count; i += 2)
+                    {
+                        if (operands[i + 1] == previous_label)
+                        {
+                            // Phis of a block read the values from before the block was entered.
+                            phi_values_[operands[1]] = GetValue(operands[i]);
+                            found                    = true;
+                        }
+                    }
+                    REQUIRE(found);
+
+                    // Commit the phis once every phi at the start of the block has been evaluated.
+                    const uint32_t next_opcode = words_[next] & 0xffff;
+                    if (next_opcode != kOpPhi)
+                    {
+                        for (const auto& phi : phi_values_)
+                        {
+                            values_[phi.first] = phi.second;
+                        }
+                        phi_values_.clear();
+                    }
+                    break;
+                }
+                case kOpLoopMerge:
+                    break;
+                case kOpBranch:
+                    next = labels_.at(operands[0]);
+                    break;
+                case kOpBranchConditional:
+                    next = labels_.at((GetValue(operands[0]) != 0) ? operands[1] : operands[2]);
+                    break;
+                case kOpReturn:
+                case kOpFunctionEnd:
+                    return;
+                default:
+                    FAIL("Unexpected SPIR-V opcode " << opcode);
+            }
+
+            offset = next;
+        }
+    }
+
+    std::vector<uint32_t>                  words_;
+    uint32_t                               local_size_{ 0 };
+    size_t                                 entry_offset_{ 0 };
+    std::unordered_map<uint32_t, uint32_t> builtins_;
+    std::unordered_map<uint32_t, uint32_t> bindings_;
+    std::unordered_map<uint32_t, uint32_t> constants_;
+    std::unordered_map<uint32_t, uint32_t> storage_classes_;
+    std::unordered_map<uint32_t, size_t>   labels_;
+
+    const std::vector<uint32_t>*           data_{ nullptr };
+    uint32_t                               word_count_{ 0 };
+    uint32_t                               group_count_{ 0 };
+    std::vector<uint32_t>                  hashes_;
+    std::unordered_map<uint32_t, uint32_t> values_;
+    std::unordered_map<uint32_t, uint32_t> vectors_;
+    std::unordered_map<uint32_t, uint32_t> phi_values_;
+    std::unordered_map<uint32_t, Pointer>  pointers_;
+};
+
+} // namespace
+
+TEST_CASE("DumpResourcesHasher - hash shader matches the CPU reference", "[dump_resources]")
+{
+    REQUIRE((g_dump_resources_hash_comp.size() % sizeof(uint32_t)) == 0);
+
+    HashShaderInterpreter interpreter(g_dump_resources_hash_comp.data(), g_dump_resources_hash_comp.size());
+    const uint32_t        local_size = interpreter.GetLocalSize();
+    REQUIRE(local_size > 0);
+
+    for (uint32_t group_count : { 16u, 3u })
+    {
+        const uint32_t lane_count = group_count * local_size;
+
+        for (uint32_t word_count : { 0u, 1u, 37u, lane_count - 1, (2 * lane_count) + 5 })
+        {
+            std::vector<uint32_t> data(word_count);
+            for (uint32_t i = 0; i < word_count; ++i)
+            {
+                data[i] = (i * 0x9e3779b9) ^ (i >> 3);
+            }
+
+            std::vector<uint32_t> expected(lane_count);
+            ComputeDumpResourcesHashLanes(data.data(), word_count, lane_count, expected.data());
+
+            const std::vector<uint32_t> hashes = interpreter.Dispatch(data, word_count, group_count);
+            REQUIRE(hashes == expected);
+        }
+    }
+}
+
+TEST_CASE("DumpResourcesHasher - hash depends on word positions", "[dump_resources]")
+{
+    const uint32_t        lane_count = 64;
+    std::vector<uint32_t> data       = { 1, 2, 3, 4 };
+    std::vector<uint32_t> swapped    = { 2, 1, 3, 4 };
+    std::vector<uint32_t> first(lane_count);
+    std::vector<uint32_t> second(lane_count);
+
+    ComputeDumpResourcesHashLanes(data.data(), 4, lane_count, first.data());
+    ComputeDumpResourcesHashLanes(swapped.data(), 4, lane_count, second.data());
+    REQUIRE(first != second);
+
+    // A trailing zero word changes the hash through the word count.
+    data.push_back(0);
+    ComputeDumpResourcesHashLanes(data.data(), 5, lane_count, second.data());
+    REQUIRE(first != second);
+}
@@ -0,0 +1,165 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include "decode/vulkan_rebind_allocator.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using gfxrecon::decode::VulkanRebindAllocator;
+
+namespace
+{
+
+const VkDeviceSize kPageSize = VulkanRebindAllocator::kMemoryPageSize;
+
+typedef std::vector<std::pair<VkDeviceSize, std::vector<uint8_t>>> ContentRuns;
+
+// Stores a page whose bytes are derived from the page index and the offset in the page.
+void AddPage(VulkanRebindAllocator::ContentPages* content_pages, VkDeviceSize page)
+{
+    auto& content = (*content_pages)[page];
+    content       = std::make_unique<uint8_t[]>(static_cast<size_t>(kPageSize));
+
+    for (size_t i = 0; i < kPageSize; ++i)
+    {
+        content[i] = static_cast<uint8_t>((page * 31) + i + 1);
+    }
+}
+
+uint8_t GetExpectedByte(const VulkanRebindAllocator::ContentPages& content_pages, VkDeviceSize offset)
+{
+    auto entry = content_pages.find(offset / kPageSize);
+    return (entry != content_pages.end()) ? entry->second[static_cast<size_t>(offset % kPageSize)] : 0;
+}
+
+ContentRuns GatherRuns(const VulkanRebindAllocator::ContentPages& content_pages,
+                       VkDeviceSize                               range_start,
+                       VkDeviceSize                               range_end,
+                       bool                                       fill_gaps)
+{
+    ContentRuns runs;
+    VulkanRebindAllocator::GatherOriginalContent(
+        content_pages,
+        range_start,
+        range_end,
+        fill_gaps,
+        [&runs](VkDeviceSize run_offset, const std::vector<uint8_t>& run_data) {
+            runs.emplace_back(run_offset, run_data);
+        });
+    return runs;
+}
+
+void CheckRun(const VulkanRebindAllocator::ContentPages& content_pages,
+              VkDeviceSize                               range_start,
+              const ContentRuns::value_type&             run)
+{
+    for (size_t i = 0; i < run.second.size(); ++i)
+    {
+        if (run.second[i] != GetExpectedByte(content_pages, range_start + run.first + i))
+        {
+            FAIL("Unexpected content at offset " << (run.first + i));
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("VulkanRebindAllocator - gathered content skips unwritten pages", "[rebind_allocator]")
+{
+    VulkanRebindAllocator::ContentPages content_pages;
+    AddPage(&content_pages, 1);
+    AddPage(&content_pages, 2);
+    AddPage(&content_pages, 4);
+
+    // The range starts and ends inside of pages, and the first page of the range was not written.
+    const VkDeviceSize range_start = 1000;
+    const VkDeviceSize range_end   = (4 * kPageSize) + 500;
+
+    const ContentRuns runs = GatherRuns(content_pages, range_start, range_end, false);
+    REQUIRE(runs.size() == 2);
+
+    REQUIRE(runs[0].first == (kPageSize - range_start));
+    REQUIRE(runs[0].second.size() == (2 * kPageSize));
+    CheckRun(content_pages, range_start, runs[0]);
+
+    REQUIRE(runs[1].first == ((4 * kPageSize) - range_start));
+    REQUIRE(runs[1].second.size() == 500);
+    CheckRun(content_pages, range_start, runs[1]);
+}
+
+TEST_CASE("VulkanRebindAllocator - gathered content with filled gaps is a single run", "[rebind_allocator]")
+{
+    VulkanRebindAllocator::ContentPages content_pages;
+    AddPage(&content_pages, 1);
+    AddPage(&content_pages, 3);
+
+    const VkDeviceSize range_start = 1000;
+    const VkDeviceSize range_end   = (4 * kPageSize) + 500;
+
+    const ContentRuns runs = GatherRuns(content_pages, range_start, range_end, true);
+    REQUIRE(runs.size() == 1);
+    REQUIRE(runs[0].first == 0);
+    REQUIRE(runs[0].second.size() == (range_end - range_start));
+    CheckRun(content_pages, range_start, runs[0]);
+
+    // The unwritten pages before, between, and after the written pages are zero-filled.
+    REQUIRE(runs[0].second.front() == 0);
+    REQUIRE(runs[0].second[static_cast<size_t>((2 * kPageSize) - range_start)] == 0);
+    REQUIRE(runs[0].second.back() == 0);
+}
+
+TEST_CASE("VulkanRebindAllocator - gathered content within a single page", "[rebind_allocator]")
+{
+    VulkanRebindAllocator::ContentPages content_pages;
+    AddPage(&content_pages, 2);
+
+    const VkDeviceSize range_start = (2 * kPageSize) + 100;
+    const VkDeviceSize range_end   = (2 * kPageSize) + 300;
+
+    for (bool fill_gaps : { false, true })
+    {
+        const ContentRuns runs = GatherRuns(content_pages, range_start, range_end, fill_gaps);
+        REQUIRE(runs.size() == 1);
+        REQUIRE(runs[0].first == 0);
+        REQUIRE(runs[0].second.size() == 200);
+        CheckRun(content_pages, range_start, runs[0]);
+    }
+}
+
+TEST_CASE("VulkanRebindAllocator - nothing is gathered from unwritten ranges", "[rebind_allocator]")
+{
+    VulkanRebindAllocator::ContentPages content_pages;
+    AddPage(&content_pages, 0);
+    AddPage(&content_pages, 5);
+
+    for (bool fill_gaps : { false, true })
+    {
+        REQUIRE(GatherRuns(content_pages, kPageSize + 10, (4 * kPageSize) + 10, fill_gaps).empty());
+        REQUIRE(GatherRuns(content_pages, 100, 100, fill_gaps).empty());
+    }
+}
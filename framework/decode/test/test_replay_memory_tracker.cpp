@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include "decode/replay_memory_tracker.h"
+#include "util/logging.h"
+
+using gfxrecon::decode::ReplayMemoryTracker;
+using gfxrecon::decode::ScopedReplayMemoryUsage;
+
+TEST_CASE("ReplayMemoryTracker - usage updates are ignored without an instance", "[memory_tracker]")
+{
+    REQUIRE(!ReplayMemoryTracker::IsEnabled());
+
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kFileBuffers, 1024);
+    ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kDumpResources, 1024);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(1));
+}
+
+TEST_CASE("ReplayMemoryTracker - soft limit counts only trimmable categories", "[memory_tracker]")
+{
+    ReplayMemoryTracker::CreateInstance(1000);
+    REQUIRE(ReplayMemoryTracker::IsEnabled());
+
+    REQUIRE(ReplayMemoryTracker::IsTrimmable(ReplayMemoryTracker::kDecodeArena));
+    REQUIRE(ReplayMemoryTracker::IsTrimmable(ReplayMemoryTracker::kFileBuffers));
+    REQUIRE(!ReplayMemoryTracker::IsTrimmable(ReplayMemoryTracker::kPreloadBuffers));
+    REQUIRE(!ReplayMemoryTracker::IsTrimmable(ReplayMemoryTracker::kObjectInfoTables));
+
+    // Memory that the file processor can't release never triggers a trim.
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kPreloadBuffers, 5000);
+    ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kObjectInfoTables, 5000);
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 600);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(1));
+
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kFileBuffers, 400);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(2));
+
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kFileBuffers, 401);
+    REQUIRE(ReplayMemoryTracker::EndFrame(3));
+
+    ReplayMemoryTracker::DestroyInstance();
+    REQUIRE(!ReplayMemoryTracker::IsEnabled());
+}
+
+TEST_CASE("ReplayMemoryTracker - soft limit is rechecked below the low-water mark", "[memory_tracker]")
+{
+    ReplayMemoryTracker::CreateInstance(1000);
+
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 2000);
+    REQUIRE(ReplayMemoryTracker::EndFrame(1));
+
+    // The working set grows back above the limit without the usage ending a frame at or below the low-water mark.
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 2000);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(2));
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 800);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(3));
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 1500);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(4));
+
+    // Ending a frame at the low-water mark, 3/4 of the limit, checks the limit again.
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 750);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(5));
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, 1500);
+    REQUIRE(ReplayMemoryTracker::EndFrame(6));
+
+    ReplayMemoryTracker::DestroyInstance();
+}
+
+TEST_CASE("ReplayMemoryTracker - no soft limit", "[memory_tracker]")
+{
+    ReplayMemoryTracker::CreateInstance(0);
+
+    ReplayMemoryTracker::SetUsage(ReplayMemoryTracker::kDecodeArena, UINT32_MAX);
+    REQUIRE(!ReplayMemoryTracker::EndFrame(1));
+
+    ReplayMemoryTracker::DestroyInstance();
+}
+
+TEST_CASE("ReplayMemoryTracker - scoped usage", "[memory_tracker]")
+{
+    ReplayMemoryTracker::CreateInstance(100);
+
+    {
+        ScopedReplayMemoryUsage usage(ReplayMemoryTracker::kDumpResources);
+        usage.Set(5000);
+        usage.Set(3000);
+
+        // Dump resources readbacks are not trimmable.
+        REQUIRE(!ReplayMemoryTracker::EndFrame(1));
+    }
+
+    // The scoped usage was removed, so the trimmable usage alone is compared with the limit.
+    ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kFileBuffers, 101);
+    REQUIRE(ReplayMemoryTracker::EndFrame(2));
+    ReplayMemoryTracker::RemoveUsage(ReplayMemoryTracker::kFileBuffers, 101);
+
+    ReplayMemoryTracker::DestroyInstance();
+}
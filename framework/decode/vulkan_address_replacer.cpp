@@ -215,35 +215,45 @@ void VulkanAddressReplacer::ProcessCmdTraceRays(
         }
         std::unordered_set<VkBuffer> buffer_set;
 
-        auto address_remap = [&address_tracker, &buffer_set](VkStridedDeviceAddressRegionKHR* address_region) {
+        // gather addresses of all non-empty regions and translate them in a single batch
+        constexpr uint32_t               num_regions          = 4;
+        VkStridedDeviceAddressRegionKHR* regions[num_regions] = { raygen_sbt, miss_sbt, hit_sbt, callable_sbt };
+        VkDeviceAddress                  addresses[num_regions];
+        const VulkanBufferInfo*          buffer_infos[num_regions];
+        uint32_t                         num_addresses = 0;
+
+        for (auto* address_region : regions)
+        {
             if (address_region->size > 0)
             {
-                auto buffer_info = address_tracker.GetBufferByCaptureDeviceAddress(address_region->deviceAddress);
+                addresses[num_addresses++] = address_region->deviceAddress;
+            }
+        }
+
+        // in-place remap: capture-addresses -> replay-addresses
+        address_tracker.TranslateCaptureDeviceAddresses(addresses, num_addresses, buffer_infos);
+
+        for (uint32_t i = 0, j = 0; i < num_regions; ++i)
+        {
+            if (regions[i]->size > 0)
+            {
+                const VulkanBufferInfo* buffer_info = buffer_infos[j];
                 GFXRECON_ASSERT(buffer_info != nullptr);
 
-                if (buffer_info->replay_address != 0)
+                if (buffer_info != nullptr && buffer_info->replay_address != 0)
                 {
                     // keep track of used handles
                     buffer_set.insert(buffer_info->handle);
-
-                    uint64_t offset = address_region->deviceAddress - buffer_info->capture_address;
-
-                    // in-place address-remap
-                    address_region->deviceAddress = buffer_info->replay_address + offset;
+                    regions[i]->deviceAddress = addresses[j];
                 }
                 else
                 {
                     GFXRECON_LOG_INFO_ONCE(
                         "VulkanAddressReplacer::ProcessCmdTraceRays: missing buffer_info->replay_address, remap failed")
                 }
+                ++j;
             }
-        };
-
-        // in-place remap: capture-addresses -> replay-addresses
-        address_remap(raygen_sbt);
-        address_remap(miss_sbt);
-        address_remap(hit_sbt);
-        address_remap(callable_sbt);
+        }
 
         // prepare linear hashmap
         hashmap_sbt_.clear();
@@ -412,28 +422,14 @@ void VulkanAddressReplacer::ProcessCmdBuildAccelerationStructuresKHR(
     // TODO: testing only -> remove when closing issue #1526
     constexpr bool force_replace = false;
 
-    std::unordered_set<VkBuffer> buffer_set;
-    auto                         address_remap = [&address_tracker, &buffer_set](VkDeviceAddress& capture_address) {
-        auto buffer_info = address_tracker.GetBufferByCaptureDeviceAddress(capture_address);
-
-        if (buffer_info != nullptr && buffer_info->replay_address != 0)
-        {
-            // keep track of used handles
-            buffer_set.insert(buffer_info->handle);
-
-            uint64_t offset = capture_address - buffer_info->capture_address;
-
-            // in-place address-remap via const-cast
-            capture_address = buffer_info->replay_address + offset;
-        }
-        else
-        {
-            GFXRECON_LOG_WARNING(
-                "ProcessCmdBuildAccelerationStructuresKHR: missing buffer_info->replay_address, remap failed");
-        }
+    // collect all addresses referenced by the build-infos, to remap them with a single batched lookup
+    std::vector<VkDeviceAddress*> build_addresses;
+    auto                          address_remap = [&build_addresses](VkDeviceAddress& capture_address) {
+        build_addresses.push_back(&capture_address);
     };
 
-    std::vector<VkDeviceAddress> addresses_to_replace;
+    // instance-data addresses and primitive-counts, used after the remap to locate acceleration-structure references
+    std::vector<std::pair<const VkDeviceAddress*, uint32_t>> instance_data;
 
     for (uint32_t i = 0; i < info_count; ++i)
     {
@@ -467,15 +463,7 @@ void VulkanAddressReplacer::ProcessCmdBuildAccelerationStructuresKHR(
                 {
                     auto& instances = geometry->geometry.instances;
                     address_remap(instances.data.deviceAddress);
-
-                    // replace VkAccelerationStructureInstanceKHR::accelerationStructureReference inside buffer
-                    for (uint32_t k = 0; k < range_info->primitiveCount; ++k)
-                    {
-                        VkDeviceAddress accel_structure_reference =
-                            instances.data.deviceAddress + k * sizeof(VkAccelerationStructureInstanceKHR) +
-                            offsetof(VkAccelerationStructureInstanceKHR, accelerationStructureReference);
-                        addresses_to_replace.push_back(accel_structure_reference);
-                    }
+                    instance_data.emplace_back(&instances.data.deviceAddress, range_info->primitiveCount);
                     break;
                 }
                 default:
@@ -487,6 +475,54 @@ void VulkanAddressReplacer::ProcessCmdBuildAccelerationStructuresKHR(
         }
     }
 
+    std::unordered_set<VkBuffer> buffer_set;
+
+    if (!build_addresses.empty())
+    {
+        std::vector<VkDeviceAddress>         addresses(build_addresses.size());
+        std::vector<const VulkanBufferInfo*> buffer_infos(build_addresses.size());
+
+        for (size_t i = 0; i < build_addresses.size(); ++i)
+        {
+            addresses[i] = *build_addresses[i];
+        }
+
+        address_tracker.TranslateCaptureDeviceAddresses(addresses.data(), addresses.size(), buffer_infos.data());
+
+        for (size_t i = 0; i < build_addresses.size(); ++i)
+        {
+            const VulkanBufferInfo* buffer_info = buffer_infos[i];
+
+            if (buffer_info != nullptr && buffer_info->replay_address != 0)
+            {
+                // keep track of used handles
+                buffer_set.insert(buffer_info->handle);
+
+                // in-place address-remap via const-cast
+                *build_addresses[i] = addresses[i];
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING(
+                    "ProcessCmdBuildAccelerationStructuresKHR: missing buffer_info->replay_address, remap failed");
+            }
+        }
+    }
+
+    std::vector<VkDeviceAddress> addresses_to_replace;
+
+    for (const auto& [instance_data_address, primitive_count] : instance_data)
+    {
+        // replace VkAccelerationStructureInstanceKHR::accelerationStructureReference inside buffer
+        for (uint32_t k = 0; k < primitive_count; ++k)
+        {
+            VkDeviceAddress accel_structure_reference =
+                *instance_data_address + k * sizeof(VkAccelerationStructureInstanceKHR) +
+                offsetof(VkAccelerationStructureInstanceKHR, accelerationStructureReference);
+            addresses_to_replace.push_back(accel_structure_reference);
+        }
+    }
+
     if (!addresses_to_replace.empty())
     {
         // prepare linear hashmap
@@ -44,7 +44,8 @@ const GfxToCppPlatform GetGfxToCppPlatform(const std::string& format_str);
 const std::string      GfxToCppPlatformToString(GfxToCppPlatform platform);
 
 VulkanCppConsumerBase::VulkanCppConsumerBase() :
-    frame_file_(nullptr), global_file_(nullptr), main_file_(nullptr), pfn_loader_()
+    frame_file_(nullptr), global_file_(nullptr), main_file_(nullptr), pfn_loader_(),
+    frame_file_writer_(std::max(1u, std::thread::hardware_concurrency() / 2))
 {
     counters_[VK_OBJECT_TYPE_UNKNOWN] = 0;
 }
@@ -278,6 +279,8 @@ void VulkanCppConsumerBase::PrintOutGlobalVar()
                 break;
             case GfxToCppPlatform::PLATFORM_WIN32:
             {
+                fputs(sWin32MapDataPack, global_file);
+
                 int   size = snprintf(NULL, 0, sWin32OutputOverrideMethod, window_width_, window_height_);
                 char* formatted_output_override_method = new char[size + 2];
                 snprintf(formatted_output_override_method,
@@ -291,6 +294,8 @@ void VulkanCppConsumerBase::PrintOutGlobalVar()
             }
             case GfxToCppPlatform::PLATFORM_XCB:
             {
+                fputs(sCommonPosixMapDataPack, global_file);
+
                 int   size = snprintf(NULL, 0, sXcbOutputOverrideMethod, window_width_, window_height_);
                 char* formatted_output_override_method = new char[size + 2];
                 snprintf(formatted_output_override_method,
@@ -304,6 +309,8 @@ void VulkanCppConsumerBase::PrintOutGlobalVar()
             }
             case GfxToCppPlatform::PLATFORM_WAYLAND:
             {
+                fputs(sCommonPosixMapDataPack, global_file);
+
                 int   size = snprintf(NULL, 0, sWaylandOutputOverrideMethod, window_width_, window_height_);
                 char* formatted_output_override_method = new char[size + 2];
                 snprintf(formatted_output_override_method,
@@ -453,6 +460,15 @@ void VulkanCppConsumerBase::Destroy()
 {
     EndFrameFile(frame_number_, frame_split_number_);
 
+    for (auto& pending_frame_file : pending_frame_files_)
+    {
+        pending_frame_file.wait();
+    }
+    pending_frame_files_.clear();
+
+    data_packer_.Flush();
+    spv_saver_.Flush();
+
     if (main_file_ != nullptr)
     {
         PrintOutGlobalVar();
@@ -487,6 +503,10 @@ void VulkanCppConsumerBase::NewFrameFile(uint32_t frameNumber, uint32_t frameSpl
         exit(-1);
     }
 
+    // Frame source is buffered in memory until the file is closed, so the file I/O for a frame is performed by the
+    // thread that closes it.
+    setvbuf(frame_file_, nullptr, _IOFBF, kFrameFileBufferSize);
+
     fprintf(frame_file_, "%s\n", sCommonFrameSourceHeader);
 
     std::string frameFunctionName = "void " + new_frame_filename + "()";
@@ -500,7 +520,10 @@ void VulkanCppConsumerBase::EndFrameFile(uint32_t frameNumber, uint32_t frameSpl
 
     // Write out closing data for previous frame file.
     fprintf(frame_file_, "%s", sCommonFrameSourceFooter);
-    util::platform::FileClose(frame_file_);
+
+    FILE* completed_frame_file = frame_file_;
+    pending_frame_files_.push_back(
+        frame_file_writer_.post([completed_frame_file]() { util::platform::FileClose(completed_frame_file); }));
     frame_file_ = nullptr;
 
     // The 'struct tracking' mechanism's restricted for every frame call.
@@ -29,6 +29,7 @@
 #include "vulkan/vulkan.h"
 
 #include <cstdio>
+#include <future>
 #include <string>
 #include <sstream>
 #include <type_traits>
@@ -36,6 +37,7 @@
 #include <queue>
 
 #include "decode/vulkan_cpp_util_datapack.h"
+#include "util/threadpool.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -740,6 +742,8 @@ class VulkanCppConsumerBase : public VulkanConsumer
         size_t      size;
     };
 
+    static constexpr size_t kFrameFileBufferSize = 4 * 1024 * 1024;
+
     bool                                               enable_virtual_swapchain_{ true };
     uint32_t                                           frame_number_;
     uint32_t                                           frame_split_number_;
@@ -759,6 +763,10 @@ class VulkanCppConsumerBase : public VulkanConsumer
     DataFilePacker                                     spv_saver_;
     std::vector<std::vector<format::DeviceMemoryType>> original_memory_types_;
     std::vector<std::vector<format::DeviceMemoryHeap>> original_memory_heaps_;
+
+    // Completed frame files are flushed and closed by worker threads while the next frame is generated.
+    util::ThreadPool               frame_file_writer_;
+    std::vector<std::future<void>> pending_frame_files_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -133,6 +133,61 @@ uint32_t RecalculateMemoryTypeIndex(uint32_t originalMemoryTypeIndex) {
 }
 )";
 
+static const char* sCommonPosixMapDataPack = R"(
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+// Data pack files are mapped into memory on first use and stay mapped until the application exits, so loading
+// resource data is a copy from the mapping instead of an open, seek and read of the file.
+static const uint8_t* MapDataPack(const char* filename, size_t required_size)
+{
+    static std::unordered_map<std::string, std::pair<const uint8_t*, size_t>> mapped_packs;
+
+    auto entry = mapped_packs.find(filename);
+    if (entry == mapped_packs.end())
+    {
+        int fd = open(filename, O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0)
+        {
+            close(fd);
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        size_t file_size = static_cast<size_t>(file_stat.st_size);
+        void*  data      = nullptr;
+        if (file_size > 0)
+        {
+            data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        entry = mapped_packs.emplace(filename, std::make_pair(static_cast<const uint8_t*>(data), file_size)).first;
+    }
+
+    if (required_size > entry->second.second)
+    {
+        throw std::runtime_error("Error while reading file: " + std::string(filename));
+    }
+
+    return entry->second.first;
+}
+)";
+
 static const char* sCommonLogVkError = R"(
 void LogVkError(const char* function,
                 VkResult returnValue,
@@ -293,20 +348,9 @@ size_t LoadBinaryData(const char* filename,
                       struct XCBApp& appdata) {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr) {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
-    }
-
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t*)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size) {
-        fclose(fp);
-        throw std::runtime_error("Error while reading file: " + std::string(filename));
-    }
-
-    fclose(fp);
-    return read_size;
+    const uint8_t* data = MapDataPack(filename, file_offset + data_size);
+    memcpy((uint8_t*)buffer + offset, data + file_offset, data_size);
+    return data_size;
 }
 
 XCBApp appdata(%d, %d);
@@ -557,22 +601,9 @@ size_t LoadBinaryData(const char* filename,
 {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr)
-    {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
-    }
-
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t *)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size)
-    {
-        fclose(fp);
-        throw std::runtime_error("Error while reading file: " + std::string(filename));
-    }
-
-    fclose(fp);
-    return read_size;
+    const uint8_t* data = MapDataPack(filename, file_offset + data_size);
+    memcpy((uint8_t*)buffer + offset, data + file_offset, data_size);
+    return data_size;
 }
 
 WaylandApp appdata(%d, %d);
@@ -944,6 +975,63 @@ extern size_t LoadBinaryData(const char* filename,
                              struct Win32App& appdata);
 )";
 
+static const char* sWin32MapDataPack = R"(
+#include <string>
+#include <utility>
+
+// Data pack files are mapped into memory on first use and stay mapped until the application exits, so loading
+// resource data is a copy from the mapping instead of an open, seek and read of the file.
+static const uint8_t* MapDataPack(const char* filename, size_t required_size)
+{
+    static std::unordered_map<std::string, std::pair<const uint8_t*, size_t>> mapped_packs;
+
+    auto entry = mapped_packs.find(filename);
+    if (entry == mapped_packs.end())
+    {
+        HANDLE file = CreateFileA(
+            filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            CloseHandle(file);
+            throw std::runtime_error("Error while opening file: " + std::string(filename));
+        }
+
+        const uint8_t* data = nullptr;
+        if (file_size.QuadPart > 0)
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+
+        if ((file_size.QuadPart > 0) && (data == nullptr))
+        {
+            throw std::runtime_error("Error while mapping file: " + std::string(filename));
+        }
+
+        entry =
+            mapped_packs.emplace(filename, std::make_pair(data, static_cast<size_t>(file_size.QuadPart))).first;
+    }
+
+    if (required_size > entry->second.second)
+    {
+        throw std::runtime_error("Error while reading file: " + std::string(filename));
+    }
+
+    return entry->second.first;
+}
+)";
+
 static const char* sWin32OutputOverrideMethod = R"(
 void OverrideVkWin32SurfaceCreateInfoKHR(VkWin32SurfaceCreateInfoKHR* createInfo,
                                          struct Win32App& appdata)
@@ -988,20 +1076,9 @@ size_t LoadBinaryData(const char* filename,
 {
     (void)appdata; // Unused
 
-    FILE* fp = fopen(filename, "rb");
-    if (fp == nullptr) {
-        throw std::runtime_error("Error while opening file: " + std::string(filename));
-    }
-
-    fseek(fp, file_offset, SEEK_SET);
-    size_t read_size = fread((uint8_t*)buffer + offset, sizeof(uint8_t), data_size, fp);
-    if (read_size != data_size) {
-        fclose(fp);
-        throw std::runtime_error("Error while reading file: " + std::string(filename));
-    }
-
-    fclose(fp);
-    return read_size;
+    const uint8_t* data = MapDataPack(filename, file_offset + data_size);
+    memcpy((uint8_t*)buffer + offset, data + file_offset, data_size);
+    return data_size;
 }
 
 Win32App appdata(%d, %d);
@@ -15,17 +15,24 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <functional>
 
 #include "decode/vulkan_cpp_util_datapack.h"
 
 #include "util/hash.h"
 #include "util/file_path.h"
+#include "util/logging.h"
 #include "util/platform.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+DataFilePacker::~DataFilePacker()
+{
+    Flush();
+}
+
 void DataFilePacker::Initialize(const std::string& outDir,
                                 const std::string& prefix,
                                 const std::string& suffix,
@@ -56,8 +63,16 @@ const SavedFileInfo DataFilePacker::AddFileContents(const uint8_t* data, const s
         data_entry.file_path   = current_data_file_.file_path;
         data_entry.byte_offset = current_data_file_.current_size;
 
-        WriteContentsToFile(
-            util::filepath::Join(out_dir_, data_entry.file_path), data_entry.byte_offset, dataSize, data);
+        // The data is copied, as the caller's buffer is only valid until this function returns.
+        auto        contents  = std::make_shared<std::vector<uint8_t>>(data, data + dataSize);
+        std::string file_path = util::filepath::Join(out_dir_, data_entry.file_path);
+
+        WaitForPendingWrites(kMaxPendingWriteSize - std::min(dataSize, kMaxPendingWriteSize));
+        CheckWriteFailure();
+
+        pending_writes_.push_back(
+            { writer_.post([this, file_path, contents]() { WriteContentsToFile(file_path, *contents); }), dataSize });
+        pending_write_size_ += dataSize;
 
         current_data_file_.current_size += dataSize;
     }
@@ -65,33 +80,77 @@ const SavedFileInfo DataFilePacker::AddFileContents(const uint8_t* data, const s
     return data_entry;
 }
 
-void DataFilePacker::NewTargetFile(void)
+void DataFilePacker::Flush()
 {
-    current_data_file_ = SavedFile{ prefix_ + std::to_string(++data_file_counter_) + "." + suffix_, 0 };
+    WaitForPendingWrites(0);
+
+    if (write_file_ != nullptr)
+    {
+        util::platform::FileClose(write_file_);
+        write_file_ = nullptr;
+        write_file_path_.clear();
+    }
+
+    CheckWriteFailure();
 }
 
-void DataFilePacker::WriteContentsToFile(const std::string& file_path,
-                                         uint64_t           fileOffset,
-                                         uint64_t           size,
-                                         const uint8_t*     data)
+void DataFilePacker::WaitForPendingWrites(size_t maxPendingSize)
 {
-    FILE*   fp     = nullptr;
-    int32_t result = util::platform::FileOpen(&fp, file_path.c_str(), "ab");
+    while (!pending_writes_.empty() && (pending_write_size_ > maxPendingSize))
+    {
+        PendingWrite& pending_write = pending_writes_.front();
+        pending_write.result.wait();
+        pending_write_size_ -= pending_write.size;
+        pending_writes_.pop_front();
+    }
+}
 
-    if (result != 0)
+void DataFilePacker::CheckWriteFailure()
+{
+    if (write_failed_)
     {
-        fprintf(stderr, "Error while opening file: %s\n", file_path.c_str());
-        return;
+        GFXRECON_LOG_FATAL("Failed to write data pack files to %s", out_dir_.c_str());
+        exit(-1);
     }
+}
 
-    util::platform::FileSeek(fp, fileOffset, util::platform::FileSeekCurrent);
+void DataFilePacker::NewTargetFile(void)
+{
+    current_data_file_ = SavedFile{ prefix_ + std::to_string(++data_file_counter_) + "." + suffix_, 0 };
+}
 
-    if (!util::platform::FileWrite(data, size, fp))
+void DataFilePacker::WriteContentsToFile(const std::string& file_path, const std::vector<uint8_t>& data)
+{
+    // Called from the writer thread.  Data for a file is always appended in offset order, so the file is kept open
+    // until data for the next file arrives.  A file that failed to open is not opened again, as reopening it would
+    // truncate it and write the following data at the wrong offsets.
+    if (file_path != write_file_path_)
     {
-        fprintf(stderr, "Error while saving data into %s\n", file_path.c_str());
+        if (write_file_ != nullptr)
+        {
+            util::platform::FileClose(write_file_);
+            write_file_ = nullptr;
+        }
+
+        write_file_path_ = file_path;
+
+        int32_t result = util::platform::FileOpen(&write_file_, file_path.c_str(), "wb");
+        if ((result != 0) || (write_file_ == nullptr))
+        {
+            GFXRECON_LOG_ERROR("Error while opening file: %s", file_path.c_str());
+            write_file_   = nullptr;
+            write_failed_ = true;
+        }
     }
 
-    util::platform::FileClose(fp);
+    if (write_file_ != nullptr)
+    {
+        if (!util::platform::FileWrite(data.data(), data.size(), write_file_))
+        {
+            GFXRECON_LOG_ERROR("Error while saving data into %s", file_path.c_str());
+            write_failed_ = true;
+        }
+    }
 }
 
 GFXRECON_END_NAMESPACE(decode)
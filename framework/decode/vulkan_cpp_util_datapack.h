@@ -18,10 +18,17 @@
 #ifndef GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 #define GFXRECON_DECODE_VULKAN_CPP_UTIL_DATAPACK_H
 
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 #include "util/defines.h"
+#include "util/threadpool.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -32,10 +39,16 @@ struct SavedFileInfo
     uint64_t    byte_offset;
 };
 
+// Packs binary data into files of a limited size.  File offsets are assigned immediately, while the data is written
+// by a background thread so that code generation does not wait for file I/O.
 class DataFilePacker
 {
   public:
-    DataFilePacker() : data_file_counter_(0) {}
+    DataFilePacker() :
+        data_file_counter_(0), writer_(1), write_file_(nullptr), pending_write_size_(0), write_failed_(false)
+    {}
+
+    ~DataFilePacker();
 
     void                Initialize(const std::string& outDir,
                                    const std::string& prefix,
@@ -43,9 +56,24 @@ class DataFilePacker
                                    uint32_t           sizeLimitInBytes);
     const SavedFileInfo AddFileContents(const uint8_t* data, const size_t dataSize);
 
+    // Waits for all pending writes to complete and closes the current file.  Exits the process if any of the writes
+    // failed, as the offsets of the data in the generated code would no longer be valid.
+    void Flush();
+
   private:
+    // Limit on the size of the data copies waiting to be written.
+    static constexpr size_t kMaxPendingWriteSize = 256 * 1024 * 1024;
+
+    struct PendingWrite
+    {
+        std::future<void> result;
+        size_t            size;
+    };
+
     void NewTargetFile(void);
-    void WriteContentsToFile(const std::string& filePath, uint64_t fileOffset, uint64_t size, const uint8_t* data);
+    void WriteContentsToFile(const std::string& filePath, const std::vector<uint8_t>& data);
+    void WaitForPendingWrites(size_t maxPendingSize);
+    void CheckWriteFailure();
 
     struct SavedFile
     {
@@ -61,6 +89,14 @@ class DataFilePacker
 
     std::unordered_map<uint64_t, SavedFileInfo> data_file_map_;
     SavedFile                                   current_data_file_;
+
+    // Writes are performed in order by a single thread, which keeps the file that is being filled open.
+    util::ThreadPool         writer_;
+    std::string              write_file_path_;
+    FILE*                    write_file_;
+    std::deque<PendingWrite> pending_writes_;
+    size_t                   pending_write_size_;
+    std::atomic<bool>        write_failed_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
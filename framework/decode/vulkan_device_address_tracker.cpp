@@ -22,6 +22,10 @@
 */
 
 #include "decode/vulkan_device_address_tracker.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -34,7 +38,20 @@ void decode::VulkanDeviceAddressTracker::TrackBuffer(const decode::VulkanBufferI
 {
     if (buffer_info != nullptr && buffer_info->capture_address != 0)
     {
-        _buffer_capture_addresses[buffer_info->capture_address] = buffer_info->capture_id;
+        // keep the flat lookup-arrays sorted by inserting at the lower bound
+        auto   address_it = std::lower_bound(
+            _sorted_buffer_addresses.begin(), _sorted_buffer_addresses.end(), buffer_info->capture_address);
+        size_t index      = static_cast<size_t>(address_it - _sorted_buffer_addresses.begin());
+
+        if (address_it != _sorted_buffer_addresses.end() && *address_it == buffer_info->capture_address)
+        {
+            _sorted_buffer_handles[index] = buffer_info->capture_id;
+        }
+        else
+        {
+            _sorted_buffer_addresses.insert(address_it, buffer_info->capture_address);
+            _sorted_buffer_handles.insert(_sorted_buffer_handles.begin() + index, buffer_info->capture_id);
+        }
     }
 }
 
@@ -42,7 +59,15 @@ void VulkanDeviceAddressTracker::RemoveBuffer(const VulkanBufferInfo* buffer_inf
 {
     if (buffer_info != nullptr)
     {
-        _buffer_capture_addresses.erase(buffer_info->capture_address);
+        auto address_it = std::lower_bound(
+            _sorted_buffer_addresses.begin(), _sorted_buffer_addresses.end(), buffer_info->capture_address);
+
+        if (address_it != _sorted_buffer_addresses.end() && *address_it == buffer_info->capture_address)
+        {
+            size_t index = static_cast<size_t>(address_it - _sorted_buffer_addresses.begin());
+            _sorted_buffer_addresses.erase(address_it);
+            _sorted_buffer_handles.erase(_sorted_buffer_handles.begin() + index);
+        }
     }
 }
 
@@ -68,32 +93,80 @@ void VulkanDeviceAddressTracker::RemoveAccelerationStructure(
 const decode::VulkanBufferInfo*
 decode::VulkanDeviceAddressTracker::GetBufferByCaptureDeviceAddress(VkDeviceAddress capture_address) const
 {
-    return GetBufferInfo(capture_address, _buffer_capture_addresses);
+    return GetBufferInfo(capture_address);
 }
 
-const VulkanBufferInfo*
-VulkanDeviceAddressTracker::GetBufferInfo(VkDeviceAddress                                         device_address,
-                                          const VulkanDeviceAddressTracker::buffer_address_map_t& address_map) const
+size_t VulkanDeviceAddressTracker::TranslateCaptureDeviceAddresses(VkDeviceAddress*         addresses,
+                                                                   size_t                   count,
+                                                                   const VulkanBufferInfo** buffer_infos) const
 {
-    if (!address_map.empty())
+    GFXRECON_ASSERT(addresses != nullptr || count == 0);
+
+    size_t                  num_translated = 0;
+    const VulkanBufferInfo* last_buffer    = nullptr;
+
+    for (size_t i = 0; i < count; ++i)
     {
-        // find first address equal or greater
-        auto address_it = address_map.lower_bound(device_address);
+        VkDeviceAddress         capture_address = addresses[i];
+        const VulkanBufferInfo* found_buffer    = nullptr;
 
-        if (address_it == address_map.end() || address_it->first > device_address)
+        // consecutive addresses frequently point into the same buffer, skip the search in that case
+        if (last_buffer != nullptr && capture_address >= last_buffer->capture_address &&
+            capture_address < last_buffer->capture_address + last_buffer->size)
         {
-            // not found
-            if (address_it == address_map.begin())
-            {
-                return nullptr;
-            }
+            found_buffer = last_buffer;
+        }
+        else if (capture_address != 0)
+        {
+            found_buffer = GetBufferInfo(capture_address);
+            last_buffer  = found_buffer;
+        }
+
+        if (found_buffer != nullptr && found_buffer->replay_address != 0)
+        {
+            addresses[i] = found_buffer->replay_address + (capture_address - found_buffer->capture_address);
+            ++num_translated;
+        }
 
-            // decrement iterator, now pointing to the first VkDeviceAddress that is lower than device_address
-            address_it--;
+        if (buffer_infos != nullptr)
+        {
+            buffer_infos[i] = found_buffer;
         }
+    }
+    return num_translated;
+}
+
+size_t VulkanDeviceAddressTracker::FindSortedBufferIndex(VkDeviceAddress device_address) const
+{
+    const size_t num_addresses = _sorted_buffer_addresses.size();
+
+    if (num_addresses == 0 || device_address < _sorted_buffer_addresses.front())
+    {
+        return SIZE_MAX;
+    }
+
+    // branchless binary search, the loop-body compiles to a conditional move and the trip-count only depends on size
+    const VkDeviceAddress* base = _sorted_buffer_addresses.data();
+    size_t                 n    = num_addresses;
+
+    while (n > 1)
+    {
+        const size_t half = n / 2;
+        base              = (base[half] <= device_address) ? base + half : base;
+        n -= half;
+    }
+    return static_cast<size_t>(base - _sorted_buffer_addresses.data());
+}
+
+const VulkanBufferInfo* VulkanDeviceAddressTracker::GetBufferInfo(VkDeviceAddress device_address) const
+{
+    size_t index = FindSortedBufferIndex(device_address);
+
+    if (index != SIZE_MAX)
+    {
         // found_address is lower or equal to device_address
-        const auto& [found_address, buffer_handle] = *address_it;
-        const VulkanBufferInfo* found_buffer       = _object_info_table.GetVkBufferInfo(buffer_handle);
+        VkDeviceAddress         found_address = _sorted_buffer_addresses[index];
+        const VulkanBufferInfo* found_buffer  = _object_info_table.GetVkBufferInfo(_sorted_buffer_handles[index]);
 
         if (found_buffer != nullptr)
         {
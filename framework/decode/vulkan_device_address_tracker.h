@@ -26,7 +26,7 @@
 
 #include "decode/vulkan_object_info.h"
 #include "vulkan_object_info_table.h"
-#include <map>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -81,6 +81,22 @@ class VulkanDeviceAddressTracker
      */
     [[nodiscard]] const VulkanBufferInfo* GetBufferByCaptureDeviceAddress(VkDeviceAddress capture_address) const;
 
+    /**
+     * @brief   Translate an array of capture-time VkDeviceAddresses to replay-time VkDeviceAddresses in one call.
+     *
+     * Addresses that do not point inside a tracked buffer, or that point inside a buffer without a replay-time
+     * address, are left unchanged.
+     *
+     * @param   addresses       an array of capture-time VkDeviceAddresses, which are replaced in-place.
+     * @param   count           the number of addresses in the array.
+     * @param   buffer_infos    optional array of count elements, receiving the buffer found for each address, or
+     *                          nullptr for addresses outside of all tracked buffers.
+     * @return  the number of addresses that were translated.
+     */
+    size_t TranslateCaptureDeviceAddresses(VkDeviceAddress*         addresses,
+                                           size_t                   count,
+                                           const VulkanBufferInfo** buffer_infos = nullptr) const;
+
     /**
      * @brief   Retrieve an acceleration-structure by providing a capture-time VkDeviceAddress.
      *
@@ -98,15 +114,18 @@ class VulkanDeviceAddressTracker
     [[nodiscard]] std::unordered_map<VkDeviceAddress, VkDeviceAddress> GetAccelerationStructureDeviceAddressMap() const;
 
   private:
-    //! use a sorted (BST-based) map
-    using buffer_address_map_t = std::map<VkDeviceAddress, format::HandleId>;
+    //! return the index of the last sorted buffer-address that is lower or equal to device_address, or SIZE_MAX
+    [[nodiscard]] size_t FindSortedBufferIndex(VkDeviceAddress device_address) const;
 
-    [[nodiscard]] const VulkanBufferInfo* GetBufferInfo(VkDeviceAddress             device_address,
-                                                        const buffer_address_map_t& address_map) const;
+    [[nodiscard]] const VulkanBufferInfo* GetBufferInfo(VkDeviceAddress device_address) const;
 
     const VulkanObjectInfoTable&                          _object_info_table;
-    buffer_address_map_t                                  _buffer_capture_addresses;
     std::unordered_map<VkDeviceAddress, format::HandleId> _acceleration_structure_capture_addresses;
+
+    //! buffer-addresses sorted in ascending order and their associated handle ids, kept sorted on insert and removal.
+    //! lookups use a branchless binary search over contiguous memory
+    std::vector<VkDeviceAddress>  _sorted_buffer_addresses;
+    std::vector<format::HandleId> _sorted_buffer_handles;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -214,7 +214,6 @@ struct VulkanPoolObjectInfo : public VulkanObjectInfo<T>
 //
 
 typedef VulkanObjectInfo<VkEvent>                              VulkanEventInfo;
-typedef VulkanObjectInfo<VkQueryPool>                          VulkanQueryPoolInfo;
 typedef VulkanObjectInfo<VkPipelineLayout>                     VulkanPipelineLayoutInfo;
 typedef VulkanObjectInfo<VkPrivateDataSlot>                    VulkanPrivateDataSlotInfo;
 typedef VulkanObjectInfo<VkSampler>                            VulkanSamplerInfo;
@@ -343,6 +342,14 @@ struct VulkanSemaphoreInfo : public VulkanObjectInfo<VkSemaphore>
     // If a semaphore is signaled with vkAcquireNextImage and also VkSubmitInfo, then the semaphore needs to be shadow
     // signaled with vkAcquireNextImage and regularly signaled with VkSubmitInfo
     bool signaled{ false };
+
+    VkSemaphoreType type{ VK_SEMAPHORE_TYPE_BINARY };
+};
+
+struct VulkanQueryPoolInfo : public VulkanObjectInfo<VkQueryPool>
+{
+    VkQueryType type{ VK_QUERY_TYPE_OCCLUSION };
+    uint32_t    query_count{ 0 };
 };
 
 struct VulkanFenceInfo : public VulkanObjectInfo<VkFence>
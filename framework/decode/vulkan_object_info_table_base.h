@@ -24,6 +24,7 @@
 #ifndef GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 #define GFXRECON_DECODE_VULKAN_OBJECT_MAPPER_BASE_H
 
+#include "decode/replay_memory_tracker.h"
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
@@ -119,6 +120,14 @@ struct ObjectInfoGetter<VulkanPhysicalDeviceInfo> : public ObjectInfoGetterBase
 class VulkanObjectInfoTableBase
 {
   protected:
+    // Approximate size of a map entry for replay memory tracking: the node value plus the node link and bucket
+    // pointers.  Memory owned by members of the info structure is not included.
+    template <typename T>
+    static constexpr uint64_t GetObjectInfoEntrySize()
+    {
+        return sizeof(typename std::unordered_map<format::HandleId, T>::value_type) + (2 * sizeof(void*));
+    }
+
     template <typename T>
     void AddVkObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
     {
@@ -135,7 +144,11 @@ class VulkanObjectInfoTableBase
         {
             auto result = map->emplace(info.capture_id, std::forward<T>(info));
 
-            if (!result.second)
+            if (result.second)
+            {
+                ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kObjectInfoTables, GetObjectInfoEntrySize<T>());
+            }
+            else
             {
                 // There are two expected cases where a capture ID would already be in the map. The first case is for
                 // handles that are retrieved, such as VkPhysicalDevice, which can be processed more than once. For
@@ -177,7 +190,12 @@ class VulkanObjectInfoTableBase
         {
             auto result = map->emplace(info.capture_id, std::forward<VulkanSurfaceKHRInfo>(info));
 
-            if (!result.second)
+            if (result.second)
+            {
+                ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kObjectInfoTables,
+                                              GetObjectInfoEntrySize<VulkanSurfaceKHRInfo>());
+            }
+            else
             {
                 // There are two expected cases where a capture ID would already be in the map. The first case is for
                 // handles that are retrieved, such as VkPhysicalDevice, which can be processed more than once. For
@@ -196,6 +214,17 @@ class VulkanObjectInfoTableBase
         }
     }
 
+    template <typename T>
+    void RemoveVkObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    {
+        assert(map != nullptr);
+
+        if (map->erase(id) > 0)
+        {
+            ReplayMemoryTracker::RemoveUsage(ReplayMemoryTracker::kObjectInfoTables, GetObjectInfoEntrySize<T>());
+        }
+    }
+
     template <typename T>
     const T* GetVkObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
     {
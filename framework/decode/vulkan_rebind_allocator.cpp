@@ -283,6 +283,7 @@ void VulkanRebindAllocator::DestroyBuffer(VkBuffer                     buffer,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_buffers.erase(buffer);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -346,6 +347,7 @@ void VulkanRebindAllocator::DestroyImage(VkImage                      image,
         if (memory_alloc_info != nullptr)
         {
             memory_alloc_info->original_images.erase(image);
+            RemoveBoundResource(memory_alloc_info, resource_alloc_info);
         }
 
         if (resource_alloc_info->mapped_pointer != nullptr)
@@ -414,6 +416,7 @@ void VulkanRebindAllocator::DestroyVideoSession(VkVideoSessionKHR            ses
             if (memory_alloc_info != nullptr)
             {
                 memory_alloc_info->original_sessions.erase(session);
+                RemoveBoundResource(memory_alloc_info, resource_alloc_info);
             }
 
             if (resource_alloc_info->allocation != VK_NULL_HANDLE)
@@ -595,17 +598,11 @@ VkResult VulkanRebindAllocator::BindBufferMemory(VkBuffer
                 }
 
                 memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
-                if (memory_alloc_info->original_content != nullptr)
-                {
-                    // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                    // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
-                }
+                // Memory may have been mapped and written prior to bind.  Copy the original content to the new
+                // allocation to ensure it contains the correct data.
+                WriteOriginalContent(resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -680,18 +677,12 @@ VkResult VulkanRebindAllocator::BindBufferMemory2(uint32_t
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
-                        {
-                            // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                            // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
-                        }
+                        // Memory may have been mapped and written prior to bind.  Copy the original content to the new
+                        // allocation to ensure it contains the correct data.
+                        WriteOriginalContent(resource_alloc_info);
 
                         memory_alloc_info->original_buffers.insert(std::make_pair(buffer, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -763,17 +754,11 @@ VkResult VulkanRebindAllocator::BindImageMemory(VkImage
                 }
 
                 memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                AddBoundResource(memory_alloc_info, resource_alloc_info);
 
-                if (memory_alloc_info->original_content != nullptr)
-                {
-                    // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                    // allocation to ensure it contains the correct data.
-                    WriteBoundResource(resource_alloc_info,
-                                       memory_offset,
-                                       0,
-                                       allocation_info.size,
-                                       memory_alloc_info->original_content.get());
-                }
+                // Memory may have been mapped and written prior to bind.  Copy the original content to the new
+                // allocation to ensure it contains the correct data.
+                WriteOriginalContent(resource_alloc_info);
 
                 (*bind_memory_properties) = property_flags;
             }
@@ -849,18 +834,12 @@ VkResult VulkanRebindAllocator::BindImageMemory2(uint32_t                     bi
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
-                        {
-                            // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                            // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               bind_info->memoryOffset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
-                        }
+                        // Memory may have been mapped and written prior to bind.  Copy the original content to the new
+                        // allocation to ensure it contains the correct data.
+                        WriteOriginalContent(resource_alloc_info);
 
                         memory_alloc_info->original_images.insert(std::make_pair(image, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[i] = property_flags;
                     }
@@ -1011,18 +990,12 @@ VkResult VulkanRebindAllocator::BindVideoSessionMemory(VkVideoSessionKHR
                             resource_alloc_info->is_host_visible = true;
                         }
 
-                        if (memory_alloc_info->original_content != nullptr)
-                        {
-                            // Memory has been mapped and written prior to bind.  Copy the original content to the new
-                            // allocation to ensure it contains the correct data.
-                            WriteBoundResource(resource_alloc_info,
-                                               src_offset,
-                                               0,
-                                               allocation_info.size,
-                                               memory_alloc_info->original_content.get());
-                        }
+                        // Memory may have been mapped and written prior to bind.  Copy the original content to the new
+                        // allocation to ensure it contains the correct data.
+                        WriteOriginalContent(resource_alloc_info);
 
                         memory_alloc_info->original_sessions.insert(std::make_pair(video_session, resource_alloc_info));
+                        AddBoundResource(memory_alloc_info, resource_alloc_info);
 
                         bind_memory_properties[mem_index] = property_flags;
                     }
@@ -1098,40 +1071,19 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
 
         if (memory_alloc_info->is_mapped)
         {
-            if (memory_alloc_info->original_content == nullptr)
-            {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, memory_alloc_info->allocation_size);
-                size_t allocation_size = static_cast<size_t>(memory_alloc_info->allocation_size);
-
-                memory_alloc_info->original_content = std::make_unique<uint8_t[]>(allocation_size);
-            }
+            VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
+            VkDeviceSize write_end   = write_start + size;
 
             // Update the reconstructed memory, which is written to memory allocations created at resource bind to
             // ensure they contain the correct data.
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-            size_t   copy_size = static_cast<size_t>(size);
-            uint8_t* copy_dst  = memory_alloc_info->original_content.get() + memory_alloc_info->mapped_offset + offset;
-
-            util::platform::MemoryCopy(copy_dst, copy_size, data, copy_size);
-
-            VkDeviceSize write_start = memory_alloc_info->mapped_offset + offset;
-            VkDeviceSize write_end   = write_start + size;
+            StoreOriginalContent(memory_alloc_info, write_start, static_cast<size_t>(size), data);
 
             // Copy to the resources that were bound to this range at capture.
-            for (const auto& entry : memory_alloc_info->original_buffers)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_images)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
-
-            for (const auto& entry : memory_alloc_info->original_sessions)
-            {
-                UpdateBoundResource(entry.second, write_start, write_end, data);
-            }
+            ForEachBoundResource(
+                memory_alloc_info, write_start, write_end, [&](ResourceAllocInfo* resource_alloc_info) {
+                    UpdateBoundResource(resource_alloc_info, write_start, write_end, data);
+                });
 
             result = VK_SUCCESS;
         }
@@ -1514,6 +1466,215 @@ void VulkanRebindAllocator::UpdateBoundResource(ResourceAllocInfo* resource_allo
     }
 }
 
+void VulkanRebindAllocator::AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    if (resource_alloc_info->size > 0)
+    {
+        const VkDeviceSize first_page = resource_alloc_info->original_offset / kMemoryPageSize;
+        const VkDeviceSize last_page =
+            (resource_alloc_info->original_offset + resource_alloc_info->size - 1) / kMemoryPageSize;
+
+        for (VkDeviceSize page = first_page; page <= last_page; ++page)
+        {
+            memory_alloc_info->bound_resources[page].push_back(resource_alloc_info);
+        }
+    }
+}
+
+void VulkanRebindAllocator::RemoveBoundResource(MemoryAllocInfo*   memory_alloc_info,
+                                                ResourceAllocInfo* resource_alloc_info)
+{
+    assert((memory_alloc_info != nullptr) && (resource_alloc_info != nullptr));
+
+    if (resource_alloc_info->size > 0)
+    {
+        const VkDeviceSize first_page = resource_alloc_info->original_offset / kMemoryPageSize;
+        const VkDeviceSize last_page =
+            (resource_alloc_info->original_offset + resource_alloc_info->size - 1) / kMemoryPageSize;
+
+        for (VkDeviceSize page = first_page; page <= last_page; ++page)
+        {
+            auto entry = memory_alloc_info->bound_resources.find(page);
+            if (entry != memory_alloc_info->bound_resources.end())
+            {
+                auto& resources = entry->second;
+                auto  resource  = std::find(resources.begin(), resources.end(), resource_alloc_info);
+                if (resource != resources.end())
+                {
+                    // Resource order within a page is not significant.
+                    *resource = resources.back();
+                    resources.pop_back();
+                }
+
+                if (resources.empty())
+                {
+                    memory_alloc_info->bound_resources.erase(entry);
+                }
+            }
+        }
+    }
+}
+
+template <typename Func>
+void VulkanRebindAllocator::ForEachBoundResource(const MemoryAllocInfo* memory_alloc_info,
+                                                 VkDeviceSize           range_start,
+                                                 VkDeviceSize           range_end,
+                                                 Func                   func)
+{
+    assert(memory_alloc_info != nullptr);
+
+    if (range_end <= range_start)
+    {
+        return;
+    }
+
+    const VkDeviceSize first_page = range_start / kMemoryPageSize;
+    const VkDeviceSize last_page  = (range_end - 1) / kMemoryPageSize;
+
+    // A resource that spans multiple pages of the range is only visited for the first page where it overlaps the
+    // range, which is the page containing the start of the overlap.
+    const auto visit_page = [&](VkDeviceSize page, const std::vector<ResourceAllocInfo*>& resources) {
+        for (ResourceAllocInfo* resource_alloc_info : resources)
+        {
+            if ((std::max(range_start, resource_alloc_info->original_offset) / kMemoryPageSize) == page)
+            {
+                func(resource_alloc_info);
+            }
+        }
+    };
+
+    if ((last_page - first_page) < memory_alloc_info->bound_resources.size())
+    {
+        for (VkDeviceSize page = first_page; page <= last_page; ++page)
+        {
+            auto entry = memory_alloc_info->bound_resources.find(page);
+            if (entry != memory_alloc_info->bound_resources.end())
+            {
+                visit_page(page, entry->second);
+            }
+        }
+    }
+    else
+    {
+        // The range covers more pages than have bound resources, as for flushes of whole allocations.
+        for (const auto& entry : memory_alloc_info->bound_resources)
+        {
+            if ((entry.first >= first_page) && (entry.first <= last_page))
+            {
+                visit_page(entry.first, entry.second);
+            }
+        }
+    }
+}
+
+void VulkanRebindAllocator::StoreOriginalContent(MemoryAllocInfo* memory_alloc_info,
+                                                 VkDeviceSize     offset,
+                                                 size_t           size,
+                                                 const uint8_t*   data)
+{
+    assert((memory_alloc_info != nullptr) && (data != nullptr));
+
+    while (size > 0)
+    {
+        const VkDeviceSize page        = offset / kMemoryPageSize;
+        const size_t       page_offset = static_cast<size_t>(offset % kMemoryPageSize);
+        const size_t       copy_size   = std::min(size, static_cast<size_t>(kMemoryPageSize) - page_offset);
+
+        auto& content = memory_alloc_info->original_content[page];
+        if (content == nullptr)
+        {
+            // Zero initialized, to match the content of the unwritten part of the page.
+            content = std::make_unique<uint8_t[]>(static_cast<size_t>(kMemoryPageSize));
+        }
+
+        util::platform::MemoryCopy(content.get() + page_offset, copy_size, data, copy_size);
+
+        offset += copy_size;
+        data += copy_size;
+        size -= copy_size;
+    }
+}
+
+void VulkanRebindAllocator::GatherOriginalContent(const ContentPages&   content_pages,
+                                                  VkDeviceSize          range_start,
+                                                  VkDeviceSize          range_end,
+                                                  bool                  fill_gaps,
+                                                  const ContentRunFunc& func)
+{
+    std::vector<uint8_t> run_data;
+    VkDeviceSize         run_start   = range_start;
+    VkDeviceSize         offset      = range_start;
+    bool                 has_content = false;
+
+    while (offset < range_end)
+    {
+        const VkDeviceSize page        = offset / kMemoryPageSize;
+        const VkDeviceSize page_offset = offset % kMemoryPageSize;
+        const VkDeviceSize copy_size   = std::min(range_end - offset, kMemoryPageSize - page_offset);
+
+        auto entry = content_pages.find(page);
+        if (entry != content_pages.end())
+        {
+            if (run_data.empty())
+            {
+                run_start = offset;
+            }
+
+            const uint8_t* page_data = entry->second.get() + page_offset;
+            run_data.insert(run_data.end(), page_data, page_data + copy_size);
+            has_content = true;
+        }
+        else if (fill_gaps)
+        {
+            run_data.insert(run_data.end(), static_cast<size_t>(copy_size), 0);
+        }
+        else if (!run_data.empty())
+        {
+            func(run_start - range_start, run_data);
+            run_data.clear();
+        }
+
+        offset += copy_size;
+    }
+
+    if (has_content && !run_data.empty())
+    {
+        func(run_start - range_start, run_data);
+    }
+}
+
+void VulkanRebindAllocator::WriteOriginalContent(ResourceAllocInfo* resource_alloc_info)
+{
+    assert((resource_alloc_info != nullptr) && (resource_alloc_info->memory_info != nullptr));
+
+    const MemoryAllocInfo* memory_alloc_info = resource_alloc_info->memory_info;
+
+    if (memory_alloc_info->original_content.empty())
+    {
+        return;
+    }
+
+    const VkDeviceSize resource_start = resource_alloc_info->original_offset;
+    const VkDeviceSize resource_end =
+        std::min(resource_start + resource_alloc_info->size, memory_alloc_info->allocation_size);
+
+    // Consecutive written pages are gathered and written to the resource together, while pages that were never
+    // written are skipped.  Staging writes to images do not support offsets, so images that are not host visible
+    // receive the whole range in one write, with the unwritten pages zero-filled.
+    const bool fill_gaps =
+        (resource_alloc_info->object_type == ObjectType::image) && !resource_alloc_info->is_host_visible;
+
+    GatherOriginalContent(memory_alloc_info->original_content,
+                          resource_start,
+                          resource_end,
+                          fill_gaps,
+                          [this, resource_alloc_info](VkDeviceSize run_offset, const std::vector<uint8_t>& run_data) {
+                              WriteBoundResource(resource_alloc_info, 0, run_offset, run_data.size(), run_data.data());
+                          });
+}
+
 VkResult VulkanRebindAllocator::UpdateMappedMemoryRange(
     ResourceAllocInfo* resource_alloc_info,
     VkDeviceSize       oiriginal_start,
@@ -1569,29 +1730,14 @@ VkResult VulkanRebindAllocator::UpdateMappedMemoryRanges(
                 VkDeviceSize range_start = memory_ranges[i].offset;
                 VkDeviceSize range_end   = range_start + size;
 
-                for (const auto& entry : memory_alloc_info->original_buffers)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_images)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
-
-                for (const auto& entry : memory_alloc_info->original_sessions)
-                {
-                    if (UpdateMappedMemoryRange(entry.second, range_start, range_end, update_func) != VK_SUCCESS)
-                    {
-                        result = VK_ERROR_MEMORY_MAP_FAILED;
-                    }
-                }
+                ForEachBoundResource(
+                    memory_alloc_info, range_start, range_end, [&](ResourceAllocInfo* resource_alloc_info) {
+                        if (UpdateMappedMemoryRange(resource_alloc_info, range_start, range_end, update_func) !=
+                            VK_SUCCESS)
+                        {
+                            result = VK_ERROR_MEMORY_MAP_FAILED;
+                        }
+                    });
             }
         }
     }
@@ -28,6 +28,7 @@
 
 #include "vk_mem_alloc.h"
 
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
@@ -307,6 +308,26 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     virtual bool SupportsOpaqueDeviceAddresses() override { return false; }
     virtual bool SupportBindVideoSessionMemory() override { return true; }
 
+    // Memory allocations are divided into pages of kMemoryPageSize bytes for tracking written content and bound
+    // resources.
+    static constexpr VkDeviceSize kMemoryPageSize = 64 * 1024;
+
+    // Content written to each page of an allocation, with pages allocated on first write.
+    typedef std::unordered_map<VkDeviceSize, std::unique_ptr<uint8_t[]>> ContentPages;
+
+    // Receives a run of stored content, with its offset from the start of the gathered range.
+    typedef std::function<void(VkDeviceSize, const std::vector<uint8_t>&)> ContentRunFunc;
+
+    // Gathers the stored content of the range [range_start, range_end) of an allocation into runs of consecutive
+    // written pages, skipping pages that were never written.  When fill_gaps is true, the unwritten pages are
+    // zero-filled instead, and the whole range is passed as a single run at offset 0.  Nothing is passed when no page
+    // of the range was written.
+    static void GatherOriginalContent(const ContentPages&   content_pages,
+                                      VkDeviceSize          range_start,
+                                      VkDeviceSize          range_end,
+                                      bool                  fill_gaps,
+                                      const ContentRunFunc& func);
+
   private:
     struct MemoryAllocInfo;
 
@@ -345,13 +366,18 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
         std::vector<SubresourceLayouts> layouts;
     };
 
+    // Resources bound to each page of an allocation, for finding the resources that overlap a range of the allocation
+    // without visiting every bound resource.
+    typedef std::unordered_map<VkDeviceSize, std::vector<ResourceAllocInfo*>> BoundResourcePages;
+
     struct MemoryAllocInfo
     {
         VkDeviceSize                                     allocation_size{ 0 };
         uint32_t                                         original_index{ std::numeric_limits<uint32_t>::max() };
         bool                                             is_mapped{ false };
         VkDeviceSize                                     mapped_offset{ 0 };
-        std::unique_ptr<uint8_t[]>                       original_content;
+        ContentPages                                     original_content;
+        BoundResourcePages                               bound_resources;
         std::unordered_map<VkBuffer, ResourceAllocInfo*> original_buffers;
         std::unordered_map<VkImage, ResourceAllocInfo*>  original_images;
         std::unordered_map<VkVideoSessionKHR, ResourceAllocInfo*> original_sessions;
@@ -392,6 +418,28 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
                              VkDeviceSize       write_end,
                              const uint8_t*     data);
 
+    void AddBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    void RemoveBoundResource(MemoryAllocInfo* memory_alloc_info, ResourceAllocInfo* resource_alloc_info);
+
+    // Calls func once for each resource bound to a page that overlaps the range, which includes all resources that
+    // overlap the range.  Range ends are exclusive.
+    template <typename Func>
+    void ForEachBoundResource(const MemoryAllocInfo* memory_alloc_info,
+                              VkDeviceSize           range_start,
+                              VkDeviceSize           range_end,
+                              Func                   func);
+
+    // Stores data written to mapped memory, for initializing resources that are bound to the memory after the write.
+    void StoreOriginalContent(MemoryAllocInfo* memory_alloc_info,
+                              VkDeviceSize     offset,
+                              size_t           size,
+                              const uint8_t*   data);
+
+    // Writes the stored content of the memory range that a resource was bound to, when the memory was written prior to
+    // bind.
+    void WriteOriginalContent(ResourceAllocInfo* resource_alloc_info);
+
     VkResult UpdateMappedMemoryRange(ResourceAllocInfo* resource_alloc_info,
                                      VkDeviceSize       oiriginal_start,
                                      VkDeviceSize       original_end,
@@ -321,6 +321,290 @@ void VulkanReplayConsumerBase::WaitDevicesIdle()
     });
 }
 
+void VulkanReplayConsumerBase::BeginReplayLoopIteration(uint32_t iteration)
+{
+    if (iteration == 0)
+    {
+        loop_fence_signaled_.clear();
+        loop_timeline_start_values_.clear();
+        loop_timeline_offsets_.clear();
+
+        object_info_table_->VisitVkFenceInfo([this](const VulkanFenceInfo* info) {
+            assert(info != nullptr);
+            const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(info->parent_id);
+
+            if (device_info != nullptr)
+            {
+                VkDevice device = device_info->handle;
+                VkResult status = GetDeviceTable(device)->GetFenceStatus(device, info->handle);
+
+                loop_fence_signaled_[info->capture_id] = (status == VK_SUCCESS);
+            }
+        });
+
+        object_info_table_->VisitVkSemaphoreInfo([this](const VulkanSemaphoreInfo* info) {
+            assert(info != nullptr);
+            const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(info->parent_id);
+            uint64_t                value       = 0;
+
+            if ((info->type == VK_SEMAPHORE_TYPE_TIMELINE) && (device_info != nullptr) &&
+                (GetDeviceTable(device_info->handle)
+                     ->GetSemaphoreCounterValue(device_info->handle, info->handle, &value) == VK_SUCCESS))
+            {
+                loop_timeline_start_values_[info->capture_id] = value;
+            }
+        });
+    }
+    else
+    {
+        // Work submitted by the previous iteration must complete before its commands are submitted again.
+        WaitDevicesIdle();
+
+        RestoreLoopFences();
+
+        // Timeline semaphore values must increase, so values signaled by the repeated iteration are offset past the
+        // values that the previous iteration reached.  Values at or below the start value remain satisfied.
+        loop_timeline_offsets_.clear();
+
+        for (const auto& entry : loop_timeline_start_values_)
+        {
+            const VulkanSemaphoreInfo* semaphore_info = object_info_table_->GetVkSemaphoreInfo(entry.first);
+
+            if (semaphore_info != nullptr)
+            {
+                const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(semaphore_info->parent_id);
+                uint64_t                value       = 0;
+
+                if ((device_info != nullptr) &&
+                    (GetDeviceTable(device_info->handle)
+                         ->GetSemaphoreCounterValue(device_info->handle, semaphore_info->handle, &value) ==
+                     VK_SUCCESS) &&
+                    (value > entry.second))
+                {
+                    loop_timeline_offsets_[semaphore_info->handle] = value - entry.second;
+                }
+            }
+        }
+
+        ResetLoopQueryPools();
+    }
+}
+
+void VulkanReplayConsumerBase::RestoreLoopFences()
+{
+    std::unordered_map<VkDevice, std::vector<VkFence>> signal_fences;
+
+    for (const auto& entry : loop_fence_signaled_)
+    {
+        const VulkanFenceInfo* fence_info = object_info_table_->GetVkFenceInfo(entry.first);
+
+        if (fence_info != nullptr)
+        {
+            const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(fence_info->parent_id);
+
+            if (device_info != nullptr)
+            {
+                VkDevice    device       = device_info->handle;
+                VkFence     fence        = fence_info->handle;
+                const auto* device_table = GetDeviceTable(device);
+                const bool  signaled     = (device_table->GetFenceStatus(device, fence) == VK_SUCCESS);
+
+                if (signaled && !entry.second)
+                {
+                    device_table->ResetFences(device, 1, &fence);
+                }
+                else if (!signaled && entry.second)
+                {
+                    signal_fences[device].push_back(fence);
+                }
+            }
+        }
+    }
+
+    if (!signal_fences.empty())
+    {
+        // Fences can only be signaled by a queue operation, so an empty submission signals each fence that was
+        // signaled when the loop started.
+        object_info_table_->VisitVkQueueInfo([this, &signal_fences](const VulkanQueueInfo* info) {
+            assert(info != nullptr);
+            auto device_fences = signal_fences.find(info->parent);
+
+            if (device_fences != signal_fences.end())
+            {
+                const auto* device_table = GetDeviceTable(info->parent);
+
+                for (VkFence fence : device_fences->second)
+                {
+                    device_table->QueueSubmit(info->handle, 0, nullptr, fence);
+                }
+
+                device_table->QueueWaitIdle(info->handle);
+                signal_fences.erase(device_fences);
+            }
+        });
+    }
+}
+
+void VulkanReplayConsumerBase::ResetLoopQueryPools()
+{
+    std::unordered_map<format::HandleId, std::vector<const VulkanQueryPoolInfo*>> device_query_pools;
+
+    object_info_table_->VisitVkQueryPoolInfo([&device_query_pools](const VulkanQueryPoolInfo* info) {
+        assert(info != nullptr);
+
+        // Video queries can only be reset on video queues.
+        if ((info->query_count > 0) && (info->type != VK_QUERY_TYPE_RESULT_STATUS_ONLY_KHR) &&
+            (info->type != VK_QUERY_TYPE_VIDEO_ENCODE_FEEDBACK_KHR))
+        {
+            device_query_pools[info->parent_id].push_back(info);
+        }
+    });
+
+    for (const auto& entry : device_query_pools)
+    {
+        const VulkanDeviceInfo* device_info = object_info_table_->GetVkDeviceInfo(entry.first);
+
+        if (device_info == nullptr)
+        {
+            continue;
+        }
+
+        VkDevice    device         = device_info->handle;
+        const auto* device_table   = GetDeviceTable(device);
+        const auto* instance_table = GetInstanceTable(device_info->parent);
+        uint32_t    family_count   = 0;
+
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(device_info->parent, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> family_properties(family_count);
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(
+            device_info->parent, &family_count, family_properties.data());
+
+        // Query pools are reset with vkCmdResetQueryPool, which requires a graphics or compute queue.
+        const VulkanQueueInfo* queue_info = nullptr;
+        object_info_table_->VisitVkQueueInfo([&](const VulkanQueueInfo* info) {
+            if ((queue_info == nullptr) && (info->parent == device) && (info->family_index < family_count) &&
+                ((family_properties[info->family_index].queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) !=
+                 0))
+            {
+                queue_info = info;
+            }
+        });
+
+        if (queue_info == nullptr)
+        {
+            GFXRECON_LOG_WARNING("Query pools were not reset for the looped frame range: no graphics or compute queue");
+            continue;
+        }
+
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        pool_create_info.queueFamilyIndex        = queue_info->family_index;
+
+        VkCommandPool   command_pool   = VK_NULL_HANDLE;
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        VkResult        result = device_table->CreateCommandPool(device, &pool_create_info, nullptr, &command_pool);
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.commandPool                 = command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+            result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            for (const VulkanQueryPoolInfo* query_pool_info : entry.second)
+            {
+                device_table->CmdResetQueryPool(
+                    command_buffer, query_pool_info->handle, 0, query_pool_info->query_count);
+            }
+
+            result = device_table->EndCommandBuffer(command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers    = &command_buffer;
+
+            result = device_table->QueueSubmit(queue_info->handle, 1, &submit_info, VK_NULL_HANDLE);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->QueueWaitIdle(queue_info->handle);
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_WARNING("Failed to reset query pools for the looped frame range (error = %s)",
+                                 util::ToString<VkResult>(result).c_str());
+        }
+
+        if (command_pool != VK_NULL_HANDLE)
+        {
+            device_table->DestroyCommandPool(device, command_pool, nullptr);
+        }
+    }
+}
+
+void VulkanReplayConsumerBase::RebaseLoopTimelineValues(uint32_t           count,
+                                                        const VkSemaphore* semaphores,
+                                                        const uint64_t*    values)
+{
+    if ((semaphores == nullptr) || (values == nullptr))
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        auto offset = loop_timeline_offsets_.find(semaphores[i]);
+
+        if (offset != loop_timeline_offsets_.end())
+        {
+            const_cast<uint64_t*>(values)[i] += offset->second;
+        }
+    }
+}
+
+void VulkanReplayConsumerBase::RebaseLoopTimelineValues(const void*        p_next,
+                                                        uint32_t           wait_count,
+                                                        const VkSemaphore* wait_semaphores,
+                                                        uint32_t           signal_count,
+                                                        const VkSemaphore* signal_semaphores)
+{
+    const auto* timeline_info = reinterpret_cast<const VkBaseInStructure*>(p_next);
+
+    while ((timeline_info != nullptr) && (timeline_info->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO))
+    {
+        timeline_info = timeline_info->pNext;
+    }
+
+    if (timeline_info != nullptr)
+    {
+        const auto* values = reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(timeline_info);
+
+        RebaseLoopTimelineValues(
+            std::min(wait_count, values->waitSemaphoreValueCount), wait_semaphores, values->pWaitSemaphoreValues);
+        RebaseLoopTimelineValues(std::min(signal_count, values->signalSemaphoreValueCount),
+                                 signal_semaphores,
+                                 values->pSignalSemaphoreValues);
+    }
+}
+
 void VulkanReplayConsumerBase::ProcessStateBeginMarker(uint64_t frame_number)
 {
     GFXRECON_UNREFERENCED_PARAMETER(frame_number);
@@ -3532,6 +3816,18 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit      fu
         fence = fence_info->handle;
     }
 
+    if (!loop_timeline_offsets_.empty())
+    {
+        for (uint32_t i = 0; i < submitCount; ++i)
+        {
+            RebaseLoopTimelineValues(submit_infos[i].pNext,
+                                     submit_infos[i].waitSemaphoreCount,
+                                     submit_infos[i].pWaitSemaphores,
+                                     submit_infos[i].signalSemaphoreCount,
+                                     submit_infos[i].pSignalSemaphores);
+        }
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
     // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
     // tracked.
@@ -3711,6 +4007,24 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit2(PFN_vkQueueSubmit2     f
         fence = fence_info->handle;
     }
 
+    if (!loop_timeline_offsets_.empty())
+    {
+        for (uint32_t i = 0; i < submitCount; ++i)
+        {
+            for (uint32_t j = 0; j < submit_infos[i].waitSemaphoreInfoCount; ++j)
+            {
+                const VkSemaphoreSubmitInfo& wait_info = submit_infos[i].pWaitSemaphoreInfos[j];
+                RebaseLoopTimelineValues(1, &wait_info.semaphore, &wait_info.value);
+            }
+
+            for (uint32_t j = 0; j < submit_infos[i].signalSemaphoreInfoCount; ++j)
+            {
+                const VkSemaphoreSubmitInfo& signal_info = submit_infos[i].pSignalSemaphoreInfos[j];
+                RebaseLoopTimelineValues(1, &signal_info.semaphore, &signal_info.value);
+            }
+        }
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
     // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
     // tracked.
@@ -3878,6 +4192,18 @@ VulkanReplayConsumerBase::OverrideQueueBindSparse(PFN_vkQueueBindSparse
         fence = fence_info->handle;
     }
 
+    if (!loop_timeline_offsets_.empty())
+    {
+        for (uint32_t i = 0; i < bindInfoCount; ++i)
+        {
+            RebaseLoopTimelineValues(bind_infos[i].pNext,
+                                     bind_infos[i].waitSemaphoreCount,
+                                     bind_infos[i].pWaitSemaphores,
+                                     bind_infos[i].signalSemaphoreCount,
+                                     bind_infos[i].pSignalSemaphores);
+        }
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
     // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
     // tracked.
@@ -8811,10 +9137,106 @@ VulkanReplayConsumerBase::OverrideWaitSemaphores(PFN_vkWaitSemaphores    func,
     {
         timeout = 0;
     }
+
+    if (!loop_timeline_offsets_.empty())
+    {
+        RebaseLoopTimelineValues(wait_info->semaphoreCount, wait_info->pSemaphores, wait_info->pValues);
+    }
+
     result = func(device, wait_info, timeout);
     return result;
 }
 
+VkResult VulkanReplayConsumerBase::OverrideSignalSemaphore(
+    PFN_vkSignalSemaphore                                      func,
+    VkResult                                                   original_result,
+    const VulkanDeviceInfo*                                    device_info,
+    const StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (pSignalInfo != nullptr) && !pSignalInfo->IsNull() &&
+           (pSignalInfo->GetPointer() != nullptr));
+
+    const VkSemaphoreSignalInfo* signal_info = pSignalInfo->GetPointer();
+
+    if (!loop_timeline_offsets_.empty())
+    {
+        RebaseLoopTimelineValues(1, &signal_info->semaphore, &signal_info->value);
+    }
+
+    return func(device_info->handle, signal_info);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateSemaphore(
+    PFN_vkCreateSemaphore                                func,
+    VkResult                                             original_result,
+    const VulkanDeviceInfo*                              device_info,
+    StructPointerDecoder<Decoded_VkSemaphoreCreateInfo>* create_info_decoder,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* allocator_decoder,
+    HandlePointerDecoder<VkSemaphore>*                   semaphore_decoder)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (create_info_decoder != nullptr) && !create_info_decoder->IsNull() &&
+           (semaphore_decoder != nullptr) && !semaphore_decoder->IsNull());
+
+    const VkSemaphoreCreateInfo* create_info = create_info_decoder->GetPointer();
+
+    VkResult result = func(device_info->handle,
+                           create_info,
+                           GetAllocationCallbacks(allocator_decoder),
+                           semaphore_decoder->GetHandlePointer());
+
+    if (result == VK_SUCCESS)
+    {
+        // The semaphore type is needed to restore timeline semaphore state when replaying a looped frame range.
+        auto semaphore_info = reinterpret_cast<VulkanSemaphoreInfo*>(semaphore_decoder->GetConsumerData(0));
+        assert(semaphore_info != nullptr);
+
+        const auto* type_info = graphics::vulkan_struct_get_pnext<VkSemaphoreTypeCreateInfo>(create_info);
+        if (type_info != nullptr)
+        {
+            semaphore_info->type = type_info->semaphoreType;
+        }
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateQueryPool(
+    PFN_vkCreateQueryPool                                func,
+    VkResult                                             original_result,
+    const VulkanDeviceInfo*                              device_info,
+    StructPointerDecoder<Decoded_VkQueryPoolCreateInfo>* create_info_decoder,
+    StructPointerDecoder<Decoded_VkAllocationCallbacks>* allocator_decoder,
+    HandlePointerDecoder<VkQueryPool>*                   query_pool_decoder)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(original_result);
+
+    assert((device_info != nullptr) && (create_info_decoder != nullptr) && !create_info_decoder->IsNull() &&
+           (query_pool_decoder != nullptr) && !query_pool_decoder->IsNull());
+
+    const VkQueryPoolCreateInfo* create_info = create_info_decoder->GetPointer();
+
+    VkResult result = func(device_info->handle,
+                           create_info,
+                           GetAllocationCallbacks(allocator_decoder),
+                           query_pool_decoder->GetHandlePointer());
+
+    if (result == VK_SUCCESS)
+    {
+        // The query type and count are needed to reset the pool when replaying a looped frame range.
+        auto query_pool_info = reinterpret_cast<VulkanQueryPoolInfo*>(query_pool_decoder->GetConsumerData(0));
+        assert(query_pool_info != nullptr);
+
+        query_pool_info->type        = create_info->queryType;
+        query_pool_info->query_count = create_info->queryCount;
+    }
+
+    return result;
+}
+
 VkResult VulkanReplayConsumerBase::OverrideAcquireProfilingLockKHR(
     PFN_vkAcquireProfilingLockKHR                                      func,
     VkResult                                                           original_result,
@@ -88,6 +88,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFpsInfo(graphics::FpsInfo* fps_info) { fps_info_ = fps_info; }
 
+    // Prepares for a replay iteration of a looped frame range.  Iteration 0 records the fence and timeline semaphore
+    // state at the start of the range.  Each later iteration waits for all devices to idle, restores the fence status,
+    // offsets the values of timeline semaphores past the values signaled by the previous iteration, and resets all
+    // query pools.
+    void BeginReplayLoopIteration(uint32_t iteration);
+
     virtual void WaitDevicesIdle() override;
 
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
@@ -1273,6 +1279,25 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                     const StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pInfo,
                                     uint64_t                                                 timeout);
 
+    VkResult OverrideSignalSemaphore(PFN_vkSignalSemaphore                                      func,
+                                     VkResult                                                   original_result,
+                                     const VulkanDeviceInfo*                                    device_info,
+                                     const StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo);
+
+    VkResult OverrideCreateSemaphore(PFN_vkCreateSemaphore                                func,
+                                     VkResult                                             original_result,
+                                     const VulkanDeviceInfo*                              device_info,
+                                     StructPointerDecoder<Decoded_VkSemaphoreCreateInfo>* create_info_decoder,
+                                     StructPointerDecoder<Decoded_VkAllocationCallbacks>* allocator_decoder,
+                                     HandlePointerDecoder<VkSemaphore>*                   semaphore_decoder);
+
+    VkResult OverrideCreateQueryPool(PFN_vkCreateQueryPool                                func,
+                                     VkResult                                             original_result,
+                                     const VulkanDeviceInfo*                              device_info,
+                                     StructPointerDecoder<Decoded_VkQueryPoolCreateInfo>* create_info_decoder,
+                                     StructPointerDecoder<Decoded_VkAllocationCallbacks>* allocator_decoder,
+                                     HandlePointerDecoder<VkQueryPool>*                   query_pool_decoder);
+
     VkResult OverrideAcquireProfilingLockKHR(PFN_vkAcquireProfilingLockKHR func,
                                              VkResult                      original_result,
                                              const VulkanDeviceInfo*       device_info,
@@ -1526,6 +1551,20 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     void GetNonForwardProgress(const StructPointerDecoder<Decoded_VkSemaphoreSubmitInfo>* semaphore_info_data,
                                std::vector<const VulkanSemaphoreInfo*>* non_forward_progress_semaphores);
 
+    // Adds the looped frame range offsets to the values of the timeline semaphores in a submission or wait.  The values
+    // are updated in place, as they are decoded again by each iteration.
+    void RebaseLoopTimelineValues(uint32_t count, const VkSemaphore* semaphores, const uint64_t* values);
+
+    void RebaseLoopTimelineValues(const void*        p_next,
+                                  uint32_t           wait_count,
+                                  const VkSemaphore* wait_semaphores,
+                                  uint32_t           signal_count,
+                                  const VkSemaphore* signal_semaphores);
+
+    void RestoreLoopFences();
+
+    void ResetLoopQueryPools();
+
     VkResult CreateSwapchainImage(const VulkanDeviceInfo*  device_info,
                                   const VkImageCreateInfo* image_create_info,
                                   VkImage*                 image,
@@ -1650,6 +1689,14 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     std::unordered_set<VkSemaphore> shadow_semaphores_;
     std::unordered_set<VkFence>     shadow_fences_;
 
+    // Fence status and timeline semaphore values at the start of a looped frame range, by capture ID.
+    std::unordered_map<format::HandleId, bool>     loop_fence_signaled_;
+    std::unordered_map<format::HandleId, uint64_t> loop_timeline_start_values_;
+
+    // Offsets added to the values of timeline semaphores by the repeated iterations of a looped frame range, so that
+    // each iteration signals values greater than the values signaled by the previous iteration.
+    std::unordered_map<VkSemaphore, uint64_t> loop_timeline_offsets_;
+
     // Used to track allocated external memory if replay uses VkImportMemoryHostPointerInfoEXT
     std::unordered_map<VkDeviceMemory, std::pair<void*, size_t>> external_memory_;
 
@@ -62,6 +62,25 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
         dump_json_.Open(options.capture_filename, options.dump_resources_output_dir);
     }
 
+    if (options.dump_resources_archive)
+    {
+        const std::filesystem::path archive_path =
+            std::filesystem::path(options.dump_resources_output_dir) / (capture_filename + "_dr.gfxa");
+
+        dump_archive_ = std::make_unique<util::DumpArchiveWriter>();
+        if (!dump_archive_->Open(archive_path.string()))
+        {
+            GFXRECON_LOG_WARNING("Dumped resources will be written to separate files");
+            dump_archive_.reset();
+        }
+    }
+
+    if (options.dump_resources_skip_unchanged)
+    {
+        hasher_ = std::make_unique<VulkanReplayDumpResourcesHasher>(*object_info_table);
+        dump_json_.SetFileReferences(&hasher_->GetFileReferences());
+    }
+
     for (size_t i = 0; i < options.BeginCommandBuffer_Indices.size(); ++i)
     {
         const uint64_t bcb_index = options.BeginCommandBuffer_Indices[i];
@@ -76,6 +95,8 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                                                *object_info_table,
                                                                options,
                                                                dump_json_,
+                                                               dump_archive_.get(),
+                                                               hasher_.get(),
                                                                capture_filename));
         }
 
@@ -93,6 +114,8 @@ VulkanReplayDumpResourcesBase::VulkanReplayDumpResourcesBase(const VulkanReplayO
                                               *object_info_table_,
                                               options,
                                               dump_json_,
+                                              dump_archive_.get(),
+                                              hasher_.get(),
                                               capture_filename));
         }
     }
@@ -111,6 +134,16 @@ void VulkanReplayDumpResourcesBase::Release()
     cmd_buf_begin_map_.clear();
     QueueSubmit_indices_.clear();
 
+    if (hasher_ != nullptr)
+    {
+        hasher_->Release();
+    }
+
+    if (dump_archive_ != nullptr)
+    {
+        dump_archive_->Close();
+    }
+
     recording_ = false;
 }
 
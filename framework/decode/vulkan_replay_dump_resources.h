@@ -31,13 +31,16 @@
 #include "decode/vulkan_replay_dump_resources_common.h"
 #include "decode/vulkan_replay_dump_resources_draw_calls.h"
 #include "decode/vulkan_replay_dump_resources_compute_ray_tracing.h"
+#include "decode/vulkan_replay_dump_resources_hasher.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "decode/vulkan_replay_dump_resources_json.h"
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/dump_archive.h"
 #include "vulkan/vulkan_core.h"
 
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -354,6 +357,13 @@ class VulkanReplayDumpResourcesBase
     VulkanReplayDumpResourcesJson dump_json_;
     bool                          output_json_per_command;
 
+    // Receives all dumped files when --dump-resources-archive is specified.
+    std::unique_ptr<util::DumpArchiveWriter> dump_archive_;
+
+    // Detects resources that did not change since they were last dumped when --dump-resources-skip-unchanged is
+    // specified.
+    std::unique_ptr<VulkanReplayDumpResourcesHasher> hasher_;
+
     std::string capture_filename;
 
     std::function<void(const char*)> fatal_error_handler_;
@@ -21,6 +21,7 @@
 */
 
 #include "decode/vulkan_replay_dump_resources_common.h"
+#include "decode/replay_memory_tracker.h"
 #include "util/logging.h"
 #include "util/image_writer.h"
 #include "util/buffer_writer.h"
@@ -435,6 +436,49 @@ uint32_t FindGreatestVertexIndex(const std::vector<uint8_t>& index_data,
     }
 }
 
+static void AddImageToDumpArchive(util::DumpArchiveWriter*       dump_archive,
+                                  const std::string&             filename,
+                                  DumpedImageFormat              output_image_format,
+                                  VkFormat                       format,
+                                  const VkExtent3D&              extent,
+                                  uint32_t                       stride,
+                                  util::imagewriter::DataFormats data_format,
+                                  bool                           separate_alpha,
+                                  const void*                    data,
+                                  size_t                         size)
+{
+    assert(dump_archive != nullptr);
+
+    // Texels are archived as they were read back, and are only encoded when extracted from the archive.
+    util::DumpArchiveImageInfo image_info;
+    image_info.data_format    = data_format;
+    image_info.width          = extent.width;
+    image_info.height         = extent.height;
+    image_info.row_pitch      = stride;
+    image_info.has_alpha      = vkuFormatHasAlpha(format);
+    image_info.separate_alpha = separate_alpha;
+
+    if (output_image_format == KFormatAstc)
+    {
+        const VKU_FORMAT_INFO format_info = vkuGetFormatInfo(format);
+
+        image_info.encoding     = util::DumpArchiveImageEncoding::kAstc;
+        image_info.block_width  = static_cast<uint8_t>(format_info.block_extent.width);
+        image_info.block_height = static_cast<uint8_t>(format_info.block_extent.height);
+        image_info.block_depth  = static_cast<uint8_t>(format_info.block_extent.depth);
+    }
+    else if (output_image_format == KFormatPNG)
+    {
+        image_info.encoding = util::DumpArchiveImageEncoding::kPng;
+    }
+    else
+    {
+        image_info.encoding = util::DumpArchiveImageEncoding::kBmp;
+    }
+
+    dump_archive->AddImage(filename, data, size, image_info);
+}
+
 VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                          const VulkanDeviceInfo*            device_info,
                          const encode::VulkanDeviceTable*   device_table,
@@ -444,6 +488,8 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         util::DumpArchiveWriter*           dump_archive,
+                         VulkanReplayDumpResourcesHasher*   hasher,
                          bool                               dump_all_subresources,
                          bool                               dump_image_raw,
                          bool                               dump_separate_alpha,
@@ -476,13 +522,55 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                              (extent_p != nullptr) ? extent_p->height : image_info->extent.height,
                              (extent_p != nullptr) ? extent_p->depth : image_info->extent.depth };
 
-    const VkFormat dst_format = ChooseDestinationImageFormat(image_info->format);
+    const VkFormat      dst_format = ChooseDestinationImageFormat(image_info->format);
+    const VkImageLayout image_layout =
+        (layout == VK_IMAGE_LAYOUT_MAX_ENUM) ? image_info->intermediate_layout : layout;
+    const size_t files_per_aspect = total_files / aspects.size();
+
+    // Aspects that did not change since the image was last dumped reference the files of that dump instead of being
+    // read back again. The aspects are hashed with a single submission.
+    std::vector<bool> unchanged_aspects(aspects.size(), false);
+    if (hasher != nullptr)
+    {
+        std::vector<size_t> hash_indices(aspects.size(), SIZE_MAX);
+
+        for (size_t i = 0; i < aspects.size(); ++i)
+        {
+            if (aspects[i] != VK_IMAGE_ASPECT_STENCIL_BIT)
+            {
+                const auto first_filename = filenames.begin() + (i * files_per_aspect);
+                hash_indices[i]           = hasher->QueueImage(image_info,
+                                                               device_info,
+                                                               device_table,
+                                                               instance_table,
+                                                               aspects[i],
+                                                               image_layout,
+                                                               extent,
+                                                               { first_filename, first_filename + files_per_aspect });
+            }
+        }
+
+        const std::vector<bool> unchanged = hasher->SubmitQueued();
+        for (size_t i = 0; i < aspects.size(); ++i)
+        {
+            unchanged_aspects[i] = (hash_indices[i] != SIZE_MAX) && unchanged[hash_indices[i]];
+        }
+    }
 
     uint32_t f = 0;
     for (size_t i = 0; i < aspects.size(); ++i)
     {
         const VkImageAspectFlagBits aspect = aspects[i];
 
+        if (unchanged_aspects[i])
+        {
+            scaling_supported[i] = true;
+            f += static_cast<uint32_t>(files_per_aspect);
+            continue;
+        }
+
+        ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
+
         std::vector<uint8_t>  data;
         std::vector<uint64_t> subresource_offsets;
         std::vector<uint64_t> subresource_sizes;
@@ -497,7 +585,7 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
             image_info->layer_count,
             image_info->tiling,
             image_info->sample_count,
-            (layout == VK_IMAGE_LAYOUT_MAX_ENUM) ? image_info->intermediate_layout : layout,
+            image_layout,
             image_info->queue_family_index,
             aspect,
             data,
@@ -521,6 +609,8 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
             return res;
         }
 
+        readback_usage.Set(data.capacity());
+
         const DumpedImageFormat output_image_format = GetDumpedImageFormat(device_info,
                                                                            device_table,
                                                                            instance_table,
@@ -559,7 +649,20 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                 const uint32_t texel_size = vkuFormatElementSizeWithAspect(dst_format, aspects[i]);
                 const uint32_t stride     = texel_size * scaled_extent.width;
 
-                if (output_image_format == KFormatAstc)
+                if (dump_archive != nullptr)
+                {
+                    AddImageToDumpArchive(dump_archive,
+                                          filename,
+                                          output_image_format,
+                                          image_info->format,
+                                          scaled_extent,
+                                          stride,
+                                          image_writer_format,
+                                          dump_separate_alpha,
+                                          data.data(),
+                                          static_cast<size_t>(subresource_sizes[0]));
+                }
+                else if (output_image_format == KFormatAstc)
                 {
                     VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
 
@@ -628,7 +731,7 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                     "%s format is not handled. Images with that format will be dump as a plain binary file.",
                     util::ToString<VkFormat>(image_info->format).c_str());
 
-                util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+                WriteDumpedBuffer(dump_archive, filename, data.data(), data.size());
             }
         }
         else
@@ -667,7 +770,20 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                         const uint32_t texel_size = vkuFormatElementSizeWithAspect(image_info->format, aspect);
                         const uint32_t stride     = texel_size * scaled_extent.width;
 
-                        if (output_image_format == KFormatAstc)
+                        if (dump_archive != nullptr)
+                        {
+                            AddImageToDumpArchive(dump_archive,
+                                                  filename,
+                                                  output_image_format,
+                                                  image_info->format,
+                                                  scaled_extent,
+                                                  stride,
+                                                  image_writer_format,
+                                                  dump_separate_alpha,
+                                                  data_offset,
+                                                  static_cast<size_t>(subresource_sizes[sub_res_idx]));
+                        }
+                        else if (output_image_format == KFormatAstc)
                         {
                             VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
 
@@ -736,7 +852,7 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                             "%s format is not handled. Images with that format will be dump as a plain binary file.",
                             util::ToString<VkFormat>(image_info->format).c_str());
 
-                        util::bufferwriter::WriteBuffer(filename, data_offset, subresource_sizes[sub_res_idx]);
+                        WriteDumpedBuffer(dump_archive, filename, data_offset, subresource_sizes[sub_res_idx]);
                     }
                 }
             }
@@ -748,6 +864,21 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
     return VK_SUCCESS;
 }
 
+void WriteDumpedBuffer(util::DumpArchiveWriter* dump_archive,
+                       const std::string&       filename,
+                       const void*              data,
+                       size_t                   size)
+{
+    if (dump_archive != nullptr)
+    {
+        dump_archive->AddBuffer(filename, data, size);
+    }
+    else
+    {
+        util::bufferwriter::WriteBuffer(filename, data, size);
+    }
+}
+
 bool CheckDescriptorCompatibility(VkDescriptorType desc_type_a, VkDescriptorType desc_type_b)
 {
     switch (desc_type_a)
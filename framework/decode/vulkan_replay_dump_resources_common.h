@@ -24,8 +24,10 @@
 #define GFXRECON_GENERATED_VULKAN_REPLAY_DUMP_RESOURCES_COMMON_H
 
 #include "decode/common_object_info_table.h"
+#include "decode/vulkan_replay_dump_resources_hasher.h"
 #include "vulkan/vulkan_core.h"
 #include "util/defines.h"
+#include "util/dump_archive.h"
 #include "util/image_writer.h"
 #include "util/options.h"
 
@@ -115,12 +117,20 @@ VkResult DumpImageToFile(const VulkanImageInfo*             image_info,
                          float                              scale,
                          std::vector<bool>&                 scaling_supported,
                          util::ScreenshotFormat             image_file_format,
+                         util::DumpArchiveWriter*           dump_archive,
+                         VulkanReplayDumpResourcesHasher*   hasher,
                          bool                               dump_all_subresources = false,
                          bool                               dump_image_raw        = false,
                          bool                               dump_separate_alpha   = false,
                          VkImageLayout                      layout                = VK_IMAGE_LAYOUT_MAX_ENUM,
                          const VkExtent3D*                  extent_p              = nullptr);
 
+// Writes dumped buffer content to its own file, or adds it to the dump archive when one is used.
+void WriteDumpedBuffer(util::DumpArchiveWriter* dump_archive,
+                       const std::string&       filename,
+                       const void*              data,
+                       size_t                   size);
+
 bool CheckDescriptorCompatibility(VkDescriptorType desc_type_a, VkDescriptorType desc_type_b);
 
 std::string ShaderStageToStr(VkShaderStageFlagBits shader_stage);
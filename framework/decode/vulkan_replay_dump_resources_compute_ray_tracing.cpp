@@ -21,13 +21,13 @@
 */
 
 #include "decode/vulkan_object_info.h"
+#include "decode/replay_memory_tracker.h"
 #include "decode/vulkan_replay_dump_resources_compute_ray_tracing.h"
 #include "decode/vulkan_replay_dump_resources_common.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_enum_to_string.h"
 #include "graphics/vulkan_resources_util.h"
 #include "util/image_writer.h"
-#include "util/buffer_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
@@ -48,12 +48,14 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vector<uint64_t>&   dispatch_indices,
-                                                                 const std::vector<uint64_t>&   trace_rays_indices,
-                                                                 CommonObjectInfoTable&         object_info_table,
-                                                                 const VulkanReplayOptions&     options,
-                                                                 VulkanReplayDumpResourcesJson& dump_json,
-                                                                 std::string                    capture_filename) :
+DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vector<uint64_t>&     dispatch_indices,
+                                                                 const std::vector<uint64_t>&     trace_rays_indices,
+                                                                 CommonObjectInfoTable&           object_info_table,
+                                                                 const VulkanReplayOptions&       options,
+                                                                 VulkanReplayDumpResourcesJson&   dump_json,
+                                                                 util::DumpArchiveWriter*         dump_archive,
+                                                                 VulkanReplayDumpResourcesHasher* hasher,
+                                                                 std::string                      capture_filename) :
     original_command_buffer_info(nullptr),
     DR_command_buffer(VK_NULL_HANDLE), dispatch_indices(dispatch_indices),
     trace_rays_indices(trace_rays_indices), bound_pipelines{ nullptr },
@@ -61,7 +63,7 @@ DispatchTraceRaysDumpingContext::DispatchTraceRaysDumpingContext(const std::vect
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
     device_table(nullptr), parent_device(VK_NULL_HANDLE), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), current_dispatch_index(0), current_trace_rays_index(0), dump_json(dump_json),
-    output_json_per_command(options.dump_resources_json_per_command),
+    dump_archive(dump_archive), hasher(hasher), output_json_per_command(options.dump_resources_json_per_command),
     dump_immutable_resources(options.dump_resources_dump_immutable_resources),
     dump_all_image_subresources(options.dump_resources_dump_all_image_subresources), capture_filename(capture_filename),
     reached_end_command_buffer(false), dump_images_raw(options.dump_resources_dump_raw_images),
@@ -85,6 +87,7 @@ void DispatchTraceRaysDumpingContext::Release()
             {
                 DestroyMutableResourcesClones();
                 ReleaseIndirectParams();
+                resources_util.reset();
 
                 VkDevice device = device_info->handle;
 
@@ -111,6 +114,27 @@ void DispatchTraceRaysDumpingContext::Release()
     trace_rays_params.clear();
 }
 
+graphics::VulkanResourcesUtil& DispatchTraceRaysDumpingContext::GetResourcesUtil(const VulkanDeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    if (resources_util == nullptr)
+    {
+        const VulkanPhysicalDeviceInfo* phys_dev_info =
+            object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
+        assert(phys_dev_info);
+
+        resources_util =
+            std::make_unique<graphics::VulkanResourcesUtil>(device_info->handle,
+                                                            device_info->parent,
+                                                            *device_table,
+                                                            *instance_table,
+                                                            *phys_dev_info->replay_device_info->memory_properties);
+    }
+
+    return *resources_util;
+}
+
 VkResult DispatchTraceRaysDumpingContext::CloneCommandBuffer(VulkanCommandBufferInfo*           orig_cmd_buf_info,
                                                              const encode::VulkanDeviceTable*   dev_table,
                                                              const encode::VulkanInstanceTable* inst_table)
@@ -1057,14 +1081,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
     const VulkanDeviceInfo* device_info = object_info_table.GetVkDeviceInfo(original_command_buffer_info->parent_id);
     assert(device_info);
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
-
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
 
     if (dump_resources_before)
     {
@@ -1137,6 +1154,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                            dump_resources_scale,
                                            scaling_supported,
                                            image_file_format,
+                                           dump_archive,
+                                           hasher,
                                            false,
                                            dump_images_raw,
                                            dump_images_separate_alpha,
@@ -1164,7 +1183,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
             assert(buffer_info != nullptr);
             assert(mutable_resources_clones_before.buffers[i].buffer != VK_NULL_HANDLE);
 
-            std::vector<uint8_t> data;
+            std::vector<uint8_t>    data;
+            ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
 
             VkResult res = resource_util.ReadFromBufferResource(mutable_resources_clones_before.buffers[i].buffer,
                                                                 buffer_info->size,
@@ -1177,6 +1197,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                 return res;
             }
 
+            readback_usage.Set(data.capacity());
+
             const uint32_t              desc_set    = mutable_resources_clones_before.buffers[i].desc_set;
             const uint32_t              binding     = mutable_resources_clones_before.buffers[i].desc_binding;
             const uint32_t              array_index = mutable_resources_clones_before.buffers[i].array_index;
@@ -1184,7 +1206,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
 
             std::string filename = GenerateDispatchTraceRaysBufferFilename(
                 is_dispatch, qs_index, bcb_index, cmd_index, desc_set, binding, array_index, stage, true);
-            util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+            WriteDumpedBuffer(dump_archive, filename, data.data(), data.size());
         }
     }
 
@@ -1256,6 +1278,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       dump_archive,
+                                       hasher,
                                        false,
                                        dump_images_raw,
                                        dump_images_separate_alpha,
@@ -1277,32 +1301,82 @@ VkResult DispatchTraceRaysDumpingContext::DumpMutableResources(uint64_t bcb_inde
     }
 
     // Dump buffers
+    ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
+    VkResult                readback_result = VK_SUCCESS;
+
+    std::vector<std::string> filenames(mutable_resources_clones.buffers.size());
+    for (size_t i = 0; i < mutable_resources_clones.buffers.size(); ++i)
+    {
+        const uint32_t              desc_set    = mutable_resources_clones.buffers[i].desc_set;
+        const uint32_t              binding     = mutable_resources_clones.buffers[i].desc_binding;
+        const uint32_t              array_index = mutable_resources_clones.buffers[i].array_index;
+        const VkShaderStageFlagBits stage       = mutable_resources_clones.buffers[i].stage;
+
+        filenames[i] = GenerateDispatchTraceRaysBufferFilename(
+            is_dispatch, qs_index, bcb_index, cmd_index, desc_set, binding, array_index, stage, false);
+    }
+
+    // The buffers are hashed with a single submission, and only those that changed since they were last dumped are
+    // read back.
+    std::vector<bool> unchanged_buffers(mutable_resources_clones.buffers.size(), false);
+    if (hasher != nullptr)
+    {
+        for (size_t i = 0; i < mutable_resources_clones.buffers.size(); ++i)
+        {
+            const VulkanBufferInfo* buffer_info = mutable_resources_clones.buffers[i].original_buffer;
+            assert(buffer_info != nullptr);
+
+            hasher->QueueBuffer(buffer_info,
+                                mutable_resources_clones.buffers[i].buffer,
+                                device_info,
+                                device_table,
+                                instance_table,
+                                0,
+                                buffer_info->size,
+                                filenames[i]);
+        }
+
+        unchanged_buffers = hasher->SubmitQueued();
+    }
+
     for (size_t i = 0; i < mutable_resources_clones.buffers.size(); ++i)
     {
         assert(mutable_resources_clones.buffers[i].original_buffer != nullptr);
         assert(mutable_resources_clones.buffers[i].buffer != VK_NULL_HANDLE);
         const VulkanBufferInfo* buffer_info = mutable_resources_clones.buffers[i].original_buffer;
-        std::vector<uint8_t>    data;
+        const std::string&      filename    = filenames[i];
 
-        VkResult res = resource_util.ReadFromBufferResource(
-            mutable_resources_clones.buffers[i].buffer, buffer_info->size, 0, buffer_info->queue_family_index, data);
-        if (res != VK_SUCCESS)
+        if (unchanged_buffers[i])
         {
-            GFXRECON_LOG_ERROR("Reading from buffer resource failed (%s)", util::ToString<VkResult>(res).c_str())
-            return res;
+            continue;
         }
 
-        const uint32_t              desc_set    = mutable_resources_clones.buffers[i].desc_set;
-        const uint32_t              binding     = mutable_resources_clones.buffers[i].desc_binding;
-        const uint32_t              array_index = mutable_resources_clones.buffers[i].array_index;
-        const VkShaderStageFlagBits stage       = mutable_resources_clones.buffers[i].stage;
+        // The copies of all buffers are batched, and each file is written from the readback staging memory.
+        resource_util.ReadFromBufferResourceAsync(
+            mutable_resources_clones.buffers[i].buffer,
+            buffer_info->size,
+            0,
+            buffer_info->queue_family_index,
+            [this, filename, &readback_result](VkResult res, const uint8_t* data, uint64_t data_size) {
+                if (res != VK_SUCCESS)
+                {
+                    GFXRECON_LOG_ERROR("Reading from buffer resource failed (%s)",
+                                       util::ToString<VkResult>(res).c_str())
+                    if (readback_result == VK_SUCCESS)
+                    {
+                        readback_result = res;
+                    }
+                    return;
+                }
 
-        std::string filename = GenerateDispatchTraceRaysBufferFilename(
-            is_dispatch, qs_index, bcb_index, cmd_index, desc_set, binding, array_index, stage, false);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+                WriteDumpedBuffer(dump_archive, filename, data, static_cast<size_t>(data_size));
+            });
     }
 
-    return VK_SUCCESS;
+    resource_util.FlushReadbacks();
+    readback_usage.Set(resource_util.GetReadbackStagingSize());
+
+    return readback_result;
 }
 
 bool DispatchTraceRaysDumpingContext::IsRecording() const
@@ -1750,6 +1824,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       dump_archive,
+                                       hasher,
                                        dump_all_image_subresources,
                                        dump_images_raw);
         if (res != VK_SUCCESS)
@@ -1768,14 +1844,7 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
         }
     }
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
-
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
 
     for (const auto& buf : buffer_descriptors)
     {
@@ -1784,6 +1853,8 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
         const VkDeviceSize      range       = buf.second.range;
         const VkDeviceSize      size        = range == VK_WHOLE_SIZE ? buffer_info->size - offset : range;
 
+        ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
+
         std::vector<uint8_t> data;
         VkResult             res = resource_util.ReadFromBufferResource(
             buffer_info->handle, size, offset, buffer_info->queue_family_index, data);
@@ -1793,15 +1864,17 @@ VkResult DispatchTraceRaysDumpingContext::DumpImmutableDescriptors(uint64_t qs_i
             return res;
         }
 
+        readback_usage.Set(data.capacity());
+
         const std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, buffer_info->capture_id);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+        WriteDumpedBuffer(dump_archive, filename, data.data(), data.size());
     }
 
     for (const auto& iub : inline_uniform_blocks)
     {
         std::string filename =
             GenerateInlineUniformBufferDescriptorFilename(qs_index, bcb_index, iub.second.set, iub.second.binding);
-        util::bufferwriter::WriteBuffer(filename, iub.second.data->data(), iub.second.data->size());
+        WriteDumpedBuffer(dump_archive, filename, iub.second.data->data(), iub.second.data->size());
     }
 
     return VK_SUCCESS;
@@ -1984,14 +2057,7 @@ VkResult DispatchTraceRaysDumpingContext::FetchIndirectParams()
     const VulkanDeviceInfo* device_info = object_info_table.GetVkDeviceInfo(original_command_buffer_info->parent_id);
     assert(device_info);
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
-
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
 
     for (auto& dis_params : dispatch_params)
     {
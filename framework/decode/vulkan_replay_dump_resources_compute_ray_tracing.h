@@ -28,12 +28,14 @@
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_replay_options.h"
 #include "generated/generated_vulkan_dispatch_table.h"
+#include "graphics/vulkan_resources_util.h"
 #include "decode/vulkan_replay_dump_resources_json.h"
 #include "format/format.h"
 #include "util/defines.h"
 #include "vulkan/vulkan_core.h"
 
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -46,12 +48,14 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class DispatchTraceRaysDumpingContext
 {
   public:
-    DispatchTraceRaysDumpingContext(const std::vector<uint64_t>&   dispatch_indices,
-                                    const std::vector<uint64_t>&   trace_rays_indices,
-                                    CommonObjectInfoTable&         object_info_table,
-                                    const VulkanReplayOptions&     options,
-                                    VulkanReplayDumpResourcesJson& dump_json,
-                                    std::string                    capture_filename);
+    DispatchTraceRaysDumpingContext(const std::vector<uint64_t>&     dispatch_indices,
+                                    const std::vector<uint64_t>&     trace_rays_indices,
+                                    CommonObjectInfoTable&           object_info_table,
+                                    const VulkanReplayOptions&       options,
+                                    VulkanReplayDumpResourcesJson&   dump_json,
+                                    util::DumpArchiveWriter*         dump_archive,
+                                    VulkanReplayDumpResourcesHasher* hasher,
+                                    std::string                      capture_filename);
 
     ~DispatchTraceRaysDumpingContext();
 
@@ -176,6 +180,8 @@ class DispatchTraceRaysDumpingContext
 
     void ReleaseIndirectParams();
 
+    graphics::VulkanResourcesUtil& GetResourcesUtil(const VulkanDeviceInfo* device_info);
+
     VkResult FetchIndirectParams();
 
     VkResult DumpImmutableDescriptors(uint64_t qs_index, uint64_t bcb_index, uint64_t cmd_index, bool is_dispatch);
@@ -190,21 +196,27 @@ class DispatchTraceRaysDumpingContext
                                           uint64_t tr_index,
                                           uint64_t cmd_index) const;
 
-    const VulkanCommandBufferInfo* original_command_buffer_info;
-    VkCommandBuffer                DR_command_buffer;
-    std::vector<uint64_t>          dispatch_indices;
-    std::vector<uint64_t>          trace_rays_indices;
-    const VulkanPipelineInfo*      bound_pipelines[kBindPoint_count];
-    bool                           dump_resources_before;
-    const std::string&             dump_resource_path;
-    util::ScreenshotFormat         image_file_format;
-    float                          dump_resources_scale;
-    VulkanReplayDumpResourcesJson& dump_json;
-    bool                           output_json_per_command;
-    bool                           dump_immutable_resources;
-    bool                           dump_all_image_subresources;
-    bool                           dump_images_raw;
-    bool                           dump_images_separate_alpha;
+    const VulkanCommandBufferInfo*   original_command_buffer_info;
+    VkCommandBuffer                  DR_command_buffer;
+    std::vector<uint64_t>            dispatch_indices;
+    std::vector<uint64_t>            trace_rays_indices;
+    const VulkanPipelineInfo*        bound_pipelines[kBindPoint_count];
+    bool                             dump_resources_before;
+    const std::string&               dump_resource_path;
+    util::ScreenshotFormat           image_file_format;
+    float                            dump_resources_scale;
+    VulkanReplayDumpResourcesJson&   dump_json;
+    util::DumpArchiveWriter*         dump_archive;
+    VulkanReplayDumpResourcesHasher* hasher;
+    bool                             output_json_per_command;
+    bool                             dump_immutable_resources;
+    bool                             dump_all_image_subresources;
+    bool                             dump_images_raw;
+    bool                             dump_images_separate_alpha;
+
+    // Created on first use and kept until the context is released, so that readback staging memory and command pools
+    // are reused by every dump of the command buffer.
+    std::unique_ptr<graphics::VulkanResourcesUtil> resources_util;
 
     // One entry per descriptor set for each compute and ray tracing binding points
     std::unordered_map<uint32_t, VulkanDescriptorSetInfo> bound_descriptor_sets_compute;
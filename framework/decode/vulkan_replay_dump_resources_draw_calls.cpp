@@ -23,12 +23,12 @@
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_replay_dump_resources_draw_calls.h"
 #include "decode/vulkan_replay_dump_resources_common.h"
+#include "decode/replay_memory_tracker.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_enum_to_string.h"
 #include "graphics/vulkan_resources_util.h"
 #include "nlohmann/json.hpp"
 #include "util/image_writer.h"
-#include "util/buffer_writer.h"
 #include "Vulkan-Utility-Libraries/vk_format_utils.h"
 #include "util/logging.h"
 #include "util/platform.h"
@@ -59,6 +59,8 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
                                                  CommonObjectInfoTable&                    object_info_table,
                                                  const VulkanReplayOptions&                options,
                                                  VulkanReplayDumpResourcesJson&            dump_json,
+                                                 util::DumpArchiveWriter*                  dump_archive,
+                                                 VulkanReplayDumpResourcesHasher*          hasher,
                                                  std::string                               capture_filename) :
     original_command_buffer_info(nullptr),
     current_cb_index(0), dc_indices(dc_indices), RP_indices(rp_indices), active_renderpass(nullptr),
@@ -67,7 +69,7 @@ DrawCallsDumpingContext::DrawCallsDumpingContext(const std::vector<uint64_t>&
     device_table(nullptr), instance_table(nullptr), object_info_table(object_info_table),
     replay_device_phys_mem_props(nullptr), dump_resource_path(options.dump_resources_output_dir),
     image_file_format(options.dump_resources_image_format), dump_resources_scale(options.dump_resources_scale),
-    dump_json(dump_json), dump_depth(options.dump_resources_dump_depth),
+    dump_json(dump_json), dump_archive(dump_archive), hasher(hasher), dump_depth(options.dump_resources_dump_depth),
     color_attachment_to_dump(options.dump_resources_color_attachment_index),
     dump_vertex_index_buffers(options.dump_resources_dump_vertex_index_buffer),
     output_json_per_command(options.dump_resources_json_per_command),
@@ -128,6 +130,7 @@ void DrawCallsDumpingContext::Release()
 
         DestroyMutableResourceBackups();
         ReleaseIndirectParams();
+        resources_util.reset();
 
         original_command_buffer_info = nullptr;
     }
@@ -143,6 +146,27 @@ void DrawCallsDumpingContext::Release()
     current_cb_index   = 0;
 }
 
+graphics::VulkanResourcesUtil& DrawCallsDumpingContext::GetResourcesUtil(const VulkanDeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    if (resources_util == nullptr)
+    {
+        const VulkanPhysicalDeviceInfo* phys_dev_info =
+            object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
+        assert(phys_dev_info);
+
+        resources_util =
+            std::make_unique<graphics::VulkanResourcesUtil>(device_info->handle,
+                                                            device_info->parent,
+                                                            *device_table,
+                                                            *instance_table,
+                                                            *phys_dev_info->replay_device_info->memory_properties);
+    }
+
+    return *resources_util;
+}
+
 void DrawCallsDumpingContext::InsertNewDrawParameters(
     uint64_t index, uint32_t vertex_count, uint32_t instance_count, uint32_t first_vertex, uint32_t first_instance)
 {
@@ -1721,6 +1745,8 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       dump_archive,
+                                       hasher,
                                        dump_all_image_subresources,
                                        dump_images_raw,
                                        dump_images_separate_alpha,
@@ -1799,6 +1825,8 @@ VkResult DrawCallsDumpingContext::DumpRenderTargetAttachments(
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       dump_archive,
+                                       hasher,
                                        dump_all_image_subresources,
                                        dump_images_raw,
                                        dump_images_separate_alpha,
@@ -2089,6 +2117,8 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
                                        dump_resources_scale,
                                        scaling_supported,
                                        image_file_format,
+                                       dump_archive,
+                                       hasher,
                                        dump_all_image_subresources,
                                        dump_images_raw,
                                        dump_images_separate_alpha);
@@ -2108,42 +2138,87 @@ DrawCallsDumpingContext::DumpImmutableDescriptors(uint64_t qs_index, uint64_t bc
         }
     }
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
+    ScopedReplayMemoryUsage        readback_usage(ReplayMemoryTracker::kDumpResources);
+
+    VkResult readback_result = VK_SUCCESS;
+
+    // The descriptors are hashed with a single submission, and only those that changed since they were last dumped
+    // are read back.
+    std::vector<bool> unchanged_buffers;
+    if (hasher != nullptr)
+    {
+        for (const auto& buf : buffer_descriptors)
+        {
+            const VulkanBufferInfo* buffer_info = buf.first;
+            const VkDeviceSize      offset      = buf.second.offset;
+            const VkDeviceSize      range       = buf.second.range;
+            const VkDeviceSize      size        = range == VK_WHOLE_SIZE ? buffer_info->size - offset : range;
+
+            hasher->QueueBuffer(buffer_info,
+                                buffer_info->handle,
+                                device_info,
+                                device_table,
+                                instance_table,
+                                offset,
+                                size,
+                                GenerateBufferDescriptorFilename(qs_index, bcb_index, rp, buffer_info->capture_id));
+        }
 
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+        unchanged_buffers = hasher->SubmitQueued();
+    }
 
+    size_t buffer_index = 0;
     for (const auto& buf : buffer_descriptors)
     {
+        if (!unchanged_buffers.empty() && unchanged_buffers[buffer_index++])
+        {
+            continue;
+        }
+
         const VulkanBufferInfo* buffer_info = buf.first;
         const VkDeviceSize      offset      = buf.second.offset;
         const VkDeviceSize      range       = buf.second.range;
         const VkDeviceSize      size        = range == VK_WHOLE_SIZE ? buffer_info->size - offset : range;
 
-        std::vector<uint8_t> data;
-        VkResult             res = resource_util.ReadFromBufferResource(
-            buffer_info->handle, size, offset, buffer_info->queue_family_index, data);
-        if (res != VK_SUCCESS)
-        {
-            GFXRECON_LOG_ERROR("Reading from buffer resource %" PRIu64 " failed (%s).",
-                               buffer_info->capture_id,
-                               util::ToString<VkResult>(res).c_str())
-            return res;
-        }
-
         const std::string filename = GenerateBufferDescriptorFilename(qs_index, bcb_index, rp, buffer_info->capture_id);
-        util::bufferwriter::WriteBuffer(filename, data.data(), data.size());
+
+        // The copies of all descriptors are batched, and each file is written from the readback staging memory.
+        resource_util.ReadFromBufferResourceAsync(
+            buffer_info->handle,
+            size,
+            offset,
+            buffer_info->queue_family_index,
+            [this, buffer_info, filename, &readback_result](VkResult res, const uint8_t* data, uint64_t data_size) {
+                if (res != VK_SUCCESS)
+                {
+                    GFXRECON_LOG_ERROR("Reading from buffer resource %" PRIu64 " failed (%s).",
+                                       buffer_info->capture_id,
+                                       util::ToString<VkResult>(res).c_str())
+                    if (readback_result == VK_SUCCESS)
+                    {
+                        readback_result = res;
+                    }
+                    return;
+                }
+
+                WriteDumpedBuffer(dump_archive, filename, data, static_cast<size_t>(data_size));
+            });
+    }
+
+    resource_util.FlushReadbacks();
+    readback_usage.Set(resource_util.GetReadbackStagingSize());
+
+    if (readback_result != VK_SUCCESS)
+    {
+        return readback_result;
     }
 
     for (const auto& iub : inline_uniform_blocks)
     {
         std::string filename =
             GenerateInlineUniformBufferDescriptorFilename(qs_index, bcb_index, iub.second.set, iub.second.binding);
-        util::bufferwriter::WriteBuffer(filename, iub.second.data->data(), iub.second.data->size());
+        WriteDumpedBuffer(dump_archive, filename, iub.second.data->data(), iub.second.data->size());
     }
 
     return VK_SUCCESS;
@@ -2187,14 +2262,7 @@ VkResult DrawCallsDumpingContext::FetchDrawIndirectParams(uint64_t dc_index)
     const VulkanDeviceInfo* device_info = object_info_table.GetVkDeviceInfo(original_command_buffer_info->parent_id);
     assert(device_info);
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
-
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
 
     auto dc_param_entry = draw_call_params.find(dc_index);
     assert(dc_param_entry != draw_call_params.end());
@@ -2347,14 +2415,7 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
     const VulkanDeviceInfo* device_info = object_info_table.GetVkDeviceInfo(original_command_buffer_info->parent_id);
     assert(device_info);
 
-    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table.GetVkPhysicalDeviceInfo(device_info->parent_id);
-    assert(phys_dev_info);
-
-    graphics::VulkanResourcesUtil resource_util(device_info->handle,
-                                                device_info->parent,
-                                                *device_table,
-                                                *instance_table,
-                                                *phys_dev_info->replay_device_info->memory_properties);
+    graphics::VulkanResourcesUtil& resource_util = GetResourcesUtil(device_info);
 
     auto dc_params_entry = draw_call_params.find(dc_index);
     assert(dc_params_entry != draw_call_params.end());
@@ -2450,6 +2511,8 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
 
             dc_params.referenced_index_buffer.actual_size = total_size;
 
+            ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
+
             std::vector<uint8_t> index_data;
             VkResult             res =
                 resource_util.ReadFromBufferResource(dc_params.referenced_index_buffer.buffer_info->handle,
@@ -2465,8 +2528,10 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
                 return res;
             }
 
+            readback_usage.Set(index_data.capacity());
+
             std::string filename = GenerateIndexBufferFilename(qs_index, bcb_index, dc_index, index_type);
-            util::bufferwriter::WriteBuffer(filename, index_data.data(), index_data.size());
+            WriteDumpedBuffer(dump_archive, filename, index_data.data(), index_data.size());
 
             for (const auto& pairs : index_count_first_index_pairs)
             {
@@ -2669,6 +2734,8 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
 
                 vb_entry->second.actual_size = total_size;
 
+                ScopedReplayMemoryUsage readback_usage(ReplayMemoryTracker::kDumpResources);
+
                 std::vector<uint8_t> vb_data;
                 VkResult             res = resource_util.ReadFromBufferResource(vb_entry->second.buffer_info->handle,
                                                                     total_size,
@@ -2682,8 +2749,10 @@ VkResult DrawCallsDumpingContext::DumpVertexIndexBuffers(uint64_t qs_index, uint
                     return res;
                 }
 
+                readback_usage.Set(vb_data.capacity());
+
                 std::string filename = GenerateVertexBufferFilename(qs_index, bcb_index, dc_index, binding);
-                util::bufferwriter::WriteBuffer(filename, vb_data.data(), vb_data.size());
+                WriteDumpedBuffer(dump_archive, filename, vb_data.data(), vb_data.size());
             }
         }
     }
@@ -29,11 +29,13 @@
 #include "decode/vulkan_replay_options.h"
 #include "decode/vulkan_replay_dump_resources_json.h"
 #include "generated/generated_vulkan_dispatch_table.h"
+#include "graphics/vulkan_resources_util.h"
 #include "format/format.h"
 #include "util/defines.h"
 #include "vulkan/vulkan_core.h"
 
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -49,6 +51,8 @@ class DrawCallsDumpingContext
                             CommonObjectInfoTable&                    object_info_table,
                             const VulkanReplayOptions&                options,
                             VulkanReplayDumpResourcesJson&            dump_json,
+                            util::DumpArchiveWriter*                  dump_archive,
+                            VulkanReplayDumpResourcesHasher*          hasher,
                             std::string                               capture_filename);
 
     ~DrawCallsDumpingContext();
@@ -245,6 +249,8 @@ class DrawCallsDumpingContext
 
     VkResult RevertMutableResources(VkQueue queue);
 
+    graphics::VulkanResourcesUtil& GetResourcesUtil(const VulkanDeviceInfo* device_info);
+
     VkResult FetchDrawIndirectParams(uint64_t dc_index);
 
     void GenerateOutputJsonDrawCallInfo(
@@ -268,6 +274,8 @@ class DrawCallsDumpingContext
     util::ScreenshotFormat             image_file_format;
     float                              dump_resources_scale;
     VulkanReplayDumpResourcesJson&     dump_json;
+    util::DumpArchiveWriter*           dump_archive;
+    VulkanReplayDumpResourcesHasher*   hasher;
     bool                               dump_depth;
     int32_t                            color_attachment_to_dump;
     bool                               dump_vertex_index_buffers;
@@ -277,6 +285,10 @@ class DrawCallsDumpingContext
     bool                               dump_images_raw;
     bool                               dump_images_separate_alpha;
 
+    // Created on first use and kept until the context is released, so that readback staging memory and command pools
+    // are reused by every dump of the command buffer.
+    std::unique_ptr<graphics::VulkanResourcesUtil> resources_util;
+
     enum RenderPassType
     {
         kNone,
@@ -0,0 +1,953 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/vulkan_replay_dump_resources_hasher.h"
+#include "decode/vulkan_replay_dump_resources_hasher_shaders.h"
+#include "decode/vulkan_replay_dump_resources_common.h"
+#include "generated/generated_vulkan_enum_to_string.h"
+#include "util/logging.h"
+
+#include "Vulkan-Utility-Libraries/vk_format_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <limits>
+#include <numeric>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+static VkDeviceSize AlignSize(VkDeviceSize size, VkDeviceSize alignment)
+{
+    return ((size + alignment - 1) / alignment) * alignment;
+}
+
+VulkanReplayDumpResourcesHasher::VulkanReplayDumpResourcesHasher(CommonObjectInfoTable& object_info_table) :
+    object_info_table_(object_info_table), unchanged_count_(0), unchanged_size_(0)
+{}
+
+VulkanReplayDumpResourcesHasher::~VulkanReplayDumpResourcesHasher()
+{
+    Release();
+}
+
+void VulkanReplayDumpResourcesHasher::Release()
+{
+    // Content that was queued but not submitted is discarded, and its command buffer is freed with its pool.
+    queued_.clear();
+    batch_ = Batch{};
+
+    for (auto& entry : device_contexts_)
+    {
+        // Skip devices that were already destroyed, along with the objects created from them.
+        if (object_info_table_.GetVkDeviceInfo(entry.first) != nullptr)
+        {
+            DestroyDeviceContext(&entry.second);
+        }
+    }
+
+    device_contexts_.clear();
+
+    if (unchanged_count_ > 0)
+    {
+        GFXRECON_LOG_INFO("Dump resources skipped the readback of %" PRIu64 " unchanged resources (%" PRIu64 " bytes)",
+                          unchanged_count_,
+                          unchanged_size_);
+        unchanged_count_ = 0;
+        unchanged_size_  = 0;
+    }
+}
+
+size_t VulkanReplayDumpResourcesHasher::QueueImage(const VulkanImageInfo*             image_info,
+                                                   const VulkanDeviceInfo*            device_info,
+                                                   const encode::VulkanDeviceTable*   device_table,
+                                                   const encode::VulkanInstanceTable* instance_table,
+                                                   VkImageAspectFlagBits              aspect,
+                                                   VkImageLayout                      layout,
+                                                   const VkExtent3D&                  extent,
+                                                   const std::vector<std::string>&    filenames)
+{
+    assert(image_info != nullptr);
+
+    DeviceContext* context = nullptr;
+
+    if ((image_info->sample_count == VK_SAMPLE_COUNT_1_BIT) && (vkuFormatPlaneCount(image_info->format) <= 1) &&
+        (layout != VK_IMAGE_LAYOUT_UNDEFINED) && (layout != VK_IMAGE_LAYOUT_PREINITIALIZED))
+    {
+        context = GetDeviceContext(device_info, device_table, instance_table);
+    }
+
+    const size_t content_index = queued_.size();
+    queued_.emplace_back();
+
+    if (context == nullptr)
+    {
+        return content_index;
+    }
+
+    // Lay out all mip levels and array layers in the scratch buffer, with offsets aligned to both the texel block size
+    // and 4 bytes as required for buffer image copies. Packed 24-bit depth is copied as 32-bit values.
+    const VKU_FORMAT_INFO format_info = vkuGetFormatInfo(image_info->format);
+    const uint32_t        block_size  = std::max(vkuFormatElementSizeWithAspect(image_info->format, aspect),
+                                         (aspect == VK_IMAGE_ASPECT_DEPTH_BIT) ? 4u : 1u);
+    const VkDeviceSize    alignment   = ((block_size % 4) == 0) ? block_size : (block_size * 4);
+
+    std::vector<VkBufferImageCopy> regions(image_info->level_count);
+    VkDeviceSize                   size = 0;
+
+    for (uint32_t level = 0; level < image_info->level_count; ++level)
+    {
+        const VkExtent3D level_extent = { std::max(1u, image_info->extent.width >> level),
+                                          std::max(1u, image_info->extent.height >> level),
+                                          std::max(1u, image_info->extent.depth >> level) };
+
+        const VkDeviceSize blocks_x = (level_extent.width + format_info.block_extent.width - 1) /
+                                      format_info.block_extent.width;
+        const VkDeviceSize blocks_y = (level_extent.height + format_info.block_extent.height - 1) /
+                                      format_info.block_extent.height;
+        const VkDeviceSize blocks_z = (level_extent.depth + format_info.block_extent.depth - 1) /
+                                      format_info.block_extent.depth;
+
+        VkBufferImageCopy& region              = regions[level];
+        region.bufferOffset                    = AlignSize(size, alignment);
+        region.bufferRowLength                 = 0;
+        region.bufferImageHeight               = 0;
+        region.imageSubresource.aspectMask     = aspect;
+        region.imageSubresource.mipLevel       = level;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount     = image_info->layer_count;
+        region.imageOffset                     = { 0, 0, 0 };
+        region.imageExtent                     = level_extent;
+
+        size = region.bufferOffset + (blocks_x * blocks_y * blocks_z * block_size * image_info->layer_count);
+    }
+
+    const VkImage  image              = image_info->handle;
+    const uint32_t queue_family_index = image_info->queue_family_index;
+
+    const auto record_copy = [&](VkCommandBuffer command_buffer, VkBuffer scratch_buffer, VkDeviceSize scratch_offset) {
+        for (VkBufferImageCopy& region : regions)
+        {
+            region.bufferOffset += scratch_offset;
+        }
+
+        VkImageMemoryBarrier barrier;
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.oldLayout                       = layout;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = aspect;
+        barrier.subresourceRange.baseMipLevel   = 0;
+        barrier.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &barrier);
+
+        device_table->CmdCopyImageToBuffer(command_buffer,
+                                           image,
+                                           VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                           scratch_buffer,
+                                           static_cast<uint32_t>(regions.size()),
+                                           regions.data());
+
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.newLayout     = layout;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                         0,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr,
+                                         1,
+                                         &barrier);
+    };
+
+    const uint64_t key_data[] = {
+        image_info->capture_id, aspect, extent.width, extent.height, extent.depth, filenames.size()
+    };
+
+    QueuedContent& content = queued_[content_index];
+    content.key            = util::hash::murmur3_128(key_data, sizeof(key_data));
+    content.size           = size;
+    content.filenames      = filenames;
+
+    QueueContent(context, queue_family_index, size, alignment, record_copy, content_index);
+
+    return content_index;
+}
+
+size_t VulkanReplayDumpResourcesHasher::QueueBuffer(const VulkanBufferInfo*            buffer_info,
+                                                    VkBuffer                           buffer,
+                                                    const VulkanDeviceInfo*            device_info,
+                                                    const encode::VulkanDeviceTable*   device_table,
+                                                    const encode::VulkanInstanceTable* instance_table,
+                                                    VkDeviceSize                       offset,
+                                                    VkDeviceSize                       size,
+                                                    const std::string&                 filename)
+{
+    assert(buffer_info != nullptr);
+
+    DeviceContext* context = nullptr;
+
+    if (size > 0)
+    {
+        context = GetDeviceContext(device_info, device_table, instance_table);
+    }
+
+    const size_t content_index = queued_.size();
+    queued_.emplace_back();
+
+    if (context == nullptr)
+    {
+        return content_index;
+    }
+
+    const auto record_copy = [&](VkCommandBuffer command_buffer, VkBuffer scratch_buffer, VkDeviceSize scratch_offset) {
+        VkMemoryBarrier barrier;
+        barrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext         = nullptr;
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        device_table->CmdPipelineBarrier(command_buffer,
+                                         VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                         VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                         0,
+                                         1,
+                                         &barrier,
+                                         0,
+                                         nullptr,
+                                         0,
+                                         nullptr);
+
+        const VkBufferCopy region = { offset, scratch_offset, size };
+        device_table->CmdCopyBuffer(command_buffer, buffer, scratch_buffer, 1, &region);
+    };
+
+    const uint64_t key_data[] = { buffer_info->capture_id, offset, size };
+
+    QueuedContent& content = queued_[content_index];
+    content.key            = util::hash::murmur3_128(key_data, sizeof(key_data));
+    content.size           = size;
+    content.filenames      = { filename };
+
+    QueueContent(context, buffer_info->queue_family_index, size, sizeof(uint32_t), record_copy, content_index);
+
+    return content_index;
+}
+
+std::vector<bool> VulkanReplayDumpResourcesHasher::SubmitQueued()
+{
+    // A failed submission leaves its content unhashed, which is reported as changed.
+    SubmitBatch();
+
+    std::vector<bool> unchanged(queued_.size(), false);
+
+    // Content is compared in queue order, so that a resource queued twice references the files of its first dump.
+    for (size_t i = 0; i < queued_.size(); ++i)
+    {
+        const QueuedContent& content = queued_[i];
+        if (content.hashed)
+        {
+            unchanged[i] = CompareContent(content.key, content.hash, content.size, content.filenames);
+        }
+    }
+
+    queued_.clear();
+
+    return unchanged;
+}
+
+bool VulkanReplayDumpResourcesHasher::CompareContent(const util::hash::Hash128&      key,
+                                                     const util::hash::Hash128&      hash,
+                                                     VkDeviceSize                    size,
+                                                     const std::vector<std::string>& filenames)
+{
+    auto entry = dumped_content_.find(key);
+    if ((entry != dumped_content_.end()) && (entry->second.hash == hash) &&
+        (entry->second.filenames.size() == filenames.size()))
+    {
+        for (size_t i = 0; i < filenames.size(); ++i)
+        {
+            file_references_[filenames[i]] = entry->second.filenames[i];
+        }
+
+        ++unchanged_count_;
+        unchanged_size_ += size;
+
+        return true;
+    }
+
+    DumpedContent& content = dumped_content_[key];
+    content.hash           = hash;
+    content.filenames      = filenames;
+
+    return false;
+}
+
+bool VulkanReplayDumpResourcesHasher::QueueContent(DeviceContext*        context,
+                                                   uint32_t              queue_family_index,
+                                                   VkDeviceSize          size,
+                                                   VkDeviceSize          alignment,
+                                                   const RecordCopyFunc& record_copy,
+                                                   size_t                content_index)
+{
+    assert(context != nullptr);
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+    const VkDeviceSize               word_size    = AlignSize(size, sizeof(uint32_t));
+
+    // Content that does not fit in a single storage buffer binding is dumped without checking for changes.
+    if (word_size > context->max_storage_buffer_range)
+    {
+        return false;
+    }
+
+    QueueContext* queue_context = GetQueueContext(context, queue_family_index);
+    if (queue_context == nullptr)
+    {
+        return false;
+    }
+
+    // Content is placed at offsets that are suitable for both the copy and the storage buffer binding that reads it.
+    const VkDeviceSize offset_alignment = std::lcm(alignment, context->min_storage_buffer_offset_alignment);
+    VkDeviceSize       scratch_offset   = AlignSize(batch_.scratch_used, offset_alignment);
+    VkDeviceSize       scratch_size     = word_size;
+
+    if (!batch_.slots.empty() &&
+        ((batch_.context != context) || (batch_.queue_context != queue_context) ||
+         (batch_.slots.size() == kMaxBatchCount) || ((scratch_offset + word_size) > context->scratch_size)))
+    {
+        // Scratch memory grows so that later batches of similar content fit in a single submission.
+        if ((batch_.context == context) && ((scratch_offset + word_size) > context->scratch_size))
+        {
+            scratch_size = std::max(word_size, std::min(scratch_offset + word_size, kMaxBatchScratchSize));
+        }
+
+        // A failed submission leaves the content of the batch unhashed, which is reported as changed.
+        SubmitBatch();
+        scratch_offset = 0;
+    }
+
+    VkCommandBuffer command_buffer = queue_context->command_buffer;
+
+    if (batch_.slots.empty())
+    {
+        if (ReserveScratchBuffer(context, scratch_size) != VK_SUCCESS)
+        {
+            return false;
+        }
+
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        device_table->ResetCommandBuffer(command_buffer, 0);
+
+        VkResult result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR(
+                "%s(): BeginCommandBuffer failed with %s", __func__, util::ToString<VkResult>(result).c_str());
+            return false;
+        }
+
+        batch_.context       = context;
+        batch_.queue_context = queue_context;
+        batch_.scratch_used  = 0;
+    }
+
+    // Clear the padding between and after the copied regions, so that it does not affect the hash.
+    device_table->CmdFillBuffer(command_buffer, context->scratch_buffer, scratch_offset, word_size, 0);
+
+    VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    device_table->CmdPipelineBarrier(command_buffer,
+                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     0,
+                                     1,
+                                     &barrier,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr);
+
+    record_copy(command_buffer, context->scratch_buffer, scratch_offset);
+
+    batch_.slots.push_back({ content_index, scratch_offset, word_size });
+    batch_.scratch_used = scratch_offset + word_size;
+
+    return true;
+}
+
+VkResult VulkanReplayDumpResourcesHasher::SubmitBatch()
+{
+    if (batch_.slots.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    DeviceContext*                   context        = batch_.context;
+    const encode::VulkanDeviceTable* device_table   = context->device_table;
+    VkCommandBuffer                  command_buffer = batch_.queue_context->command_buffer;
+    const uint32_t                   slot_count     = static_cast<uint32_t>(batch_.slots.size());
+    const VkDeviceSize               lanes_size     = kLaneCount * sizeof(uint32_t);
+
+    // Each slot reads its content through its own descriptor set, which is updated before it is bound.
+    const VkWriteDescriptorSet          write = { VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET };
+    std::vector<VkDescriptorBufferInfo> buffer_infos(slot_count * 2);
+    std::vector<VkWriteDescriptorSet>   writes(slot_count, write);
+
+    for (uint32_t i = 0; i < slot_count; ++i)
+    {
+        const BatchSlot& slot = batch_.slots[i];
+
+        buffer_infos[i * 2]     = { context->scratch_buffer, slot.scratch_offset, slot.word_size };
+        buffer_infos[i * 2 + 1] = { context->result_buffer, i * lanes_size, lanes_size };
+
+        writes[i].dstSet          = context->descriptor_sets[i];
+        writes[i].dstBinding      = 0;
+        writes[i].dstArrayElement = 0;
+        writes[i].descriptorCount = 2;
+        writes[i].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[i].pBufferInfo     = &buffer_infos[i * 2];
+    }
+
+    device_table->UpdateDescriptorSets(context->device, slot_count, writes.data(), 0, nullptr);
+
+    VkMemoryBarrier barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+
+    device_table->CmdPipelineBarrier(command_buffer,
+                                     VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                     0,
+                                     1,
+                                     &barrier,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr);
+
+    device_table->CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, context->pipeline);
+
+    for (uint32_t i = 0; i < slot_count; ++i)
+    {
+        const uint32_t word_count = static_cast<uint32_t>(batch_.slots[i].word_size / sizeof(uint32_t));
+
+        device_table->CmdBindDescriptorSets(command_buffer,
+                                            VK_PIPELINE_BIND_POINT_COMPUTE,
+                                            context->pipeline_layout,
+                                            0,
+                                            1,
+                                            &context->descriptor_sets[i],
+                                            0,
+                                            nullptr);
+        device_table->CmdPushConstants(command_buffer,
+                                       context->pipeline_layout,
+                                       VK_SHADER_STAGE_COMPUTE_BIT,
+                                       0,
+                                       sizeof(word_count),
+                                       &word_count);
+        device_table->CmdDispatch(command_buffer, kWorkGroupCount, 1, 1);
+    }
+
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+
+    device_table->CmdPipelineBarrier(command_buffer,
+                                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                     VK_PIPELINE_STAGE_HOST_BIT,
+                                     0,
+                                     1,
+                                     &barrier,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr);
+
+    VkResult result = device_table->EndCommandBuffer(command_buffer);
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info       = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers    = &command_buffer;
+
+        device_table->ResetFences(context->device, 1, &context->fence);
+        result = device_table->QueueSubmit(batch_.queue_context->queue, 1, &submit_info, context->fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->WaitForFences(
+            context->device, 1, &context->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        // Only the lane hashes are read back. The result buffer is host coherent and persistently mapped.
+        for (uint32_t i = 0; i < slot_count; ++i)
+        {
+            QueuedContent& content = queued_[batch_.slots[i].content_index];
+            content.hash   = util::hash::murmur3_128(context->result_data + (i * kLaneCount), lanes_size);
+            content.hashed = true;
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("%s(): Hash submission failed with %s", __func__, util::ToString<VkResult>(result).c_str());
+    }
+
+    batch_ = Batch{};
+
+    return result;
+}
+
+VulkanReplayDumpResourcesHasher::DeviceContext*
+VulkanReplayDumpResourcesHasher::GetDeviceContext(const VulkanDeviceInfo*            device_info,
+                                                  const encode::VulkanDeviceTable*   device_table,
+                                                  const encode::VulkanInstanceTable* instance_table)
+{
+    assert((device_info != nullptr) && (device_table != nullptr) && (instance_table != nullptr));
+
+    auto entry = device_contexts_.find(device_info->capture_id);
+    if (entry != device_contexts_.end())
+    {
+        // A device whose objects could not be created is only reported once.
+        return (entry->second.pipeline != VK_NULL_HANDLE) ? &entry->second : nullptr;
+    }
+
+    DeviceContext* context = &device_contexts_[device_info->capture_id];
+    context->device        = device_info->handle;
+    context->device_table  = device_table;
+
+    const VulkanPhysicalDeviceInfo* phys_dev_info = object_info_table_.GetVkPhysicalDeviceInfo(device_info->parent_id);
+    assert((phys_dev_info != nullptr) && (phys_dev_info->replay_device_info != nullptr));
+
+    if (phys_dev_info->replay_device_info->memory_properties)
+    {
+        context->memory_properties = *phys_dev_info->replay_device_info->memory_properties;
+    }
+    else
+    {
+        instance_table->GetPhysicalDeviceMemoryProperties(device_info->parent, &context->memory_properties);
+    }
+
+    VkPhysicalDeviceLimits limits;
+    if (phys_dev_info->replay_device_info->properties)
+    {
+        limits = phys_dev_info->replay_device_info->properties->limits;
+    }
+    else
+    {
+        VkPhysicalDeviceProperties properties;
+        instance_table->GetPhysicalDeviceProperties(device_info->parent, &properties);
+        limits = properties.limits;
+    }
+
+    context->max_storage_buffer_range            = limits.maxStorageBufferRange;
+    context->min_storage_buffer_offset_alignment = std::max<VkDeviceSize>(limits.minStorageBufferOffsetAlignment, 1);
+
+    uint32_t queue_family_count = 0;
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(device_info->parent, &queue_family_count, nullptr);
+    context->queue_family_properties.resize(queue_family_count);
+    instance_table->GetPhysicalDeviceQueueFamilyProperties(
+        device_info->parent, &queue_family_count, context->queue_family_properties.data());
+
+    if (CreatePipeline(context) != VK_SUCCESS)
+    {
+        GFXRECON_LOG_WARNING("Failed to create the dump resources hash pipeline. Resources will be dumped without "
+                             "checking for changes.");
+        DestroyDeviceContext(context);
+        return nullptr;
+    }
+
+    return context;
+}
+
+VkResult VulkanReplayDumpResourcesHasher::CreatePipeline(DeviceContext* context)
+{
+    assert(context != nullptr);
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+    const VkDevice                   device       = context->device;
+
+    VkDescriptorSetLayoutBinding bindings[2];
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        bindings[i].binding            = i;
+        bindings[i].descriptorType     = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[i].descriptorCount    = 1;
+        bindings[i].stageFlags         = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[i].pImmutableSamplers = nullptr;
+    }
+
+    VkDescriptorSetLayoutCreateInfo set_layout_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO };
+    set_layout_info.bindingCount                    = 2;
+    set_layout_info.pBindings                       = bindings;
+
+    VkResult result =
+        device_table->CreateDescriptorSetLayout(device, &set_layout_info, nullptr, &context->descriptor_set_layout);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    const VkPushConstantRange push_constant_range = { VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(uint32_t) };
+
+    VkPipelineLayoutCreateInfo pipeline_layout_info = { VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO };
+    pipeline_layout_info.setLayoutCount             = 1;
+    pipeline_layout_info.pSetLayouts                = &context->descriptor_set_layout;
+    pipeline_layout_info.pushConstantRangeCount     = 1;
+    pipeline_layout_info.pPushConstantRanges        = &push_constant_range;
+
+    result = device_table->CreatePipelineLayout(device, &pipeline_layout_info, nullptr, &context->pipeline_layout);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VkShaderModuleCreateInfo shader_module_info = { VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO };
+    shader_module_info.codeSize                 = g_dump_resources_hash_comp.size();
+    shader_module_info.pCode = reinterpret_cast<const uint32_t*>(g_dump_resources_hash_comp.data());
+
+    VkShaderModule shader_module = VK_NULL_HANDLE;
+    result = device_table->CreateShaderModule(device, &shader_module_info, nullptr, &shader_module);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    VkComputePipelineCreateInfo pipeline_info = { VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO };
+    pipeline_info.stage.sType                 = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeline_info.stage.stage                 = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_info.stage.module                = shader_module;
+    pipeline_info.stage.pName                 = "main";
+    pipeline_info.layout                      = context->pipeline_layout;
+
+    result =
+        device_table->CreateComputePipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &context->pipeline);
+
+    device_table->DestroyShaderModule(device, shader_module, nullptr);
+
+    if (result != VK_SUCCESS)
+    {
+        context->pipeline = VK_NULL_HANDLE;
+        return result;
+    }
+
+    // Every slot of a batch has its own descriptor set.
+    const VkDescriptorPoolSize pool_size = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kMaxBatchCount * 2 };
+
+    VkDescriptorPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
+    pool_info.maxSets                    = kMaxBatchCount;
+    pool_info.poolSizeCount              = 1;
+    pool_info.pPoolSizes                 = &pool_size;
+
+    result = device_table->CreateDescriptorPool(device, &pool_info, nullptr, &context->descriptor_pool);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    const std::vector<VkDescriptorSetLayout> set_layouts(kMaxBatchCount, context->descriptor_set_layout);
+
+    VkDescriptorSetAllocateInfo set_info = { VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
+    set_info.descriptorPool              = context->descriptor_pool;
+    set_info.descriptorSetCount          = kMaxBatchCount;
+    set_info.pSetLayouts                 = set_layouts.data();
+
+    context->descriptor_sets.resize(kMaxBatchCount, VK_NULL_HANDLE);
+
+    result = device_table->AllocateDescriptorSets(device, &set_info, context->descriptor_sets.data());
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    const VkFenceCreateInfo fence_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+
+    result = device_table->CreateFence(device, &fence_info, nullptr, &context->fence);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    result = CreateBuffer(context,
+                          kMaxBatchCount * kLaneCount * sizeof(uint32_t),
+                          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                          &context->result_buffer,
+                          &context->result_memory);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    void* result_data = nullptr;
+    result = device_table->MapMemory(device, context->result_memory, 0, VK_WHOLE_SIZE, 0, &result_data);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    context->result_data = static_cast<const uint32_t*>(result_data);
+
+    return VK_SUCCESS;
+}
+
+VulkanReplayDumpResourcesHasher::QueueContext*
+VulkanReplayDumpResourcesHasher::GetQueueContext(DeviceContext* context, uint32_t queue_family_index)
+{
+    assert(context != nullptr);
+
+    auto entry = context->queues.find(queue_family_index);
+    if (entry != context->queues.end())
+    {
+        return (entry->second.command_buffer != VK_NULL_HANDLE) ? &entry->second : nullptr;
+    }
+
+    QueueContext* queue_context = &context->queues[queue_family_index];
+
+    if ((queue_family_index >= context->queue_family_properties.size()) ||
+        ((context->queue_family_properties[queue_family_index].queueFlags & VK_QUEUE_COMPUTE_BIT) == 0))
+    {
+        return nullptr;
+    }
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+
+    device_table->GetDeviceQueue(context->device, queue_family_index, 0, &queue_context->queue);
+    if (queue_context->queue == VK_NULL_HANDLE)
+    {
+        return nullptr;
+    }
+
+    VkCommandPoolCreateInfo pool_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex        = queue_family_index;
+
+    if (device_table->CreateCommandPool(context->device, &pool_info, nullptr, &queue_context->command_pool) !=
+        VK_SUCCESS)
+    {
+        return nullptr;
+    }
+
+    VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+    alloc_info.commandPool                 = queue_context->command_pool;
+    alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount          = 1;
+
+    if (device_table->AllocateCommandBuffers(context->device, &alloc_info, &queue_context->command_buffer) !=
+        VK_SUCCESS)
+    {
+        queue_context->command_buffer = VK_NULL_HANDLE;
+        return nullptr;
+    }
+
+    return queue_context;
+}
+
+VkResult VulkanReplayDumpResourcesHasher::CreateBuffer(DeviceContext*        context,
+                                                       VkDeviceSize          size,
+                                                       VkBufferUsageFlags    usage,
+                                                       VkMemoryPropertyFlags memory_properties,
+                                                       VkBuffer*             buffer,
+                                                       VkDeviceMemory*       memory)
+{
+    assert((context != nullptr) && (buffer != nullptr) && (memory != nullptr));
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+
+    VkBufferCreateInfo buffer_info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+    buffer_info.size               = size;
+    buffer_info.usage              = usage;
+    buffer_info.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkResult result = device_table->CreateBuffer(context->device, &buffer_info, nullptr, buffer);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("%s(): CreateBuffer failed with %s", __func__, util::ToString<VkResult>(result).c_str());
+        return result;
+    }
+
+    VkMemoryRequirements memory_requirements;
+    device_table->GetBufferMemoryRequirements(context->device, *buffer, &memory_requirements);
+
+    VkMemoryAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO };
+    alloc_info.allocationSize       = memory_requirements.size;
+    alloc_info.memoryTypeIndex =
+        GetMemoryTypeIndex(context->memory_properties, memory_requirements.memoryTypeBits, memory_properties);
+
+    if (alloc_info.memoryTypeIndex == std::numeric_limits<uint32_t>::max())
+    {
+        GFXRECON_LOG_ERROR("%s(): Failed to find an appropriate memory type", __func__);
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    result = device_table->AllocateMemory(context->device, &alloc_info, nullptr, memory);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("%s(): AllocateMemory failed with %s", __func__, util::ToString<VkResult>(result).c_str());
+        return result;
+    }
+
+    result = device_table->BindBufferMemory(context->device, *buffer, *memory, 0);
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("%s(): BindBufferMemory failed with %s", __func__, util::ToString<VkResult>(result).c_str());
+    }
+
+    return result;
+}
+
+VkResult VulkanReplayDumpResourcesHasher::ReserveScratchBuffer(DeviceContext* context, VkDeviceSize size)
+{
+    assert(context != nullptr);
+
+    if (size <= context->scratch_size)
+    {
+        return VK_SUCCESS;
+    }
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+
+    // Grow geometrically to avoid reallocating for every slightly larger batch.
+    const VkDeviceSize scratch_size =
+        std::min(std::max(size, context->scratch_size * 2), std::max(size, kMaxBatchScratchSize));
+
+    if (context->scratch_buffer != VK_NULL_HANDLE)
+    {
+        device_table->DestroyBuffer(context->device, context->scratch_buffer, nullptr);
+        device_table->FreeMemory(context->device, context->scratch_memory, nullptr);
+        context->scratch_buffer = VK_NULL_HANDLE;
+        context->scratch_memory = VK_NULL_HANDLE;
+        context->scratch_size   = 0;
+    }
+
+    VkResult result = CreateBuffer(context,
+                                   scratch_size,
+                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                   &context->scratch_buffer,
+                                   &context->scratch_memory);
+    if (result == VK_SUCCESS)
+    {
+        context->scratch_size = scratch_size;
+    }
+
+    return result;
+}
+
+void VulkanReplayDumpResourcesHasher::DestroyDeviceContext(DeviceContext* context)
+{
+    assert(context != nullptr);
+
+    const encode::VulkanDeviceTable* device_table = context->device_table;
+    const VkDevice                   device       = context->device;
+
+    for (auto& entry : context->queues)
+    {
+        if (entry.second.command_pool != VK_NULL_HANDLE)
+        {
+            device_table->DestroyCommandPool(device, entry.second.command_pool, nullptr);
+        }
+    }
+
+    context->queues.clear();
+
+    if (context->result_buffer != VK_NULL_HANDLE)
+    {
+        device_table->DestroyBuffer(device, context->result_buffer, nullptr);
+    }
+
+    if (context->result_memory != VK_NULL_HANDLE)
+    {
+        device_table->FreeMemory(device, context->result_memory, nullptr);
+    }
+
+    if (context->scratch_buffer != VK_NULL_HANDLE)
+    {
+        device_table->DestroyBuffer(device, context->scratch_buffer, nullptr);
+    }
+
+    if (context->scratch_memory != VK_NULL_HANDLE)
+    {
+        device_table->FreeMemory(device, context->scratch_memory, nullptr);
+    }
+
+    if (context->fence != VK_NULL_HANDLE)
+    {
+        device_table->DestroyFence(device, context->fence, nullptr);
+    }
+
+    if (context->descriptor_pool != VK_NULL_HANDLE)
+    {
+        device_table->DestroyDescriptorPool(device, context->descriptor_pool, nullptr);
+    }
+
+    if (context->pipeline != VK_NULL_HANDLE)
+    {
+        device_table->DestroyPipeline(device, context->pipeline, nullptr);
+    }
+
+    if (context->pipeline_layout != VK_NULL_HANDLE)
+    {
+        device_table->DestroyPipelineLayout(device, context->pipeline_layout, nullptr);
+    }
+
+    if (context->descriptor_set_layout != VK_NULL_HANDLE)
+    {
+        device_table->DestroyDescriptorSetLayout(device, context->descriptor_set_layout, nullptr);
+    }
+
+    // Reset the handles, so that a failed device is not used again.
+    *context = DeviceContext{};
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
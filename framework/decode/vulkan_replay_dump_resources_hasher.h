@@ -0,0 +1,213 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_H
+#define GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_H
+
+#include "decode/common_object_info_table.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+#include "util/hash.h"
+#include "vulkan/vulkan_core.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Detects resources whose content did not change since they were last dumped, so that they are not read back and
+// written again. The content is copied to a device local buffer and hashed by a compute shader, and only the compact
+// hash is read back. The files of an unchanged resource are recorded as references to the files of its last dump.
+//
+// Resources are queued and then hashed together by SubmitQueued(). The queued resources share one submission, unless
+// they target different devices or queue families, or exceed the scratch memory or result slots of a batch.
+class VulkanReplayDumpResourcesHasher
+{
+  public:
+    // The content is split between kLaneCount invocations, each writing a 32-bit hash that is combined on the host.
+    static constexpr uint32_t kWorkGroupSize  = 64;
+    static constexpr uint32_t kWorkGroupCount = 16;
+    static constexpr uint32_t kLaneCount      = kWorkGroupSize * kWorkGroupCount;
+
+    // Number of resources, and amount of scratch memory, after which a batch is submitted.
+    static constexpr uint32_t     kMaxBatchCount       = 64;
+    static constexpr VkDeviceSize kMaxBatchScratchSize = 64 * 1024 * 1024;
+
+  public:
+    VulkanReplayDumpResourcesHasher(CommonObjectInfoTable& object_info_table);
+
+    ~VulkanReplayDumpResourcesHasher();
+
+    // Queues the hash of an image aspect and returns the index of its result in the vector returned by
+    // SubmitQueued(). Images that cannot be hashed (multisampled and multi-planar images, undefined layouts, or queue
+    // families without compute support) are reported as changed.
+    size_t QueueImage(const VulkanImageInfo*             image_info,
+                      const VulkanDeviceInfo*            device_info,
+                      const encode::VulkanDeviceTable*   device_table,
+                      const encode::VulkanInstanceTable* instance_table,
+                      VkImageAspectFlagBits              aspect,
+                      VkImageLayout                      layout,
+                      const VkExtent3D&                  extent,
+                      const std::vector<std::string>&    filenames);
+
+    // Same as QueueImage() for a range of a buffer. The content is read from the buffer handle, which is either the
+    // handle of buffer_info or the handle of a copy of the buffer.
+    size_t QueueBuffer(const VulkanBufferInfo*            buffer_info,
+                       VkBuffer                           buffer,
+                       const VulkanDeviceInfo*            device_info,
+                       const encode::VulkanDeviceTable*   device_table,
+                       const encode::VulkanInstanceTable* instance_table,
+                       VkDeviceSize                       offset,
+                       VkDeviceSize                       size,
+                       const std::string&                 filename);
+
+    // Hashes the queued resources and returns, in queue order, whether each resource has the same content and extent
+    // as when it was last dumped. An unchanged resource does not need to be dumped, and its filenames reference the
+    // files written by that dump. The queue is empty afterwards.
+    std::vector<bool> SubmitQueued();
+
+    // Maps the filenames of unchanged resources to the files that hold their content.
+    const std::unordered_map<std::string, std::string>& GetFileReferences() const { return file_references_; }
+
+    // Destroys the Vulkan objects created for hashing, which must be done before the devices are destroyed.
+    void Release();
+
+  private:
+    struct QueueContext
+    {
+        VkQueue         queue{ VK_NULL_HANDLE };
+        VkCommandPool   command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer command_buffer{ VK_NULL_HANDLE };
+    };
+
+    struct DeviceContext
+    {
+        VkDevice                                   device{ VK_NULL_HANDLE };
+        const encode::VulkanDeviceTable*           device_table{ nullptr };
+        VkPhysicalDeviceMemoryProperties           memory_properties{};
+        VkDeviceSize                               max_storage_buffer_range{ 0 };
+        VkDeviceSize                               min_storage_buffer_offset_alignment{ 1 };
+        std::vector<VkQueueFamilyProperties>       queue_family_properties;
+        VkDescriptorSetLayout                      descriptor_set_layout{ VK_NULL_HANDLE };
+        VkPipelineLayout                           pipeline_layout{ VK_NULL_HANDLE };
+        VkPipeline                                 pipeline{ VK_NULL_HANDLE };
+        VkDescriptorPool                           descriptor_pool{ VK_NULL_HANDLE };
+        std::vector<VkDescriptorSet>               descriptor_sets;
+        VkFence                                    fence{ VK_NULL_HANDLE };
+        VkBuffer                                   scratch_buffer{ VK_NULL_HANDLE };
+        VkDeviceMemory                             scratch_memory{ VK_NULL_HANDLE };
+        VkDeviceSize                               scratch_size{ 0 };
+        VkBuffer                                   result_buffer{ VK_NULL_HANDLE };
+        VkDeviceMemory                             result_memory{ VK_NULL_HANDLE };
+        const uint32_t*                            result_data{ nullptr };
+        std::unordered_map<uint32_t, QueueContext> queues;
+    };
+
+    struct DumpedContent
+    {
+        util::hash::Hash128      hash;
+        std::vector<std::string> filenames;
+    };
+
+    struct QueuedContent
+    {
+        util::hash::Hash128      key;
+        util::hash::Hash128      hash;
+        VkDeviceSize             size{ 0 };
+        std::vector<std::string> filenames;
+        bool                     hashed{ false };
+    };
+
+    // Content copied to the scratch buffer by the batch being recorded, and hashed to the result slot at the same
+    // index.
+    struct BatchSlot
+    {
+        size_t       content_index;
+        VkDeviceSize scratch_offset;
+        VkDeviceSize word_size;
+    };
+
+    struct Batch
+    {
+        DeviceContext*         context{ nullptr };
+        QueueContext*          queue_context{ nullptr };
+        VkDeviceSize           scratch_used{ 0 };
+        std::vector<BatchSlot> slots;
+    };
+
+    // Records the commands that copy the content to the scratch buffer at the specified offset.
+    typedef std::function<void(VkCommandBuffer command_buffer, VkBuffer scratch_buffer, VkDeviceSize scratch_offset)>
+        RecordCopyFunc;
+
+    DeviceContext* GetDeviceContext(const VulkanDeviceInfo*            device_info,
+                                    const encode::VulkanDeviceTable*   device_table,
+                                    const encode::VulkanInstanceTable* instance_table);
+
+    VkResult CreatePipeline(DeviceContext* context);
+
+    QueueContext* GetQueueContext(DeviceContext* context, uint32_t queue_family_index);
+
+    VkResult CreateBuffer(DeviceContext*        context,
+                          VkDeviceSize          size,
+                          VkBufferUsageFlags    usage,
+                          VkMemoryPropertyFlags memory_properties,
+                          VkBuffer*             buffer,
+                          VkDeviceMemory*       memory);
+
+    VkResult ReserveScratchBuffer(DeviceContext* context, VkDeviceSize size);
+
+    bool QueueContent(DeviceContext*        context,
+                      uint32_t              queue_family_index,
+                      VkDeviceSize          size,
+                      VkDeviceSize          alignment,
+                      const RecordCopyFunc& record_copy,
+                      size_t                content_index);
+
+    VkResult SubmitBatch();
+
+    bool CompareContent(const util::hash::Hash128&      key,
+                        const util::hash::Hash128&      hash,
+                        VkDeviceSize                    size,
+                        const std::vector<std::string>& filenames);
+
+    void DestroyDeviceContext(DeviceContext* context);
+
+  private:
+    CommonObjectInfoTable&                                                             object_info_table_;
+    std::unordered_map<format::HandleId, DeviceContext>                                device_contexts_;
+    std::unordered_map<util::hash::Hash128, DumpedContent, util::hash::Hash128Hasher> dumped_content_;
+    std::unordered_map<std::string, std::string>                                       file_references_;
+    std::vector<QueuedContent>                                                         queued_;
+    Batch                                                                              batch_;
+    uint64_t                                                                           unchanged_count_;
+    uint64_t                                                                           unchanged_size_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_H
@@ -0,0 +1,326 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_SHADERS_H
+#define GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_SHADERS_H
+
+#include "util/defines.h"
+
+#include <array>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// g_dump_resources_hash_comp: reference GLSL source
+#if 0
+// dump_resources_hash.comp
+
+#version 450
+
+// Each invocation hashes a strided subset of the words with the murmur3_32 block and finalization steps, so the
+// sequence of lane hashes depends on both the value and the position of every word. The lane hashes are combined on
+// the host. Only core Vulkan 1.0 features are used, so the shader also runs on software implementations.
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(set = 0, binding = 0, std430) readonly buffer Data
+{
+    uint words[];
+} data;
+
+layout(set = 0, binding = 1, std430) buffer Hashes
+{
+    uint words[];
+} hashes;
+
+layout(push_constant, std430) uniform PushConstants
+{
+    uint word_count;
+} pc;
+
+void main()
+{
+    const uint id     = gl_GlobalInvocationID.x;
+    const uint stride = gl_NumWorkGroups.x * 64;
+
+    uint h = id;
+    for (uint i = id; i < pc.word_count; i += stride)
+    {
+        uint k = data.words[i];
+        k *= 0xcc9e2d51;
+        k = (k << 15) | (k >> 17);
+        k *= 0x1b873593;
+
+        h ^= k;
+        h = (h << 13) | (h >> 19);
+        h = h * 5 + 0xe6546b64;
+    }
+
+    h ^= pc.word_count;
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+
+    hashes.words[id] = h;
+}
+#endif // g_dump_resources_hash_comp: reference GLSL source
+
+// CPU reference of g_dump_resources_hash_comp. Computes the hashes written by a dispatch of lane_count invocations. The
+// decode tests execute the SPIR-V below against it.
+inline void ComputeDumpResourcesHashLanes(const uint32_t* words,
+                                          uint32_t        word_count,
+                                          uint32_t        lane_count,
+                                          uint32_t*       lane_hashes)
+{
+    for (uint32_t id = 0; id < lane_count; ++id)
+    {
+        uint32_t h = id;
+        for (uint32_t i = id; i < word_count; i += lane_count)
+        {
+            uint32_t k = words[i];
+            k *= 0xcc9e2d51;
+            k = (k << 15) | (k >> 17);
+            k *= 0x1b873593;
+
+            h ^= k;
+            h = (h << 13) | (h >> 19);
+            h = h * 5 + 0xe6546b64;
+        }
+
+        h ^= word_count;
+        h ^= h >> 16;
+        h *= 0x85ebca6b;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35;
+        h ^= h >> 16;
+
+        lane_hashes[id] = h;
+    }
+}
+
+// Build commands.
+#if 0
+; g_dump_resources_hash_comp is assembled from the SPIR-V listing below, which implements the GLSL source above; it
+; is not glslangValidator output. spirv-as produces the same module, except for the generator word of the header.
+; The decode tests execute the module against ComputeDumpResourcesHashLanes, so a regenerated module must pass them.
+; Command: spirv-as --target-env vulkan1.0 dump_resources_hash.spvasm -o dump_resources_hash.spv
+#endif
+
+// Shader code.
+#if 0
+; SPIR-V
+; Version: 1.0
+; Generator: 0
+; Bound: 72
+; Schema: 0
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main" %gl_GlobalInvocationID %gl_NumWorkGroups
+               OpExecutionMode %main LocalSize 64 1 1
+               OpSource GLSL 450
+               OpDecorate %gl_GlobalInvocationID BuiltIn GlobalInvocationId
+               OpDecorate %gl_NumWorkGroups BuiltIn NumWorkgroups
+               OpDecorate %_runtimearr_uint ArrayStride 4
+               OpMemberDecorate %Words 0 Offset 0
+               OpDecorate %Words BufferBlock
+               OpDecorate %data DescriptorSet 0
+               OpDecorate %data Binding 0
+               OpDecorate %data NonWritable
+               OpDecorate %hashes DescriptorSet 0
+               OpDecorate %hashes Binding 1
+               OpMemberDecorate %PushConstants 0 Offset 0
+               OpDecorate %PushConstants Block
+       %void = OpTypeVoid
+         %fn = OpTypeFunction %void
+       %bool = OpTypeBool
+       %uint = OpTypeInt 32 0
+     %v3uint = OpTypeVector %uint 3
+%_ptr_Input_v3uint = OpTypePointer Input %v3uint
+%gl_GlobalInvocationID = OpVariable %_ptr_Input_v3uint Input
+%gl_NumWorkGroups = OpVariable %_ptr_Input_v3uint Input
+%_runtimearr_uint = OpTypeRuntimeArray %uint
+      %Words = OpTypeStruct %_runtimearr_uint
+%_ptr_Uniform_Words = OpTypePointer Uniform %Words
+       %data = OpVariable %_ptr_Uniform_Words Uniform
+     %hashes = OpVariable %_ptr_Uniform_Words Uniform
+%_ptr_Uniform_uint = OpTypePointer Uniform %uint
+%PushConstants = OpTypeStruct %uint
+%_ptr_PushConstant_PushConstants = OpTypePointer PushConstant %PushConstants
+         %pc = OpVariable %_ptr_PushConstant_PushConstants PushConstant
+%_ptr_PushConstant_uint = OpTypePointer PushConstant %uint
+     %uint_0 = OpConstant %uint 0
+     %uint_5 = OpConstant %uint 5
+    %uint_13 = OpConstant %uint 13
+    %uint_15 = OpConstant %uint 15
+    %uint_16 = OpConstant %uint 16
+    %uint_17 = OpConstant %uint 17
+    %uint_19 = OpConstant %uint 19
+    %uint_64 = OpConstant %uint 64
+%uint_3432918353 = OpConstant %uint 3432918353
+%uint_461845907 = OpConstant %uint 461845907
+%uint_3864292196 = OpConstant %uint 3864292196
+%uint_2246822507 = OpConstant %uint 2246822507
+%uint_3266489909 = OpConstant %uint 3266489909
+       %main = OpFunction %void None %fn
+      %entry = OpLabel
+        %gid = OpLoad %v3uint %gl_GlobalInvocationID
+         %id = OpCompositeExtract %uint %gid 0
+        %nwg = OpLoad %v3uint %gl_NumWorkGroups
+      %nwg_x = OpCompositeExtract %uint %nwg 0
+     %stride = OpIMul %uint %nwg_x %uint_64
+%word_count_ptr = OpAccessChain %_ptr_PushConstant_uint %pc %uint_0
+ %word_count = OpLoad %uint %word_count_ptr
+               OpBranch %header
+     %header = OpLabel
+          %i = OpPhi %uint %id %entry %i_next %continue
+          %h = OpPhi %uint %id %entry %h_next %continue
+       %cond = OpULessThan %bool %i %word_count
+               OpLoopMerge %merge %continue None
+               OpBranchConditional %cond %body %merge
+       %body = OpLabel
+   %word_ptr = OpAccessChain %_ptr_Uniform_uint %data %uint_0 %i
+         %k0 = OpLoad %uint %word_ptr
+         %k1 = OpIMul %uint %k0 %uint_3432918353
+         %k2 = OpShiftLeftLogical %uint %k1 %uint_15
+         %k3 = OpShiftRightLogical %uint %k1 %uint_17
+         %k4 = OpBitwiseOr %uint %k2 %k3
+         %k5 = OpIMul %uint %k4 %uint_461845907
+         %h1 = OpBitwiseXor %uint %h %k5
+         %h2 = OpShiftLeftLogical %uint %h1 %uint_13
+         %h3 = OpShiftRightLogical %uint %h1 %uint_19
+         %h4 = OpBitwiseOr %uint %h2 %h3
+         %h5 = OpIMul %uint %h4 %uint_5
+     %h_next = OpIAdd %uint %h5 %uint_3864292196
+               OpBranch %continue
+   %continue = OpLabel
+     %i_next = OpIAdd %uint %i %stride
+               OpBranch %header
+      %merge = OpLabel
+         %f0 = OpBitwiseXor %uint %h %word_count
+         %f1 = OpShiftRightLogical %uint %f0 %uint_16
+         %f2 = OpBitwiseXor %uint %f0 %f1
+         %f3 = OpIMul %uint %f2 %uint_2246822507
+         %f4 = OpShiftRightLogical %uint %f3 %uint_13
+         %f5 = OpBitwiseXor %uint %f3 %f4
+         %f6 = OpIMul %uint %f5 %uint_3266489909
+         %f7 = OpShiftRightLogical %uint %f6 %uint_16
+         %f8 = OpBitwiseXor %uint %f6 %f7
+   %hash_ptr = OpAccessChain %_ptr_Uniform_uint %hashes %uint_0 %id
+               OpStore %hash_ptr %f8
+               OpReturn
+               OpFunctionEnd
+#endif
+
+static const std::array<unsigned char, 1580> g_dump_resources_hash_comp = {
+    0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00,
+    0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x48, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x47, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00,
+    0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+    0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04,
+    0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x09, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+    0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0d, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1d, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x05, 0x00,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x3b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x08, 0x00,
+    0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x2b, 0x00,
+    0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x1c, 0x00, 0x00, 0x00, 0x51, 0x2d, 0x9e, 0xcc, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00,
+    0x00, 0x93, 0x35, 0x87, 0x1b, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x64, 0x6b,
+    0x54, 0xe6, 0x2b, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x6b, 0xca, 0xeb, 0x85, 0x2b,
+    0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x35, 0xae, 0xb2, 0xc2, 0x36, 0x00, 0x05, 0x00,
+    0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x51, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x1b, 0x00,
+    0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+    0xf9, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2b, 0x00,
+    0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x2f, 0x00,
+    0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x31, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x2a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00,
+    0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x1c, 0x00,
+    0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x19, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x37, 0x00,
+    0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x2d,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+    0x39, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00,
+    0x00, 0x39, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+    0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2c, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x02, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2b, 0x00,
+    0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf8,
+    0x00, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+    0x2d, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00,
+    0x00, 0x3e, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x40, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00, 0x00,
+    0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x43, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0c, 0x00,
+    0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x05, 0x00,
+    0x0c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x23, 0x00,
+    0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x47, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38,
+    0x00, 0x01, 0x00
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_REPLAY_DUMP_RESOURCES_HASHER_SHADERS_H
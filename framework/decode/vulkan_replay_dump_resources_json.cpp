@@ -33,7 +33,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 VulkanReplayDumpResourcesJson::VulkanReplayDumpResourcesJson(const VulkanReplayOptions& options) :
-    file_(nullptr), current_entry(nullptr), first_block_(true)
+    file_(nullptr), current_entry(nullptr), first_block_(true), file_references_(nullptr)
 {
     header_["vulkanVersion"] = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
                                std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
@@ -52,6 +52,8 @@ VulkanReplayDumpResourcesJson::VulkanReplayDumpResourcesJson(const VulkanReplayO
     dr_options["dumpResourcesDumpAllImageSubresources"] = options.dump_resources_dump_all_image_subresources;
     dr_options["dumpResourcesDumpRawImages"]            = options.dump_resources_dump_raw_images;
     dr_options["dumpResourcesDumpSeparateAlpha"]        = options.dump_resources_dump_separate_alpha;
+    dr_options["dumpResourcesArchive"]                  = options.dump_resources_archive;
+    dr_options["dumpResourcesSkipUnchanged"]            = options.dump_resources_skip_unchanged;
 };
 
 bool VulkanReplayDumpResourcesJson::InitializeFile(const std::string& filename)
@@ -187,32 +189,36 @@ void VulkanReplayDumpResourcesJson::InsertImageInfo(nlohmann::ordered_json& json
         json_entry["scaleFailed"] = true;
     }
 
+    const std::string& file = ResolveFilename(filename);
+
     if (separate_alpha && vkuFormatHasAlpha(image_format))
     {
         if (filename_before != nullptr)
         {
-            json_entry["beforeFile"]      = *filename_before;
-            json_entry["beforeFileAlpha"] = util::filepath::InsertFilenamePostfix(*filename_before, "_alpha");
-            json_entry["afterFile"]       = filename;
-            json_entry["afterFileAlpha"]  = util::filepath::InsertFilenamePostfix(filename, "_alpha");
+            const std::string& file_before = ResolveFilename(*filename_before);
+
+            json_entry["beforeFile"]      = file_before;
+            json_entry["beforeFileAlpha"] = util::filepath::InsertFilenamePostfix(file_before, "_alpha");
+            json_entry["afterFile"]       = file;
+            json_entry["afterFileAlpha"]  = util::filepath::InsertFilenamePostfix(file, "_alpha");
             ;
         }
         else
         {
-            json_entry["file"]      = filename;
-            json_entry["fileAlpha"] = util::filepath::InsertFilenamePostfix(filename, "_alpha");
+            json_entry["file"]      = file;
+            json_entry["fileAlpha"] = util::filepath::InsertFilenamePostfix(file, "_alpha");
         }
     }
     else
     {
         if (filename_before != nullptr)
         {
-            json_entry["beforeFile"] = *filename_before;
-            json_entry["afterFile"]  = filename;
+            json_entry["beforeFile"] = ResolveFilename(*filename_before);
+            json_entry["afterFile"]  = file;
         }
         else
         {
-            json_entry["file"] = filename;
+            json_entry["file"] = file;
         }
     }
 }
@@ -224,7 +230,21 @@ void VulkanReplayDumpResourcesJson::InsertBufferInfo(nlohmann::ordered_json& jso
     assert(buffer_info != nullptr);
 
     json_entry["bufferId"] = buffer_info->capture_id;
-    json_entry["file"]     = filename;
+    json_entry["file"]     = ResolveFilename(filename);
+}
+
+const std::string& VulkanReplayDumpResourcesJson::ResolveFilename(const std::string& filename) const
+{
+    if (file_references_ != nullptr)
+    {
+        const auto entry = file_references_->find(filename);
+        if (entry != file_references_->end())
+        {
+            return entry->second;
+        }
+    }
+
+    return filename;
 }
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,6 +27,9 @@
 #include "decode/vulkan_object_info.h"
 #include "decode/vulkan_replay_options.h"
 
+#include <string>
+#include <unordered_map>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -76,14 +79,25 @@ class VulkanReplayDumpResourcesJson
                           const VulkanBufferInfo* buffer_info,
                           const std::string&      filename);
 
+    // Maps the names of files that were not written, because their content did not change, to the name of the file
+    // holding the same content.  The json entries reference the mapped file in place of the skipped one.
+    void SetFileReferences(const std::unordered_map<std::string, std::string>* file_references)
+    {
+        file_references_ = file_references;
+    }
+
   private:
     bool InitializeFile(const std::string& filename);
 
+    const std::string& ResolveFilename(const std::string& filename) const;
+
     FILE*                   file_;
     nlohmann::ordered_json  header_;
     nlohmann::ordered_json  json_data_;
     nlohmann::ordered_json* current_entry;
     bool                    first_block_;
+
+    const std::unordered_map<std::string, std::string>* file_references_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -94,8 +94,11 @@ struct VulkanReplayOptions : public ReplayOptions
     bool  dump_resources_dump_all_image_subresources{ false };
     bool  dump_resources_dump_raw_images{ false };
     bool  dump_resources_dump_separate_alpha{ false };
+    bool  dump_resources_archive{ false };
+    bool  dump_resources_skip_unchanged{ false };
 
-    bool preload_measurement_range{ false };
+    bool     preload_measurement_range{ false };
+    uint32_t measurement_range_loop_count{ 1 };
 
     std::string load_pipeline_cache_filename;
     std::string save_pipeline_cache_filename;
@@ -25,6 +25,7 @@
 
 #include "decode/copy_shaders.h"
 #include "decode/decoder_util.h"
+#include "decode/replay_memory_tracker.h"
 #include "util/platform.h"
 
 #include <algorithm>
@@ -69,6 +70,7 @@ VulkanResourceInitializer::~VulkanResourceInitializer()
 
     if (staging_buffer_ != VK_NULL_HANDLE)
     {
+        RemoveStagingUsage(staging_buffer_);
         resource_allocator_->DestroyBufferDirect(staging_buffer_, nullptr, staging_buffer_data_);
     }
 
@@ -973,6 +975,12 @@ VkResult VulkanResourceInitializer::AcquireStagingBuffer(VkDeviceMemory*
                 (*allocator_memory_data) = staging_memory_data;
                 (*allocator_buffer_data) = staging_buffer_data;
 
+                if (ReplayMemoryTracker::IsEnabled())
+                {
+                    staging_usage_sizes_[staging_buffer] = alloc_info.allocationSize;
+                    ReplayMemoryTracker::AddUsage(ReplayMemoryTracker::kResourceStaging, alloc_info.allocationSize);
+                }
+
                 if (size <= max_copy_size_)
                 {
                     staging_memory_      = staging_memory;
@@ -1033,6 +1041,7 @@ void VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory
     {
         if (buffer != VK_NULL_HANDLE)
         {
+            RemoveStagingUsage(buffer);
             resource_allocator_->DestroyBufferDirect(buffer, nullptr, staging_buffer_data);
         }
 
@@ -1043,6 +1052,16 @@ void VulkanResourceInitializer::ReleaseStagingBuffer(VkDeviceMemory
     }
 }
 
+void VulkanResourceInitializer::RemoveStagingUsage(VkBuffer buffer)
+{
+    auto entry = staging_usage_sizes_.find(buffer);
+    if (entry != staging_usage_sizes_.end())
+    {
+        ReplayMemoryTracker::RemoveUsage(ReplayMemoryTracker::kResourceStaging, entry->second);
+        staging_usage_sizes_.erase(entry);
+    }
+}
+
 void VulkanResourceInitializer::UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler)
 {
     VkDescriptorImageInfo image_write_info;
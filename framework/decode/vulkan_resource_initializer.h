@@ -140,6 +140,10 @@ class VulkanResourceInitializer
                               VulkanResourceAllocator::MemoryData   staging_memory_data,
                               VulkanResourceAllocator::ResourceData staging_buffer_data);
 
+    // Removes the memory of a staging buffer that is about to be destroyed from the replay memory usage, using the
+    // allocation size recorded by AcquireStagingBuffer.
+    void RemoveStagingUsage(VkBuffer buffer);
+
     void UpdateDrawDescriptorSet(VkDescriptorSet set, VkImageView view, VkSampler sampler);
 
     VkResult BeginCommandBuffer(VkCommandBuffer command_buffer);
@@ -204,6 +208,9 @@ class VulkanResourceInitializer
     VulkanResourceAllocator*              resource_allocator_;
     const encode::VulkanDeviceTable*      device_table_;
     const VulkanDeviceInfo*               device_info_;
+
+    // Staging memory allocation sizes reported to the replay memory tracker, by staging buffer.
+    std::unordered_map<VkBuffer, VkDeviceSize> staging_usage_sizes_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -54,6 +54,13 @@ class ApiCaptureManager
                              const std::string*      asset_file_name,
                              format::ThreadId        thread_id)                                            = 0;
 
+    // Writes state that WriteTrackedState deferred until it is referenced by the captured commands.
+    virtual void WriteDeferredState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(file_stream);
+        GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+    }
+
     virtual CaptureSettings::TraceSettings GetDefaultTraceSettings();
 
     format::ApiFamilyId GetApiFamily() const { return api_family_; }
@@ -118,6 +125,10 @@ class ApiCaptureManager
     {
         common_manager_->PostQueueSubmit(api_family_, current_lock);
     }
+    void ProcessDeferredState(std::shared_lock<CommonCaptureManager::ApiCallMutexT>& current_lock)
+    {
+        common_manager_->WriteDeferredState(this, current_lock);
+    }
 
     bool ShouldTriggerScreenshot() { return common_manager_->ShouldTriggerScreenshot(); }
 
@@ -164,6 +175,12 @@ class ApiCaptureManager
     auto GetForceCommandSerialization() const { return common_manager_->GetForceCommandSerialization(); }
     auto GetQueueZeroOnly() const { return common_manager_->GetQueueZeroOnly(); }
     auto GetAllowPipelineCompileRequired() const { return common_manager_->GetAllowPipelineCompileRequired(); }
+    bool GetDeferResourceContent() const { return common_manager_->GetDeferResourceContent(); }
+
+    const std::string& GetShaderReflectionCacheFile() const
+    {
+        return common_manager_->GetShaderReflectionCacheFile();
+    }
 
     bool     IsAnnotated() const { return common_manager_->IsAnnotated(); }
     uint16_t GetGPUVAMask() const { return common_manager_->GetGPUVAMask(); }
@@ -183,6 +200,7 @@ class ApiCaptureManager
     {
         return common_manager_->GetPageGuardMemoryMode();
     }
+    util::MemoryHashTracker* GetMemoryHashTracker() const { return common_manager_->GetMemoryHashTracker(); }
     const std::string&                GetTrimKey() const { return common_manager_->GetTrimKey(); }
     bool                              IsTrimEnabled() const { return common_manager_->IsTrimEnabled(); }
     uint32_t                          GetCurrentFrame() const { return common_manager_->GetCurrentFrame(); }
@@ -205,6 +223,8 @@ class ApiCaptureManager
     {
         common_manager_->WriteCreateHeapAllocationCmd(api_family_, allocation_id, allocation_size);
     }
+    void WriteTrackedMemoryFillMemoryCmds() { common_manager_->WriteTrackedMemoryFillMemoryCmds(api_family_); }
+
     void WriteToFile(const void* data, size_t size) { common_manager_->WriteToFile(data, size); }
 
     template <size_t N>
@@ -214,6 +234,7 @@ class ApiCaptureManager
     }
 
     CommonCaptureManager::ThreadData* GetThreadData() { return common_manager_->GetThreadData(); }
+    util::CallProfiler*               GetCallProfiler() const { return common_manager_->GetCallProfiler(); }
     util::Compressor*                 GetCompressor() { return common_manager_->GetCompressor(); }
     std::mutex&                       GetMappedMemoryLock() { return common_manager_->GetMappedMemoryLock(); }
     util::Keyboard&                   GetKeyboard() { return common_manager_->GetKeyboard(); }
@@ -222,6 +243,8 @@ class ApiCaptureManager
     auto                              GetTrimBoundary() const { return common_manager_->GetTrimBoundary(); }
     auto                              GetTrimDrawCalls() const { return common_manager_->GetTrimDrawCalls(); }
 
+    util::ScopedCallTimer ProfileStateTracking() { return common_manager_->ProfileStateTracking(); }
+
   protected:
     const format::ApiFamilyId api_family_;
     CommonCaptureManager*     common_manager_ = nullptr;
@@ -32,6 +32,7 @@
 #include "encode/parameter_buffer.h"
 #include "encode/parameter_encoder.h"
 #include "format/format_util.h"
+#include "generated/generated_api_call_id_to_string.h"
 #include "util/compressor.h"
 #include "util/file_path.h"
 #include "util/date_time.h"
@@ -40,8 +41,12 @@
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstdlib>
+#include <map>
+#include <thread>
 #include <unordered_map>
 
 #if defined(__unix__)
@@ -52,8 +57,9 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
 // One based frame count.
-const uint32_t kFirstFrame           = 1;
-const size_t   kFileStreamBufferSize = 256 * 1024;
+const uint32_t kFirstFrame                = 1;
+const size_t   kFileStreamBufferSize      = 256 * 1024;
+const size_t   kAssetFileStreamBufferSize = 4 * 1024 * 1024; // Asset file writes are large resource upload blocks.
 
 std::mutex                                     CommonCaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CommonCaptureManager::ThreadData::thread_count_ = 0;
@@ -68,7 +74,7 @@ std::atomic<format::HandleId> CommonCaptureManager::unique_id_counter_{ format::
 
 CommonCaptureManager::ThreadData::ThreadData() :
     thread_id_(GetThreadId()), object_id_(format::kNullHandleId), call_id_(format::ApiCallId::ApiCall_Unknown),
-    block_index_(0)
+    block_index_(0), call_start_time_(0), encode_end_time_(0)
 {
     parameter_buffer_  = std::make_unique<encode::ParameterBuffer>();
     parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get());
@@ -105,12 +111,17 @@ CommonCaptureManager::CommonCaptureManager() :
     previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
     debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
     accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
-    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), use_asset_file_(false), block_index_(0),
-    write_assets_(false), previous_write_assets_(false)
+    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), use_asset_file_(false),
+    defer_resource_content_(false), block_index_(0), write_assets_(false), previous_write_assets_(false)
 {}
 
 CommonCaptureManager::~CommonCaptureManager()
 {
+    if (call_profiler_ != nullptr)
+    {
+        WriteCallProfile();
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -313,6 +324,23 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
     allow_pipeline_compile_required_ = trace_settings.allow_pipeline_compile_required;
     force_fifo_present_mode_         = trace_settings.force_fifo_present_mode;
     use_asset_file_                  = trace_settings.use_asset_file;
+    defer_resource_content_          = trace_settings.defer_resource_content;
+    shader_reflection_cache_file_    = trace_settings.shader_reflection_cache_file;
+    call_profile_file_               = trace_settings.call_profile_file;
+
+    if (defer_resource_content_ && use_asset_file_)
+    {
+        // Deferred content is written to the capture file, which would bypass the asset file.
+        GFXRECON_LOG_WARNING("Settings Loader: Ignoring defer resource content setting as the asset file is enabled.");
+        defer_resource_content_ = false;
+    }
+
+    if (!call_profile_file_.empty())
+    {
+        // Only the per call statistics are reported, so no event buffer is needed for trace export.
+        call_profiler_ = std::make_unique<util::CallProfiler>(
+            std::vector<std::string>{ "total", "encode", "state_tracking", "compress", "write" }, 0);
+    }
 
     rv_annotation_info_.gpuva_mask      = trace_settings.rv_anotation_info.gpuva_mask;
     rv_annotation_info_.descriptor_mask = trace_settings.rv_anotation_info.descriptor_mask;
@@ -344,6 +372,18 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_signal_handler_watcher_max_restores_ = trace_settings.page_guard_signal_handler_watcher_max_restores;
         page_guard_separate_read_                       = trace_settings.page_guard_separate_read;
 
+        // Modified memory is only processed in parallel at queue submit when more than one thread is requested.
+        uint32_t process_thread_count = static_cast<uint32_t>(std::max(0, trace_settings.page_guard_process_threads));
+        if (process_thread_count == 0)
+        {
+            process_thread_count = std::thread::hardware_concurrency() / 2;
+        }
+
+        if (process_thread_count > 1)
+        {
+            memory_process_pool_ = std::make_unique<util::ThreadPool>(process_thread_count);
+        }
+
         bool use_external_memory = trace_settings.page_guard_external_memory;
 
 #if !defined(WIN32)
@@ -375,6 +415,14 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_align_buffer_sizes_ = false;
         page_guard_track_ahb_memory_   = false;
         page_guard_memory_mode_        = kMemoryModeDisabled;
+
+        if ((memory_tracking_mode_ == CaptureSettings::kUnassisted) && trace_settings.unassisted_hash_tracking)
+        {
+            // Large mapped regions are hashed in parallel, on half of the available cores.
+            const size_t hash_thread_count = std::max(1u, std::thread::hardware_concurrency() / 2);
+            memory_hash_tracker_           = std::make_unique<util::MemoryHashTracker>(
+                util::MemoryHashTracker::kDefaultBlockSize, hash_thread_count);
+        }
     }
 
     if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty() &&
@@ -472,11 +520,17 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
             memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
         {
-            const util::PageGuardManager::MemoryProtectionMode mem_prot_mode =
+            util::PageGuardManager::MemoryProtectionMode mem_prot_mode =
                 memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard
                     ? util::PageGuardManager::MemoryProtectionMode::kMProtectMode
                     : util::PageGuardManager::MemoryProtectionMode::kUserFaultFdMode;
 
+            if ((mem_prot_mode == util::PageGuardManager::MemoryProtectionMode::kUserFaultFdMode) &&
+                trace_settings.page_guard_userfaultfd_async)
+            {
+                mem_prot_mode = util::PageGuardManager::MemoryProtectionMode::kUserFaultFdAsyncMode;
+            }
+
             util::PageGuardManager::Create(trace_settings.page_guard_copy_on_map,
                                            trace_settings.page_guard_separate_read,
                                            util::PageGuardManager::kDefaultEnableReadWriteSamePage,
@@ -517,6 +571,12 @@ ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId cal
     auto thread_data      = GetThreadData();
     thread_data->call_id_ = call_id;
 
+    if (call_profiler_ != nullptr)
+    {
+        thread_data->call_start_time_ = util::CallProfiler::GetTimestamp();
+        thread_data->encode_end_time_ = 0;
+    }
+
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
 
@@ -529,6 +589,12 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
     thread_data->call_id_   = call_id;
     thread_data->object_id_ = object_id;
 
+    if (call_profiler_ != nullptr)
+    {
+        thread_data->call_start_time_ = util::CallProfiler::GetTimestamp();
+        thread_data->encode_end_time_ = 0;
+    }
+
     // Reset the parameter buffer and reserve space for an uncompressed MethodCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::MethodCallHeader));
 
@@ -537,6 +603,13 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
 
 void CommonCaptureManager::EndApiCallCapture()
 {
+    // Outside of file writes, the thread data is only looked up when the call profile is enabled.
+    util::CallProfiler* profiler = call_profiler_.get();
+    if (profiler != nullptr)
+    {
+        EndEncodeProfile(GetThreadData());
+    }
+
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
         auto thread_data = GetThreadData();
@@ -551,8 +624,13 @@ void CommonCaptureManager::EndApiCallCapture()
         if (compressor_ != nullptr)
         {
             size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            size_t compressed_size = 0;
+
+            {
+                util::ScopedCallTimer compress_timer(profiler, kProfilerStageCompress, thread_data->call_id_);
+                compressed_size = compressor_->Compress(
+                    uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            }
 
             if ((compressed_size > 0) && (compressed_size < uncompressed_size))
             {
@@ -566,6 +644,7 @@ void CommonCaptureManager::EndApiCallCapture()
                                                        sizeof(compressed_header->thread_id) +
                                                        sizeof(compressed_header->uncompressed_size) + compressed_size;
 
+                util::ScopedCallTimer write_timer(profiler, kProfilerStageWrite, thread_data->call_id_);
                 WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
 
                 not_compressed = false;
@@ -585,14 +664,31 @@ void CommonCaptureManager::EndApiCallCapture()
             uncompressed_header->block_header.size =
                 sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
+            util::ScopedCallTimer write_timer(profiler, kProfilerStageWrite, thread_data->call_id_);
             WriteToFile(parameter_buffer->GetHeaderData(),
                         parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
         }
     }
+
+    if (profiler != nullptr)
+    {
+        auto thread_data = GetThreadData();
+        profiler->Record(kProfilerStageTotal,
+                         thread_data->call_id_,
+                         thread_data->call_start_time_,
+                         util::CallProfiler::GetTimestamp());
+    }
 }
 
 void CommonCaptureManager::EndMethodCallCapture()
 {
+    // Outside of file writes, the thread data is only looked up when the call profile is enabled.
+    util::CallProfiler* profiler = call_profiler_.get();
+    if (profiler != nullptr)
+    {
+        EndEncodeProfile(GetThreadData());
+    }
+
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
         auto thread_data = GetThreadData();
@@ -607,8 +703,13 @@ void CommonCaptureManager::EndMethodCallCapture()
         if (compressor_ != nullptr)
         {
             size_t header_size     = sizeof(format::CompressedMethodCallHeader);
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            size_t compressed_size = 0;
+
+            {
+                util::ScopedCallTimer compress_timer(profiler, kProfilerStageCompress, thread_data->call_id_);
+                compressed_size = compressor_->Compress(
+                    uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            }
 
             if ((compressed_size > 0) && (compressed_size < uncompressed_size))
             {
@@ -624,6 +725,7 @@ void CommonCaptureManager::EndMethodCallCapture()
                                                        sizeof(compressed_header->uncompressed_size) +
                                                        sizeof(compressed_header->thread_id) + compressed_size;
 
+                util::ScopedCallTimer write_timer(profiler, kProfilerStageWrite, thread_data->call_id_);
                 WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
 
                 not_compressed = false;
@@ -645,10 +747,20 @@ void CommonCaptureManager::EndMethodCallCapture()
                                                      sizeof(uncompressed_header->object_id) +
                                                      sizeof(uncompressed_header->thread_id) + uncompressed_size;
 
+            util::ScopedCallTimer write_timer(profiler, kProfilerStageWrite, thread_data->call_id_);
             WriteToFile(parameter_buffer->GetHeaderData(),
                         parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
         }
     }
+
+    if (profiler != nullptr)
+    {
+        auto thread_data = GetThreadData();
+        profiler->Record(kProfilerStageTotal,
+                         thread_data->call_id_,
+                         thread_data->call_start_time_,
+                         util::CallProfiler::GetTimestamp());
+    }
 }
 
 bool CommonCaptureManager::IsTrimHotkeyPressed()
@@ -834,6 +946,12 @@ void CommonCaptureManager::CheckStartCaptureForTrackMode(format::ApiFamilyId
     {
         capture_mode_ |= kModeWrite;
 
+        if (memory_hash_tracker_ != nullptr)
+        {
+            // Hashes computed before trimming started describe content that was never written to the capture file.
+            memory_hash_tracker_->Clear();
+        }
+
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
@@ -1053,7 +1171,7 @@ std::unique_ptr<util::FileOutputStream> CommonCaptureManager::CreateAssetFile()
     }
 
     std::unique_ptr<util::FileOutputStream> asset_file_stream =
-        std::make_unique<util::FileOutputStream>(asset_file_name_, kFileStreamBufferSize, true);
+        std::make_unique<util::FileOutputStream>(asset_file_name_, kAssetFileStreamBufferSize, true);
     if (!asset_file_stream->IsValid())
     {
         GFXRECON_LOG_ERROR("Failed opening asset file %s", asset_file_name_.c_str())
@@ -1226,6 +1344,12 @@ void CommonCaptureManager::ActivateTrimming(std::shared_lock<ApiCallMutexT>& cur
 
         capture_mode_ |= kModeWrite;
 
+        if (memory_hash_tracker_ != nullptr)
+        {
+            // Hashes computed before trimming started describe content that was never written to the capture file.
+            memory_hash_tracker_->Clear();
+        }
+
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
         if (use_asset_file_)
@@ -1281,6 +1405,41 @@ void CommonCaptureManager::DeactivateTrimming(std::shared_lock<ApiCallMutexT>& c
     }
 }
 
+void CommonCaptureManager::WriteDeferredState(ApiCaptureManager*               api_capture_manager,
+                                              std::shared_lock<ApiCallMutexT>& current_lock)
+{
+    assert(api_capture_manager != nullptr);
+
+    auto has_shared_lock = current_lock.owns_lock();
+    if (has_shared_lock)
+    {
+        current_lock.unlock();
+    }
+
+    {
+        auto exclusive_api_call_lock = std::unique_lock<CommonCaptureManager::ApiCallMutexT>{};
+        if (!GetForceCommandSerialization())
+        {
+            // If command serialization is active, the caller already holds the exclusive lock.
+            exclusive_api_call_lock = AcquireExclusiveApiCallLock();
+        }
+
+        // Another thread may have ended the trimmed range while the lock was released.
+        if (((capture_mode_ & kModeWrite) == kModeWrite) && (file_stream_ != nullptr))
+        {
+            auto thread_data = GetThreadData();
+            assert(thread_data != nullptr);
+
+            api_capture_manager->WriteDeferredState(file_stream_.get(), thread_data->thread_id_);
+        }
+    }
+
+    if (has_shared_lock)
+    {
+        current_lock.lock();
+    }
+}
+
 void CommonCaptureManager::WriteFileHeader(util::FileOutputStream* file_stream)
 {
     std::vector<format::FileOptionPair> option_list;
@@ -1404,56 +1563,169 @@ void CommonCaptureManager::WriteFillMemoryCmd(
 {
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
-        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
-
-        format::FillMemoryCommandHeader fill_cmd;
-        size_t                          header_size       = sizeof(format::FillMemoryCommandHeader);
-        const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
-        size_t                          uncompressed_size = static_cast<size_t>(size);
-
         auto thread_data = GetThreadData();
         assert(thread_data != nullptr);
 
-        fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
-        fill_cmd.meta_header.meta_data_id =
-            format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
-        fill_cmd.thread_id     = thread_data->thread_id_;
-        fill_cmd.memory_id     = memory_id;
-        fill_cmd.memory_offset = offset;
-        fill_cmd.memory_size   = size;
+        std::vector<uint8_t>& block_data = thread_data->compressed_buffer_;
+        block_data.clear();
 
-        bool not_compressed = true;
+        EncodeFillMemoryCmd(api_family, thread_data->thread_id_, memory_id, offset, size, data, &block_data);
+        WriteToFile(block_data.data(), block_data.size());
+    }
+}
 
-        if (compressor_ != nullptr)
+void CommonCaptureManager::EncodeFillMemoryCmd(format::ApiFamilyId   api_family,
+                                               format::ThreadId      thread_id,
+                                               format::HandleId      memory_id,
+                                               uint64_t              offset,
+                                               uint64_t              size,
+                                               const void*           data,
+                                               std::vector<uint8_t>* block_data) const
+{
+    assert(block_data != nullptr);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, size);
+
+    format::FillMemoryCommandHeader fill_cmd;
+    const size_t                    header_size       = sizeof(format::FillMemoryCommandHeader);
+    const uint8_t*                  uncompressed_data = (static_cast<const uint8_t*>(data) + offset);
+    const size_t                    uncompressed_size = static_cast<size_t>(size);
+    const size_t                    block_offset      = block_data->size();
+
+    fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    fill_cmd.meta_header.meta_data_id = format::MakeMetaDataId(api_family, format::MetaDataType::kFillMemoryCommand);
+    fill_cmd.thread_id                = thread_id;
+    fill_cmd.memory_id                = memory_id;
+    fill_cmd.memory_offset            = offset;
+    fill_cmd.memory_size              = size;
+
+    size_t data_size = uncompressed_size;
+
+    if (compressor_ != nullptr)
+    {
+        size_t compressed_size =
+            compressor_->Compress(uncompressed_size, uncompressed_data, block_data, block_offset + header_size);
+
+        if ((compressed_size > 0) && (compressed_size < uncompressed_size))
         {
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, uncompressed_data, &thread_data->compressed_buffer_, header_size);
+            fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            data_size                              = compressed_size;
+        }
+    }
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+    fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
+
+    block_data->resize(block_offset + header_size + data_size);
+    util::platform::MemoryCopy(block_data->data() + block_offset, header_size, &fill_cmd, header_size);
+
+    if (fill_cmd.meta_header.block_header.type == format::BlockType::kMetaDataBlock)
+    {
+        util::platform::MemoryCopy(
+            block_data->data() + block_offset + header_size, data_size, uncompressed_data, uncompressed_size);
+    }
+}
+
+void CommonCaptureManager::WriteTrackedMemoryFillMemoryCmds(format::ApiFamilyId api_family)
+{
+    util::PageGuardManager* manager = util::PageGuardManager::Get();
+    assert(manager != nullptr);
+
+    if (memory_process_pool_ == nullptr)
+    {
+        manager->ProcessMemoryEntries(
+            [this, api_family](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+                WriteFillMemoryCmd(api_family, memory_id, offset, size, start_address);
+            });
+
+        return;
+    }
+
+    // Memory must be processed to reset the tracking state, even when the blocks are not written.
+    const bool write_blocks = IsCaptureModeWrite();
+    auto       thread_data  = GetThreadData();
+    assert(thread_data != nullptr);
+
+    // Blocks are written in memory object order as soon as the objects before them have been written.  Workers that
+    // finish objects too far ahead of the next object to write wait, which bounds the memory held for encoded blocks.
+    const size_t           max_held_entries = memory_process_pool_->numthreads() * kMaxHeldFillMemoryEntriesPerThread;
+    const format::ThreadId thread_id        = thread_data->thread_id_;
+
+    std::mutex                                       entry_lock;
+    std::condition_variable                          entry_written;
+    size_t                                           next_entry = 0;
+    std::unordered_map<size_t, std::vector<uint8_t>> encoding_entries;
+    std::map<size_t, std::vector<uint8_t>>           completed_entries;
+
+    manager->ProcessMemoryEntries(
+        [&](size_t entry_index, uint64_t memory_id, void* start_address, size_t offset, size_t size) {
+            if (write_blocks)
             {
-                not_compressed = false;
+                std::vector<uint8_t>* block_data = nullptr;
+                {
+                    std::lock_guard<std::mutex> lock(entry_lock);
+                    block_data = &encoding_entries[entry_index];
+                }
 
-                // We don't have a special header for compressed fill commands because the header always includes
-                // the uncompressed size, so we just change the type to indicate the data is compressed.
-                fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+                EncodeFillMemoryCmd(api_family, thread_id, memory_id, offset, size, start_address, block_data);
+            }
+        },
+        [&](size_t entry_index) {
+            std::unique_lock<std::mutex> lock(entry_lock);
 
-                // Calculate size of packet with uncompressed data size.
-                fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+            std::vector<uint8_t> block_data;
+            auto                 encoded = encoding_entries.find(entry_index);
+            if (encoded != encoding_entries.end())
+            {
+                block_data = std::move(encoded->second);
+                encoding_entries.erase(encoded);
+            }
+
+            if (entry_index != next_entry)
+            {
+                completed_entries.emplace(entry_index, std::move(block_data));
+                entry_written.wait(lock, [&]() { return (entry_index - next_entry) < max_held_entries; });
+                return;
+            }
 
-                // Copy header to beginning of compressed_buffer_
-                util::platform::MemoryCopy(thread_data->compressed_buffer_.data(), header_size, &fill_cmd, header_size);
+            // The file writes are serialized by the entry lock.
+            WriteFillMemoryBlocks(block_data);
+            ++next_entry;
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+            for (auto completed = completed_entries.begin();
+                 (completed != completed_entries.end()) && (completed->first == next_entry);
+                 completed = completed_entries.erase(completed))
+            {
+                WriteFillMemoryBlocks(completed->second);
+                ++next_entry;
             }
-        }
 
-        if (not_compressed)
-        {
-            // Calculate size of packet with compressed data size.
-            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + uncompressed_size;
+            entry_written.notify_all();
+        },
+        memory_process_pool_.get());
 
-            CombineAndWriteToFile({ { &fill_cmd, header_size }, { uncompressed_data, uncompressed_size } });
-        }
+    assert(encoding_entries.empty() && completed_entries.empty());
+
+    // The blocks were written by the worker threads on behalf of this thread.
+    thread_data->block_index_ = block_index_.load();
+}
+
+void CommonCaptureManager::WriteFillMemoryBlocks(const std::vector<uint8_t>& block_data)
+{
+    const uint8_t* block_start    = block_data.data();
+    size_t         remaining_size = block_data.size();
+
+    // Write one block at a time to keep the block index consistent with the sequential path.
+    while (remaining_size > 0)
+    {
+        format::BlockHeader block_header;
+        util::platform::MemoryCopy(&block_header, sizeof(block_header), block_start, sizeof(block_header));
+
+        const size_t block_size = sizeof(block_header) + static_cast<size_t>(block_header.size);
+        assert(block_size <= remaining_size);
+
+        WriteToFileStream(file_stream_.get(), block_start, block_size);
+
+        block_start += block_size;
+        remaining_size -= block_size;
     }
 }
 
@@ -1481,6 +1753,19 @@ void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_
 }
 
 void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream)
+{
+    util::FileOutputStream* output_stream = (file_stream != nullptr) ? file_stream : file_stream_.get();
+
+    WriteToFileStream(output_stream, data, size);
+
+    // Increment block index
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    thread_data->block_index_ = block_index_.load();
+}
+
+void CommonCaptureManager::WriteToFileStream(util::FileOutputStream* output_stream, const void* data, size_t size)
 {
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -1496,8 +1781,6 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
         }
     }
 
-    util::FileOutputStream* output_stream = (file_stream != nullptr) ? file_stream : file_stream_.get();
-
     output_stream->Write(data, size);
     if (force_file_flush_)
     {
@@ -1514,12 +1797,7 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size, util::File
         }
     }
 
-    // Increment block index
-    auto thread_data = GetThreadData();
-    assert(thread_data != nullptr);
-
     ++block_index_;
-    thread_data->block_index_ = block_index_.load();
 }
 
 void CommonCaptureManager::AtExit()
@@ -1535,6 +1813,35 @@ void CommonCaptureManager::AtExit()
     }
 }
 
+void CommonCaptureManager::WriteCallProfile()
+{
+    assert(call_profiler_ != nullptr);
+
+    // API calls are reported by entry point name, with the hexadecimal API call ID as a fallback for unknown IDs.
+    auto name_func = [](uint16_t, uint32_t id) {
+        const char* call_name = util::GetApiCallIdString(static_cast<format::ApiCallId>(id));
+        if (call_name != nullptr)
+        {
+            return std::string(call_name);
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "ApiCall_0x%08x", id);
+        return std::string(name);
+    };
+
+    call_profiler_->LogSummary(name_func, kCallProfileSummaryEntries);
+
+    if (call_profiler_->WriteHistograms(call_profile_file_, name_func))
+    {
+        GFXRECON_WRITE_CONSOLE("Wrote API call capture profile to %s", call_profile_file_.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to write API call capture profile to %s", call_profile_file_.c_str());
+    }
+}
+
 void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation)
 {
     CaptureSettings::TraceSettings default_settings = default_settings_.GetTraceSettings();
@@ -1548,7 +1855,14 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
 
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
-        buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
+        if (memory_hash_tracker_ != nullptr)
+        {
+            buffer += "\n    \"memory-tracking-mode\": \"unassisted_hash\",";
+        }
+        else
+        {
+            buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
+        }
     }
     else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kAssisted)
     {
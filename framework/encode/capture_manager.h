@@ -33,9 +33,11 @@
 #include "format/format.h"
 #include "format/platform_types.h"
 #include "util/compressor.h"
+#include "util/call_profiler.h"
 #include "util/defines.h"
 #include "util/file_output_stream.h"
 #include "util/keyboard.h"
+#include "util/memory_hash_tracker.h"
 
 #include <atomic>
 #include <cassert>
@@ -124,6 +126,10 @@ class CommonCaptureManager
     void PreQueueSubmit(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
     void PostQueueSubmit(format::ApiFamilyId api_family, std::shared_lock<ApiCallMutexT>& current_lock);
 
+    // Writes state that was omitted from the trim state snapshot, while other API calls are blocked.  Called by an API
+    // capture manager when the captured commands are about to use the deferred state.
+    void WriteDeferredState(ApiCaptureManager* api_capture_manager, std::shared_lock<ApiCallMutexT>& current_lock);
+
     bool ShouldTriggerScreenshot();
 
     util::ScreenshotFormat GetScreenshotFormat() { return screenshot_format_; }
@@ -164,6 +170,12 @@ class CommonCaptureManager
     auto GetForceCommandSerialization() const { return force_command_serialization_; }
     auto GetQueueZeroOnly() const { return queue_zero_only_; }
     auto GetAllowPipelineCompileRequired() const { return allow_pipeline_compile_required_; }
+    bool GetDeferResourceContent() const { return defer_resource_content_; }
+
+    const std::string& GetShaderReflectionCacheFile() const { return shader_reflection_cache_file_; }
+
+    // Returns the profiler that times the capture work of each API call, or nullptr when the call profile is disabled.
+    util::CallProfiler* GetCallProfiler() const { return call_profiler_.get(); }
 
     bool     IsAnnotated() const { return rv_annotation_info_.rv_annotation; }
     uint16_t GetGPUVAMask() const { return rv_annotation_info_.gpuva_mask; }
@@ -203,6 +215,18 @@ class CommonCaptureManager
 
     typedef uint32_t CaptureMode;
 
+    // Stages of the capture work for an API call that are timed when the call profile is enabled.  The total stage
+    // spans from the start of parameter encoding to the end of the file write.
+    enum ProfilerStage : uint16_t
+    {
+        kProfilerStageTotal,
+        kProfilerStageEncode,
+        kProfilerStageStateTracking,
+        kProfilerStageCompress,
+        kProfilerStageWrite,
+        kProfilerStageCount
+    };
+
     class ThreadData
     {
       public:
@@ -221,6 +245,8 @@ class CommonCaptureManager
         std::vector<uint8_t>                     compressed_buffer_;
         HandleUnwrapMemory                       handle_unwrap_memory_;
         uint64_t                                 block_index_;
+        int64_t                                  call_start_time_;
+        int64_t                                  encode_end_time_;
 
       private:
         static format::ThreadId GetThreadId();
@@ -239,6 +265,37 @@ class CommonCaptureManager
     bool        IsCaptureModeTrack() const;
     bool        IsCaptureModeWrite() const;
 
+    // Ends the encode stage of the current call and times the state tracking that follows it.  The thread data is
+    // only looked up when the call profile is enabled.
+    util::ScopedCallTimer ProfileStateTracking()
+    {
+        if (call_profiler_ == nullptr)
+        {
+            return util::ScopedCallTimer(nullptr, kProfilerStageStateTracking, format::ApiCallId::ApiCall_Unknown);
+        }
+
+        ThreadData* thread_data = GetThreadData();
+        EndEncodeProfile(thread_data);
+
+        return util::ScopedCallTimer(call_profiler_.get(), kProfilerStageStateTracking, thread_data->call_id_);
+    }
+
+    // Records the encode stage of the current call, if it has not already ended.  Only called when the call profile
+    // is enabled.
+    void EndEncodeProfile(ThreadData* thread_data)
+    {
+        assert((call_profiler_ != nullptr) && (thread_data != nullptr));
+
+        if (thread_data->encode_end_time_ == 0)
+        {
+            thread_data->encode_end_time_ = util::CallProfiler::GetTimestamp();
+            call_profiler_->Record(kProfilerStageEncode,
+                                   thread_data->call_id_,
+                                   thread_data->call_start_time_,
+                                   thread_data->encode_end_time_);
+        }
+    }
+
     void DestroyInstance(ApiCaptureManager* singleton);
 
   protected:
@@ -256,6 +313,7 @@ class CommonCaptureManager
     bool                                GetPageGuardAlignBufferSizes() const { return page_guard_align_buffer_sizes_; }
     bool                                GetPageGuardTrackAhbMemory() const { return page_guard_track_ahb_memory_; }
     PageGuardMemoryMode                 GetPageGuardMemoryMode() const { return page_guard_memory_mode_; }
+    util::MemoryHashTracker*            GetMemoryHashTracker() const { return memory_hash_tracker_.get(); }
     const std::string&                  GetTrimKey() const { return trim_key_; }
     bool                                IsTrimEnabled() const { return trim_enabled_; }
     uint32_t                            GetCurrentFrame() const { return current_frame_; }
@@ -301,6 +359,21 @@ class CommonCaptureManager
     void WriteFillMemoryCmd(
         format::ApiFamilyId api_family, format::HandleId memory_id, uint64_t offset, uint64_t size, const void* data);
 
+    // Appends a FillMemoryCommand block to block_data instead of writing it to the capture file, so that blocks can
+    // be encoded by worker threads on behalf of the thread identified by thread_id.
+    void EncodeFillMemoryCmd(format::ApiFamilyId   api_family,
+                             format::ThreadId      thread_id,
+                             format::HandleId      memory_id,
+                             uint64_t              offset,
+                             uint64_t              size,
+                             const void*           data,
+                             std::vector<uint8_t>* block_data) const;
+
+    // Writes FillMemoryCommands for the modified memory of all objects tracked by the PageGuardManager.  When a
+    // worker pool is available, the objects are scanned, copied, and encoded in parallel, and the resulting blocks are
+    // written in memory object ID order as each object completes.
+    void WriteTrackedMemoryFillMemoryCmds(format::ApiFamilyId api_family);
+
     void WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family, uint64_t allocation_id, uint64_t allocation_size);
 
     void WriteToFile(const void* data, size_t size, util::FileOutputStream* file_stream = nullptr);
@@ -341,6 +414,13 @@ class CommonCaptureManager
                               uint32_t                n_blocks,
                               int64_t                 offset);
 
+    // Writes data to output_stream and increments the block index, without updating the block index of the calling
+    // thread.
+    void WriteToFileStream(util::FileOutputStream* output_stream, const void* data, size_t size);
+
+    // Writes the FillMemoryCommand blocks encoded by EncodeFillMemoryCmd to the capture file.
+    void WriteFillMemoryBlocks(const std::vector<uint8_t>& block_data);
+
   protected:
     std::unique_ptr<util::Compressor> compressor_;
     std::mutex                        mapped_memory_lock_;
@@ -349,9 +429,19 @@ class CommonCaptureManager
     util::ScreenshotFormat            screenshot_format_;
     std::atomic<uint64_t>             block_index_;
 
+  private:
+    // Number of entries with the highest total time that are written to the console at capture end.
+    static const size_t kCallProfileSummaryEntries = 32;
+
+    // Number of memory objects per worker thread that can be encoded ahead of the next object to write when modified
+    // memory is processed in parallel.
+    static const size_t kMaxHeldFillMemoryEntriesPerThread = 4;
+
   private:
     static void AtExit();
 
+    void WriteCallProfile();
+
   private:
     static std::mutex                               instance_lock_;
     static CommonCaptureManager*                    singleton_;
@@ -415,10 +505,17 @@ class CommonCaptureManager
     bool                                    quit_after_frame_ranges_;
     bool                                    force_fifo_present_mode_;
     bool                                    use_asset_file_;
+    bool                                    defer_resource_content_;
+    std::string                             shader_reflection_cache_file_;
+    std::string                             call_profile_file_;
     bool                                    write_assets_;
     bool                                    previous_write_assets_;
     bool                                    write_state_files_;
 
+    std::unique_ptr<util::MemoryHashTracker> memory_hash_tracker_;
+    std::unique_ptr<util::ThreadPool>        memory_process_pool_;
+    std::unique_ptr<util::CallProfiler>      call_profiler_;
+
     struct
     {
         bool     rv_annotation{ false };
@@ -101,6 +101,12 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_QUEUE_SUBMITS_UPPER                          "CAPTURE_QUEUE_SUBMITS"
 #define CAPTURE_USE_ASSET_FILE_LOWER                         "capture_use_asset_file"
 #define CAPTURE_USE_ASSET_FILE_UPPER                         "CAPTURE_USE_ASSET_FILE"
+#define CAPTURE_DEFER_RESOURCE_CONTENT_LOWER                 "capture_defer_resource_content"
+#define CAPTURE_DEFER_RESOURCE_CONTENT_UPPER                 "CAPTURE_DEFER_RESOURCE_CONTENT"
+#define CAPTURE_SHADER_REFLECTION_CACHE_LOWER                "capture_shader_reflection_cache"
+#define CAPTURE_SHADER_REFLECTION_CACHE_UPPER                "CAPTURE_SHADER_REFLECTION_CACHE"
+#define CAPTURE_CALL_PROFILE_LOWER                           "capture_call_profile"
+#define CAPTURE_CALL_PROFILE_UPPER                           "CAPTURE_CALL_PROFILE"
 #define PAGE_GUARD_COPY_ON_MAP_LOWER                         "page_guard_copy_on_map"
 #define PAGE_GUARD_COPY_ON_MAP_UPPER                         "PAGE_GUARD_COPY_ON_MAP"
 #define PAGE_GUARD_SEPARATE_READ_LOWER                       "page_guard_separate_read"
@@ -119,6 +125,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER              "PAGE_GUARD_SIGNAL_HANDLER_WATCHER"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER "page_guard_signal_handler_watcher_max_restores"
 #define PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER "PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES"
+#define PAGE_GUARD_PROCESS_THREADS_LOWER                     "page_guard_process_threads"
+#define PAGE_GUARD_PROCESS_THREADS_UPPER                     "PAGE_GUARD_PROCESS_THREADS"
 #define DEBUG_LAYER_LOWER                                    "debug_layer"
 #define DEBUG_LAYER_UPPER                                    "DEBUG_LAYER"
 #define DEBUG_DEVICE_LOST_LOWER                              "debug_device_lost"
@@ -177,6 +185,9 @@ const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_LOWER;
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_LOWER;
 const char kCaptureUseAssetFileEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_USE_ASSET_FILE_LOWER;
+const char kCaptureDeferResourceContentEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEFER_RESOURCE_CONTENT_LOWER;
+const char kCaptureShaderReflectionCacheEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_SHADER_REFLECTION_CACHE_LOWER;
+const char kCaptureCallProfileEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX CAPTURE_CALL_PROFILE_LOWER;
 const char kPageGuardCopyOnMapEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
 const char kPageGuardSeparateReadEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
 const char kPageGuardPersistentMemoryEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
@@ -186,6 +197,7 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER;
+const char kPageGuardProcessThreadsEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PROCESS_THREADS_LOWER;
 const char kDebugLayerEnvVar[]                               = GFXRECON_ENV_VAR_PREFIX DEBUG_LAYER_LOWER;
 const char kDebugDeviceLostEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX DEBUG_DEVICE_LOST_LOWER;
 const char kCaptureAndroidTriggerEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_ANDROID_TRIGGER_LOWER;
@@ -212,6 +224,9 @@ const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kCaptureUseAssetFileEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_USE_ASSET_FILE_UPPER;
+const char kCaptureDeferResourceContentEnvVar[]              = GFXRECON_ENV_VAR_PREFIX CAPTURE_DEFER_RESOURCE_CONTENT_UPPER;
+const char kCaptureShaderReflectionCacheEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_SHADER_REFLECTION_CACHE_UPPER;
+const char kCaptureCallProfileEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX CAPTURE_CALL_PROFILE_UPPER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
 const char kLogBreakOnErrorEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_UPPER;
 const char kLogDetailedEnvVar[]                              = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_UPPER;
@@ -239,6 +254,7 @@ const char kPageGuardExternalMemoryEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kPageGuardUnblockSIGSEGVEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_UNBLOCK_SIGSEGV_UPPER;
 const char kPageGuardSignalHandlerWatcherEnvVar[]            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_UPPER;
 const char kPageGuardSignalHandlerWatcherMaxRestoresEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_UPPER;
+const char kPageGuardProcessThreadsEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PROCESS_THREADS_UPPER;
 const char kCaptureTriggerEnvVar[]                           = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
 const char kCaptureTriggerFramesEnvVar[]                     = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_FRAMES_UPPER;
 const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_IUNKNOWN_WRAPPING_UPPER;
@@ -288,6 +304,9 @@ const std::string kOptionKeyCaptureTriggerFrames                     = std::stri
 const std::string kOptionKeyCaptureIUnknownWrapping                  = std::string(kSettingsFilter) + std::string(CAPTURE_IUNKNOWN_WRAPPING_LOWER);
 const std::string kOptionKeyCaptureQueueSubmits                      = std::string(kSettingsFilter) + std::string(CAPTURE_QUEUE_SUBMITS_LOWER);
 const std::string kOptionKeyCaptureUseAssetFile                      = std::string(kSettingsFilter) + std::string(CAPTURE_USE_ASSET_FILE_LOWER);
+const std::string kOptionKeyCaptureDeferResourceContent              = std::string(kSettingsFilter) + std::string(CAPTURE_DEFER_RESOURCE_CONTENT_LOWER);
+const std::string kOptionKeyCaptureShaderReflectionCache             = std::string(kSettingsFilter) + std::string(CAPTURE_SHADER_REFLECTION_CACHE_LOWER);
+const std::string kOptionKeyCaptureCallProfile                       = std::string(kSettingsFilter) + std::string(CAPTURE_CALL_PROFILE_LOWER);
 const std::string kOptionKeyPageGuardCopyOnMap                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
 const std::string kOptionKeyPageGuardSeparateRead                    = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
 const std::string kOptionKeyPageGuardPersistentMemory                = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
@@ -297,6 +316,7 @@ const std::string kOptionKeyPageGuardExternalMemory                  = std::stri
 const std::string kOptionKeyPageGuardUnblockSigSegV                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_UNBLOCK_SIGSEGV_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcher            = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_LOWER);
 const std::string kOptionKeyPageGuardSignalHandlerWatcherMaxRestores = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SIGNAL_HANDLER_WATCHER_MAX_RESTORES_LOWER);
+const std::string kOptionKeyPageGuardProcessThreads                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PROCESS_THREADS_LOWER);
 const std::string kDebugLayer                                        = std::string(kSettingsFilter) + std::string(DEBUG_LAYER_LOWER);
 const std::string kDebugDeviceLost                                   = std::string(kSettingsFilter) + std::string(DEBUG_DEVICE_LOST_LOWER);
 const std::string kOptionDisableDxr                                  = std::string(kSettingsFilter) + std::string(DISABLE_DXR_LOWER);
@@ -439,6 +459,9 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureTriggerFramesEnvVar, kOptionKeyCaptureTriggerFrames);
     LoadSingleOptionEnvVar(options, kCaptureQueueSubmitsEnvVar, kOptionKeyCaptureQueueSubmits);
     LoadSingleOptionEnvVar(options, kCaptureUseAssetFileEnvVar, kOptionKeyCaptureUseAssetFile);
+    LoadSingleOptionEnvVar(options, kCaptureDeferResourceContentEnvVar, kOptionKeyCaptureDeferResourceContent);
+    LoadSingleOptionEnvVar(options, kCaptureShaderReflectionCacheEnvVar, kOptionKeyCaptureShaderReflectionCache);
+    LoadSingleOptionEnvVar(options, kCaptureCallProfileEnvVar, kOptionKeyCaptureCallProfile);
 
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
@@ -451,6 +474,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kPageGuardSignalHandlerWatcherEnvVar, kOptionKeyPageGuardSignalHandlerWatcher);
     LoadSingleOptionEnvVar(
         options, kPageGuardSignalHandlerWatcherMaxRestoresEnvVar, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores);
+    LoadSingleOptionEnvVar(options, kPageGuardProcessThreadsEnvVar, kOptionKeyPageGuardProcessThreads);
 
     // Debug environment variables
     LoadSingleOptionEnvVar(options, kDebugLayerEnvVar, kDebugLayer);
@@ -518,8 +542,13 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
 
     // Memory tracking options
-    settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
-        FindOption(options, kOptionKeyMemoryTrackingMode), settings->trace_settings_.memory_tracking_mode);
+    const std::string memory_tracking_mode         = FindOption(options, kOptionKeyMemoryTrackingMode);
+    settings->trace_settings_.memory_tracking_mode =
+        ParseMemoryTrackingModeString(memory_tracking_mode, settings->trace_settings_.memory_tracking_mode);
+    settings->trace_settings_.page_guard_userfaultfd_async =
+        (util::platform::StringCompareNoCase("userfaultfd_async", memory_tracking_mode.c_str()) == 0);
+    settings->trace_settings_.unassisted_hash_tracking =
+        (util::platform::StringCompareNoCase("unassisted_hash", memory_tracking_mode.c_str()) == 0);
 
     // Trimming options:
     // Trim frame ranges, trim queue submit ranges, and trim frame hotkey are mutually exclusive.
@@ -608,6 +637,15 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.use_asset_file =
         ParseBoolString(FindOption(options, kOptionKeyCaptureUseAssetFile), settings->trace_settings_.use_asset_file);
 
+    settings->trace_settings_.defer_resource_content = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureDeferResourceContent), settings->trace_settings_.defer_resource_content);
+
+    settings->trace_settings_.shader_reflection_cache_file = FindOption(
+        options, kOptionKeyCaptureShaderReflectionCache, settings->trace_settings_.shader_reflection_cache_file);
+
+    settings->trace_settings_.call_profile_file =
+        FindOption(options, kOptionKeyCaptureCallProfile, settings->trace_settings_.call_profile_file);
+
     // Page guard environment variables
     settings->trace_settings_.page_guard_copy_on_map = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardCopyOnMap), settings->trace_settings_.page_guard_copy_on_map);
@@ -631,6 +669,9 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     settings->trace_settings_.page_guard_signal_handler_watcher_max_restores =
         ParseIntegerString(FindOption(options, kOptionKeyPageGuardSignalHandlerWatcherMaxRestores),
                            settings->trace_settings_.page_guard_signal_handler_watcher_max_restores);
+    settings->trace_settings_.page_guard_process_threads =
+        ParseIntegerString(FindOption(options, kOptionKeyPageGuardProcessThreads),
+                           settings->trace_settings_.page_guard_process_threads);
 
     // Debug options
     settings->trace_settings_.debug_layer =
@@ -793,7 +834,8 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kPageGuard;
     }
-    else if (util::platform::StringCompareNoCase("userfaultfd", value_string.c_str()) == 0)
+    else if ((util::platform::StringCompareNoCase("userfaultfd", value_string.c_str()) == 0) ||
+             (util::platform::StringCompareNoCase("userfaultfd_async", value_string.c_str()) == 0))
     {
         result = MemoryTrackingMode::kUserfaultfd;
     }
@@ -801,7 +843,8 @@ CaptureSettings::ParseMemoryTrackingModeString(const std::string&
     {
         result = MemoryTrackingMode::kAssisted;
     }
-    else if (util::platform::StringCompareNoCase("unassisted", value_string.c_str()) == 0)
+    else if ((util::platform::StringCompareNoCase("unassisted", value_string.c_str()) == 0) ||
+             (util::platform::StringCompareNoCase("unassisted_hash", value_string.c_str()) == 0))
     {
         result = MemoryTrackingMode::kUnassisted;
     }
@@ -43,7 +43,9 @@ class CaptureSettings
   public:
     enum MemoryTrackingMode
     {
-        // Assume the application does not flush, so write all mapped data on unmap and queue submit.
+        // Assume the application does not flush, so write all mapped data on unmap and queue submit.  The
+        // "unassisted_hash" option value selects this mode with a per-block hash of the mapped data, so that only the
+        // blocks that changed since the previous write are written.
         kUnassisted = 0,
         // Assume the application will always flush after writing to mapped memory, so only write mapped memory data on
         // flush.
@@ -55,7 +57,7 @@ class CaptureSettings
         kPageGuard = 2,
         // Similar mechanism as page guard. The mapper memory returned by the driver is replaced by a shadow
         // allocation but in this case the memory is monitored using the userfaultfd mechanism provided by the linux
-        // kernel.
+        // kernel.  The "userfaultfd_async" option value selects this mode with asynchronous write-protect tracking.
         kUserfaultfd = 3
     };
 
@@ -115,6 +117,7 @@ class CaptureSettings
         RuntimeTriggerState          runtime_capture_trigger{ kNotUsed };
         bool                         runtime_write_assets{ false };
         int                          page_guard_signal_handler_watcher_max_restores{ 1 };
+        int                          page_guard_process_threads{ 1 };
         bool                         page_guard_copy_on_map{ util::PageGuardManager::kDefaultEnableCopyOnMap };
         bool                         page_guard_separate_read{ util::PageGuardManager::kDefaultEnableSeparateRead };
         bool                         page_guard_persistent_memory{ false };
@@ -122,6 +125,8 @@ class CaptureSettings
         bool                         page_guard_track_ahb_memory{ false };
         bool                         page_guard_unblock_sigsegv{ false };
         bool                         page_guard_signal_handler_watcher{ false };
+        bool                         page_guard_userfaultfd_async{ false };
+        bool                         unassisted_hash_tracking{ false };
         bool                         debug_layer{ false };
         bool                         debug_device_lost{ false };
         bool                         disable_dxr{ false };
@@ -132,6 +137,9 @@ class CaptureSettings
         bool                         quit_after_frame_ranges{ false };
         bool                         force_fifo_present_mode{ true };
         bool                         use_asset_file{ false };
+        bool                         defer_resource_content{ false };
+        std::string                  shader_reflection_cache_file;
+        std::string                  call_profile_file;
 
         // An optimization for the page_guard memory tracking mode that eliminates the need for shadow memory by
         // overriding vkAllocateMemory so that all host visible allocations use the external memory extension with a
@@ -45,6 +45,12 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+// Specialized by the generated struct encoders for structs that are encoded as an exact copy of their memory, with no
+// pointers, handles, or values that are converted to a different size for encoding.
+template <typename T>
+struct IsTriviallyEncodable : std::false_type
+{};
+
 class ParameterEncoder
 {
   public:
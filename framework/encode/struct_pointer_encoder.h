@@ -52,9 +52,16 @@ void EncodeStructArray(
 
     if ((value != nullptr) && (len > 0) && !omit_data)
     {
-        for (size_t i = 0; i < len; ++i)
+        if constexpr (IsTriviallyEncodable<T>::value)
         {
-            EncodeStruct(encoder, value[i]);
+            encoder->EncodeRawBytes(value, len * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                EncodeStruct(encoder, value[i]);
+            }
         }
     }
 }
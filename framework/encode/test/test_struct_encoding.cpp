@@ -0,0 +1,137 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "util/memory_output_stream.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using gfxrecon::encode::EncodeStruct;
+using gfxrecon::encode::EncodeStructArray;
+using gfxrecon::encode::IsTriviallyEncodable;
+using gfxrecon::encode::ParameterEncoder;
+using gfxrecon::util::MemoryOutputStream;
+
+// Encodes an array with EncodeStructArray, which uses a single copy for trivially encodable structs.
+template <typename T>
+static std::vector<uint8_t> EncodeArray(const T* values, size_t count)
+{
+    MemoryOutputStream stream;
+    ParameterEncoder   encoder(&stream);
+
+    EncodeStructArray(&encoder, values, count);
+
+    return std::vector<uint8_t>(stream.GetData(), stream.GetData() + stream.GetDataSize());
+}
+
+// Encodes an array one member at a time, as EncodeStructArray does for structs that are not trivially encodable.
+template <typename T>
+static std::vector<uint8_t> EncodeArrayMemberwise(const T* values, size_t count)
+{
+    MemoryOutputStream stream;
+    ParameterEncoder   encoder(&stream);
+
+    encoder.EncodeStructArrayPreamble(values, count, false, false);
+    for (size_t i = 0; i < count; ++i)
+    {
+        EncodeStruct(&encoder, values[i]);
+    }
+
+    return std::vector<uint8_t>(stream.GetData(), stream.GetData() + stream.GetDataSize());
+}
+
+TEST_CASE("EncodeStructArray - bulk encoding matches member-wise encoding", "[encode]")
+{
+    REQUIRE(IsTriviallyEncodable<VkBufferImageCopy>::value);
+
+    VkBufferImageCopy regions[3];
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        regions[i].bufferOffset                    = 0x100000000ull * (i + 1) + i;
+        regions[i].bufferRowLength                 = 64 + i;
+        regions[i].bufferImageHeight               = 32 + i;
+        regions[i].imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        regions[i].imageSubresource.mipLevel       = i;
+        regions[i].imageSubresource.baseArrayLayer = 2 * i;
+        regions[i].imageSubresource.layerCount     = 1;
+        regions[i].imageOffset                     = { static_cast<int32_t>(i), -static_cast<int32_t>(i), 0 };
+        regions[i].imageExtent                     = { 16, 8, 1 };
+    }
+
+    REQUIRE(EncodeArray(regions, 3) == EncodeArrayMemberwise(regions, 3));
+}
+
+TEST_CASE("EncodeStructArray - padding is not encoded", "[encode]")
+{
+    // VkMemoryHeap has four bytes of padding after flags, so it must be encoded member by member.
+    REQUIRE(!IsTriviallyEncodable<VkMemoryHeap>::value);
+
+    VkMemoryHeap heaps[2];
+    std::memset(heaps, 0xcd, sizeof(heaps));
+    heaps[0].size  = 0x200000000ull;
+    heaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    heaps[1].size  = 0x10000000ull;
+    heaps[1].flags = 0;
+
+    const std::vector<uint8_t> encoded = EncodeArray(heaps, 2);
+
+    REQUIRE(encoded == EncodeArrayMemberwise(heaps, 2));
+
+    MemoryOutputStream preamble_stream;
+    ParameterEncoder   preamble_encoder(&preamble_stream);
+    preamble_encoder.EncodeStructArrayPreamble(heaps, 2, false, false);
+
+    REQUIRE(encoded.size() == preamble_stream.GetDataSize() + 2 * (sizeof(uint64_t) + sizeof(uint32_t)));
+}
+
+TEST_CASE("EncodeStructArray - structs with a pNext chain", "[encode]")
+{
+    REQUIRE(!IsTriviallyEncodable<VkAttachmentReference2>::value);
+
+    VkAttachmentReferenceStencilLayout stencil_layout = { VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT };
+    stencil_layout.stencilLayout                      = VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL;
+
+    VkAttachmentReference2 references[2] = { { VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2 },
+                                             { VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2 } };
+    references[0].pNext                  = &stencil_layout;
+    references[0].attachment             = 0;
+    references[0].layout                 = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    references[0].aspectMask             = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+    references[1].attachment             = 1;
+    references[1].layout                 = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    references[1].aspectMask             = VK_IMAGE_ASPECT_COLOR_BIT;
+
+    const std::vector<uint8_t> encoded = EncodeArray(references, 2);
+
+    REQUIRE(encoded == EncodeArrayMemberwise(references, 2));
+
+    // The chained struct is encoded, so the output is larger than the memory of the array.
+    REQUIRE(encoded.size() > sizeof(references));
+}
@@ -36,7 +36,6 @@
 #include "encode/vulkan_capture_common.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_struct_handle_wrappers.h"
-#include "graphics/vulkan_check_buffer_references.h"
 #include "graphics/vulkan_device_util.h"
 #include "graphics/vulkan_struct_get_pnext.h"
 #include "graphics/vulkan_util.h"
@@ -70,6 +69,12 @@ bool VulkanCaptureManager::CreateInstance()
     bool result = CommonCaptureManager::CreateInstance<VulkanCaptureManager>();
     GFXRECON_ASSERT(singleton_);
 
+    if (result && (singleton_->shader_reflection_cache_ == nullptr))
+    {
+        singleton_->shader_reflection_cache_ =
+            std::make_unique<VulkanShaderReflectionCache>(singleton_->GetShaderReflectionCacheFile());
+    }
+
     GFXRECON_LOG_INFO("  Vulkan Header Version %u.%u.%u",
                       VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
                       VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
@@ -104,8 +109,14 @@ void VulkanCaptureManager::DestroyInstance()
 
 void VulkanCaptureManager::WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
 {
-    uint64_t n_blocks = state_tracker_->WriteState(
-        file_stream, thread_id, [] { return GetUniqueId(); }, GetCompressor(), GetCurrentFrame(), nullptr, nullptr);
+    uint64_t n_blocks = state_tracker_->WriteState(file_stream,
+                                                   thread_id,
+                                                   [] { return GetUniqueId(); },
+                                                   GetCompressor(),
+                                                   GetCurrentFrame(),
+                                                   nullptr,
+                                                   nullptr,
+                                                   GetDeferResourceContent());
 
     common_manager_->IncrementBlockIndex(n_blocks);
 }
@@ -122,7 +133,18 @@ void VulkanCaptureManager::WriteTrackedStateWithAssetFile(util::FileOutputStream
         GetCompressor(),
         GetCurrentFrame(),
         asset_file_stream,
-        asset_file_name);
+        asset_file_name,
+        false);
+
+    common_manager_->IncrementBlockIndex(n_blocks);
+}
+
+void VulkanCaptureManager::WriteDeferredState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
+{
+    assert(state_tracker_ != nullptr);
+
+    uint64_t n_blocks = state_tracker_->WritePendingResourceContent(
+        file_stream, thread_id, [] { return GetUniqueId(); }, GetCompressor());
 
     common_manager_->IncrementBlockIndex(n_blocks);
 }
@@ -2112,21 +2134,18 @@ void VulkanCaptureManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMem
         }
         else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUnassisted)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
-
-            // Write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            WriteUnassistedFillMemoryCmd(wrapper);
 
             {
                 std::lock_guard<std::mutex> lock(GetMappedMemoryLock());
                 mapped_memory_.erase(wrapper);
             }
+
+            util::MemoryHashTracker* hash_tracker = GetMemoryHashTracker();
+            if (hash_tracker != nullptr)
+            {
+                hash_tracker->RemoveMemory(wrapper->handle_id);
+            }
         }
     }
     else
@@ -2160,8 +2179,16 @@ void VulkanCaptureManager::PreProcess_vkFreeMemory(VkDevice
             }
             else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUnassisted)
             {
-                std::lock_guard<std::mutex> lock(GetMappedMemoryLock());
-                mapped_memory_.erase(wrapper);
+                {
+                    std::lock_guard<std::mutex> lock(GetMappedMemoryLock());
+                    mapped_memory_.erase(wrapper);
+                }
+
+                util::MemoryHashTracker* hash_tracker = GetMemoryHashTracker();
+                if (hash_tracker != nullptr)
+                {
+                    hash_tracker->RemoveMemory(wrapper->handle_id);
+                }
             }
         }
     }
@@ -2314,6 +2341,14 @@ void VulkanCaptureManager::PreProcess_vkQueueSubmit(std::shared_lock<CommonCaptu
 
     PreQueueSubmit(current_lock);
 
+    // Resource content that was omitted from the trim state snapshot is written before the first submission that
+    // references the resources, which may be the submission that started the trimmed range.
+    if (IsCaptureModeWrite() && IsCaptureModeTrack() && GetDeferResourceContent() &&
+        state_tracker_->TrackDeferredResourceReferences(submitCount, pSubmits))
+    {
+        ProcessDeferredState(current_lock);
+    }
+
     if (IsCaptureModeTrack())
     {
         if (pSubmits)
@@ -2350,6 +2385,14 @@ void VulkanCaptureManager::PreProcess_vkQueueSubmit2(
 
     PreQueueSubmit(current_lock);
 
+    // Resource content that was omitted from the trim state snapshot is written before the first submission that
+    // references the resources, which may be the submission that started the trimmed range.
+    if (IsCaptureModeWrite() && IsCaptureModeTrack() && GetDeferResourceContent() &&
+        state_tracker_->TrackDeferredResourceReferences(submitCount, pSubmits))
+    {
+        ProcessDeferredState(current_lock);
+    }
+
     if (IsCaptureModeTrack())
     {
         std::vector<VkCommandBuffer> command_buffs;
@@ -2376,12 +2419,7 @@ void VulkanCaptureManager::QueueSubmitWriteFillMemoryCmd()
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
-        util::PageGuardManager* manager = util::PageGuardManager::Get();
-        assert(manager != nullptr);
-
-        manager->ProcessMemoryEntries([this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
-            WriteFillMemoryCmd(memory_id, offset, size, start_address);
-        });
+        WriteTrackedMemoryFillMemoryCmds();
     }
     else if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
@@ -2389,20 +2427,50 @@ void VulkanCaptureManager::QueueSubmitWriteFillMemoryCmd()
 
         for (auto wrapper : mapped_memory_)
         {
-            VkDeviceSize size = wrapper->mapped_size;
-            if (size == VK_WHOLE_SIZE)
-            {
-                assert(wrapper->mapped_offset <= wrapper->allocation_size);
-                size = wrapper->allocation_size - wrapper->mapped_offset;
-            }
-
-            // If the memory is mapped, write the entire mapped region.
-            // We set offset to 0, because the pointer returned by vkMapMemory already includes the offset.
-            WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+            WriteUnassistedFillMemoryCmd(wrapper);
         }
     }
 }
 
+void VulkanCaptureManager::WriteUnassistedFillMemoryCmd(const vulkan_wrappers::DeviceMemoryWrapper* wrapper)
+{
+    assert(wrapper != nullptr);
+
+    VkDeviceSize size = wrapper->mapped_size;
+    if (size == VK_WHOLE_SIZE)
+    {
+        assert(wrapper->mapped_offset <= wrapper->allocation_size);
+        size = wrapper->allocation_size - wrapper->mapped_offset;
+    }
+
+    if (!IsCaptureModeWrite())
+    {
+        // Nothing is written before trimming starts, and hashing would only record content that the capture file never
+        // received.
+        return;
+    }
+
+    // Offsets are relative to the start of the mapped region, because the pointer returned by vkMapMemory already
+    // includes the mapped offset.
+    util::MemoryHashTracker* hash_tracker = GetMemoryHashTracker();
+    if (hash_tracker != nullptr)
+    {
+        // Only write the blocks of the mapped region that changed since the last write.
+        const void* mapped_data = wrapper->mapped_data;
+        hash_tracker->ProcessMemory(wrapper->handle_id,
+                                    mapped_data,
+                                    static_cast<size_t>(size),
+                                    [this, mapped_data](uint64_t memory_id, size_t offset, size_t range_size) {
+                                        WriteFillMemoryCmd(memory_id, offset, range_size, mapped_data);
+                                    });
+    }
+    else
+    {
+        // Write the entire mapped region.
+        WriteFillMemoryCmd(wrapper->handle_id, 0, size, wrapper->mapped_data);
+    }
+}
+
 void VulkanCaptureManager::PostProcess_vkCreateDescriptorUpdateTemplate(
     VkResult                                    result,
     VkDevice                                    device,
@@ -2735,20 +2803,16 @@ void VulkanCaptureManager::PostProcess_vkCreateShaderModule(VkResult
     GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
     GFXRECON_UNREFERENCED_PARAMETER(pShaderModule);
 
-    if (result == VK_SUCCESS)
+    if ((result == VK_SUCCESS) && (shader_reflection_cache_ != nullptr))
     {
-        graphics::vulkan_check_buffer_references(pCreateInfo->pCode, pCreateInfo->codeSize);
-
         vulkan_wrappers::ShaderModuleWrapper* shader_wrapper =
             vulkan_wrappers::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(*pShaderModule);
         if (shader_wrapper != nullptr)
         {
-            gfxrecon::util::SpirVParsingUtil spirv_util;
-            if (!spirv_util.SPIRVReflectPerformReflectionOnShaderModule(
-                    pCreateInfo->codeSize, pCreateInfo->pCode, shader_wrapper->used_descriptors_info))
-            {
-                GFXRECON_LOG_WARNING("Reflection on shader %" PRIu64 "failed", shader_wrapper->handle_id);
-            }
+            // Reflection, including the check for buffer references, runs on a worker thread unless identical code
+            // was already reflected.
+            shader_wrapper->reflection = shader_reflection_cache_->GetReflection(
+                pCreateInfo->pCode, pCreateInfo->codeSize, shader_wrapper->handle_id);
         }
     }
 }
@@ -2786,7 +2850,7 @@ void VulkanCaptureManager::PostProcess_vkCreateGraphicsPipelines(VkResult
                         pCreateInfos[p].pStages[s].module);
                 assert(shader_wrapper != nullptr);
 
-                ppl_wrapper->bound_shaders.push_back(*shader_wrapper);
+                ppl_wrapper->bound_shaders.push_back(shader_wrapper->reflection);
             }
         }
     }
@@ -2812,7 +2876,7 @@ void VulkanCaptureManager::PostProcess_vkCreateComputePipelines(VkResult
                 vulkan_wrappers::GetWrapper<vulkan_wrappers::ShaderModuleWrapper>(pCreateInfos[p].stage.module);
             assert(shader_wrapper != nullptr);
 
-            ppl_wrapper->bound_shaders.push_back(*shader_wrapper);
+            ppl_wrapper->bound_shaders.push_back(shader_wrapper->reflection);
         }
     }
 }
@@ -2842,7 +2906,7 @@ void VulkanCaptureManager::PostProcess_vkCreateRayTracingPipelinesKHR(
                         pCreateInfos[p].pStages[s].module);
                 assert(shader_wrapper != nullptr);
 
-                ppl_wrapper->bound_shaders.push_back(*shader_wrapper);
+                ppl_wrapper->bound_shaders.push_back(shader_wrapper->reflection);
             }
         }
     }
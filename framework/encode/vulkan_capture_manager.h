@@ -33,6 +33,7 @@
 #include "encode/parameter_encoder.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_handle_wrappers.h"
+#include "encode/vulkan_shader_reflection_cache.h"
 #include "encode/vulkan_state_tracker.h"
 #include "format/api_call_id.h"
 #include "format/format.h"
@@ -101,6 +102,8 @@ class VulkanCaptureManager : public ApiCaptureManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->AddEntry<ParentHandle, Wrapper, CreateInfo>(
                 parent_handle, handle, create_info, thread_data->call_id_, thread_data->parameter_buffer_.get());
         }
@@ -123,6 +126,8 @@ class VulkanCaptureManager : public ApiCaptureManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->AddPoolEntry<ParentHandle, Wrapper, AllocateInfo>(
                 parent_handle, count, handles, alloc_info, thread_data->call_id_, thread_data->parameter_buffer_.get());
         }
@@ -149,6 +154,8 @@ class VulkanCaptureManager : public ApiCaptureManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->AddGroupEntry<ParentHandle, SecondaryHandle, Wrapper, CreateInfo>(
                 parent_handle,
                 secondary_handle,
@@ -178,6 +185,8 @@ class VulkanCaptureManager : public ApiCaptureManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->AddStructGroupEntry(parent_handle,
                                                 count,
                                                 handle_structs,
@@ -196,6 +205,9 @@ class VulkanCaptureManager : public ApiCaptureManager
         if (IsCaptureModeTrack())
         {
             assert(state_tracker_ != nullptr);
+
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->RemoveEntry<Wrapper>(handle);
         }
 
@@ -210,6 +222,8 @@ class VulkanCaptureManager : public ApiCaptureManager
         {
             assert(state_tracker_ != nullptr);
 
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             for (uint32_t i = 0; i < count; ++i)
             {
                 state_tracker_->RemoveEntry<Wrapper>(handles[i]);
@@ -239,6 +253,9 @@ class VulkanCaptureManager : public ApiCaptureManager
         if (IsCaptureModeTrack())
         {
             assert(state_tracker_ != nullptr);
+
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->TrackCommand(command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get());
         }
 
@@ -256,6 +273,9 @@ class VulkanCaptureManager : public ApiCaptureManager
         if (IsCaptureModeTrack())
         {
             assert(state_tracker_ != nullptr);
+
+            util::ScopedCallTimer state_timer = ProfileStateTracking();
+
             state_tracker_->TrackCommand(
                 command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get(), func, args...);
         }
@@ -914,12 +934,15 @@ class VulkanCaptureManager : public ApiCaptureManager
         }
     }
 
-    void PostProcess_vkResetCommandPool(VkResult result, VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags)
+    void PostProcess_vkResetCommandPool(VkResult                result,
+                                        VkDevice,
+                                        VkCommandPool           commandPool,
+                                        VkCommandPoolResetFlags flags)
     {
         if (IsCaptureModeTrack() && (result == VK_SUCCESS))
         {
             assert(state_tracker_ != nullptr);
-            state_tracker_->TrackResetCommandPool(commandPool);
+            state_tracker_->TrackResetCommandPool(commandPool, flags);
         }
     }
 
@@ -1621,6 +1644,8 @@ class VulkanCaptureManager : public ApiCaptureManager
                              const std::string*      asset_file_name,
                              format::ThreadId        thread_id) override;
 
+    virtual void WriteDeferredState(util::FileOutputStream* file_stream, format::ThreadId thread_id) override;
+
   private:
     struct HardwareBufferInfo
     {
@@ -1674,12 +1699,15 @@ class VulkanCaptureManager : public ApiCaptureManager
   private:
     void QueueSubmitWriteFillMemoryCmd();
 
+    void WriteUnassistedFillMemoryCmd(const vulkan_wrappers::DeviceMemoryWrapper* wrapper);
+
     static VulkanCaptureManager*                    singleton_;
     static VulkanLayerTable                         vulkan_layer_table_;
     std::set<vulkan_wrappers::DeviceMemoryWrapper*> mapped_memory_; // Track mapped memory for unassisted tracking mode.
     std::unique_ptr<VulkanStateTracker>             state_tracker_;
     HardwareBufferMap                               hardware_buffers_;
     std::mutex                                      deferred_operation_mutex;
+    std::unique_ptr<VulkanShaderReflectionCache>    shader_reflection_cache_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -30,6 +30,7 @@
 #include "format/format.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "graphics/vulkan_device_util.h"
+#include "util/chunked_buffer.h"
 #include "util/defines.h"
 #include "util/memory_output_stream.h"
 #include "util/page_guard_manager.h"
@@ -116,7 +117,7 @@ struct DisplayModeKHRWrapper            : public HandleWrapper<VkDisplayModeKHR>
 
 struct ShaderModuleWrapper : public HandleWrapper<VkShaderModule>
 {
-    vulkan_state_info::ShaderReflectionDescriptorSetsInfos used_descriptors_info;
+    vulkan_state_info::ShaderReflectionFuture reflection;
 };
 
 // This handle type is retrieved and has no destroy function. The handle wrapper will be owned by its parent
@@ -225,6 +226,7 @@ struct ImageWrapper : public HandleWrapper<VkImage>, AssetWrapperBase
     uint32_t                 array_layers{ 0 };
     VkSampleCountFlagBits    samples{};
     VkImageTiling            tiling{};
+    VkImageUsageFlags        usage{ 0 };
     VkImageLayout            current_layout{ VK_IMAGE_LAYOUT_UNDEFINED };
     bool                     is_swapchain_image{ false };
     std::set<VkSwapchainKHR> parent_swapchains;
@@ -388,7 +390,8 @@ struct PipelineWrapper : public HandleWrapper<VkPipeline>
     // TODO: Base pipeline
     // TODO: Pipeline cache
 
-    std::vector<ShaderModuleWrapper> bound_shaders;
+    // Reflection of the pipeline's shader stages, shared with the shader modules.
+    std::vector<vulkan_state_info::ShaderReflectionFuture> bound_shaders;
 };
 
 struct AccelerationStructureKHRWrapper;
@@ -403,8 +406,11 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     CommandPoolWrapper* parent_pool{ nullptr };
 
     // Members for trimming state tracking.
-    VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
+    VkCommandBufferLevel level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
+
+    // Encoded commands, stored as records of { size_t parameter_size, ApiCallId call_id, uint8_t parameters[] } in
+    // chunks that are shared with the other command buffers allocated from the parent pool.
+    util::ChunkedBuffer        command_data;
     std::set<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
 
     // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
@@ -473,6 +479,10 @@ struct CommandPoolWrapper : public HandleWrapper<VkCommandPool>
 
     DeviceWrapper* device{ nullptr };
     bool           trim_command_pool{ false };
+
+    // Storage for the command data recorded to the pool's command buffers, which is recycled when the command buffers
+    // are reset.  Command buffers allocated from the same pool are externally synchronized, so no lock is required.
+    std::shared_ptr<util::ChunkPool> command_data_pool{ std::make_shared<util::ChunkPool>() };
 };
 
 // For vkGetPhysicalDeviceSurfaceCapabilitiesKHR
@@ -0,0 +1,326 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/vulkan_shader_reflection_cache.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/spirv_parsing_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <future>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Identifies the cache file format, which must be updated when the layout of the saved entries changes.
+const uint32_t kCacheFileMagic   = 0x43525347; // "GSRC"
+const uint32_t kCacheFileVersion = 1;
+
+template <typename T>
+static void WriteValue(std::vector<uint8_t>& buffer, T value)
+{
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+static bool ReadValue(const std::vector<uint8_t>& buffer, size_t& offset, T& value)
+{
+    if ((buffer.size() - offset) < sizeof(T))
+    {
+        return false;
+    }
+
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+VulkanShaderReflectionCache::VulkanShaderReflectionCache(const std::string& filename) :
+    filename_(filename), modified_(false),
+    thread_pool_(std::max(1u, std::thread::hardware_concurrency() / 4))
+{
+    if (!filename_.empty())
+    {
+        Load();
+    }
+}
+
+VulkanShaderReflectionCache::~VulkanShaderReflectionCache()
+{
+    // Pending tasks are discarded when the thread pool is destroyed, so all reflections must complete first.
+    for (const auto& entry : entries_)
+    {
+        entry.second.wait();
+    }
+
+    if (!filename_.empty() && modified_)
+    {
+        Save();
+    }
+}
+
+vulkan_state_info::ShaderReflectionFuture
+VulkanShaderReflectionCache::GetReflection(const uint32_t* code, size_t code_size, format::HandleId shader_id)
+{
+    assert(code != nullptr);
+
+    const util::hash::Hash128 key = util::hash::murmur3_128(code, code_size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto entry = entries_.find(key);
+    if (entry != entries_.end())
+    {
+        // Reflections loaded from the cache file did not go through Reflect(), which issues the warning.
+        if (entry->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            const vulkan_state_info::ShaderReflectionPtr& reflection = entry->second.get();
+            if ((reflection != nullptr) && reflection->uses_buffer_references)
+            {
+                WarnBufferReferences();
+            }
+        }
+
+        return entry->second;
+    }
+
+    // The application may release the code as soon as the shader module is created, so the worker gets a copy.
+    std::vector<uint32_t> code_copy(code, code + (code_size / sizeof(uint32_t)));
+
+    vulkan_state_info::ShaderReflectionFuture reflection =
+        thread_pool_.post([code_copy, shader_id]() { return Reflect(code_copy, shader_id); }).share();
+
+    entries_.emplace(key, reflection);
+    modified_ = true;
+
+    return reflection;
+}
+
+vulkan_state_info::ShaderReflectionPtr VulkanShaderReflectionCache::Reflect(const std::vector<uint32_t>& code,
+                                                                            format::HandleId             shader_id)
+{
+    auto                   reflection = std::make_shared<vulkan_state_info::ShaderReflectionInfo>();
+    const size_t           code_size  = code.size() * sizeof(uint32_t);
+    util::SpirVParsingUtil spirv_util;
+
+    if (spirv_util.ParseBufferReferences(code.data(), code_size) && !spirv_util.GetBufferReferenceInfos().empty())
+    {
+        reflection->uses_buffer_references = true;
+        WarnBufferReferences();
+    }
+
+    if (!spirv_util.SPIRVReflectPerformReflectionOnShaderModule(
+            code_size, code.data(), reflection->used_descriptors_info))
+    {
+        GFXRECON_LOG_WARNING("Reflection on shader %" PRIu64 " failed", shader_id);
+        return nullptr;
+    }
+
+    return reflection;
+}
+
+void VulkanShaderReflectionCache::WarnBufferReferences()
+{
+    GFXRECON_LOG_WARNING_ONCE("A Shader is using the 'SPV_KHR_physical_storage_buffer' feature. "
+                              "Resource tracking for buffers accessed via references is currently "
+                              "unsupported, so replay may fail.");
+}
+
+bool VulkanShaderReflectionCache::Load()
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "rb");
+    if ((result != 0) || (file == nullptr))
+    {
+        // The file does not exist before the first session that uses it.
+        return false;
+    }
+
+    std::vector<uint8_t> buffer;
+    uint8_t              chunk[64 * 1024];
+    size_t               chunk_size = 0;
+    while ((chunk_size = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        buffer.insert(buffer.end(), chunk, chunk + chunk_size);
+    }
+
+    util::platform::FileClose(file);
+
+    size_t   offset      = 0;
+    uint32_t magic       = 0;
+    uint32_t version     = 0;
+    uint64_t entry_count = 0;
+
+    if (!ReadValue(buffer, offset, magic) || !ReadValue(buffer, offset, version) ||
+        !ReadValue(buffer, offset, entry_count) || (magic != kCacheFileMagic) || (version != kCacheFileVersion))
+    {
+        GFXRECON_LOG_WARNING("Ignoring shader reflection cache file %s with unsupported format", filename_.c_str());
+        return false;
+    }
+
+    ReflectionMap entries;
+
+    for (uint64_t i = 0; i < entry_count; ++i)
+    {
+        util::hash::Hash128 key;
+        uint8_t             uses_buffer_references = 0;
+        uint32_t            set_count              = 0;
+
+        if (!ReadValue(buffer, offset, key.low) || !ReadValue(buffer, offset, key.high) ||
+            !ReadValue(buffer, offset, uses_buffer_references) || !ReadValue(buffer, offset, set_count))
+        {
+            break;
+        }
+
+        auto reflection                    = std::make_shared<vulkan_state_info::ShaderReflectionInfo>();
+        reflection->uses_buffer_references = (uses_buffer_references != 0);
+
+        bool valid = true;
+        for (uint32_t s = 0; valid && (s < set_count); ++s)
+        {
+            uint32_t set           = 0;
+            uint32_t binding_count = 0;
+
+            valid = ReadValue(buffer, offset, set) && ReadValue(buffer, offset, binding_count);
+
+            for (uint32_t b = 0; valid && (b < binding_count); ++b)
+            {
+                uint32_t binding  = 0;
+                uint32_t type     = 0;
+                uint8_t  readonly = 0;
+                uint32_t accessed = 0;
+                uint32_t count    = 0;
+                uint8_t  is_array = 0;
+
+                valid = ReadValue(buffer, offset, binding) && ReadValue(buffer, offset, type) &&
+                        ReadValue(buffer, offset, readonly) && ReadValue(buffer, offset, accessed) &&
+                        ReadValue(buffer, offset, count) && ReadValue(buffer, offset, is_array);
+
+                if (valid)
+                {
+                    reflection->used_descriptors_info[set].emplace(
+                        binding,
+                        vulkan_state_info::ShaderReflectionDescriptorInfo(
+                            static_cast<VkDescriptorType>(type), readonly != 0, accessed, count, is_array != 0));
+                }
+            }
+        }
+
+        if (!valid)
+        {
+            break;
+        }
+
+        std::promise<vulkan_state_info::ShaderReflectionPtr> promise;
+        promise.set_value(reflection);
+        entries.emplace(key, promise.get_future().share());
+    }
+
+    if (entries.size() != entry_count)
+    {
+        GFXRECON_LOG_WARNING("Ignoring truncated shader reflection cache file %s", filename_.c_str());
+        return false;
+    }
+
+    GFXRECON_LOG_INFO("Loaded %" PRIu64 " shader reflections from %s", entry_count, filename_.c_str());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_ = std::move(entries);
+
+    return true;
+}
+
+bool VulkanShaderReflectionCache::Save()
+{
+    std::vector<uint8_t> buffer;
+    uint64_t             entry_count = 0;
+
+    WriteValue(buffer, kCacheFileMagic);
+    WriteValue(buffer, kCacheFileVersion);
+    WriteValue(buffer, entry_count);
+
+    for (const auto& entry : entries_)
+    {
+        // Code that failed to parse is not saved, so that it is parsed again by the next session.
+        const vulkan_state_info::ShaderReflectionPtr& reflection = entry.second.get();
+        if (reflection == nullptr)
+        {
+            continue;
+        }
+
+        WriteValue(buffer, entry.first.low);
+        WriteValue(buffer, entry.first.high);
+        WriteValue(buffer, static_cast<uint8_t>(reflection->uses_buffer_references ? 1 : 0));
+        WriteValue(buffer, static_cast<uint32_t>(reflection->used_descriptors_info.size()));
+
+        for (const auto& set : reflection->used_descriptors_info)
+        {
+            WriteValue(buffer, set.first);
+            WriteValue(buffer, static_cast<uint32_t>(set.second.size()));
+
+            for (const auto& binding : set.second)
+            {
+                WriteValue(buffer, binding.first);
+                WriteValue(buffer, static_cast<uint32_t>(binding.second.type));
+                WriteValue(buffer, static_cast<uint8_t>(binding.second.readonly ? 1 : 0));
+                WriteValue(buffer, binding.second.accessed);
+                WriteValue(buffer, binding.second.count);
+                WriteValue(buffer, static_cast<uint8_t>(binding.second.is_array ? 1 : 0));
+            }
+        }
+
+        ++entry_count;
+    }
+
+    std::memcpy(buffer.data() + sizeof(kCacheFileMagic) + sizeof(kCacheFileVersion), &entry_count, sizeof(entry_count));
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename_.c_str(), "wb");
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open shader reflection cache file %s for writing", filename_.c_str());
+        return false;
+    }
+
+    const bool success = util::platform::FileWrite(buffer.data(), buffer.size(), file);
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write shader reflection cache file %s", filename_.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
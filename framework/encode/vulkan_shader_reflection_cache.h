@@ -0,0 +1,83 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_VULKAN_SHADER_REFLECTION_CACHE_H
+#define GFXRECON_ENCODE_VULKAN_SHADER_REFLECTION_CACHE_H
+
+#include "encode/vulkan_state_info.h"
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/hash.h"
+#include "util/threadpool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Caches the reflection of SPIR-V shader code by content hash, so that identical code is only parsed once.  Code that
+// is not in the cache is parsed on a worker thread, and the returned future is shared by every shader module and
+// pipeline created from the same code.  When a file is specified, the cache is loaded from it on construction and
+// written back to it on destruction, so that reflection is reused across capture sessions.
+class VulkanShaderReflectionCache
+{
+  public:
+    VulkanShaderReflectionCache(const std::string& filename);
+
+    ~VulkanShaderReflectionCache();
+
+    vulkan_state_info::ShaderReflectionFuture
+    GetReflection(const uint32_t* code, size_t code_size, format::HandleId shader_id);
+
+  private:
+    typedef std::unordered_map<util::hash::Hash128,
+                               vulkan_state_info::ShaderReflectionFuture,
+                               util::hash::Hash128Hasher>
+        ReflectionMap;
+
+    static vulkan_state_info::ShaderReflectionPtr Reflect(const std::vector<uint32_t>& code,
+                                                          format::HandleId             shader_id);
+
+    static void WarnBufferReferences();
+
+    bool Load();
+
+    bool Save();
+
+  private:
+    const std::string filename_;
+    std::mutex        mutex_;
+    ReflectionMap     entries_;
+    bool              modified_;
+    util::ThreadPool  thread_pool_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_VULKAN_SHADER_REFLECTION_CACHE_H
@@ -32,8 +32,10 @@
 #include "vulkan/vulkan.h"
 #include "vulkan/vulkan_core.h"
 
+#include <future>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -162,6 +164,18 @@ using ShaderReflectionDescriptorSetInfo = std::unordered_map<uint32_t, ShaderRef
 // One entry per descriptor set
 using ShaderReflectionDescriptorSetsInfos = std::unordered_map<uint32_t, ShaderReflectionDescriptorSetInfo>;
 
+// Reflection of a shader's SPIR-V, shared by all shader modules and pipelines created from identical code.
+struct ShaderReflectionInfo
+{
+    ShaderReflectionDescriptorSetsInfos used_descriptors_info;
+    bool                                uses_buffer_references{ false };
+};
+
+using ShaderReflectionPtr = std::shared_ptr<const ShaderReflectionInfo>;
+
+// Reflection that may still be running on a worker thread.  The reflection is null if the code could not be parsed.
+using ShaderReflectionFuture = std::shared_future<ShaderReflectionPtr>;
+
 enum PipelineBindPoints
 {
     kBindPoint_graphics = 0,
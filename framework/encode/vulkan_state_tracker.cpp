@@ -81,11 +81,15 @@ void VulkanStateTracker::TrackCommandExecution(vulkan_wrappers::CommandBufferWra
 
     if (call_id != format::ApiCallId::ApiCall_vkResetCommandBuffer)
     {
-        // Append the command data.
-        size_t size = parameter_buffer->GetDataSize();
-        wrapper->command_data.Write(&size, sizeof(size));
-        wrapper->command_data.Write(&call_id, sizeof(call_id));
-        wrapper->command_data.Write(parameter_buffer->GetData(), size);
+        // Append the command data as a single record, which is stored contiguously in the command pool's arena.
+        size_t   size   = parameter_buffer->GetDataSize();
+        uint8_t* record = wrapper->command_data.AllocateRecord(sizeof(size) + sizeof(call_id) + size);
+
+        util::platform::MemoryCopy(record, sizeof(size), &size, sizeof(size));
+        record += sizeof(size);
+        util::platform::MemoryCopy(record, sizeof(call_id), &call_id, sizeof(call_id));
+        record += sizeof(call_id);
+        util::platform::MemoryCopy(record, size, parameter_buffer->GetData(), size);
     }
 }
 
@@ -98,9 +102,12 @@ void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool com
 
     auto device_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceWrapper>(device);
     wrapper->device     = device_wrapper;
+
+    // Trimming returns unused command pool memory to the system, which includes the memory for tracked command data.
+    wrapper->command_data_pool->FreeUnusedChunks();
 }
 
-void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
+void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool, VkCommandPoolResetFlags flags)
 {
     assert(command_pool != VK_NULL_HANDLE);
 
@@ -126,6 +133,11 @@ void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
             entry.second->command_handles[i].clear();
         }
     }
+
+    if ((flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) != 0)
+    {
+        wrapper->command_data_pool->FreeUnusedChunks();
+    }
 }
 
 void VulkanStateTracker::TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice                        physical_device,
@@ -2856,7 +2868,14 @@ void VulkanStateTracker::TrackPipelineDescriptors(vulkan_wrappers::CommandBuffer
     {
         for (const auto& stage : ppl_wrapper->bound_shaders)
         {
-            for (const auto& set : stage.used_descriptors_info)
+            // Waits for reflection that is still running on a worker thread.
+            const vulkan_state_info::ShaderReflectionPtr reflection = stage.valid() ? stage.get() : nullptr;
+            if (reflection == nullptr)
+            {
+                continue;
+            }
+
+            for (const auto& set : reflection->used_descriptors_info)
             {
                 const uint32_t desc_set_index = set.first;
                 for (const auto& desc : set.second)
@@ -3186,6 +3205,182 @@ void VulkanStateTracker::TrackSubmission(uint32_t submitCount, const VkSubmitInf
     }
 }
 
+void VulkanStateTracker::AddDeferredResourceReference(format::HandleId resource_id)
+{
+    if (deferred_resource_content_ids_.erase(resource_id) > 0)
+    {
+        pending_resource_content_ids_.insert(resource_id);
+    }
+}
+
+void VulkanStateTracker::AddDeferredResourceReferences(const vulkan_wrappers::CommandBufferWrapper* cmd_buf_wrapper)
+{
+    assert(cmd_buf_wrapper != nullptr);
+
+    const auto& command_handles = cmd_buf_wrapper->command_handles;
+
+    for (auto buffer_id : command_handles[vulkan_state_info::CommandHandleType::BufferHandle])
+    {
+        AddDeferredResourceReference(buffer_id);
+    }
+
+    for (auto image_id : command_handles[vulkan_state_info::CommandHandleType::ImageHandle])
+    {
+        AddDeferredResourceReference(image_id);
+    }
+
+    for (auto view_id : command_handles[vulkan_state_info::CommandHandleType::BufferViewHandle])
+    {
+        const vulkan_wrappers::BufferViewWrapper* view_wrapper = state_table_.GetBufferViewWrapper(view_id);
+        if (view_wrapper != nullptr)
+        {
+            AddDeferredResourceReference(view_wrapper->buffer_id);
+        }
+    }
+
+    for (auto view_id : command_handles[vulkan_state_info::CommandHandleType::ImageViewHandle])
+    {
+        const vulkan_wrappers::ImageViewWrapper* view_wrapper = state_table_.GetImageViewWrapper(view_id);
+        if (view_wrapper != nullptr)
+        {
+            AddDeferredResourceReference(view_wrapper->image_id);
+        }
+    }
+
+    for (auto framebuffer_id : command_handles[vulkan_state_info::CommandHandleType::FramebufferHandle])
+    {
+        const vulkan_wrappers::FramebufferWrapper* framebuffer_wrapper =
+            state_table_.GetFramebufferWrapper(framebuffer_id);
+        if (framebuffer_wrapper != nullptr)
+        {
+            for (auto view_id : framebuffer_wrapper->image_view_ids)
+            {
+                const vulkan_wrappers::ImageViewWrapper* view_wrapper = state_table_.GetImageViewWrapper(view_id);
+                if (view_wrapper != nullptr)
+                {
+                    AddDeferredResourceReference(view_wrapper->image_id);
+                }
+            }
+        }
+    }
+
+    // Descriptor sets are processed at submission because they may be updated after they are bound.
+    for (auto set_id : command_handles[vulkan_state_info::CommandHandleType::DescriptorSetHandle])
+    {
+        const vulkan_wrappers::DescriptorSetWrapper* set_wrapper = state_table_.GetDescriptorSetWrapper(set_id);
+        if (set_wrapper == nullptr)
+        {
+            continue;
+        }
+
+        for (const auto& binding_entry : set_wrapper->bindings)
+        {
+            const vulkan_state_info::DescriptorInfo& binding = binding_entry.second;
+
+            for (uint32_t i = 0; i < binding.count; ++i)
+            {
+                if (!binding.written[i])
+                {
+                    continue;
+                }
+
+                VkDescriptorType type = binding.type;
+                if (type == VK_DESCRIPTOR_TYPE_MUTABLE_EXT)
+                {
+                    type = binding.mutable_type[i];
+                }
+
+                switch (type)
+                {
+                    case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                    case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    {
+                        const vulkan_wrappers::ImageViewWrapper* view_wrapper =
+                            state_table_.GetImageViewWrapper(binding.handle_ids[i]);
+                        if (view_wrapper != nullptr)
+                        {
+                            AddDeferredResourceReference(view_wrapper->image_id);
+                        }
+                        break;
+                    }
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                        AddDeferredResourceReference(binding.handle_ids[i]);
+                        break;
+                    case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    {
+                        const vulkan_wrappers::BufferViewWrapper* view_wrapper =
+                            state_table_.GetBufferViewWrapper(binding.handle_ids[i]);
+                        if (view_wrapper != nullptr)
+                        {
+                            AddDeferredResourceReference(view_wrapper->buffer_id);
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+}
+
+bool VulkanStateTracker::TrackDeferredResourceReferences(uint32_t submitCount, const VkSubmitInfo* pSubmits)
+{
+    std::unique_lock<std::mutex> lock(state_table_mutex_);
+
+    if ((pSubmits != nullptr) && !deferred_resource_content_ids_.empty())
+    {
+        for (uint32_t s = 0; s < submitCount; ++s)
+        {
+            for (uint32_t c = 0; c < pSubmits[s].commandBufferCount; ++c)
+            {
+                vulkan_wrappers::CommandBufferWrapper* primary =
+                    vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(pSubmits[s].pCommandBuffers[c]);
+                AddDeferredResourceReferences(primary);
+
+                for (const auto secondary : primary->secondaries)
+                {
+                    AddDeferredResourceReferences(secondary);
+                }
+            }
+        }
+    }
+
+    return !pending_resource_content_ids_.empty();
+}
+
+bool VulkanStateTracker::TrackDeferredResourceReferences(uint32_t submitCount, const VkSubmitInfo2* pSubmits)
+{
+    std::unique_lock<std::mutex> lock(state_table_mutex_);
+
+    if ((pSubmits != nullptr) && !deferred_resource_content_ids_.empty())
+    {
+        for (uint32_t s = 0; s < submitCount; ++s)
+        {
+            for (uint32_t c = 0; c < pSubmits[s].commandBufferInfoCount; ++c)
+            {
+                vulkan_wrappers::CommandBufferWrapper* primary =
+                    vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(
+                        pSubmits[s].pCommandBufferInfos[c].commandBuffer);
+                AddDeferredResourceReferences(primary);
+
+                for (const auto secondary : primary->secondaries)
+                {
+                    AddDeferredResourceReferences(secondary);
+                }
+            }
+        }
+    }
+
+    return !pending_resource_content_ids_.empty();
+}
+
 void VulkanStateTracker::TrackBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo)
 {
     if (commandBuffer != VK_NULL_HANDLE && pRenderingInfo != nullptr)
@@ -44,6 +44,7 @@
 #include <cassert>
 #include <functional>
 #include <mutex>
+#include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -61,7 +62,8 @@ class VulkanStateTracker
                         util::Compressor*                 compressor,
                         uint64_t                          frame_number,
                         util::FileOutputStream*           asset_file_stream,
-                        const std::string*                asset_file_name)
+                        const std::string*                asset_file_name,
+                        bool                              defer_resource_content)
     {
         VulkanStateWriter state_writer(file_stream,
                                        compressor,
@@ -69,12 +71,39 @@ class VulkanStateTracker
                                        get_unique_id_fn,
                                        asset_file_stream,
                                        asset_file_name,
-                                       asset_file_stream != nullptr ? &asset_file_offsets_ : nullptr);
+                                       asset_file_stream != nullptr ? &asset_file_offsets_ : nullptr,
+                                       asset_file_stream != nullptr ? &asset_file_content_index_ : nullptr);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
+
+        deferred_resource_content_ids_.clear();
+        pending_resource_content_ids_.clear();
+
+        if (defer_resource_content)
+        {
+            state_writer.SetDeferredResourceContent(&deferred_resource_content_ids_);
+        }
+
         return state_writer.WriteState(state_table_, frame_number);
     }
 
+    // Writes the content of the resources that were deferred by WriteState and are referenced by the command buffers
+    // passed to TrackDeferredResourceReferences since the previous call.
+    uint64_t WritePendingResourceContent(util::FileOutputStream*           file_stream,
+                                         format::ThreadId                  thread_id,
+                                         std::function<format::HandleId()> get_unique_id_fn,
+                                         util::Compressor*                 compressor)
+    {
+        VulkanStateWriter state_writer(file_stream, compressor, thread_id, get_unique_id_fn);
+
+        std::unique_lock<std::mutex> lock(state_table_mutex_);
+
+        uint64_t blocks_written = state_writer.WriteResourceContent(state_table_, pending_resource_content_ids_);
+        pending_resource_content_ids_.clear();
+
+        return blocks_written;
+    }
+
     uint64_t WriteAssets(util::FileOutputStream*           asset_file_stream,
                          const std::string*                asset_file_name,
                          format::ThreadId                  thread_id,
@@ -84,8 +113,14 @@ class VulkanStateTracker
         assert(asset_file_stream != nullptr);
         assert(asset_file_name != nullptr);
 
-        VulkanStateWriter state_writer(
-            nullptr, compressor, thread_id, get_unique_id_fn, asset_file_stream, asset_file_name, &asset_file_offsets_);
+        VulkanStateWriter state_writer(nullptr,
+                                       compressor,
+                                       thread_id,
+                                       get_unique_id_fn,
+                                       asset_file_stream,
+                                       asset_file_name,
+                                       &asset_file_offsets_,
+                                       &asset_file_content_index_);
 
         std::unique_lock<std::mutex> lock(state_table_mutex_);
         return state_writer.WriteAssets(state_table_);
@@ -311,7 +346,7 @@ class VulkanStateTracker
 
     void TrackTrimCommandPool(VkDevice device, VkCommandPool command_pool);
 
-    void TrackResetCommandPool(VkCommandPool command_pool);
+    void TrackResetCommandPool(VkCommandPool command_pool, VkCommandPoolResetFlags flags);
 
     void TrackPhysicalDeviceMemoryProperties(VkPhysicalDevice                        physical_device,
                                              const VkPhysicalDeviceMemoryProperties* properties);
@@ -723,6 +758,12 @@ class VulkanStateTracker
 
     void TrackSubmission(uint32_t submitCount, const VkSubmitInfo2* pSubmits);
 
+    // Moves the deferred resources referenced by the submitted command buffers to the set of resources written by
+    // WritePendingResourceContent.  Returns true if there is pending resource content to write.
+    bool TrackDeferredResourceReferences(uint32_t submitCount, const VkSubmitInfo* pSubmits);
+
+    bool TrackDeferredResourceReferences(uint32_t submitCount, const VkSubmitInfo2* pSubmits);
+
     void TrackBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo);
 
     void TrackSetDebugUtilsObjectNameEXT(VkDevice                             device,
@@ -825,6 +866,10 @@ class VulkanStateTracker
 
     void MarkReferencedAssetsAsDirty(vulkan_wrappers::CommandBufferWrapper* cmd_buf_wrapper);
 
+    void AddDeferredResourceReferences(const vulkan_wrappers::CommandBufferWrapper* cmd_buf_wrapper);
+
+    void AddDeferredResourceReference(format::HandleId resource_id);
+
     std::mutex       state_table_mutex_;
     VulkanStateTable state_table_;
 
@@ -836,7 +881,13 @@ class VulkanStateTracker
 
     std::map<VkDevice, graphics::VulkanResourcesUtil> resource_utils_;
 
-    VulkanStateWriter::AssetFileOffsetsInfo asset_file_offsets_;
+    VulkanStateWriter::AssetFileOffsetsInfo  asset_file_offsets_;
+    VulkanStateWriter::AssetFileContentIndex asset_file_content_index_;
+
+    // Resources with content omitted from the trim state snapshot, and the subset that has been referenced by a
+    // submission and must be written before the submission.
+    std::unordered_set<format::HandleId> deferred_resource_content_ids_;
+    std::unordered_set<format::HandleId> pending_resource_content_ids_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
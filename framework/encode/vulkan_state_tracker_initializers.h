@@ -640,6 +640,7 @@ inline void InitializeState<VkDevice, vulkan_wrappers::ImageWrapper, VkImageCrea
     wrapper->array_layers = create_info->arrayLayers;
     wrapper->samples      = create_info->samples;
     wrapper->tiling       = create_info->tiling;
+    wrapper->usage        = create_info->usage;
 
     // TODO: Do we need to track the queue family that the image is actually used with?
     if ((create_info->queueFamilyIndexCount > 0) && (create_info->pQueueFamilyIndices != nullptr))
@@ -48,6 +48,38 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 
 const uint32_t kDefaultQueueFamilyIndex = 0;
 
+// Computes the key that identifies an upload command in the asset file content index.  The key covers the resource
+// data, the level sizes, and the header fields that affect replay.  The thread ID and block size are cleared, because
+// they differ between writes of the same upload command.  The header fields include the ID of the buffer or image
+// that the command initializes, so deduplication is per resource: the command can only be replayed for that
+// resource, and identical content in different resources is written once for each of them.
+template <typename UploadCommandHeader>
+static util::hash::Hash128 GetUploadCommandContentKey(UploadCommandHeader upload_cmd,
+                                                      const void*         levels,
+                                                      size_t              levels_size,
+                                                      const uint8_t*      bytes,
+                                                      size_t              data_size)
+{
+    upload_cmd.meta_header.block_header.size = 0;
+    upload_cmd.thread_id                     = 0;
+
+    const util::hash::Hash128 header_key = util::hash::murmur3_128(&upload_cmd, sizeof(upload_cmd), 1);
+    util::hash::Hash128       key        = util::hash::murmur3_128(bytes, data_size);
+
+    key.low ^= header_key.low;
+    key.high ^= header_key.high;
+
+    if (levels_size > 0)
+    {
+        const util::hash::Hash128 levels_key = util::hash::murmur3_128(levels, levels_size, 2);
+
+        key.low ^= levels_key.low;
+        key.high ^= levels_key.high;
+    }
+
+    return key;
+}
+
 static bool IsMemoryCoherent(VkMemoryPropertyFlags property_flags)
 {
     return ((property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
@@ -83,17 +115,18 @@ static bool IsImageReadable(VkMemoryPropertyFlags                       property
                                                    (memory_wrapper->mapped_size == VK_WHOLE_SIZE)))));
 }
 
-VulkanStateWriter::VulkanStateWriter(util::FileOutputStream*                  output_stream,
-                                     util::Compressor*                        compressor,
-                                     format::ThreadId                         thread_id,
-                                     std::function<format::HandleId()>        get_unique_id_fn,
-                                     util::FileOutputStream*                  asset_file_stream,
-                                     const std::string*                       asset_file_name,
-                                     VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets) :
+VulkanStateWriter::VulkanStateWriter(util::FileOutputStream*                   output_stream,
+                                     util::Compressor*                         compressor,
+                                     format::ThreadId                          thread_id,
+                                     std::function<format::HandleId()>         get_unique_id_fn,
+                                     util::FileOutputStream*                   asset_file_stream,
+                                     const std::string*                        asset_file_name,
+                                     VulkanStateWriter::AssetFileOffsetsInfo*  asset_file_offsets,
+                                     VulkanStateWriter::AssetFileContentIndex* asset_file_content_index) :
     output_stream_(output_stream),
     compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_),
     get_unique_id_(std::move(get_unique_id_fn)), asset_file_stream_(asset_file_stream),
-    asset_file_offsets_(asset_file_offsets)
+    asset_file_offsets_(asset_file_offsets), asset_file_content_index_(asset_file_content_index)
 {
     assert(output_stream != nullptr || asset_file_stream != nullptr);
 
@@ -113,6 +146,18 @@ uint64_t VulkanStateWriter::WriteAssets(const VulkanStateTable& state_table)
     return blocks_written_;
 }
 
+uint64_t VulkanStateWriter::WriteResourceContent(const VulkanStateTable&                     state_table,
+                                                 const std::unordered_set<format::HandleId>& resource_ids)
+{
+    blocks_written_ = 0;
+
+    resource_content_ids_ = &resource_ids;
+    WriteResourceMemoryState(state_table, false);
+    resource_content_ids_ = nullptr;
+
+    return blocks_written_;
+}
+
 uint64_t VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t frame_number)
 {
     // clang-format off
@@ -1569,18 +1614,7 @@ void VulkanStateWriter::InitializeASInputBuffer(ASInputBuffer& buffer)
     upload_cmd.data_size = data_size;
 
     const uint8_t* bytes = buffer.bytes.data();
-    if (compressor_ != nullptr)
-    {
-        size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-        if ((compressed_size > 0) && (compressed_size < data_size))
-        {
-            upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-            bytes     = compressed_parameter_buffer_.data();
-            data_size = compressed_size;
-        }
-    }
+    CompressUploadCommandData(&upload_cmd, &bytes, &data_size);
 
     // Calculate size of packet with compressed or uncompressed data size.
     upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
@@ -2004,26 +2038,28 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
     {
         const vulkan_wrappers::BufferWrapper*       buffer_wrapper = snapshot_entry.buffer_wrapper;
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
-        const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
 
         assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
 
         if (snapshot_entry.need_staging_copy)
         {
-            VkResult result = resource_util.ReadFromBufferResource(
-                buffer_wrapper->handle, buffer_wrapper->size, 0, buffer_wrapper->queue_family_index, data);
-
-            if (result == VK_SUCCESS)
-            {
-                bytes = data.data();
-            }
+            // Staging copies are batched, and the buffer content is written when the batch that contains the copy
+            // completes.
+            resource_util.ReadFromBufferResourceAsync(
+                buffer_wrapper->handle,
+                buffer_wrapper->size,
+                0,
+                buffer_wrapper->queue_family_index,
+                [this, device_wrapper, buffer_wrapper](VkResult, const uint8_t* data, uint64_t) {
+                    WriteBufferMemory(device_wrapper, buffer_wrapper, data);
+                });
         }
         else
         {
             assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-            VkResult result = VK_SUCCESS;
+            const uint8_t* bytes  = nullptr;
+            VkResult       result = VK_SUCCESS;
 
             if (memory_wrapper->mapped_data == nullptr)
             {
@@ -2050,54 +2086,17 @@ void VulkanStateWriter::ProcessBufferMemory(const vulkan_wrappers::DeviceWrapper
                 InvalidateMappedMemoryRange(
                     device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
             }
-        }
-
-        if (bytes != nullptr)
-        {
-            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
-
-            size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-            format::InitBufferCommandHeader upload_cmd;
-
-            upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-            upload_cmd.meta_header.meta_data_id =
-                format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
-            upload_cmd.thread_id = thread_id_;
-            upload_cmd.device_id = device_wrapper->handle_id;
-            upload_cmd.buffer_id = buffer_wrapper->handle_id;
-            upload_cmd.data_size = data_size;
-
-            if (compressor_ != nullptr)
-            {
-                size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                if ((compressed_size > 0) && (compressed_size < data_size))
-                {
-                    upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                    bytes     = compressed_parameter_buffer_.data();
-                    data_size = compressed_size;
-                }
-            }
-
-            // Calculate size of packet with compressed or uncompressed data size.
-            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
 
-            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-            output_stream_->Write(bytes, data_size);
-            ++blocks_written_;
+            WriteBufferMemory(device_wrapper, buffer_wrapper, bytes);
 
-            if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+            if ((bytes != nullptr) && (memory_wrapper->mapped_data == nullptr))
             {
                 device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
             }
         }
-        else
-        {
-            GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                               buffer_wrapper->handle_id);
-        }
     }
+
+    resource_util.FlushReadbacks();
 }
 
 void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::DeviceWrapper*  device_wrapper,
@@ -2113,8 +2112,6 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
     {
         vulkan_wrappers::BufferWrapper*             buffer_wrapper = snapshot_entry.buffer_wrapper;
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper = snapshot_entry.memory_wrapper;
-        const uint8_t*                              bytes          = nullptr;
-        std::vector<uint8_t>                        data;
 
         assert((buffer_wrapper != nullptr));
 
@@ -2125,19 +2122,21 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
 
             if (snapshot_entry.need_staging_copy)
             {
-                VkResult result = resource_util.ReadFromBufferResource(
-                    buffer_wrapper->handle, buffer_wrapper->size, 0, buffer_wrapper->queue_family_index, data);
-
-                if (result == VK_SUCCESS)
-                {
-                    bytes = data.data();
-                }
+                resource_util.ReadFromBufferResourceAsync(
+                    buffer_wrapper->handle,
+                    buffer_wrapper->size,
+                    0,
+                    buffer_wrapper->queue_family_index,
+                    [this, device_wrapper, buffer_wrapper](VkResult, const uint8_t* data, uint64_t) {
+                        WriteBufferMemory(device_wrapper, buffer_wrapper, data);
+                    });
             }
             else
             {
                 assert((memory_wrapper->mapped_data == nullptr) || (memory_wrapper->mapped_offset == 0));
 
-                VkResult result = VK_SUCCESS;
+                const uint8_t* bytes  = nullptr;
+                VkResult       result = VK_SUCCESS;
 
                 if (memory_wrapper->mapped_data == nullptr)
                 {
@@ -2164,61 +2163,16 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
                     InvalidateMappedMemoryRange(
                         device_wrapper, memory_wrapper->handle, buffer_wrapper->bind_offset, buffer_wrapper->size);
                 }
-            }
-
-            assert(bytes);
-
-            if (bytes != nullptr)
-            {
-                GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
-
-                size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
-                format::InitBufferCommandHeader upload_cmd;
-
-                upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-                upload_cmd.meta_header.meta_data_id      = format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan,
-                                                                             format::MetaDataType::kInitBufferCommand);
-                upload_cmd.thread_id                     = thread_id_;
-                upload_cmd.device_id                     = device_wrapper->handle_id;
-                upload_cmd.buffer_id                     = buffer_wrapper->handle_id;
-                upload_cmd.data_size                     = data_size;
-
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
 
-                // Calculate size of packet with compressed or uncompressed data size.
-                upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+                assert(bytes);
 
-                const int64_t offset = asset_file_stream_->GetOffset();
-                asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                asset_file_stream_->Write(bytes, data_size);
-                (*asset_file_offsets_)[buffer_wrapper->handle_id] = offset;
+                WriteBufferMemory(device_wrapper, buffer_wrapper, bytes);
 
-                if (output_stream_ != nullptr)
-                {
-                    WriteExecuteFromFile(asset_file_name_, 1, offset);
-                }
-
-                if (!snapshot_entry.need_staging_copy && memory_wrapper->mapped_data == nullptr)
+                if ((bytes != nullptr) && (memory_wrapper->mapped_data == nullptr))
                 {
                     device_table->UnmapMemory(device_wrapper->handle, memory_wrapper->handle);
                 }
             }
-            else
-            {
-                GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
-                                   buffer_wrapper->handle_id);
-            }
         }
         else
         {
@@ -2230,6 +2184,120 @@ void VulkanStateWriter::ProcessBufferMemoryWithAssetFile(const vulkan_wrappers::
             }
         }
     }
+
+    resource_util.FlushReadbacks();
+}
+
+void VulkanStateWriter::WriteBufferMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                                          const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                                          const uint8_t*                        bytes)
+{
+    if (bytes != nullptr)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, buffer_wrapper->size);
+
+        size_t                          data_size = static_cast<size_t>(buffer_wrapper->size);
+        format::InitBufferCommandHeader upload_cmd;
+
+        upload_cmd.meta_header.block_header.type = format::kMetaDataBlock;
+        upload_cmd.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        upload_cmd.thread_id = thread_id_;
+        upload_cmd.device_id = device_wrapper->handle_id;
+        upload_cmd.buffer_id = buffer_wrapper->handle_id;
+        upload_cmd.data_size = data_size;
+
+        if (asset_file_stream_ != nullptr)
+        {
+            const int64_t offset = WriteUploadCommandToAssetFile(upload_cmd, nullptr, 0, bytes, data_size);
+            (*asset_file_offsets_)[buffer_wrapper->handle_id] = offset;
+
+            if (output_stream_ != nullptr)
+            {
+                WriteExecuteFromFile(asset_file_name_, 1, offset);
+            }
+        }
+        else
+        {
+            CompressUploadCommandData(&upload_cmd, &bytes, &data_size);
+
+            // Calculate size of packet with compressed or uncompressed data size.
+            upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + data_size;
+
+            output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+            output_stream_->Write(bytes, data_size);
+            ++blocks_written_;
+        }
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Trimming state snapshot failed to retrieve memory content for buffer %" PRIu64,
+                           buffer_wrapper->handle_id);
+    }
+}
+
+template <typename UploadCommandHeader>
+void VulkanStateWriter::CompressUploadCommandData(UploadCommandHeader* upload_cmd,
+                                                  const uint8_t**      bytes,
+                                                  size_t*              data_size)
+{
+    if (compressor_ != nullptr)
+    {
+        size_t compressed_size = compressor_->Compress(*data_size, *bytes, &compressed_parameter_buffer_, 0);
+
+        if ((compressed_size > 0) && (compressed_size < *data_size))
+        {
+            upload_cmd->meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+
+            *bytes     = compressed_parameter_buffer_.data();
+            *data_size = compressed_size;
+        }
+    }
+}
+
+template <typename UploadCommandHeader>
+int64_t VulkanStateWriter::WriteUploadCommandToAssetFile(UploadCommandHeader& upload_cmd,
+                                                         const void*          levels,
+                                                         size_t               levels_size,
+                                                         const uint8_t*       bytes,
+                                                         size_t               data_size)
+{
+    assert(asset_file_stream_ != nullptr);
+
+    util::hash::Hash128 content_key;
+
+    if (asset_file_content_index_ != nullptr)
+    {
+        content_key = GetUploadCommandContentKey(upload_cmd, levels, levels_size, bytes, data_size);
+
+        auto entry = asset_file_content_index_->find(content_key);
+        if (entry != asset_file_content_index_->end())
+        {
+            return entry->second;
+        }
+    }
+
+    CompressUploadCommandData(&upload_cmd, &bytes, &data_size);
+
+    // Calculate size of packet with compressed or uncompressed data size.
+    upload_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(upload_cmd) + levels_size + data_size;
+
+    const int64_t offset = asset_file_stream_->GetOffset();
+    asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
+
+    if (levels_size > 0)
+    {
+        asset_file_stream_->Write(levels, levels_size);
+    }
+
+    asset_file_stream_->Write(bytes, data_size);
+
+    if (asset_file_content_index_ != nullptr)
+    {
+        (*asset_file_content_index_)[content_key] = offset;
+    }
+
+    return offset;
 }
 
 void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
@@ -2337,18 +2405,7 @@ void VulkanStateWriter::ProcessImageMemory(const vulkan_wrappers::DeviceWrapper*
                 upload_cmd.data_size   = data_size;
                 upload_cmd.level_count = image_wrapper->mip_levels;
 
-                if (compressor_ != nullptr)
-                {
-                    size_t compressed_size = compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                    if ((compressed_size > 0) && (compressed_size < data_size))
-                    {
-                        upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                        bytes     = compressed_parameter_buffer_.data();
-                        data_size = compressed_size;
-                    }
-                }
+                CompressUploadCommandData(&upload_cmd, &bytes, &data_size);
 
                 // Calculate size of packet with compressed or uncompressed data size.
                 assert(!snapshot_entry.level_sizes.empty() &&
@@ -2495,32 +2552,13 @@ void VulkanStateWriter::ProcessImageMemoryWithAssetFile(const vulkan_wrappers::D
                     upload_cmd.data_size   = data_size;
                     upload_cmd.level_count = image_wrapper->mip_levels;
 
-                    if (compressor_ != nullptr)
-                    {
-                        size_t compressed_size =
-                            compressor_->Compress(data_size, bytes, &compressed_parameter_buffer_, 0);
-
-                        if ((compressed_size > 0) && (compressed_size < data_size))
-                        {
-                            upload_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
-
-                            bytes     = compressed_parameter_buffer_.data();
-                            data_size = compressed_size;
-                        }
-                    }
-
-                    // Calculate size of packet with compressed or uncompressed data size.
                     assert(!snapshot_entry.level_sizes.empty() &&
                            (snapshot_entry.level_sizes.size() == upload_cmd.level_count));
                     size_t levels_size = snapshot_entry.level_sizes.size() * sizeof(snapshot_entry.level_sizes[0]);
 
-                    upload_cmd.meta_header.block_header.size += levels_size + data_size;
-
-                    const int64_t offset                             = asset_file_stream_->GetOffset();
+                    const int64_t offset = WriteUploadCommandToAssetFile(
+                        upload_cmd, snapshot_entry.level_sizes.data(), levels_size, bytes, data_size);
                     (*asset_file_offsets_)[image_wrapper->handle_id] = offset;
-                    asset_file_stream_->Write(&upload_cmd, sizeof(upload_cmd));
-                    asset_file_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
-                    asset_file_stream_->Write(bytes, data_size);
 
                     if (output_stream_ != nullptr)
                     {
@@ -2570,6 +2608,12 @@ void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_tab
     state_table.VisitWrappers([&](vulkan_wrappers::BufferWrapper* wrapper) {
         assert(wrapper != nullptr);
 
+        if ((resource_content_ids_ != nullptr) &&
+            (resource_content_ids_->find(wrapper->handle_id) == resource_content_ids_->end()))
+        {
+            return;
+        }
+
         // Perform memory binding.
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper =
             state_table.GetDeviceMemoryWrapper(wrapper->bind_memory_id);
@@ -2626,6 +2670,20 @@ void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_tab
                 parameter_stream_.Clear();
             }
 
+            VkMemoryPropertyFlags memory_properties = GetMemoryProperties(device_wrapper, memory_wrapper);
+
+            // The content of device local buffers is deferred until a submitted command buffer references the buffer
+            // handle.  Buffers with device addresses may be referenced from shader data, and are written immediately.
+            if ((deferred_resource_ids_ != nullptr) &&
+                ((memory_properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+                ((wrapper->usage & (VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT |
+                                    VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR)) == 0) &&
+                (wrapper->address == 0) && (wrapper->opaque_address == 0))
+            {
+                deferred_resource_ids_->insert(wrapper->handle_id);
+                return;
+            }
+
             // Group buffers with memory bindings by device for memory snapshot.
             ResourceSnapshotQueueFamilyTable& snapshot_table = (*resources)[device_wrapper];
             ResourceSnapshotInfo&             snapshot_entry = snapshot_table[wrapper->queue_family_index];
@@ -2633,7 +2691,7 @@ void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_tab
             BufferSnapshotInfo snapshot_info;
             snapshot_info.buffer_wrapper    = wrapper;
             snapshot_info.memory_wrapper    = memory_wrapper;
-            snapshot_info.memory_properties = GetMemoryProperties(device_wrapper, memory_wrapper);
+            snapshot_info.memory_properties = memory_properties;
             snapshot_info.need_staging_copy = !IsBufferReadable(snapshot_info.memory_properties, memory_wrapper);
 
             if ((*max_resource_size) < wrapper->size)
@@ -2662,6 +2720,12 @@ void VulkanStateWriter::WriteImageMemoryState(const VulkanStateTable& state_tabl
     state_table.VisitWrappers([&](vulkan_wrappers::ImageWrapper* wrapper) {
         assert(wrapper != nullptr);
 
+        if ((resource_content_ids_ != nullptr) &&
+            (resource_content_ids_->find(wrapper->handle_id) == resource_content_ids_->end()))
+        {
+            return;
+        }
+
         // Perform memory binding.
         const vulkan_wrappers::DeviceMemoryWrapper* memory_wrapper =
             state_table.GetDeviceMemoryWrapper(wrapper->bind_memory_id);
@@ -2734,6 +2798,17 @@ void VulkanStateWriter::WriteImageMemoryState(const VulkanStateTable& state_tabl
             // layouts, no data could have been loaded into it and its data will be omitted from the state snapshot.
             if (is_transitioned || is_writable)
             {
+                // The content of device local images is deferred until a submitted command buffer references the
+                // image.  Swapchain images are also referenced by present operations, and images with host transfer
+                // usage may be read by host image copies without a submission, so both are written immediately.
+                if ((deferred_resource_ids_ != nullptr) && !wrapper->is_swapchain_image &&
+                    ((wrapper->usage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT) == 0) &&
+                    ((memory_properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT))
+                {
+                    deferred_resource_ids_->insert(wrapper->handle_id);
+                    return;
+                }
+
                 // Group images with memory bindings by device for memory snapshot.
                 ResourceSnapshotQueueFamilyTable& snapshot_table = (*resources)[device_wrapper];
                 ResourceSnapshotInfo&             snapshot_entry = snapshot_table[wrapper->queue_family_index];
@@ -2929,10 +3004,21 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
     auto     done = std::chrono::high_resolution_clock::now();
     uint32_t time = std::chrono::duration_cast<std::chrono::milliseconds>(done - started).count();
 
-    GFXRECON_LOG_INFO("--------------------------------------")
-    GFXRECON_LOG_INFO("%s()", __func__)
-    GFXRECON_LOG_INFO("  saved in %u ms", time);
-    GFXRECON_LOG_INFO("--------------------------------------")
+    if (resource_content_ids_ != nullptr)
+    {
+        // Deferred resource content is written at every submission that first references a deferred resource.
+        GFXRECON_LOG_DEBUG("%s() wrote %" PRIuPTR " deferred resources in %u ms",
+                           __func__,
+                           resource_content_ids_->size(),
+                           time);
+    }
+    else
+    {
+        GFXRECON_LOG_INFO("--------------------------------------")
+        GFXRECON_LOG_INFO("%s()", __func__)
+        GFXRECON_LOG_INFO("  saved in %u ms", time);
+        GFXRECON_LOG_INFO("--------------------------------------")
+    }
 }
 
 void VulkanStateWriter::WriteMappedMemoryState(const VulkanStateTable& state_table)
@@ -3380,26 +3466,29 @@ void VulkanStateWriter::WriteCommandBufferCommands(const vulkan_wrappers::Comman
 
     if (CheckCommandHandles(wrapper, state_table))
     {
-        // Replay each of the commands that was recorded for the command buffer.
-        size_t         offset    = 0;
-        size_t         data_size = wrapper->command_data.GetDataSize();
-        const uint8_t* data      = wrapper->command_data.GetData();
-
-        while (offset < data_size)
+        // Replay each of the commands that was recorded for the command buffer.  Records never span chunks.
+        for (const auto& chunk : wrapper->command_data.GetChunks())
         {
-            const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
-            const format::ApiCallId* call_id =
-                reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
-            const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
+            size_t         offset    = 0;
+            size_t         data_size = chunk.size;
+            const uint8_t* data      = chunk.data.get();
 
-            parameter_stream_.Write(parameter_data, (*parameter_size));
-            WriteFunctionCall((*call_id), &parameter_stream_);
-            parameter_stream_.Clear();
+            while (offset < data_size)
+            {
+                const size_t*            parameter_size = reinterpret_cast<const size_t*>(&data[offset]);
+                const format::ApiCallId* call_id =
+                    reinterpret_cast<const format::ApiCallId*>(&data[offset] + sizeof(size_t));
+                const uint8_t* parameter_data = &data[offset] + (sizeof(size_t) + sizeof(format::ApiCallId));
 
-            offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
-        }
+                parameter_stream_.Write(parameter_data, (*parameter_size));
+                WriteFunctionCall((*call_id), &parameter_stream_);
+                parameter_stream_.Clear();
 
-        assert(offset == data_size);
+                offset += sizeof(size_t) + sizeof(format::ApiCallId) + (*parameter_size);
+            }
+
+            assert(offset == data_size);
+        }
     }
 }
 
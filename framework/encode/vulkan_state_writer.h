@@ -34,6 +34,7 @@
 #include "util/compressor.h"
 #include "util/defines.h"
 #include "util/file_output_stream.h"
+#include "util/hash.h"
 #include "util/memory_output_stream.h"
 
 #include "vulkan/vulkan.h"
@@ -41,6 +42,7 @@
 #include <cstdint>
 #include <set>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -51,19 +53,38 @@ class VulkanStateWriter
   public:
     using AssetFileOffsetsInfo = std::unordered_map<uint64_t, int64_t>;
 
-    VulkanStateWriter(util::FileOutputStream*                  output_stream,
-                      util::Compressor*                        compressor,
-                      format::ThreadId                         thread_id,
-                      std::function<format::HandleId()>        get_unique_id_fn,
-                      util::FileOutputStream*                  asset_file_stream  = nullptr,
-                      const std::string*                       asset_file_name    = nullptr,
-                      VulkanStateWriter::AssetFileOffsetsInfo* asset_file_offsets = nullptr);
+    // Maps the content key of the resource upload commands written to the append-only asset file to their offsets, so
+    // that identical upload commands are written once and referenced by every later state snapshot.  Upload commands
+    // name the resource they initialize, so content is only shared between snapshots of the same resource.
+    using AssetFileContentIndex = std::unordered_map<util::hash::Hash128, int64_t, util::hash::Hash128Hasher>;
+
+    VulkanStateWriter(util::FileOutputStream*                   output_stream,
+                      util::Compressor*                         compressor,
+                      format::ThreadId                          thread_id,
+                      std::function<format::HandleId()>         get_unique_id_fn,
+                      util::FileOutputStream*                   asset_file_stream        = nullptr,
+                      const std::string*                        asset_file_name          = nullptr,
+                      VulkanStateWriter::AssetFileOffsetsInfo*  asset_file_offsets       = nullptr,
+                      VulkanStateWriter::AssetFileContentIndex* asset_file_content_index = nullptr);
 
     // Returns number of blocks written to the output_stream.
     uint64_t WriteState(const VulkanStateTable& state_table, uint64_t frame_number);
 
     uint64_t WriteAssets(const VulkanStateTable& state_table);
 
+    // When set, WriteState omits the content of resources that can be written later by WriteResourceContent and adds
+    // their IDs to deferred_resource_ids.  Only device local buffers and images that cannot be referenced by device
+    // address are deferred, because the references of those resources are recorded with the command buffers.
+    void SetDeferredResourceContent(std::unordered_set<format::HandleId>* deferred_resource_ids)
+    {
+        deferred_resource_ids_ = deferred_resource_ids;
+    }
+
+    // Writes the content of the specified buffers and images, which must have been deferred by WriteState.  Returns
+    // number of blocks written to the output_stream.
+    uint64_t WriteResourceContent(const VulkanStateTable&                     state_table,
+                                  const std::unordered_set<format::HandleId>& resource_ids);
+
     bool OutputStreamWrite(const void* data, size_t len);
 
     void WriteFillMemoryCmd(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size, const void* data);
@@ -172,6 +193,27 @@ class VulkanStateWriter
                                           const std::vector<BufferSnapshotInfo>& buffer_snapshot_info,
                                           graphics::VulkanResourcesUtil&         resource_util);
 
+    // Writes an InitBufferCommand with the buffer content to the asset file when one is in use, or to the capture
+    // file otherwise.
+    void WriteBufferMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
+                           const vulkan_wrappers::BufferWrapper* buffer_wrapper,
+                           const uint8_t*                        bytes);
+
+    // Replaces the upload data with its compressed form when compression makes it smaller, updating the command's
+    // block type.  The compressed data is held by compressed_parameter_buffer_ until the next compression.
+    template <typename UploadCommandHeader>
+    void CompressUploadCommandData(UploadCommandHeader* upload_cmd, const uint8_t** bytes, size_t* data_size);
+
+    // Writes a buffer or image upload command with its level sizes and resource data to the asset file, returning its
+    // offset.  When the content index is available and holds an upload command with the same content key, nothing is
+    // written and the offset of the existing command is returned.
+    template <typename UploadCommandHeader>
+    int64_t WriteUploadCommandToAssetFile(UploadCommandHeader& upload_cmd,
+                                          const void*          levels,
+                                          size_t               levels_size,
+                                          const uint8_t*       bytes,
+                                          size_t               data_size);
+
     void ProcessImageMemory(const vulkan_wrappers::DeviceWrapper* device_wrapper,
                             const std::vector<ImageSnapshotInfo>& image_snapshot_info,
                             graphics::VulkanResourcesUtil&        resource_util);
@@ -432,6 +474,10 @@ class VulkanStateWriter
     util::FileOutputStream* asset_file_stream_;
     std::string             asset_file_name_;
     AssetFileOffsetsInfo*   asset_file_offsets_;
+    AssetFileContentIndex*  asset_file_content_index_;
+
+    std::unordered_set<format::HandleId>*       deferred_resource_ids_{ nullptr };
+    const std::unordered_set<format::HandleId>* resource_content_ids_{ nullptr };
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -156,7 +156,8 @@ enum class MetaDataType : uint16_t
     kReserved31                             = 31,
     kSetEnvironmentVariablesCommand         = 32,
     kViewRelativeLocation                   = 33,
-    kExecuteBlocksFromFile                  = 34
+    kExecuteBlocksFromFile                  = 34,
+    kDataReferenceCommand                   = 35
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -695,6 +696,20 @@ struct ExecuteBlocksFromFile
     uint32_t filename_length;
 };
 
+// Replaces a kFillMemoryCommand, kInitBufferCommand, or kInitImageCommand block whose data is identical to the data of
+// an earlier block in the same file.  The fields of the replaced command that follow its thread_id are encoded after
+// this header, including the level sizes of a kInitImageCommand, but the command data is not.
+struct DataReferenceCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    MetaDataId       command_id;  // Meta data ID of the replaced command.
+    int64_t          data_offset; // Offset from the start of the file to the referenced data.
+    uint64_t         stored_size; // Size of the referenced data in the file.
+    uint64_t         data_size;   // Uncompressed size of the referenced data.
+    uint32_t         compressed;  // Non-zero if the referenced data is compressed with the file's compression type.
+};
+
 // Restore size_t to normal behavior.
 #undef size_t
 
@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+
+# Generates the function that converts the API call IDs of all API families to entry point names, from the
+# ApiCallId enumeration of format/api_call_id.h.  Run again after API call IDs are added.
+
+import os
+import re
+
+
+SCRIPT_DIR = os.path.abspath(os.path.dirname(__file__))
+API_CALL_ID_HEADER = os.path.normpath(os.path.join(SCRIPT_DIR, '..', 'format', 'api_call_id.h'))
+GENERATED_FILENAME = os.path.join(SCRIPT_DIR, 'generated_api_call_id_to_string.h')
+
+
+COPYRIGHT = '''/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+'''
+
+
+def read_api_call_names(header_path: str) -> list:
+
+    with open(header_path, 'r') as file:
+        content = file.read()
+
+    enum_start = content.index('enum ApiCallId')
+    enum_end = content.index('};', enum_start)
+
+    # Only the enumerators with an assigned API call ID are entry points, which excludes ApiCall_Unknown and the
+    # ApiCall_*Last range markers.
+    return re.findall(r'^\s*ApiCall_(\w+)\s*=\s*MakeApiCallId\(', content[enum_start:enum_end], re.MULTILINE)
+
+
+def generate() -> None:
+
+    names = read_api_call_names(API_CALL_ID_HEADER)
+
+    print(f'Generating {os.path.basename(GENERATED_FILENAME)} with {len(names)} API calls')
+
+    with open(GENERATED_FILENAME, 'w', newline='\n') as file:
+        file.write(COPYRIGHT)
+        file.write('\n')
+        file.write('/*\n')
+        file.write('** This file is generated from generate_api_call_id_to_string.py.\n')
+        file.write('**\n')
+        file.write('*/\n')
+        file.write('\n')
+        file.write('#ifndef GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H\n')
+        file.write('#define GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H\n')
+        file.write('\n')
+        file.write('#include "format/api_call_id.h"\n')
+        file.write('#include "util/defines.h"\n')
+        file.write('\n')
+        file.write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)\n')
+        file.write('GFXRECON_BEGIN_NAMESPACE(util)\n')
+        file.write('\n')
+        file.write('// Returns the entry point name of an API call ID, or nullptr for IDs that are not API calls.\n')
+        file.write('inline const char* GetApiCallIdString(format::ApiCallId call_id)\n')
+        file.write('{\n')
+        file.write('    switch (call_id)\n')
+        file.write('    {\n')
+
+        for name in names:
+            file.write(f'        case format::ApiCallId::ApiCall_{name}:\n')
+            file.write(f'            return "{name}";\n')
+
+        file.write('        default:\n')
+        file.write('            return nullptr;\n')
+        file.write('    }\n')
+        file.write('}\n')
+        file.write('\n')
+        file.write('GFXRECON_END_NAMESPACE(util)\n')
+        file.write('GFXRECON_END_NAMESPACE(gfxrecon)\n')
+        file.write('\n')
+        file.write('#endif // GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H\n')
+
+
+if __name__ == '__main__':
+    generate()
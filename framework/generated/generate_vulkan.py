@@ -56,6 +56,7 @@ generate_targets = [
     'generated_vulkan_command_buffer_util.cpp',
     'generated_vulkan_dispatch_table.h',
     'generated_layer_func_table.h',
+    'generated_layer_func_table_names.h',
     'generated_vulkan_struct_decoders.h',
     'generated_vulkan_struct_decoders.cpp',
     'generated_vulkan_struct_decoders_forward.h',
@@ -0,0 +1,2424 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+** This file is generated from generate_api_call_id_to_string.py.
+**
+*/
+
+#ifndef GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H
+#define GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H
+
+#include "format/api_call_id.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Returns the entry point name of an API call ID, or nullptr for IDs that are not API calls.
+inline const char* GetApiCallIdString(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+            return "vkCreateInstance";
+        case format::ApiCallId::ApiCall_vkDestroyInstance:
+            return "vkDestroyInstance";
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
+            return "vkEnumeratePhysicalDevices";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures:
+            return "vkGetPhysicalDeviceFeatures";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties:
+            return "vkGetPhysicalDeviceFormatProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties:
+            return "vkGetPhysicalDeviceImageFormatProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            return "vkGetPhysicalDeviceProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties:
+            return "vkGetPhysicalDeviceQueueFamilyProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
+            return "vkGetPhysicalDeviceMemoryProperties";
+        case format::ApiCallId::ApiCall_vkGetInstanceProcAddr:
+            return "vkGetInstanceProcAddr";
+        case format::ApiCallId::ApiCall_vkGetDeviceProcAddr:
+            return "vkGetDeviceProcAddr";
+        case format::ApiCallId::ApiCall_vkCreateDevice:
+            return "vkCreateDevice";
+        case format::ApiCallId::ApiCall_vkDestroyDevice:
+            return "vkDestroyDevice";
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties:
+            return "vkEnumerateInstanceExtensionProperties";
+        case format::ApiCallId::ApiCall_vkEnumerateDeviceExtensionProperties:
+            return "vkEnumerateDeviceExtensionProperties";
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties:
+            return "vkEnumerateInstanceLayerProperties";
+        case format::ApiCallId::ApiCall_vkEnumerateDeviceLayerProperties:
+            return "vkEnumerateDeviceLayerProperties";
+        case format::ApiCallId::ApiCall_vkGetDeviceQueue:
+            return "vkGetDeviceQueue";
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+            return "vkQueueSubmit";
+        case format::ApiCallId::ApiCall_vkQueueWaitIdle:
+            return "vkQueueWaitIdle";
+        case format::ApiCallId::ApiCall_vkDeviceWaitIdle:
+            return "vkDeviceWaitIdle";
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+            return "vkAllocateMemory";
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+            return "vkFreeMemory";
+        case format::ApiCallId::ApiCall_vkMapMemory:
+            return "vkMapMemory";
+        case format::ApiCallId::ApiCall_vkUnmapMemory:
+            return "vkUnmapMemory";
+        case format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges:
+            return "vkFlushMappedMemoryRanges";
+        case format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges:
+            return "vkInvalidateMappedMemoryRanges";
+        case format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment:
+            return "vkGetDeviceMemoryCommitment";
+        case format::ApiCallId::ApiCall_vkBindBufferMemory:
+            return "vkBindBufferMemory";
+        case format::ApiCallId::ApiCall_vkBindImageMemory:
+            return "vkBindImageMemory";
+        case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements:
+            return "vkGetBufferMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements:
+            return "vkGetImageMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements:
+            return "vkGetImageSparseMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties";
+        case format::ApiCallId::ApiCall_vkQueueBindSparse:
+            return "vkQueueBindSparse";
+        case format::ApiCallId::ApiCall_vkCreateFence:
+            return "vkCreateFence";
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+            return "vkDestroyFence";
+        case format::ApiCallId::ApiCall_vkResetFences:
+            return "vkResetFences";
+        case format::ApiCallId::ApiCall_vkGetFenceStatus:
+            return "vkGetFenceStatus";
+        case format::ApiCallId::ApiCall_vkWaitForFences:
+            return "vkWaitForFences";
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+            return "vkCreateSemaphore";
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+            return "vkDestroySemaphore";
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+            return "vkCreateEvent";
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+            return "vkDestroyEvent";
+        case format::ApiCallId::ApiCall_vkGetEventStatus:
+            return "vkGetEventStatus";
+        case format::ApiCallId::ApiCall_vkSetEvent:
+            return "vkSetEvent";
+        case format::ApiCallId::ApiCall_vkResetEvent:
+            return "vkResetEvent";
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+            return "vkCreateQueryPool";
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+            return "vkDestroyQueryPool";
+        case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
+            return "vkGetQueryPoolResults";
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+            return "vkCreateBuffer";
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+            return "vkDestroyBuffer";
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+            return "vkCreateBufferView";
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+            return "vkDestroyBufferView";
+        case format::ApiCallId::ApiCall_vkCreateImage:
+            return "vkCreateImage";
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+            return "vkDestroyImage";
+        case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout:
+            return "vkGetImageSubresourceLayout";
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+            return "vkCreateImageView";
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+            return "vkDestroyImageView";
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+            return "vkCreateShaderModule";
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+            return "vkDestroyShaderModule";
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+            return "vkCreatePipelineCache";
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+            return "vkDestroyPipelineCache";
+        case format::ApiCallId::ApiCall_vkGetPipelineCacheData:
+            return "vkGetPipelineCacheData";
+        case format::ApiCallId::ApiCall_vkMergePipelineCaches:
+            return "vkMergePipelineCaches";
+        case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            return "vkCreateGraphicsPipelines";
+        case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            return "vkCreateComputePipelines";
+        case format::ApiCallId::ApiCall_vkDestroyPipeline:
+            return "vkDestroyPipeline";
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+            return "vkCreatePipelineLayout";
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+            return "vkDestroyPipelineLayout";
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+            return "vkCreateSampler";
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+            return "vkDestroySampler";
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+            return "vkCreateDescriptorSetLayout";
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+            return "vkDestroyDescriptorSetLayout";
+        case format::ApiCallId::ApiCall_vkCreateDescriptorPool:
+            return "vkCreateDescriptorPool";
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorPool:
+            return "vkDestroyDescriptorPool";
+        case format::ApiCallId::ApiCall_vkResetDescriptorPool:
+            return "vkResetDescriptorPool";
+        case format::ApiCallId::ApiCall_vkAllocateDescriptorSets:
+            return "vkAllocateDescriptorSets";
+        case format::ApiCallId::ApiCall_vkFreeDescriptorSets:
+            return "vkFreeDescriptorSets";
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
+            return "vkUpdateDescriptorSets";
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+            return "vkCreateFramebuffer";
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+            return "vkDestroyFramebuffer";
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+            return "vkCreateRenderPass";
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+            return "vkDestroyRenderPass";
+        case format::ApiCallId::ApiCall_vkGetRenderAreaGranularity:
+            return "vkGetRenderAreaGranularity";
+        case format::ApiCallId::ApiCall_vkCreateCommandPool:
+            return "vkCreateCommandPool";
+        case format::ApiCallId::ApiCall_vkDestroyCommandPool:
+            return "vkDestroyCommandPool";
+        case format::ApiCallId::ApiCall_vkResetCommandPool:
+            return "vkResetCommandPool";
+        case format::ApiCallId::ApiCall_vkAllocateCommandBuffers:
+            return "vkAllocateCommandBuffers";
+        case format::ApiCallId::ApiCall_vkFreeCommandBuffers:
+            return "vkFreeCommandBuffers";
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+            return "vkBeginCommandBuffer";
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+            return "vkEndCommandBuffer";
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+            return "vkResetCommandBuffer";
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+            return "vkCmdBindPipeline";
+        case format::ApiCallId::ApiCall_vkCmdSetViewport:
+            return "vkCmdSetViewport";
+        case format::ApiCallId::ApiCall_vkCmdSetScissor:
+            return "vkCmdSetScissor";
+        case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+            return "vkCmdSetLineWidth";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+            return "vkCmdSetDepthBias";
+        case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+            return "vkCmdSetBlendConstants";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+            return "vkCmdSetDepthBounds";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+            return "vkCmdSetStencilCompareMask";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+            return "vkCmdSetStencilWriteMask";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+            return "vkCmdSetStencilReference";
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+            return "vkCmdBindDescriptorSets";
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+            return "vkCmdBindIndexBuffer";
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+            return "vkCmdBindVertexBuffers";
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+            return "vkCmdDraw";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+            return "vkCmdDrawIndexed";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+            return "vkCmdDrawIndirect";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+            return "vkCmdDrawIndexedIndirect";
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+            return "vkCmdDispatch";
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+            return "vkCmdDispatchIndirect";
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+            return "vkCmdCopyBuffer";
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+            return "vkCmdCopyImage";
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+            return "vkCmdBlitImage";
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+            return "vkCmdCopyBufferToImage";
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+            return "vkCmdCopyImageToBuffer";
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+            return "vkCmdUpdateBuffer";
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+            return "vkCmdFillBuffer";
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+            return "vkCmdClearColorImage";
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+            return "vkCmdClearDepthStencilImage";
+        case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+            return "vkCmdClearAttachments";
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+            return "vkCmdResolveImage";
+        case format::ApiCallId::ApiCall_vkCmdSetEvent:
+            return "vkCmdSetEvent";
+        case format::ApiCallId::ApiCall_vkCmdResetEvent:
+            return "vkCmdResetEvent";
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+            return "vkCmdWaitEvents";
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+            return "vkCmdPipelineBarrier";
+        case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+            return "vkCmdBeginQuery";
+        case format::ApiCallId::ApiCall_vkCmdEndQuery:
+            return "vkCmdEndQuery";
+        case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+            return "vkCmdResetQueryPool";
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+            return "vkCmdWriteTimestamp";
+        case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+            return "vkCmdCopyQueryPoolResults";
+        case format::ApiCallId::ApiCall_vkCmdPushConstants:
+            return "vkCmdPushConstants";
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
+            return "vkCmdBeginRenderPass";
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+            return "vkCmdNextSubpass";
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+            return "vkCmdEndRenderPass";
+        case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
+            return "vkCmdExecuteCommands";
+        case format::ApiCallId::ApiCall_vkEnumerateInstanceVersion:
+            return "vkEnumerateInstanceVersion";
+        case format::ApiCallId::ApiCall_vkBindBufferMemory2:
+            return "vkBindBufferMemory2";
+        case format::ApiCallId::ApiCall_vkBindImageMemory2:
+            return "vkBindImageMemory2";
+        case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeatures:
+            return "vkGetDeviceGroupPeerMemoryFeatures";
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+            return "vkCmdSetDeviceMask";
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+            return "vkCmdDispatchBase";
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
+            return "vkEnumeratePhysicalDeviceGroups";
+        case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2:
+            return "vkGetImageMemoryRequirements2";
+        case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2:
+            return "vkGetBufferMemoryRequirements2";
+        case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2:
+            return "vkGetImageSparseMemoryRequirements2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2:
+            return "vkGetPhysicalDeviceFeatures2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            return "vkGetPhysicalDeviceProperties2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2:
+            return "vkGetPhysicalDeviceFormatProperties2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2:
+            return "vkGetPhysicalDeviceImageFormatProperties2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+            return "vkGetPhysicalDeviceMemoryProperties2";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2";
+        case format::ApiCallId::ApiCall_vkTrimCommandPool:
+            return "vkTrimCommandPool";
+        case format::ApiCallId::ApiCall_vkGetDeviceQueue2:
+            return "vkGetDeviceQueue2";
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+            return "vkCreateSamplerYcbcrConversion";
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+            return "vkDestroySamplerYcbcrConversion";
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate:
+            return "vkCreateDescriptorUpdateTemplate";
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplate:
+            return "vkDestroyDescriptorUpdateTemplate";
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplate:
+            return "vkUpdateDescriptorSetWithTemplate";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties:
+            return "vkGetPhysicalDeviceExternalBufferProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties:
+            return "vkGetPhysicalDeviceExternalFenceProperties";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties:
+            return "vkGetPhysicalDeviceExternalSemaphoreProperties";
+        case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport:
+            return "vkGetDescriptorSetLayoutSupport";
+        case format::ApiCallId::ApiCall_vkDestroySurfaceKHR:
+            return "vkDestroySurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceSupportKHR:
+            return "vkGetPhysicalDeviceSurfaceSupportKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilitiesKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormatsKHR:
+            return "vkGetPhysicalDeviceSurfaceFormatsKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModesKHR:
+            return "vkGetPhysicalDeviceSurfacePresentModesKHR";
+        case format::ApiCallId::ApiCall_vkCreateSwapchainKHR:
+            return "vkCreateSwapchainKHR";
+        case format::ApiCallId::ApiCall_vkDestroySwapchainKHR:
+            return "vkDestroySwapchainKHR";
+        case format::ApiCallId::ApiCall_vkGetSwapchainImagesKHR:
+            return "vkGetSwapchainImagesKHR";
+        case format::ApiCallId::ApiCall_vkAcquireNextImageKHR:
+            return "vkAcquireNextImageKHR";
+        case format::ApiCallId::ApiCall_vkQueuePresentKHR:
+            return "vkQueuePresentKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceGroupPresentCapabilitiesKHR:
+            return "vkGetDeviceGroupPresentCapabilitiesKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModesKHR:
+            return "vkGetDeviceGroupSurfacePresentModesKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDevicePresentRectanglesKHR:
+            return "vkGetPhysicalDevicePresentRectanglesKHR";
+        case format::ApiCallId::ApiCall_vkAcquireNextImage2KHR:
+            return "vkAcquireNextImage2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
+            return "vkGetPhysicalDeviceDisplayPlanePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetDisplayPlaneSupportedDisplaysKHR:
+            return "vkGetDisplayPlaneSupportedDisplaysKHR";
+        case format::ApiCallId::ApiCall_vkGetDisplayModePropertiesKHR:
+            return "vkGetDisplayModePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkCreateDisplayModeKHR:
+            return "vkCreateDisplayModeKHR";
+        case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilitiesKHR:
+            return "vkGetDisplayPlaneCapabilitiesKHR";
+        case format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR:
+            return "vkCreateDisplayPlaneSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR:
+            return "vkCreateSharedSwapchainsKHR";
+        case format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR:
+            return "vkCreateXlibSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXlibPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXlibPresentationSupportKHR";
+        case format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR:
+            return "vkCreateXcbSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceXcbPresentationSupportKHR:
+            return "vkGetPhysicalDeviceXcbPresentationSupportKHR";
+        case format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR:
+            return "vkCreateWaylandSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWaylandPresentationSupportKHR:
+            return "vkGetPhysicalDeviceWaylandPresentationSupportKHR";
+        case format::ApiCallId::ApiCall_vkCreateMirSurfaceKHR:
+            return "vkCreateMirSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMirPresentationSupportKHR:
+            return "vkGetPhysicalDeviceMirPresentationSupportKHR";
+        case format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR:
+            return "vkCreateAndroidSurfaceKHR";
+        case format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR:
+            return "vkCreateWin32SurfaceKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceWin32PresentationSupportKHR:
+            return "vkGetPhysicalDeviceWin32PresentationSupportKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFeatures2KHR:
+            return "vkGetPhysicalDeviceFeatures2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            return "vkGetPhysicalDeviceProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFormatProperties2KHR:
+            return "vkGetPhysicalDeviceFormatProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceImageFormatProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            return "vkGetPhysicalDeviceQueueFamilyProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+            return "vkGetPhysicalDeviceMemoryProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            return "vkGetPhysicalDeviceSparseImageFormatProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceGroupPeerMemoryFeaturesKHR:
+            return "vkGetDeviceGroupPeerMemoryFeaturesKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+            return "vkCmdSetDeviceMaskKHR";
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+            return "vkCmdDispatchBaseKHR";
+        case format::ApiCallId::ApiCall_vkTrimCommandPoolKHR:
+            return "vkTrimCommandPoolKHR";
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
+            return "vkEnumeratePhysicalDeviceGroupsKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
+            return "vkGetPhysicalDeviceExternalBufferPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR:
+            return "vkGetMemoryWin32HandleKHR";
+        case format::ApiCallId::ApiCall_vkGetMemoryWin32HandlePropertiesKHR:
+            return "vkGetMemoryWin32HandlePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetMemoryFdKHR:
+            return "vkGetMemoryFdKHR";
+        case format::ApiCallId::ApiCall_vkGetMemoryFdPropertiesKHR:
+            return "vkGetMemoryFdPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR:
+            return "vkImportSemaphoreWin32HandleKHR";
+        case format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR:
+            return "vkGetSemaphoreWin32HandleKHR";
+        case format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR:
+            return "vkImportSemaphoreFdKHR";
+        case format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR:
+            return "vkGetSemaphoreFdKHR";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+            return "vkCmdPushDescriptorSetKHR";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+            return "vkCmdPushDescriptorSetWithTemplateKHR";
+        case format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR:
+            return "vkCreateDescriptorUpdateTemplateKHR";
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorUpdateTemplateKHR:
+            return "vkDestroyDescriptorUpdateTemplateKHR";
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSetWithTemplateKHR:
+            return "vkUpdateDescriptorSetWithTemplateKHR";
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+            return "vkCreateRenderPass2KHR";
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+            return "vkCmdBeginRenderPass2KHR";
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+            return "vkCmdNextSubpass2KHR";
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+            return "vkCmdEndRenderPass2KHR";
+        case format::ApiCallId::ApiCall_vkGetSwapchainStatusKHR:
+            return "vkGetSwapchainStatusKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR:
+            return "vkGetPhysicalDeviceExternalFencePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR:
+            return "vkImportFenceWin32HandleKHR";
+        case format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR:
+            return "vkGetFenceWin32HandleKHR";
+        case format::ApiCallId::ApiCall_vkImportFenceFdKHR:
+            return "vkImportFenceFdKHR";
+        case format::ApiCallId::ApiCall_vkGetFenceFdKHR:
+            return "vkGetFenceFdKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR:
+            return "vkGetPhysicalDeviceSurfaceFormats2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
+            return "vkGetPhysicalDeviceDisplayPlaneProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetDisplayModeProperties2KHR:
+            return "vkGetDisplayModeProperties2KHR";
+        case format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR:
+            return "vkGetDisplayPlaneCapabilities2KHR";
+        case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR:
+            return "vkGetImageMemoryRequirements2KHR";
+        case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR:
+            return "vkGetBufferMemoryRequirements2KHR";
+        case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR:
+            return "vkGetImageSparseMemoryRequirements2KHR";
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+            return "vkCreateSamplerYcbcrConversionKHR";
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+            return "vkDestroySamplerYcbcrConversionKHR";
+        case format::ApiCallId::ApiCall_vkBindBufferMemory2KHR:
+            return "vkBindBufferMemory2KHR";
+        case format::ApiCallId::ApiCall_vkBindImageMemory2KHR:
+            return "vkBindImageMemory2KHR";
+        case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR:
+            return "vkGetDescriptorSetLayoutSupportKHR";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+            return "vkCmdDrawIndirectCountKHR";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+            return "vkCmdDrawIndexedIndirectCountKHR";
+        case format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT:
+            return "vkCreateDebugReportCallbackEXT";
+        case format::ApiCallId::ApiCall_vkDestroyDebugReportCallbackEXT:
+            return "vkDestroyDebugReportCallbackEXT";
+        case format::ApiCallId::ApiCall_vkDebugReportMessageEXT:
+            return "vkDebugReportMessageEXT";
+        case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT:
+            return "vkDebugMarkerSetObjectTagEXT";
+        case format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT:
+            return "vkDebugMarkerSetObjectNameEXT";
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+            return "vkCmdDebugMarkerBeginEXT";
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+            return "vkCmdDebugMarkerEndEXT";
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+            return "vkCmdDebugMarkerInsertEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+            return "vkCmdDrawIndirectCountAMD";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+            return "vkCmdDrawIndexedIndirectCountAMD";
+        case format::ApiCallId::ApiCall_vkGetShaderInfoAMD:
+            return "vkGetShaderInfoAMD";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            return "vkGetPhysicalDeviceExternalImageFormatPropertiesNV";
+        case format::ApiCallId::ApiCall_vkGetMemoryWin32HandleNV:
+            return "vkGetMemoryWin32HandleNV";
+        case format::ApiCallId::ApiCall_vkCreateViSurfaceNN:
+            return "vkCreateViSurfaceNN";
+        case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+            return "vkCmdBeginConditionalRenderingEXT";
+        case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+            return "vkCmdEndConditionalRenderingEXT";
+        case format::ApiCallId::ApiCall_vkCmdProcessCommandsNVX:
+            return "vkCmdProcessCommandsNVX";
+        case format::ApiCallId::ApiCall_vkCmdReserveSpaceForCommandsNVX:
+            return "vkCmdReserveSpaceForCommandsNVX";
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNVX:
+            return "vkCreateIndirectCommandsLayoutNVX";
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNVX:
+            return "vkDestroyIndirectCommandsLayoutNVX";
+        case format::ApiCallId::ApiCall_vkCreateObjectTableNVX:
+            return "vkCreateObjectTableNVX";
+        case format::ApiCallId::ApiCall_vkDestroyObjectTableNVX:
+            return "vkDestroyObjectTableNVX";
+        case format::ApiCallId::ApiCall_vkRegisterObjectsNVX:
+            return "vkRegisterObjectsNVX";
+        case format::ApiCallId::ApiCall_vkUnregisterObjectsNVX:
+            return "vkUnregisterObjectsNVX";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX:
+            return "vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+            return "vkCmdSetViewportWScalingNV";
+        case format::ApiCallId::ApiCall_vkReleaseDisplayEXT:
+            return "vkReleaseDisplayEXT";
+        case format::ApiCallId::ApiCall_vkAcquireXlibDisplayEXT:
+            return "vkAcquireXlibDisplayEXT";
+        case format::ApiCallId::ApiCall_vkGetRandROutputDisplayEXT:
+            return "vkGetRandROutputDisplayEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
+            return "vkGetPhysicalDeviceSurfaceCapabilities2EXT";
+        case format::ApiCallId::ApiCall_vkDisplayPowerControlEXT:
+            return "vkDisplayPowerControlEXT";
+        case format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT:
+            return "vkRegisterDeviceEventEXT";
+        case format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT:
+            return "vkRegisterDisplayEventEXT";
+        case format::ApiCallId::ApiCall_vkGetSwapchainCounterEXT:
+            return "vkGetSwapchainCounterEXT";
+        case format::ApiCallId::ApiCall_vkGetRefreshCycleDurationGOOGLE:
+            return "vkGetRefreshCycleDurationGOOGLE";
+        case format::ApiCallId::ApiCall_vkGetPastPresentationTimingGOOGLE:
+            return "vkGetPastPresentationTimingGOOGLE";
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+            return "vkCmdSetDiscardRectangleEXT";
+        case format::ApiCallId::ApiCall_vkSetHdrMetadataEXT:
+            return "vkSetHdrMetadataEXT";
+        case format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK:
+            return "vkCreateIOSSurfaceMVK";
+        case format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK:
+            return "vkCreateMacOSSurfaceMVK";
+        case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT:
+            return "vkSetDebugUtilsObjectNameEXT";
+        case format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT:
+            return "vkSetDebugUtilsObjectTagEXT";
+        case format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT:
+            return "vkQueueBeginDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkQueueEndDebugUtilsLabelEXT:
+            return "vkQueueEndDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT:
+            return "vkQueueInsertDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+            return "vkCmdBeginDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+            return "vkCmdEndDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+            return "vkCmdInsertDebugUtilsLabelEXT";
+        case format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT:
+            return "vkCreateDebugUtilsMessengerEXT";
+        case format::ApiCallId::ApiCall_vkDestroyDebugUtilsMessengerEXT:
+            return "vkDestroyDebugUtilsMessengerEXT";
+        case format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT:
+            return "vkSubmitDebugUtilsMessageEXT";
+        case format::ApiCallId::ApiCall_vkGetAndroidHardwareBufferPropertiesANDROID:
+            return "vkGetAndroidHardwareBufferPropertiesANDROID";
+        case format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID:
+            return "vkGetMemoryAndroidHardwareBufferANDROID";
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+            return "vkCmdSetSampleLocationsEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMultisamplePropertiesEXT:
+            return "vkGetPhysicalDeviceMultisamplePropertiesEXT";
+        case format::ApiCallId::ApiCall_vkCreateValidationCacheEXT:
+            return "vkCreateValidationCacheEXT";
+        case format::ApiCallId::ApiCall_vkDestroyValidationCacheEXT:
+            return "vkDestroyValidationCacheEXT";
+        case format::ApiCallId::ApiCall_vkMergeValidationCachesEXT:
+            return "vkMergeValidationCachesEXT";
+        case format::ApiCallId::ApiCall_vkGetValidationCacheDataEXT:
+            return "vkGetValidationCacheDataEXT";
+        case format::ApiCallId::ApiCall_vkGetMemoryHostPointerPropertiesEXT:
+            return "vkGetMemoryHostPointerPropertiesEXT";
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+            return "vkCmdWriteBufferMarkerAMD";
+        case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+            return "vkCmdBindShadingRateImageNV";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+            return "vkCmdSetViewportShadingRatePaletteNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+            return "vkCmdSetCoarseSampleOrderNV";
+        case format::ApiCallId::ApiCall_vkGetImageDrmFormatModifierPropertiesEXT:
+            return "vkGetImageDrmFormatModifierPropertiesEXT";
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV:
+            return "vkCreateAccelerationStructureNV";
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureNV:
+            return "vkDestroyAccelerationStructureNV";
+        case format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV:
+            return "vkGetAccelerationStructureMemoryRequirementsNV";
+        case format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV:
+            return "vkBindAccelerationStructureMemoryNV";
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+            return "vkCmdBuildAccelerationStructureNV";
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+            return "vkCmdCopyAccelerationStructureNV";
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+            return "vkCmdTraceRaysNV";
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV:
+            return "vkCreateRayTracingPipelinesNV";
+        case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesNV:
+            return "vkGetRayTracingShaderGroupHandlesNV";
+        case format::ApiCallId::ApiCall_vkGetAccelerationStructureHandleNV:
+            return "vkGetAccelerationStructureHandleNV";
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+            return "vkCmdWriteAccelerationStructuresPropertiesNV";
+        case format::ApiCallId::ApiCall_vkCompileDeferredNV:
+            return "vkCompileDeferredNV";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+            return "vkCmdDrawMeshTasksNV";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+            return "vkCmdDrawMeshTasksIndirectNV";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+            return "vkCmdDrawMeshTasksIndirectCountNV";
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+            return "vkCmdSetExclusiveScissorNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+            return "vkCmdSetCheckpointNV";
+        case format::ApiCallId::ApiCall_vkGetQueueCheckpointDataNV:
+            return "vkGetQueueCheckpointDataNV";
+        case format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA:
+            return "vkCreateImagePipeSurfaceFUCHSIA";
+        case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+            return "vkCmdBindTransformFeedbackBuffersEXT";
+        case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+            return "vkCmdBeginTransformFeedbackEXT";
+        case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+            return "vkCmdEndTransformFeedbackEXT";
+        case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+            return "vkCmdBeginQueryIndexedEXT";
+        case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+            return "vkCmdEndQueryIndexedEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+            return "vkCmdDrawIndirectByteCountEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT:
+            return "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT";
+        case format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT:
+            return "vkGetCalibratedTimestampsEXT";
+        case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT:
+            return "vkGetBufferDeviceAddressEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV:
+            return "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV";
+        case format::ApiCallId::ApiCall_vkGetImageViewHandleNVX:
+            return "vkGetImageViewHandleNVX";
+        case format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT:
+            return "vkCreateMetalSurfaceEXT";
+        case format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP:
+            return "vkCreateStreamDescriptorSurfaceGGP";
+        case format::ApiCallId::ApiCall_vkSetLocalDimmingAMD:
+            return "vkSetLocalDimmingAMD";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV:
+            return "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT:
+            return "vkGetPhysicalDeviceSurfacePresentModes2EXT";
+        case format::ApiCallId::ApiCall_vkAcquireFullScreenExclusiveModeEXT:
+            return "vkAcquireFullScreenExclusiveModeEXT";
+        case format::ApiCallId::ApiCall_vkReleaseFullScreenExclusiveModeEXT:
+            return "vkReleaseFullScreenExclusiveModeEXT";
+        case format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT:
+            return "vkGetDeviceGroupSurfacePresentModes2EXT";
+        case format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT:
+            return "vkCreateHeadlessSurfaceEXT";
+        case format::ApiCallId::ApiCall_vkResetQueryPoolEXT:
+            return "vkResetQueryPoolEXT";
+        case format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR:
+            return "vkGetPipelineExecutablePropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR:
+            return "vkGetPipelineExecutableStatisticsKHR";
+        case format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR:
+            return "vkGetPipelineExecutableInternalRepresentationsKHR";
+        case format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL:
+            return "vkInitializePerformanceApiINTEL";
+        case format::ApiCallId::ApiCall_vkUninitializePerformanceApiINTEL:
+            return "vkUninitializePerformanceApiINTEL";
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+            return "vkCmdSetPerformanceMarkerINTEL";
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+            return "vkCmdSetPerformanceStreamMarkerINTEL";
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+            return "vkCmdSetPerformanceOverrideINTEL";
+        case format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL:
+            return "vkAcquirePerformanceConfigurationINTEL";
+        case format::ApiCallId::ApiCall_vkReleasePerformanceConfigurationINTEL:
+            return "vkReleasePerformanceConfigurationINTEL";
+        case format::ApiCallId::ApiCall_vkQueueSetPerformanceConfigurationINTEL:
+            return "vkQueueSetPerformanceConfigurationINTEL";
+        case format::ApiCallId::ApiCall_vkGetPerformanceParameterINTEL:
+            return "vkGetPerformanceParameterINTEL";
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+            return "vkCmdSetLineStippleEXT";
+        case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValueKHR:
+            return "vkGetSemaphoreCounterValueKHR";
+        case format::ApiCallId::ApiCall_vkWaitSemaphoresKHR:
+            return "vkWaitSemaphoresKHR";
+        case format::ApiCallId::ApiCall_vkSignalSemaphoreKHR:
+            return "vkSignalSemaphoreKHR";
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR:
+            return "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR:
+            return "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR";
+        case format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR:
+            return "vkAcquireProfilingLockKHR";
+        case format::ApiCallId::ApiCall_vkReleaseProfilingLockKHR:
+            return "vkReleaseProfilingLockKHR";
+        case format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR:
+            return "vkGetBufferDeviceAddressKHR";
+        case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR:
+            return "vkGetBufferOpaqueCaptureAddressKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR:
+            return "vkGetDeviceMemoryOpaqueCaptureAddressKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolPropertiesEXT:
+            return "vkGetPhysicalDeviceToolPropertiesEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+            return "vkCmdDrawIndirectCount";
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+            return "vkCmdDrawIndexedIndirectCount";
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+            return "vkCreateRenderPass2";
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+            return "vkCmdBeginRenderPass2";
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+            return "vkCmdNextSubpass2";
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+            return "vkCmdEndRenderPass2";
+        case format::ApiCallId::ApiCall_vkResetQueryPool:
+            return "vkResetQueryPool";
+        case format::ApiCallId::ApiCall_vkGetSemaphoreCounterValue:
+            return "vkGetSemaphoreCounterValue";
+        case format::ApiCallId::ApiCall_vkWaitSemaphores:
+            return "vkWaitSemaphores";
+        case format::ApiCallId::ApiCall_vkSignalSemaphore:
+            return "vkSignalSemaphore";
+        case format::ApiCallId::ApiCall_vkGetBufferDeviceAddress:
+            return "vkGetBufferDeviceAddress";
+        case format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress:
+            return "vkGetBufferOpaqueCaptureAddress";
+        case format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress:
+            return "vkGetDeviceMemoryOpaqueCaptureAddress";
+        case format::ApiCallId::ApiCall_vkCreateDeferredOperationKHR:
+            return "vkCreateDeferredOperationKHR";
+        case format::ApiCallId::ApiCall_vkDestroyDeferredOperationKHR:
+            return "vkDestroyDeferredOperationKHR";
+        case format::ApiCallId::ApiCall_vkGetDeferredOperationMaxConcurrencyKHR:
+            return "vkGetDeferredOperationMaxConcurrencyKHR";
+        case format::ApiCallId::ApiCall_vkGetDeferredOperationResultKHR:
+            return "vkGetDeferredOperationResultKHR";
+        case format::ApiCallId::ApiCall_vkDeferredOperationJoinKHR:
+            return "vkDeferredOperationJoinKHR";
+        case format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR:
+            return "vkCreateAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkDestroyAccelerationStructureKHR:
+            return "vkDestroyAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsKHR:
+            return "vkGetAccelerationStructureMemoryRequirementsKHR";
+        case format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryKHR:
+            return "vkBindAccelerationStructureMemoryKHR";
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR:
+            return "vkCmdBuildAccelerationStructuresKHR";
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR:
+            return "vkCmdBuildAccelerationStructuresIndirectKHR";
+        case format::ApiCallId::ApiCall_vkBuildAccelerationStructuresKHR:
+            return "vkBuildAccelerationStructuresKHR";
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureKHR:
+            return "vkCopyAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
+            return "vkCopyAccelerationStructureToMemoryKHR";
+        case format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
+            return "vkCopyMemoryToAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
+            return "vkWriteAccelerationStructuresPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+            return "vkCmdCopyAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+            return "vkCmdCopyAccelerationStructureToMemoryKHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+            return "vkCmdCopyMemoryToAccelerationStructureKHR";
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+            return "vkCmdTraceRaysKHR";
+        case format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR:
+            return "vkCreateRayTracingPipelinesKHR";
+        case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupHandlesKHR:
+            return "vkGetRayTracingShaderGroupHandlesKHR";
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+            return "vkCmdWriteAccelerationStructuresPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR:
+            return "vkGetAccelerationStructureDeviceAddressKHR";
+        case format::ApiCallId::ApiCall_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR:
+            return "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR";
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+            return "vkCmdTraceRaysIndirectKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR:
+            return "vkGetDeviceAccelerationStructureCompatibilityKHR";
+        case format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV:
+            return "vkGetGeneratedCommandsMemoryRequirementsNV";
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+            return "vkCmdPreprocessGeneratedCommandsNV";
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+            return "vkCmdExecuteGeneratedCommandsNV";
+        case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+            return "vkCmdBindPipelineShaderGroupNV";
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV:
+            return "vkCreateIndirectCommandsLayoutNV";
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutNV:
+            return "vkDestroyIndirectCommandsLayoutNV";
+        case format::ApiCallId::ApiCall_vkGetImageViewAddressNVX:
+            return "vkGetImageViewAddressNVX";
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT:
+            return "vkCreatePrivateDataSlotEXT";
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlotEXT:
+            return "vkDestroyPrivateDataSlotEXT";
+        case format::ApiCallId::ApiCall_vkSetPrivateDataEXT:
+            return "vkSetPrivateDataEXT";
+        case format::ApiCallId::ApiCall_vkGetPrivateDataEXT:
+            return "vkGetPrivateDataEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+            return "vkCmdSetCullModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+            return "vkCmdSetFrontFaceEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+            return "vkCmdSetPrimitiveTopologyEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+            return "vkCmdSetViewportWithCountEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+            return "vkCmdSetScissorWithCountEXT";
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+            return "vkCmdBindVertexBuffers2EXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+            return "vkCmdSetDepthTestEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+            return "vkCmdSetDepthWriteEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+            return "vkCmdSetDepthCompareOpEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+            return "vkCmdSetDepthBoundsTestEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+            return "vkCmdSetStencilTestEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+            return "vkCmdSetStencilOpEXT";
+        case format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT:
+            return "vkCreateDirectFBSurfaceEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceDirectFBPresentationSupportEXT:
+            return "vkGetPhysicalDeviceDirectFBPresentationSupportEXT";
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+            return "vkCmdCopyBuffer2KHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+            return "vkCmdCopyImage2KHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+            return "vkCmdCopyBufferToImage2KHR";
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+            return "vkCmdCopyImageToBuffer2KHR";
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+            return "vkCmdBlitImage2KHR";
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+            return "vkCmdResolveImage2KHR";
+        case format::ApiCallId::ApiCall_vkGetAccelerationStructureBuildSizesKHR:
+            return "vkGetAccelerationStructureBuildSizesKHR";
+        case format::ApiCallId::ApiCall_vkGetRayTracingShaderGroupStackSizeKHR:
+            return "vkGetRayTracingShaderGroupStackSizeKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+            return "vkCmdSetRayTracingPipelineStackSizeKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceFragmentShadingRatesKHR:
+            return "vkGetPhysicalDeviceFragmentShadingRatesKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
+            return "vkCmdSetFragmentShadingRateKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+            return "vkCmdSetFragmentShadingRateEnumNV";
+        case format::ApiCallId::ApiCall_vkAcquireWinrtDisplayNV:
+            return "vkAcquireWinrtDisplayNV";
+        case format::ApiCallId::ApiCall_vkGetWinrtDisplayNV:
+            return "vkGetWinrtDisplayNV";
+        case format::ApiCallId::ApiCall_vkCmdSetEvent2KHR:
+            return "vkCmdSetEvent2KHR";
+        case format::ApiCallId::ApiCall_vkCmdResetEvent2KHR:
+            return "vkCmdResetEvent2KHR";
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents2KHR:
+            return "vkCmdWaitEvents2KHR";
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier2KHR:
+            return "vkCmdPipelineBarrier2KHR";
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2KHR:
+            return "vkCmdWriteTimestamp2KHR";
+        case format::ApiCallId::ApiCall_vkQueueSubmit2KHR:
+            return "vkQueueSubmit2KHR";
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarker2AMD:
+            return "vkCmdWriteBufferMarker2AMD";
+        case format::ApiCallId::ApiCall_vkGetQueueCheckpointData2NV:
+            return "vkGetQueueCheckpointData2NV";
+        case format::ApiCallId::ApiCall_vkCmdSetVertexInputEXT:
+            return "vkCmdSetVertexInputEXT";
+        case format::ApiCallId::ApiCall_vkGetMemoryZirconHandleFUCHSIA:
+            return "vkGetMemoryZirconHandleFUCHSIA";
+        case format::ApiCallId::ApiCall_vkGetMemoryZirconHandlePropertiesFUCHSIA:
+            return "vkGetMemoryZirconHandlePropertiesFUCHSIA";
+        case format::ApiCallId::ApiCall_vkImportSemaphoreZirconHandleFUCHSIA:
+            return "vkImportSemaphoreZirconHandleFUCHSIA";
+        case format::ApiCallId::ApiCall_vkGetSemaphoreZirconHandleFUCHSIA:
+            return "vkGetSemaphoreZirconHandleFUCHSIA";
+        case format::ApiCallId::ApiCall_vkCmdSetPatchControlPointsEXT:
+            return "vkCmdSetPatchControlPointsEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnableEXT:
+            return "vkCmdSetRasterizerDiscardEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnableEXT:
+            return "vkCmdSetDepthBiasEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetLogicOpEXT:
+            return "vkCmdSetLogicOpEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnableEXT:
+            return "vkCmdSetPrimitiveRestartEnableEXT";
+        case format::ApiCallId::ApiCall_vkCreateScreenSurfaceQNX:
+            return "vkCreateScreenSurfaceQNX";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceScreenPresentationSupportQNX:
+            return "vkGetPhysicalDeviceScreenPresentationSupportQNX";
+        case format::ApiCallId::ApiCall_vkCmdSetColorWriteEnableEXT:
+            return "vkCmdSetColorWriteEnableEXT";
+        case format::ApiCallId::ApiCall_vkAcquireDrmDisplayEXT:
+            return "vkAcquireDrmDisplayEXT";
+        case format::ApiCallId::ApiCall_vkGetDrmDisplayEXT:
+            return "vkGetDrmDisplayEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiEXT:
+            return "vkCmdDrawMultiEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawMultiIndexedEXT:
+            return "vkCmdDrawMultiIndexedEXT";
+        case format::ApiCallId::ApiCall_vkWaitForPresentKHR:
+            return "vkWaitForPresentKHR";
+        case format::ApiCallId::ApiCall_vkCmdBindInvocationMaskHUAWEI:
+            return "vkCmdBindInvocationMaskHUAWEI";
+        case format::ApiCallId::ApiCall_vkGetMemoryRemoteAddressNV:
+            return "vkGetMemoryRemoteAddressNV";
+        case format::ApiCallId::ApiCall_vkGetDeviceBufferMemoryRequirementsKHR:
+            return "vkGetDeviceBufferMemoryRequirementsKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageMemoryRequirementsKHR:
+            return "vkGetDeviceImageMemoryRequirementsKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageSparseMemoryRequirementsKHR:
+            return "vkGetDeviceImageSparseMemoryRequirementsKHR";
+        case format::ApiCallId::ApiCall_vkSetDeviceMemoryPriorityEXT:
+            return "vkSetDeviceMemoryPriorityEXT";
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderingKHR:
+            return "vkCmdBeginRenderingKHR";
+        case format::ApiCallId::ApiCall_vkCmdEndRenderingKHR:
+            return "vkCmdEndRenderingKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceToolProperties:
+            return "vkGetPhysicalDeviceToolProperties";
+        case format::ApiCallId::ApiCall_vkCreatePrivateDataSlot:
+            return "vkCreatePrivateDataSlot";
+        case format::ApiCallId::ApiCall_vkDestroyPrivateDataSlot:
+            return "vkDestroyPrivateDataSlot";
+        case format::ApiCallId::ApiCall_vkSetPrivateData:
+            return "vkSetPrivateData";
+        case format::ApiCallId::ApiCall_vkGetPrivateData:
+            return "vkGetPrivateData";
+        case format::ApiCallId::ApiCall_vkCmdSetEvent2:
+            return "vkCmdSetEvent2";
+        case format::ApiCallId::ApiCall_vkCmdResetEvent2:
+            return "vkCmdResetEvent2";
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents2:
+            return "vkCmdWaitEvents2";
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier2:
+            return "vkCmdPipelineBarrier2";
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp2:
+            return "vkCmdWriteTimestamp2";
+        case format::ApiCallId::ApiCall_vkQueueSubmit2:
+            return "vkQueueSubmit2";
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2:
+            return "vkCmdCopyBuffer2";
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2:
+            return "vkCmdCopyImage2";
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2:
+            return "vkCmdCopyBufferToImage2";
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2:
+            return "vkCmdCopyImageToBuffer2";
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2:
+            return "vkCmdBlitImage2";
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2:
+            return "vkCmdResolveImage2";
+        case format::ApiCallId::ApiCall_vkCmdBeginRendering:
+            return "vkCmdBeginRendering";
+        case format::ApiCallId::ApiCall_vkCmdEndRendering:
+            return "vkCmdEndRendering";
+        case format::ApiCallId::ApiCall_vkCmdSetCullMode:
+            return "vkCmdSetCullMode";
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFace:
+            return "vkCmdSetFrontFace";
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopology:
+            return "vkCmdSetPrimitiveTopology";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCount:
+            return "vkCmdSetViewportWithCount";
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCount:
+            return "vkCmdSetScissorWithCount";
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2:
+            return "vkCmdBindVertexBuffers2";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnable:
+            return "vkCmdSetDepthTestEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnable:
+            return "vkCmdSetDepthWriteEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOp:
+            return "vkCmdSetDepthCompareOp";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnable:
+            return "vkCmdSetDepthBoundsTestEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnable:
+            return "vkCmdSetStencilTestEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOp:
+            return "vkCmdSetStencilOp";
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizerDiscardEnable:
+            return "vkCmdSetRasterizerDiscardEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBiasEnable:
+            return "vkCmdSetDepthBiasEnable";
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveRestartEnable:
+            return "vkCmdSetPrimitiveRestartEnable";
+        case format::ApiCallId::ApiCall_vkGetDeviceBufferMemoryRequirements:
+            return "vkGetDeviceBufferMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageMemoryRequirements:
+            return "vkGetDeviceImageMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageSparseMemoryRequirements:
+            return "vkGetDeviceImageSparseMemoryRequirements";
+        case format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutHostMappingInfoVALVE:
+            return "vkGetDescriptorSetLayoutHostMappingInfoVALVE";
+        case format::ApiCallId::ApiCall_vkGetDescriptorSetHostMappingVALVE:
+            return "vkGetDescriptorSetHostMappingVALVE";
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirect2KHR:
+            return "vkCmdTraceRaysIndirect2KHR";
+        case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout2EXT:
+            return "vkGetImageSubresourceLayout2EXT";
+        case format::ApiCallId::ApiCall_vkGetPipelinePropertiesEXT:
+            return "vkGetPipelinePropertiesEXT";
+        case format::ApiCallId::ApiCall_vkGetShaderModuleIdentifierEXT:
+            return "vkGetShaderModuleIdentifierEXT";
+        case format::ApiCallId::ApiCall_vkGetShaderModuleCreateInfoIdentifierEXT:
+            return "vkGetShaderModuleCreateInfoIdentifierEXT";
+        case format::ApiCallId::ApiCall_vkGetFramebufferTilePropertiesQCOM:
+            return "vkGetFramebufferTilePropertiesQCOM";
+        case format::ApiCallId::ApiCall_vkGetDynamicRenderingTilePropertiesQCOM:
+            return "vkGetDynamicRenderingTilePropertiesQCOM";
+        case format::ApiCallId::ApiCall_vkGetDeviceFaultInfoEXT:
+            return "vkGetDeviceFaultInfoEXT";
+        case format::ApiCallId::ApiCall_vkCreateMicromapEXT:
+            return "vkCreateMicromapEXT";
+        case format::ApiCallId::ApiCall_vkDestroyMicromapEXT:
+            return "vkDestroyMicromapEXT";
+        case format::ApiCallId::ApiCall_vkCmdBuildMicromapsEXT:
+            return "vkCmdBuildMicromapsEXT";
+        case format::ApiCallId::ApiCall_vkBuildMicromapsEXT:
+            return "vkBuildMicromapsEXT";
+        case format::ApiCallId::ApiCall_vkCopyMicromapEXT:
+            return "vkCopyMicromapEXT";
+        case format::ApiCallId::ApiCall_vkCopyMicromapToMemoryEXT:
+            return "vkCopyMicromapToMemoryEXT";
+        case format::ApiCallId::ApiCall_vkCopyMemoryToMicromapEXT:
+            return "vkCopyMemoryToMicromapEXT";
+        case format::ApiCallId::ApiCall_vkWriteMicromapsPropertiesEXT:
+            return "vkWriteMicromapsPropertiesEXT";
+        case format::ApiCallId::ApiCall_vkCmdCopyMicromapEXT:
+            return "vkCmdCopyMicromapEXT";
+        case format::ApiCallId::ApiCall_vkCmdCopyMicromapToMemoryEXT:
+            return "vkCmdCopyMicromapToMemoryEXT";
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToMicromapEXT:
+            return "vkCmdCopyMemoryToMicromapEXT";
+        case format::ApiCallId::ApiCall_vkCmdWriteMicromapsPropertiesEXT:
+            return "vkCmdWriteMicromapsPropertiesEXT";
+        case format::ApiCallId::ApiCall_vkGetDeviceMicromapCompatibilityEXT:
+            return "vkGetDeviceMicromapCompatibilityEXT";
+        case format::ApiCallId::ApiCall_vkGetMicromapBuildSizesEXT:
+            return "vkGetMicromapBuildSizesEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetTessellationDomainOriginEXT:
+            return "vkCmdSetTessellationDomainOriginEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClampEnableEXT:
+            return "vkCmdSetDepthClampEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetPolygonModeEXT:
+            return "vkCmdSetPolygonModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizationSamplesEXT:
+            return "vkCmdSetRasterizationSamplesEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetSampleMaskEXT:
+            return "vkCmdSetSampleMaskEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetAlphaToCoverageEnableEXT:
+            return "vkCmdSetAlphaToCoverageEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetAlphaToOneEnableEXT:
+            return "vkCmdSetAlphaToOneEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetLogicOpEnableEXT:
+            return "vkCmdSetLogicOpEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendEnableEXT:
+            return "vkCmdSetColorBlendEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendEquationEXT:
+            return "vkCmdSetColorBlendEquationEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetColorWriteMaskEXT:
+            return "vkCmdSetColorWriteMaskEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetRasterizationStreamEXT:
+            return "vkCmdSetRasterizationStreamEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetConservativeRasterizationModeEXT:
+            return "vkCmdSetConservativeRasterizationModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetExtraPrimitiveOverestimationSizeEXT:
+            return "vkCmdSetExtraPrimitiveOverestimationSizeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClipEnableEXT:
+            return "vkCmdSetDepthClipEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEnableEXT:
+            return "vkCmdSetSampleLocationsEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetColorBlendAdvancedEXT:
+            return "vkCmdSetColorBlendAdvancedEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetProvokingVertexModeEXT:
+            return "vkCmdSetProvokingVertexModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetLineRasterizationModeEXT:
+            return "vkCmdSetLineRasterizationModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEnableEXT:
+            return "vkCmdSetLineStippleEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClipNegativeOneToOneEXT:
+            return "vkCmdSetDepthClipNegativeOneToOneEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingEnableNV:
+            return "vkCmdSetViewportWScalingEnableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetViewportSwizzleNV:
+            return "vkCmdSetViewportSwizzleNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorEnableNV:
+            return "vkCmdSetCoverageToColorEnableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageToColorLocationNV:
+            return "vkCmdSetCoverageToColorLocationNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationModeNV:
+            return "vkCmdSetCoverageModulationModeNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableEnableNV:
+            return "vkCmdSetCoverageModulationTableEnableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageModulationTableNV:
+            return "vkCmdSetCoverageModulationTableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetShadingRateImageEnableNV:
+            return "vkCmdSetShadingRateImageEnableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetRepresentativeFragmentTestEnableNV:
+            return "vkCmdSetRepresentativeFragmentTestEnableNV";
+        case format::ApiCallId::ApiCall_vkCmdSetCoverageReductionModeNV:
+            return "vkCmdSetCoverageReductionModeNV";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceOpticalFlowImageFormatsNV:
+            return "vkGetPhysicalDeviceOpticalFlowImageFormatsNV";
+        case format::ApiCallId::ApiCall_vkCreateOpticalFlowSessionNV:
+            return "vkCreateOpticalFlowSessionNV";
+        case format::ApiCallId::ApiCall_vkDestroyOpticalFlowSessionNV:
+            return "vkDestroyOpticalFlowSessionNV";
+        case format::ApiCallId::ApiCall_vkBindOpticalFlowSessionImageNV:
+            return "vkBindOpticalFlowSessionImageNV";
+        case format::ApiCallId::ApiCall_vkCmdOpticalFlowExecuteNV:
+            return "vkCmdOpticalFlowExecuteNV";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksEXT:
+            return "vkCmdDrawMeshTasksEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectEXT:
+            return "vkCmdDrawMeshTasksIndirectEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountEXT:
+            return "vkCmdDrawMeshTasksIndirectCountEXT";
+        case format::ApiCallId::ApiCall_vkReleaseSwapchainImagesEXT:
+            return "vkReleaseSwapchainImagesEXT";
+        case format::ApiCallId::ApiCall_vkCmdDrawClusterHUAWEI:
+            return "vkCmdDrawClusterHUAWEI";
+        case format::ApiCallId::ApiCall_vkCmdDrawClusterIndirectHUAWEI:
+            return "vkCmdDrawClusterIndirectHUAWEI";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceVideoCapabilitiesKHR:
+            return "vkGetPhysicalDeviceVideoCapabilitiesKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceVideoFormatPropertiesKHR:
+            return "vkGetPhysicalDeviceVideoFormatPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionKHR:
+            return "vkCreateVideoSessionKHR";
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionKHR:
+            return "vkDestroyVideoSessionKHR";
+        case format::ApiCallId::ApiCall_vkGetVideoSessionMemoryRequirementsKHR:
+            return "vkGetVideoSessionMemoryRequirementsKHR";
+        case format::ApiCallId::ApiCall_vkBindVideoSessionMemoryKHR:
+            return "vkBindVideoSessionMemoryKHR";
+        case format::ApiCallId::ApiCall_vkCreateVideoSessionParametersKHR:
+            return "vkCreateVideoSessionParametersKHR";
+        case format::ApiCallId::ApiCall_vkUpdateVideoSessionParametersKHR:
+            return "vkUpdateVideoSessionParametersKHR";
+        case format::ApiCallId::ApiCall_vkDestroyVideoSessionParametersKHR:
+            return "vkDestroyVideoSessionParametersKHR";
+        case format::ApiCallId::ApiCall_vkCmdBeginVideoCodingKHR:
+            return "vkCmdBeginVideoCodingKHR";
+        case format::ApiCallId::ApiCall_vkCmdEndVideoCodingKHR:
+            return "vkCmdEndVideoCodingKHR";
+        case format::ApiCallId::ApiCall_vkCmdControlVideoCodingKHR:
+            return "vkCmdControlVideoCodingKHR";
+        case format::ApiCallId::ApiCall_vkCmdDecodeVideoKHR:
+            return "vkCmdDecodeVideoKHR";
+        case format::ApiCallId::ApiCall_vkCmdEncodeVideoKHR:
+            return "vkCmdEncodeVideoKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEnableEXT:
+            return "vkCmdSetDiscardRectangleEnableEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleModeEXT:
+            return "vkCmdSetDiscardRectangleModeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorEnableNV:
+            return "vkCmdSetExclusiveScissorEnableNV";
+        case format::ApiCallId::ApiCall_vkMapMemory2KHR:
+            return "vkMapMemory2KHR";
+        case format::ApiCallId::ApiCall_vkUnmapMemory2KHR:
+            return "vkUnmapMemory2KHR";
+        case format::ApiCallId::ApiCall_vkCreateShadersEXT:
+            return "vkCreateShadersEXT";
+        case format::ApiCallId::ApiCall_vkDestroyShaderEXT:
+            return "vkDestroyShaderEXT";
+        case format::ApiCallId::ApiCall_vkGetShaderBinaryDataEXT:
+            return "vkGetShaderBinaryDataEXT";
+        case format::ApiCallId::ApiCall_vkCmdBindShadersEXT:
+            return "vkCmdBindShadersEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetAttachmentFeedbackLoopEnableEXT:
+            return "vkCmdSetAttachmentFeedbackLoopEnableEXT";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR:
+            return "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkGetEncodedVideoSessionParametersKHR:
+            return "vkGetEncodedVideoSessionParametersKHR";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR:
+            return "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias2EXT:
+            return "vkCmdSetDepthBias2EXT";
+        case format::ApiCallId::ApiCall_vkCopyMemoryToImageEXT:
+            return "vkCopyMemoryToImageEXT";
+        case format::ApiCallId::ApiCall_vkCopyImageToMemoryEXT:
+            return "vkCopyImageToMemoryEXT";
+        case format::ApiCallId::ApiCall_vkCopyImageToImageEXT:
+            return "vkCopyImageToImageEXT";
+        case format::ApiCallId::ApiCall_vkTransitionImageLayoutEXT:
+            return "vkTransitionImageLayoutEXT";
+        case format::ApiCallId::ApiCall_vkGetPipelineIndirectMemoryRequirementsNV:
+            return "vkGetPipelineIndirectMemoryRequirementsNV";
+        case format::ApiCallId::ApiCall_vkCmdUpdatePipelineIndirectBuffer:
+            return "vkCmdUpdatePipelineIndirectBuffer";
+        case format::ApiCallId::ApiCall_vkGetPipelineIndirectDeviceAddressNV:
+            return "vkGetPipelineIndirectDeviceAddressNV";
+        case format::ApiCallId::ApiCall_vkCmdUpdatePipelineIndirectBufferNV:
+            return "vkCmdUpdatePipelineIndirectBufferNV";
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer2KHR:
+            return "vkCmdBindIndexBuffer2KHR";
+        case format::ApiCallId::ApiCall_vkGetRenderingAreaGranularityKHR:
+            return "vkGetRenderingAreaGranularityKHR";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageSubresourceLayoutKHR:
+            return "vkGetDeviceImageSubresourceLayoutKHR";
+        case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout2KHR:
+            return "vkGetImageSubresourceLayout2KHR";
+        case format::ApiCallId::ApiCall_vkFrameBoundaryANDROID:
+            return "vkFrameBoundaryANDROID";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR:
+            return "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR";
+        case format::ApiCallId::ApiCall_vkGetCalibratedTimestampsKHR:
+            return "vkGetCalibratedTimestampsKHR";
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2KHR:
+            return "vkCmdBindDescriptorSets2KHR";
+        case format::ApiCallId::ApiCall_vkCmdPushConstants2KHR:
+            return "vkCmdPushConstants2KHR";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet2KHR:
+            return "vkCmdPushDescriptorSet2KHR";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplate2KHR:
+            return "vkCmdPushDescriptorSetWithTemplate2KHR";
+        case format::ApiCallId::ApiCall_vkCmdSetDescriptorBufferOffsets2EXT:
+            return "vkCmdSetDescriptorBufferOffsets2EXT";
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT:
+            return "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT";
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingAttachmentLocationsKHR:
+            return "vkCmdSetRenderingAttachmentLocationsKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingInputAttachmentIndicesKHR:
+            return "vkCmdSetRenderingInputAttachmentIndicesKHR";
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleKHR:
+            return "vkCmdSetLineStippleKHR";
+        case format::ApiCallId::ApiCall_vkSetLatencySleepModeNV:
+            return "vkSetLatencySleepModeNV";
+        case format::ApiCallId::ApiCall_vkLatencySleepNV:
+            return "vkLatencySleepNV";
+        case format::ApiCallId::ApiCall_vkSetLatencyMarkerNV:
+            return "vkSetLatencyMarkerNV";
+        case format::ApiCallId::ApiCall_vkGetLatencyTimingsNV:
+            return "vkGetLatencyTimingsNV";
+        case format::ApiCallId::ApiCall_vkQueueNotifyOutOfBandNV:
+            return "vkQueueNotifyOutOfBandNV";
+        case format::ApiCallId::ApiCall_vkCreatePipelineBinariesKHR:
+            return "vkCreatePipelineBinariesKHR";
+        case format::ApiCallId::ApiCall_vkDestroyPipelineBinaryKHR:
+            return "vkDestroyPipelineBinaryKHR";
+        case format::ApiCallId::ApiCall_vkGetPipelineBinaryDataKHR:
+            return "vkGetPipelineBinaryDataKHR";
+        case format::ApiCallId::ApiCall_vkGetPipelineKeyKHR:
+            return "vkGetPipelineKeyKHR";
+        case format::ApiCallId::ApiCall_vkReleaseCapturedPipelineDataKHR:
+            return "vkReleaseCapturedPipelineDataKHR";
+        case format::ApiCallId::ApiCall_vkAntiLagUpdateAMD:
+            return "vkAntiLagUpdateAMD";
+        case format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsEXT:
+            return "vkGetGeneratedCommandsMemoryRequirementsEXT";
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsEXT:
+            return "vkCmdPreprocessGeneratedCommandsEXT";
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsEXT:
+            return "vkCmdExecuteGeneratedCommandsEXT";
+        case format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutEXT:
+            return "vkCreateIndirectCommandsLayoutEXT";
+        case format::ApiCallId::ApiCall_vkDestroyIndirectCommandsLayoutEXT:
+            return "vkDestroyIndirectCommandsLayoutEXT";
+        case format::ApiCallId::ApiCall_vkCreateIndirectExecutionSetEXT:
+            return "vkCreateIndirectExecutionSetEXT";
+        case format::ApiCallId::ApiCall_vkDestroyIndirectExecutionSetEXT:
+            return "vkDestroyIndirectExecutionSetEXT";
+        case format::ApiCallId::ApiCall_vkUpdateIndirectExecutionSetPipelineEXT:
+            return "vkUpdateIndirectExecutionSetPipelineEXT";
+        case format::ApiCallId::ApiCall_vkUpdateIndirectExecutionSetShaderEXT:
+            return "vkUpdateIndirectExecutionSetShaderEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetDepthClampRangeEXT:
+            return "vkCmdSetDepthClampRangeEXT";
+        case format::ApiCallId::ApiCall_vkCmdSetLineStipple:
+            return "vkCmdSetLineStipple";
+        case format::ApiCallId::ApiCall_vkMapMemory2:
+            return "vkMapMemory2";
+        case format::ApiCallId::ApiCall_vkUnmapMemory2:
+            return "vkUnmapMemory2";
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer2:
+            return "vkCmdBindIndexBuffer2";
+        case format::ApiCallId::ApiCall_vkGetRenderingAreaGranularity:
+            return "vkGetRenderingAreaGranularity";
+        case format::ApiCallId::ApiCall_vkGetDeviceImageSubresourceLayout:
+            return "vkGetDeviceImageSubresourceLayout";
+        case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout2:
+            return "vkGetImageSubresourceLayout2";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet:
+            return "vkCmdPushDescriptorSet";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplate:
+            return "vkCmdPushDescriptorSetWithTemplate";
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingAttachmentLocations:
+            return "vkCmdSetRenderingAttachmentLocations";
+        case format::ApiCallId::ApiCall_vkCmdSetRenderingInputAttachmentIndices:
+            return "vkCmdSetRenderingInputAttachmentIndices";
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets2:
+            return "vkCmdBindDescriptorSets2";
+        case format::ApiCallId::ApiCall_vkCmdPushConstants2:
+            return "vkCmdPushConstants2";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSet2:
+            return "vkCmdPushDescriptorSet2";
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplate2:
+            return "vkCmdPushDescriptorSetWithTemplate2";
+        case format::ApiCallId::ApiCall_vkCopyMemoryToImage:
+            return "vkCopyMemoryToImage";
+        case format::ApiCallId::ApiCall_vkCopyImageToMemory:
+            return "vkCopyImageToMemory";
+        case format::ApiCallId::ApiCall_vkCopyImageToImage:
+            return "vkCopyImageToImage";
+        case format::ApiCallId::ApiCall_vkTransitionImageLayout:
+            return "vkTransitionImageLayout";
+        case format::ApiCallId::ApiCall_vkGetImageViewHandle64NVX:
+            return "vkGetImageViewHandle64NVX";
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV:
+            return "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV";
+        case format::ApiCallId::ApiCall_CreateDXGIFactory:
+            return "CreateDXGIFactory";
+        case format::ApiCallId::ApiCall_CreateDXGIFactory1:
+            return "CreateDXGIFactory1";
+        case format::ApiCallId::ApiCall_IDXGIObject_SetPrivateData:
+            return "IDXGIObject_SetPrivateData";
+        case format::ApiCallId::ApiCall_IDXGIObject_SetPrivateDataInterface:
+            return "IDXGIObject_SetPrivateDataInterface";
+        case format::ApiCallId::ApiCall_IDXGIObject_GetPrivateData:
+            return "IDXGIObject_GetPrivateData";
+        case format::ApiCallId::ApiCall_IDXGIObject_GetParent:
+            return "IDXGIObject_GetParent";
+        case format::ApiCallId::ApiCall_IDXGIDeviceSubObject_GetDevice:
+            return "IDXGIDeviceSubObject_GetDevice";
+        case format::ApiCallId::ApiCall_IDXGIResource_GetSharedHandle:
+            return "IDXGIResource_GetSharedHandle";
+        case format::ApiCallId::ApiCall_IDXGIResource_GetUsage:
+            return "IDXGIResource_GetUsage";
+        case format::ApiCallId::ApiCall_IDXGIResource_SetEvictionPriority:
+            return "IDXGIResource_SetEvictionPriority";
+        case format::ApiCallId::ApiCall_IDXGIResource_GetEvictionPriority:
+            return "IDXGIResource_GetEvictionPriority";
+        case format::ApiCallId::ApiCall_IDXGIKeyedMutex_AcquireSync:
+            return "IDXGIKeyedMutex_AcquireSync";
+        case format::ApiCallId::ApiCall_IDXGIKeyedMutex_ReleaseSync:
+            return "IDXGIKeyedMutex_ReleaseSync";
+        case format::ApiCallId::ApiCall_IDXGISurface_GetDesc:
+            return "IDXGISurface_GetDesc";
+        case format::ApiCallId::ApiCall_IDXGISurface_Map:
+            return "IDXGISurface_Map";
+        case format::ApiCallId::ApiCall_IDXGISurface_Unmap:
+            return "IDXGISurface_Unmap";
+        case format::ApiCallId::ApiCall_IDXGISurface1_GetDC:
+            return "IDXGISurface1_GetDC";
+        case format::ApiCallId::ApiCall_IDXGISurface1_ReleaseDC:
+            return "IDXGISurface1_ReleaseDC";
+        case format::ApiCallId::ApiCall_IDXGIAdapter_EnumOutputs:
+            return "IDXGIAdapter_EnumOutputs";
+        case format::ApiCallId::ApiCall_IDXGIAdapter_GetDesc:
+            return "IDXGIAdapter_GetDesc";
+        case format::ApiCallId::ApiCall_IDXGIAdapter_CheckInterfaceSupport:
+            return "IDXGIAdapter_CheckInterfaceSupport";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetDesc:
+            return "IDXGIOutput_GetDesc";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetDisplayModeList:
+            return "IDXGIOutput_GetDisplayModeList";
+        case format::ApiCallId::ApiCall_IDXGIOutput_FindClosestMatchingMode:
+            return "IDXGIOutput_FindClosestMatchingMode";
+        case format::ApiCallId::ApiCall_IDXGIOutput_WaitForVBlank:
+            return "IDXGIOutput_WaitForVBlank";
+        case format::ApiCallId::ApiCall_IDXGIOutput_TakeOwnership:
+            return "IDXGIOutput_TakeOwnership";
+        case format::ApiCallId::ApiCall_IDXGIOutput_ReleaseOwnership:
+            return "IDXGIOutput_ReleaseOwnership";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetGammaControlCapabilities:
+            return "IDXGIOutput_GetGammaControlCapabilities";
+        case format::ApiCallId::ApiCall_IDXGIOutput_SetGammaControl:
+            return "IDXGIOutput_SetGammaControl";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetGammaControl:
+            return "IDXGIOutput_GetGammaControl";
+        case format::ApiCallId::ApiCall_IDXGIOutput_SetDisplaySurface:
+            return "IDXGIOutput_SetDisplaySurface";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetDisplaySurfaceData:
+            return "IDXGIOutput_GetDisplaySurfaceData";
+        case format::ApiCallId::ApiCall_IDXGIOutput_GetFrameStatistics:
+            return "IDXGIOutput_GetFrameStatistics";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_Present:
+            return "IDXGISwapChain_Present";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetBuffer:
+            return "IDXGISwapChain_GetBuffer";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_SetFullscreenState:
+            return "IDXGISwapChain_SetFullscreenState";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetFullscreenState:
+            return "IDXGISwapChain_GetFullscreenState";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetDesc:
+            return "IDXGISwapChain_GetDesc";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_ResizeBuffers:
+            return "IDXGISwapChain_ResizeBuffers";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_ResizeTarget:
+            return "IDXGISwapChain_ResizeTarget";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetContainingOutput:
+            return "IDXGISwapChain_GetContainingOutput";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetFrameStatistics:
+            return "IDXGISwapChain_GetFrameStatistics";
+        case format::ApiCallId::ApiCall_IDXGISwapChain_GetLastPresentCount:
+            return "IDXGISwapChain_GetLastPresentCount";
+        case format::ApiCallId::ApiCall_IDXGIFactory_EnumAdapters:
+            return "IDXGIFactory_EnumAdapters";
+        case format::ApiCallId::ApiCall_IDXGIFactory_MakeWindowAssociation:
+            return "IDXGIFactory_MakeWindowAssociation";
+        case format::ApiCallId::ApiCall_IDXGIFactory_GetWindowAssociation:
+            return "IDXGIFactory_GetWindowAssociation";
+        case format::ApiCallId::ApiCall_IDXGIFactory_CreateSwapChain:
+            return "IDXGIFactory_CreateSwapChain";
+        case format::ApiCallId::ApiCall_IDXGIFactory_CreateSoftwareAdapter:
+            return "IDXGIFactory_CreateSoftwareAdapter";
+        case format::ApiCallId::ApiCall_IDXGIDevice_GetAdapter:
+            return "IDXGIDevice_GetAdapter";
+        case format::ApiCallId::ApiCall_IDXGIDevice_CreateSurface:
+            return "IDXGIDevice_CreateSurface";
+        case format::ApiCallId::ApiCall_IDXGIDevice_QueryResourceResidency:
+            return "IDXGIDevice_QueryResourceResidency";
+        case format::ApiCallId::ApiCall_IDXGIDevice_SetGPUThreadPriority:
+            return "IDXGIDevice_SetGPUThreadPriority";
+        case format::ApiCallId::ApiCall_IDXGIDevice_GetGPUThreadPriority:
+            return "IDXGIDevice_GetGPUThreadPriority";
+        case format::ApiCallId::ApiCall_IDXGIFactory1_EnumAdapters1:
+            return "IDXGIFactory1_EnumAdapters1";
+        case format::ApiCallId::ApiCall_IDXGIFactory1_IsCurrent:
+            return "IDXGIFactory1_IsCurrent";
+        case format::ApiCallId::ApiCall_IDXGIAdapter1_GetDesc1:
+            return "IDXGIAdapter1_GetDesc1";
+        case format::ApiCallId::ApiCall_IDXGIDevice1_SetMaximumFrameLatency:
+            return "IDXGIDevice1_SetMaximumFrameLatency";
+        case format::ApiCallId::ApiCall_IDXGIDevice1_GetMaximumFrameLatency:
+            return "IDXGIDevice1_GetMaximumFrameLatency";
+        case format::ApiCallId::ApiCall_IDXGIDisplayControl_IsStereoEnabled:
+            return "IDXGIDisplayControl_IsStereoEnabled";
+        case format::ApiCallId::ApiCall_IDXGIDisplayControl_SetStereoEnabled:
+            return "IDXGIDisplayControl_SetStereoEnabled";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_GetDesc:
+            return "IDXGIOutputDuplication_GetDesc";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_AcquireNextFrame:
+            return "IDXGIOutputDuplication_AcquireNextFrame";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_GetFrameDirtyRects:
+            return "IDXGIOutputDuplication_GetFrameDirtyRects";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_GetFrameMoveRects:
+            return "IDXGIOutputDuplication_GetFrameMoveRects";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_GetFramePointerShape:
+            return "IDXGIOutputDuplication_GetFramePointerShape";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_MapDesktopSurface:
+            return "IDXGIOutputDuplication_MapDesktopSurface";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_UnMapDesktopSurface:
+            return "IDXGIOutputDuplication_UnMapDesktopSurface";
+        case format::ApiCallId::ApiCall_IDXGIOutputDuplication_ReleaseFrame:
+            return "IDXGIOutputDuplication_ReleaseFrame";
+        case format::ApiCallId::ApiCall_IDXGISurface2_GetResource:
+            return "IDXGISurface2_GetResource";
+        case format::ApiCallId::ApiCall_IDXGIResource1_CreateSubresourceSurface:
+            return "IDXGIResource1_CreateSubresourceSurface";
+        case format::ApiCallId::ApiCall_IDXGIResource1_CreateSharedHandle:
+            return "IDXGIResource1_CreateSharedHandle";
+        case format::ApiCallId::ApiCall_IDXGIDevice2_OfferResources:
+            return "IDXGIDevice2_OfferResources";
+        case format::ApiCallId::ApiCall_IDXGIDevice2_ReclaimResources:
+            return "IDXGIDevice2_ReclaimResources";
+        case format::ApiCallId::ApiCall_IDXGIDevice2_EnqueueSetEvent:
+            return "IDXGIDevice2_EnqueueSetEvent";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetDesc1:
+            return "IDXGISwapChain1_GetDesc1";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetFullscreenDesc:
+            return "IDXGISwapChain1_GetFullscreenDesc";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetHwnd:
+            return "IDXGISwapChain1_GetHwnd";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetCoreWindow:
+            return "IDXGISwapChain1_GetCoreWindow";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_Present1:
+            return "IDXGISwapChain1_Present1";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_IsTemporaryMonoSupported:
+            return "IDXGISwapChain1_IsTemporaryMonoSupported";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetRestrictToOutput:
+            return "IDXGISwapChain1_GetRestrictToOutput";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_SetBackgroundColor:
+            return "IDXGISwapChain1_SetBackgroundColor";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetBackgroundColor:
+            return "IDXGISwapChain1_GetBackgroundColor";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_SetRotation:
+            return "IDXGISwapChain1_SetRotation";
+        case format::ApiCallId::ApiCall_IDXGISwapChain1_GetRotation:
+            return "IDXGISwapChain1_GetRotation";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_IsWindowedStereoEnabled:
+            return "IDXGIFactory2_IsWindowedStereoEnabled";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_CreateSwapChainForHwnd:
+            return "IDXGIFactory2_CreateSwapChainForHwnd";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_CreateSwapChainForCoreWindow:
+            return "IDXGIFactory2_CreateSwapChainForCoreWindow";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_GetSharedResourceAdapterLuid:
+            return "IDXGIFactory2_GetSharedResourceAdapterLuid";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_RegisterStereoStatusWindow:
+            return "IDXGIFactory2_RegisterStereoStatusWindow";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_RegisterStereoStatusEvent:
+            return "IDXGIFactory2_RegisterStereoStatusEvent";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_UnregisterStereoStatus:
+            return "IDXGIFactory2_UnregisterStereoStatus";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_RegisterOcclusionStatusWindow:
+            return "IDXGIFactory2_RegisterOcclusionStatusWindow";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_RegisterOcclusionStatusEvent:
+            return "IDXGIFactory2_RegisterOcclusionStatusEvent";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_UnregisterOcclusionStatus:
+            return "IDXGIFactory2_UnregisterOcclusionStatus";
+        case format::ApiCallId::ApiCall_IDXGIFactory2_CreateSwapChainForComposition:
+            return "IDXGIFactory2_CreateSwapChainForComposition";
+        case format::ApiCallId::ApiCall_IDXGIAdapter2_GetDesc2:
+            return "IDXGIAdapter2_GetDesc2";
+        case format::ApiCallId::ApiCall_IDXGIOutput1_GetDisplayModeList1:
+            return "IDXGIOutput1_GetDisplayModeList1";
+        case format::ApiCallId::ApiCall_IDXGIOutput1_FindClosestMatchingMode1:
+            return "IDXGIOutput1_FindClosestMatchingMode1";
+        case format::ApiCallId::ApiCall_IDXGIOutput1_GetDisplaySurfaceData1:
+            return "IDXGIOutput1_GetDisplaySurfaceData1";
+        case format::ApiCallId::ApiCall_IDXGIOutput1_DuplicateOutput:
+            return "IDXGIOutput1_DuplicateOutput";
+        case format::ApiCallId::ApiCall_CreateDXGIFactory2:
+            return "CreateDXGIFactory2";
+        case format::ApiCallId::ApiCall_DXGIGetDebugInterface1:
+            return "DXGIGetDebugInterface1";
+        case format::ApiCallId::ApiCall_IDXGIDevice3_Trim:
+            return "IDXGIDevice3_Trim";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_SetSourceSize:
+            return "IDXGISwapChain2_SetSourceSize";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_GetSourceSize:
+            return "IDXGISwapChain2_GetSourceSize";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_SetMaximumFrameLatency:
+            return "IDXGISwapChain2_SetMaximumFrameLatency";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_GetMaximumFrameLatency:
+            return "IDXGISwapChain2_GetMaximumFrameLatency";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_GetFrameLatencyWaitableObject:
+            return "IDXGISwapChain2_GetFrameLatencyWaitableObject";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_SetMatrixTransform:
+            return "IDXGISwapChain2_SetMatrixTransform";
+        case format::ApiCallId::ApiCall_IDXGISwapChain2_GetMatrixTransform:
+            return "IDXGISwapChain2_GetMatrixTransform";
+        case format::ApiCallId::ApiCall_IDXGIOutput2_SupportsOverlays:
+            return "IDXGIOutput2_SupportsOverlays";
+        case format::ApiCallId::ApiCall_IDXGIFactory3_GetCreationFlags:
+            return "IDXGIFactory3_GetCreationFlags";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_PresentBuffer:
+            return "IDXGIDecodeSwapChain_PresentBuffer";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_SetSourceRect:
+            return "IDXGIDecodeSwapChain_SetSourceRect";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_SetTargetRect:
+            return "IDXGIDecodeSwapChain_SetTargetRect";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_SetDestSize:
+            return "IDXGIDecodeSwapChain_SetDestSize";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_GetSourceRect:
+            return "IDXGIDecodeSwapChain_GetSourceRect";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_GetTargetRect:
+            return "IDXGIDecodeSwapChain_GetTargetRect";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_GetDestSize:
+            return "IDXGIDecodeSwapChain_GetDestSize";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_SetColorSpace:
+            return "IDXGIDecodeSwapChain_SetColorSpace";
+        case format::ApiCallId::ApiCall_IDXGIDecodeSwapChain_GetColorSpace:
+            return "IDXGIDecodeSwapChain_GetColorSpace";
+        case format::ApiCallId::ApiCall_IDXGIFactoryMedia_CreateSwapChainForCompositionSurfaceHandle:
+            return "IDXGIFactoryMedia_CreateSwapChainForCompositionSurfaceHandle";
+        case format::ApiCallId::ApiCall_IDXGIFactoryMedia_CreateDecodeSwapChainForCompositionSurfaceHandle:
+            return "IDXGIFactoryMedia_CreateDecodeSwapChainForCompositionSurfaceHandle";
+        case format::ApiCallId::ApiCall_IDXGISwapChainMedia_GetFrameStatisticsMedia:
+            return "IDXGISwapChainMedia_GetFrameStatisticsMedia";
+        case format::ApiCallId::ApiCall_IDXGISwapChainMedia_SetPresentDuration:
+            return "IDXGISwapChainMedia_SetPresentDuration";
+        case format::ApiCallId::ApiCall_IDXGISwapChainMedia_CheckPresentDurationSupport:
+            return "IDXGISwapChainMedia_CheckPresentDurationSupport";
+        case format::ApiCallId::ApiCall_IDXGIOutput3_CheckOverlaySupport:
+            return "IDXGIOutput3_CheckOverlaySupport";
+        case format::ApiCallId::ApiCall_IDXGISwapChain3_GetCurrentBackBufferIndex:
+            return "IDXGISwapChain3_GetCurrentBackBufferIndex";
+        case format::ApiCallId::ApiCall_IDXGISwapChain3_CheckColorSpaceSupport:
+            return "IDXGISwapChain3_CheckColorSpaceSupport";
+        case format::ApiCallId::ApiCall_IDXGISwapChain3_SetColorSpace1:
+            return "IDXGISwapChain3_SetColorSpace1";
+        case format::ApiCallId::ApiCall_IDXGISwapChain3_ResizeBuffers1:
+            return "IDXGISwapChain3_ResizeBuffers1";
+        case format::ApiCallId::ApiCall_IDXGIOutput4_CheckOverlayColorSpaceSupport:
+            return "IDXGIOutput4_CheckOverlayColorSpaceSupport";
+        case format::ApiCallId::ApiCall_IDXGIFactory4_EnumAdapterByLuid:
+            return "IDXGIFactory4_EnumAdapterByLuid";
+        case format::ApiCallId::ApiCall_IDXGIFactory4_EnumWarpAdapter:
+            return "IDXGIFactory4_EnumWarpAdapter";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_RegisterHardwareContentProtectionTeardownStatusEvent:
+            return "IDXGIAdapter3_RegisterHardwareContentProtectionTeardownStatusEvent";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_UnregisterHardwareContentProtectionTeardownStatus:
+            return "IDXGIAdapter3_UnregisterHardwareContentProtectionTeardownStatus";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_QueryVideoMemoryInfo:
+            return "IDXGIAdapter3_QueryVideoMemoryInfo";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_SetVideoMemoryReservation:
+            return "IDXGIAdapter3_SetVideoMemoryReservation";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNotificationEvent:
+            return "IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNotificationEvent";
+        case format::ApiCallId::ApiCall_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNotification:
+            return "IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNotification";
+        case format::ApiCallId::ApiCall_IDXGIOutput5_DuplicateOutput1:
+            return "IDXGIOutput5_DuplicateOutput1";
+        case format::ApiCallId::ApiCall_IDXGISwapChain4_SetHDRMetaData:
+            return "IDXGISwapChain4_SetHDRMetaData";
+        case format::ApiCallId::ApiCall_IDXGIDevice4_OfferResources1:
+            return "IDXGIDevice4_OfferResources1";
+        case format::ApiCallId::ApiCall_IDXGIDevice4_ReclaimResources1:
+            return "IDXGIDevice4_ReclaimResources1";
+        case format::ApiCallId::ApiCall_IDXGIFactory5_CheckFeatureSupport:
+            return "IDXGIFactory5_CheckFeatureSupport";
+        case format::ApiCallId::ApiCall_DXGIDeclareAdapterRemovalSupport:
+            return "DXGIDeclareAdapterRemovalSupport";
+        case format::ApiCallId::ApiCall_IDXGIAdapter4_GetDesc3:
+            return "IDXGIAdapter4_GetDesc3";
+        case format::ApiCallId::ApiCall_IDXGIOutput6_GetDesc1:
+            return "IDXGIOutput6_GetDesc1";
+        case format::ApiCallId::ApiCall_IDXGIOutput6_CheckHardwareCompositionSupport:
+            return "IDXGIOutput6_CheckHardwareCompositionSupport";
+        case format::ApiCallId::ApiCall_IDXGIFactory6_EnumAdapterByGpuPreference:
+            return "IDXGIFactory6_EnumAdapterByGpuPreference";
+        case format::ApiCallId::ApiCall_IDXGIFactory7_RegisterAdaptersChangedEvent:
+            return "IDXGIFactory7_RegisterAdaptersChangedEvent";
+        case format::ApiCallId::ApiCall_IDXGIFactory7_UnregisterAdaptersChangedEvent:
+            return "IDXGIFactory7_UnregisterAdaptersChangedEvent";
+        case format::ApiCallId::ApiCall_IUnknown_QueryInterface:
+            return "IUnknown_QueryInterface";
+        case format::ApiCallId::ApiCall_IUnknown_AddRef:
+            return "IUnknown_AddRef";
+        case format::ApiCallId::ApiCall_IUnknown_Release:
+            return "IUnknown_Release";
+        case format::ApiCallId::ApiCall_D3D12SerializeRootSignature:
+            return "D3D12SerializeRootSignature";
+        case format::ApiCallId::ApiCall_D3D12CreateRootSignatureDeserializer:
+            return "D3D12CreateRootSignatureDeserializer";
+        case format::ApiCallId::ApiCall_D3D12SerializeVersionedRootSignature:
+            return "D3D12SerializeVersionedRootSignature";
+        case format::ApiCallId::ApiCall_D3D12CreateVersionedRootSignatureDeserializer:
+            return "D3D12CreateVersionedRootSignatureDeserializer";
+        case format::ApiCallId::ApiCall_D3D12CreateDevice:
+            return "D3D12CreateDevice";
+        case format::ApiCallId::ApiCall_D3D12GetDebugInterface:
+            return "D3D12GetDebugInterface";
+        case format::ApiCallId::ApiCall_D3D12EnableExperimentalFeatures:
+            return "D3D12EnableExperimentalFeatures";
+        case format::ApiCallId::ApiCall_ID3D12Object_GetPrivateData:
+            return "ID3D12Object_GetPrivateData";
+        case format::ApiCallId::ApiCall_ID3D12Object_SetPrivateData:
+            return "ID3D12Object_SetPrivateData";
+        case format::ApiCallId::ApiCall_ID3D12Object_SetPrivateDataInterface:
+            return "ID3D12Object_SetPrivateDataInterface";
+        case format::ApiCallId::ApiCall_ID3D12Object_SetName:
+            return "ID3D12Object_SetName";
+        case format::ApiCallId::ApiCall_ID3D12DeviceChild_GetDevice:
+            return "ID3D12DeviceChild_GetDevice";
+        case format::ApiCallId::ApiCall_ID3D12RootSignatureDeserializer_GetRootSignatureDesc:
+            return "ID3D12RootSignatureDeserializer_GetRootSignatureDesc";
+        case format::ApiCallId::ApiCall_ID3D12VersionedRootSignatureDeserializer_GetRootSignatureDescAtVersion:
+            return "ID3D12VersionedRootSignatureDeserializer_GetRootSignatureDescAtVersion";
+        case format::ApiCallId::ApiCall_ID3D12VersionedRootSignatureDeserializer_GetUnconvertedRootSignatureDesc:
+            return "ID3D12VersionedRootSignatureDeserializer_GetUnconvertedRootSignatureDesc";
+        case format::ApiCallId::ApiCall_ID3D12Heap_GetDesc:
+            return "ID3D12Heap_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12Resource_Map:
+            return "ID3D12Resource_Map";
+        case format::ApiCallId::ApiCall_ID3D12Resource_Unmap:
+            return "ID3D12Resource_Unmap";
+        case format::ApiCallId::ApiCall_ID3D12Resource_GetDesc:
+            return "ID3D12Resource_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12Resource_GetGPUVirtualAddress:
+            return "ID3D12Resource_GetGPUVirtualAddress";
+        case format::ApiCallId::ApiCall_ID3D12Resource_WriteToSubresource:
+            return "ID3D12Resource_WriteToSubresource";
+        case format::ApiCallId::ApiCall_ID3D12Resource_ReadFromSubresource:
+            return "ID3D12Resource_ReadFromSubresource";
+        case format::ApiCallId::ApiCall_ID3D12Resource_GetHeapProperties:
+            return "ID3D12Resource_GetHeapProperties";
+        case format::ApiCallId::ApiCall_ID3D12CommandAllocator_Reset:
+            return "ID3D12CommandAllocator_Reset";
+        case format::ApiCallId::ApiCall_ID3D12Fence_GetCompletedValue:
+            return "ID3D12Fence_GetCompletedValue";
+        case format::ApiCallId::ApiCall_ID3D12Fence_SetEventOnCompletion:
+            return "ID3D12Fence_SetEventOnCompletion";
+        case format::ApiCallId::ApiCall_ID3D12Fence_Signal:
+            return "ID3D12Fence_Signal";
+        case format::ApiCallId::ApiCall_ID3D12Fence1_GetCreationFlags:
+            return "ID3D12Fence1_GetCreationFlags";
+        case format::ApiCallId::ApiCall_ID3D12PipelineState_GetCachedBlob:
+            return "ID3D12PipelineState_GetCachedBlob";
+        case format::ApiCallId::ApiCall_ID3D12DescriptorHeap_GetDesc:
+            return "ID3D12DescriptorHeap_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapStart:
+            return "ID3D12DescriptorHeap_GetCPUDescriptorHandleForHeapStart";
+        case format::ApiCallId::ApiCall_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHeapStart:
+            return "ID3D12DescriptorHeap_GetGPUDescriptorHandleForHeapStart";
+        case format::ApiCallId::ApiCall_ID3D12CommandList_GetType:
+            return "ID3D12CommandList_GetType";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_Close:
+            return "ID3D12GraphicsCommandList_Close";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_Reset:
+            return "ID3D12GraphicsCommandList_Reset";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ClearState:
+            return "ID3D12GraphicsCommandList_ClearState";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawInstanced:
+            return "ID3D12GraphicsCommandList_DrawInstanced";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawIndexedInstanced:
+            return "ID3D12GraphicsCommandList_DrawIndexedInstanced";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_Dispatch:
+            return "ID3D12GraphicsCommandList_Dispatch";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_CopyBufferRegion:
+            return "ID3D12GraphicsCommandList_CopyBufferRegion";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_CopyTextureRegion:
+            return "ID3D12GraphicsCommandList_CopyTextureRegion";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_CopyResource:
+            return "ID3D12GraphicsCommandList_CopyResource";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_CopyTiles:
+            return "ID3D12GraphicsCommandList_CopyTiles";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ResolveSubresource:
+            return "ID3D12GraphicsCommandList_ResolveSubresource";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_IASetPrimitiveTopology:
+            return "ID3D12GraphicsCommandList_IASetPrimitiveTopology";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_RSSetViewports:
+            return "ID3D12GraphicsCommandList_RSSetViewports";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_RSSetScissorRects:
+            return "ID3D12GraphicsCommandList_RSSetScissorRects";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_OMSetBlendFactor:
+            return "ID3D12GraphicsCommandList_OMSetBlendFactor";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_OMSetStencilRef:
+            return "ID3D12GraphicsCommandList_OMSetStencilRef";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetPipelineState:
+            return "ID3D12GraphicsCommandList_SetPipelineState";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ResourceBarrier:
+            return "ID3D12GraphicsCommandList_ResourceBarrier";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ExecuteBundle:
+            return "ID3D12GraphicsCommandList_ExecuteBundle";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetDescriptorHeaps:
+            return "ID3D12GraphicsCommandList_SetDescriptorHeaps";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRootSignature:
+            return "ID3D12GraphicsCommandList_SetComputeRootSignature";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRootSignature:
+            return "ID3D12GraphicsCommandList_SetGraphicsRootSignature";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRootDescriptorTable:
+            return "ID3D12GraphicsCommandList_SetComputeRootDescriptorTable";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTable:
+            return "ID3D12GraphicsCommandList_SetGraphicsRootDescriptorTable";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRoot32BitConstant:
+            return "ID3D12GraphicsCommandList_SetComputeRoot32BitConstant";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstant:
+            return "ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstant";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRoot32BitConstants:
+            return "ID3D12GraphicsCommandList_SetComputeRoot32BitConstants";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstants:
+            return "ID3D12GraphicsCommandList_SetGraphicsRoot32BitConstants";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRootConstantBufferView:
+            return "ID3D12GraphicsCommandList_SetComputeRootConstantBufferView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRootConstantBufferView:
+            return "ID3D12GraphicsCommandList_SetGraphicsRootConstantBufferView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRootShaderResourceView:
+            return "ID3D12GraphicsCommandList_SetComputeRootShaderResourceView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRootShaderResourceView:
+            return "ID3D12GraphicsCommandList_SetGraphicsRootShaderResourceView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetComputeRootUnorderedAccessView:
+            return "ID3D12GraphicsCommandList_SetComputeRootUnorderedAccessView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetGraphicsRootUnorderedAccessView:
+            return "ID3D12GraphicsCommandList_SetGraphicsRootUnorderedAccessView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_IASetIndexBuffer:
+            return "ID3D12GraphicsCommandList_IASetIndexBuffer";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_IASetVertexBuffers:
+            return "ID3D12GraphicsCommandList_IASetVertexBuffers";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SOSetTargets:
+            return "ID3D12GraphicsCommandList_SOSetTargets";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_OMSetRenderTargets:
+            return "ID3D12GraphicsCommandList_OMSetRenderTargets";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ClearDepthStencilView:
+            return "ID3D12GraphicsCommandList_ClearDepthStencilView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ClearRenderTargetView:
+            return "ID3D12GraphicsCommandList_ClearRenderTargetView";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ClearUnorderedAccessViewUint:
+            return "ID3D12GraphicsCommandList_ClearUnorderedAccessViewUint";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ClearUnorderedAccessViewFloat:
+            return "ID3D12GraphicsCommandList_ClearUnorderedAccessViewFloat";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DiscardResource:
+            return "ID3D12GraphicsCommandList_DiscardResource";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_BeginQuery:
+            return "ID3D12GraphicsCommandList_BeginQuery";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_EndQuery:
+            return "ID3D12GraphicsCommandList_EndQuery";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ResolveQueryData:
+            return "ID3D12GraphicsCommandList_ResolveQueryData";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetPredication:
+            return "ID3D12GraphicsCommandList_SetPredication";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetMarker:
+            return "ID3D12GraphicsCommandList_SetMarker";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_BeginEvent:
+            return "ID3D12GraphicsCommandList_BeginEvent";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_EndEvent:
+            return "ID3D12GraphicsCommandList_EndEvent";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_ExecuteIndirect:
+            return "ID3D12GraphicsCommandList_ExecuteIndirect";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT:
+            return "ID3D12GraphicsCommandList1_AtomicCopyBufferUINT";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64:
+            return "ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_OMSetDepthBounds:
+            return "ID3D12GraphicsCommandList1_OMSetDepthBounds";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_SetSamplePositions:
+            return "ID3D12GraphicsCommandList1_SetSamplePositions";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_ResolveSubresourceRegion:
+            return "ID3D12GraphicsCommandList1_ResolveSubresourceRegion";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList1_SetViewInstanceMask:
+            return "ID3D12GraphicsCommandList1_SetViewInstanceMask";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList2_WriteBufferImmediate:
+            return "ID3D12GraphicsCommandList2_WriteBufferImmediate";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_UpdateTileMappings:
+            return "ID3D12CommandQueue_UpdateTileMappings";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_CopyTileMappings:
+            return "ID3D12CommandQueue_CopyTileMappings";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_ExecuteCommandLists:
+            return "ID3D12CommandQueue_ExecuteCommandLists";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_SetMarker:
+            return "ID3D12CommandQueue_SetMarker";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_BeginEvent:
+            return "ID3D12CommandQueue_BeginEvent";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_EndEvent:
+            return "ID3D12CommandQueue_EndEvent";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_Signal:
+            return "ID3D12CommandQueue_Signal";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_Wait:
+            return "ID3D12CommandQueue_Wait";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_GetTimestampFrequency:
+            return "ID3D12CommandQueue_GetTimestampFrequency";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_GetClockCalibration:
+            return "ID3D12CommandQueue_GetClockCalibration";
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_GetDesc:
+            return "ID3D12CommandQueue_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetNodeCount:
+            return "ID3D12Device_GetNodeCount";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateCommandQueue:
+            return "ID3D12Device_CreateCommandQueue";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateCommandAllocator:
+            return "ID3D12Device_CreateCommandAllocator";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateGraphicsPipelineState:
+            return "ID3D12Device_CreateGraphicsPipelineState";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateComputePipelineState:
+            return "ID3D12Device_CreateComputePipelineState";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateCommandList:
+            return "ID3D12Device_CreateCommandList";
+        case format::ApiCallId::ApiCall_ID3D12Device_CheckFeatureSupport:
+            return "ID3D12Device_CheckFeatureSupport";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateDescriptorHeap:
+            return "ID3D12Device_CreateDescriptorHeap";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetDescriptorHandleIncrementSize:
+            return "ID3D12Device_GetDescriptorHandleIncrementSize";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateRootSignature:
+            return "ID3D12Device_CreateRootSignature";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateConstantBufferView:
+            return "ID3D12Device_CreateConstantBufferView";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateShaderResourceView:
+            return "ID3D12Device_CreateShaderResourceView";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateUnorderedAccessView:
+            return "ID3D12Device_CreateUnorderedAccessView";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateRenderTargetView:
+            return "ID3D12Device_CreateRenderTargetView";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateDepthStencilView:
+            return "ID3D12Device_CreateDepthStencilView";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateSampler:
+            return "ID3D12Device_CreateSampler";
+        case format::ApiCallId::ApiCall_ID3D12Device_CopyDescriptors:
+            return "ID3D12Device_CopyDescriptors";
+        case format::ApiCallId::ApiCall_ID3D12Device_CopyDescriptorsSimple:
+            return "ID3D12Device_CopyDescriptorsSimple";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetResourceAllocationInfo:
+            return "ID3D12Device_GetResourceAllocationInfo";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetCustomHeapProperties:
+            return "ID3D12Device_GetCustomHeapProperties";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateCommittedResource:
+            return "ID3D12Device_CreateCommittedResource";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateHeap:
+            return "ID3D12Device_CreateHeap";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreatePlacedResource:
+            return "ID3D12Device_CreatePlacedResource";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateReservedResource:
+            return "ID3D12Device_CreateReservedResource";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateSharedHandle:
+            return "ID3D12Device_CreateSharedHandle";
+        case format::ApiCallId::ApiCall_ID3D12Device_OpenSharedHandle:
+            return "ID3D12Device_OpenSharedHandle";
+        case format::ApiCallId::ApiCall_ID3D12Device_OpenSharedHandleByName:
+            return "ID3D12Device_OpenSharedHandleByName";
+        case format::ApiCallId::ApiCall_ID3D12Device_MakeResident:
+            return "ID3D12Device_MakeResident";
+        case format::ApiCallId::ApiCall_ID3D12Device_Evict:
+            return "ID3D12Device_Evict";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateFence:
+            return "ID3D12Device_CreateFence";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetDeviceRemovedReason:
+            return "ID3D12Device_GetDeviceRemovedReason";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetCopyableFootprints:
+            return "ID3D12Device_GetCopyableFootprints";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateQueryHeap:
+            return "ID3D12Device_CreateQueryHeap";
+        case format::ApiCallId::ApiCall_ID3D12Device_SetStablePowerState:
+            return "ID3D12Device_SetStablePowerState";
+        case format::ApiCallId::ApiCall_ID3D12Device_CreateCommandSignature:
+            return "ID3D12Device_CreateCommandSignature";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetResourceTiling:
+            return "ID3D12Device_GetResourceTiling";
+        case format::ApiCallId::ApiCall_ID3D12Device_GetAdapterLuid:
+            return "ID3D12Device_GetAdapterLuid";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary_StorePipeline:
+            return "ID3D12PipelineLibrary_StorePipeline";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary_LoadGraphicsPipeline:
+            return "ID3D12PipelineLibrary_LoadGraphicsPipeline";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary_LoadComputePipeline:
+            return "ID3D12PipelineLibrary_LoadComputePipeline";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary_GetSerializedSize:
+            return "ID3D12PipelineLibrary_GetSerializedSize";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary_Serialize:
+            return "ID3D12PipelineLibrary_Serialize";
+        case format::ApiCallId::ApiCall_ID3D12PipelineLibrary1_LoadPipeline:
+            return "ID3D12PipelineLibrary1_LoadPipeline";
+        case format::ApiCallId::ApiCall_ID3D12Device1_CreatePipelineLibrary:
+            return "ID3D12Device1_CreatePipelineLibrary";
+        case format::ApiCallId::ApiCall_ID3D12Device1_SetEventOnMultipleFenceCompletion:
+            return "ID3D12Device1_SetEventOnMultipleFenceCompletion";
+        case format::ApiCallId::ApiCall_ID3D12Device1_SetResidencyPriority:
+            return "ID3D12Device1_SetResidencyPriority";
+        case format::ApiCallId::ApiCall_ID3D12Device2_CreatePipelineState:
+            return "ID3D12Device2_CreatePipelineState";
+        case format::ApiCallId::ApiCall_ID3D12Device3_OpenExistingHeapFromAddress:
+            return "ID3D12Device3_OpenExistingHeapFromAddress";
+        case format::ApiCallId::ApiCall_ID3D12Device3_OpenExistingHeapFromFileMapping:
+            return "ID3D12Device3_OpenExistingHeapFromFileMapping";
+        case format::ApiCallId::ApiCall_ID3D12Device3_EnqueueMakeResident:
+            return "ID3D12Device3_EnqueueMakeResident";
+        case format::ApiCallId::ApiCall_ID3D12ProtectedSession_GetStatusFence:
+            return "ID3D12ProtectedSession_GetStatusFence";
+        case format::ApiCallId::ApiCall_ID3D12ProtectedSession_GetSessionStatus:
+            return "ID3D12ProtectedSession_GetSessionStatus";
+        case format::ApiCallId::ApiCall_ID3D12ProtectedResourceSession_GetDesc:
+            return "ID3D12ProtectedResourceSession_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12Device4_CreateCommandList1:
+            return "ID3D12Device4_CreateCommandList1";
+        case format::ApiCallId::ApiCall_ID3D12Device4_CreateProtectedResourceSession:
+            return "ID3D12Device4_CreateProtectedResourceSession";
+        case format::ApiCallId::ApiCall_ID3D12Device4_CreateCommittedResource1:
+            return "ID3D12Device4_CreateCommittedResource1";
+        case format::ApiCallId::ApiCall_ID3D12Device4_CreateHeap1:
+            return "ID3D12Device4_CreateHeap1";
+        case format::ApiCallId::ApiCall_ID3D12Device4_CreateReservedResource1:
+            return "ID3D12Device4_CreateReservedResource1";
+        case format::ApiCallId::ApiCall_ID3D12Device4_GetResourceAllocationInfo1:
+            return "ID3D12Device4_GetResourceAllocationInfo1";
+        case format::ApiCallId::ApiCall_ID3D12LifetimeOwner_LifetimeStateUpdated:
+            return "ID3D12LifetimeOwner_LifetimeStateUpdated";
+        case format::ApiCallId::ApiCall_ID3D12SwapChainAssistant_GetLUID:
+            return "ID3D12SwapChainAssistant_GetLUID";
+        case format::ApiCallId::ApiCall_ID3D12SwapChainAssistant_GetSwapChainObject:
+            return "ID3D12SwapChainAssistant_GetSwapChainObject";
+        case format::ApiCallId::ApiCall_ID3D12SwapChainAssistant_GetCurrentResourceAndCommandQueue:
+            return "ID3D12SwapChainAssistant_GetCurrentResourceAndCommandQueue";
+        case format::ApiCallId::ApiCall_ID3D12SwapChainAssistant_InsertImplicitSync:
+            return "ID3D12SwapChainAssistant_InsertImplicitSync";
+        case format::ApiCallId::ApiCall_ID3D12LifetimeTracker_DestroyOwnedObject:
+            return "ID3D12LifetimeTracker_DestroyOwnedObject";
+        case format::ApiCallId::ApiCall_ID3D12StateObjectProperties_GetShaderIdentifier:
+            return "ID3D12StateObjectProperties_GetShaderIdentifier";
+        case format::ApiCallId::ApiCall_ID3D12StateObjectProperties_GetShaderStackSize:
+            return "ID3D12StateObjectProperties_GetShaderStackSize";
+        case format::ApiCallId::ApiCall_ID3D12StateObjectProperties_GetPipelineStackSize:
+            return "ID3D12StateObjectProperties_GetPipelineStackSize";
+        case format::ApiCallId::ApiCall_ID3D12StateObjectProperties_SetPipelineStackSize:
+            return "ID3D12StateObjectProperties_SetPipelineStackSize";
+        case format::ApiCallId::ApiCall_ID3D12Device5_CreateLifetimeTracker:
+            return "ID3D12Device5_CreateLifetimeTracker";
+        case format::ApiCallId::ApiCall_ID3D12Device5_RemoveDevice:
+            return "ID3D12Device5_RemoveDevice";
+        case format::ApiCallId::ApiCall_ID3D12Device5_EnumerateMetaCommands:
+            return "ID3D12Device5_EnumerateMetaCommands";
+        case format::ApiCallId::ApiCall_ID3D12Device5_EnumerateMetaCommandParameters:
+            return "ID3D12Device5_EnumerateMetaCommandParameters";
+        case format::ApiCallId::ApiCall_ID3D12Device5_CreateMetaCommand:
+            return "ID3D12Device5_CreateMetaCommand";
+        case format::ApiCallId::ApiCall_ID3D12Device5_CreateStateObject:
+            return "ID3D12Device5_CreateStateObject";
+        case format::ApiCallId::ApiCall_ID3D12Device5_GetRaytracingAccelerationStructurePrebuildInfo:
+            return "ID3D12Device5_GetRaytracingAccelerationStructurePrebuildInfo";
+        case format::ApiCallId::ApiCall_ID3D12Device5_CheckDriverMatchingIdentifier:
+            return "ID3D12Device5_CheckDriverMatchingIdentifier";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBreadcrumbsEnablement:
+            return "ID3D12DeviceRemovedExtendedDataSettings_SetAutoBreadcrumbsEnablement";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedDataSettings_SetPageFaultEnablement:
+            return "ID3D12DeviceRemovedExtendedDataSettings_SetPageFaultEnablement";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedDataSettings_SetWatsonDumpEnablement:
+            return "ID3D12DeviceRemovedExtendedDataSettings_SetWatsonDumpEnablement";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedDataSettings1_SetBreadcrumbContextEnablement:
+            return "ID3D12DeviceRemovedExtendedDataSettings1_SetBreadcrumbContextEnablement";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumbsOutput:
+            return "ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumbsOutput";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData_GetPageFaultAllocationOutput:
+            return "ID3D12DeviceRemovedExtendedData_GetPageFaultAllocationOutput";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrumbsOutput1:
+            return "ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrumbsOutput1";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllocationOutput1:
+            return "ID3D12DeviceRemovedExtendedData1_GetPageFaultAllocationOutput1";
+        case format::ApiCallId::ApiCall_ID3D12Device6_SetBackgroundProcessingMode:
+            return "ID3D12Device6_SetBackgroundProcessingMode";
+        case format::ApiCallId::ApiCall_ID3D12ProtectedResourceSession1_GetDesc1:
+            return "ID3D12ProtectedResourceSession1_GetDesc1";
+        case format::ApiCallId::ApiCall_ID3D12Device7_AddToStateObject:
+            return "ID3D12Device7_AddToStateObject";
+        case format::ApiCallId::ApiCall_ID3D12Device7_CreateProtectedResourceSession1:
+            return "ID3D12Device7_CreateProtectedResourceSession1";
+        case format::ApiCallId::ApiCall_ID3D12Device8_GetResourceAllocationInfo2:
+            return "ID3D12Device8_GetResourceAllocationInfo2";
+        case format::ApiCallId::ApiCall_ID3D12Device8_CreateCommittedResource2:
+            return "ID3D12Device8_CreateCommittedResource2";
+        case format::ApiCallId::ApiCall_ID3D12Device8_CreatePlacedResource1:
+            return "ID3D12Device8_CreatePlacedResource1";
+        case format::ApiCallId::ApiCall_ID3D12Device8_CreateSamplerFeedbackUnorderedAccessView:
+            return "ID3D12Device8_CreateSamplerFeedbackUnorderedAccessView";
+        case format::ApiCallId::ApiCall_ID3D12Device8_GetCopyableFootprints1:
+            return "ID3D12Device8_GetCopyableFootprints1";
+        case format::ApiCallId::ApiCall_ID3D12Resource1_GetProtectedResourceSession:
+            return "ID3D12Resource1_GetProtectedResourceSession";
+        case format::ApiCallId::ApiCall_ID3D12Resource2_GetDesc1:
+            return "ID3D12Resource2_GetDesc1";
+        case format::ApiCallId::ApiCall_ID3D12Heap1_GetProtectedResourceSession:
+            return "ID3D12Heap1_GetProtectedResourceSession";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList3_SetProtectedResourceSession:
+            return "ID3D12GraphicsCommandList3_SetProtectedResourceSession";
+        case format::ApiCallId::ApiCall_ID3D12MetaCommand_GetRequiredParameterResourceSize:
+            return "ID3D12MetaCommand_GetRequiredParameterResourceSize";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_BeginRenderPass:
+            return "ID3D12GraphicsCommandList4_BeginRenderPass";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_EndRenderPass:
+            return "ID3D12GraphicsCommandList4_EndRenderPass";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_InitializeMetaCommand:
+            return "ID3D12GraphicsCommandList4_InitializeMetaCommand";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_ExecuteMetaCommand:
+            return "ID3D12GraphicsCommandList4_ExecuteMetaCommand";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_BuildRaytracingAccelerationStructure:
+            return "ID3D12GraphicsCommandList4_BuildRaytracingAccelerationStructure";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_EmitRaytracingAccelerationStructurePostbuildInfo:
+            return "ID3D12GraphicsCommandList4_EmitRaytracingAccelerationStructurePostbuildInfo";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_CopyRaytracingAccelerationStructure:
+            return "ID3D12GraphicsCommandList4_CopyRaytracingAccelerationStructure";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_SetPipelineState1:
+            return "ID3D12GraphicsCommandList4_SetPipelineState1";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList4_DispatchRays:
+            return "ID3D12GraphicsCommandList4_DispatchRays";
+        case format::ApiCallId::ApiCall_ID3D12Tools_EnableShaderInstrumentation:
+            return "ID3D12Tools_EnableShaderInstrumentation";
+        case format::ApiCallId::ApiCall_ID3D12Tools_ShaderInstrumentationEnabled:
+            return "ID3D12Tools_ShaderInstrumentationEnabled";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList5_RSSetShadingRate:
+            return "ID3D12GraphicsCommandList5_RSSetShadingRate";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList5_RSSetShadingRateImage:
+            return "ID3D12GraphicsCommandList5_RSSetShadingRateImage";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList6_DispatchMesh:
+            return "ID3D12GraphicsCommandList6_DispatchMesh";
+        case format::ApiCallId::ApiCall_ID3D10Blob_GetBufferPointer:
+            return "ID3D10Blob_GetBufferPointer";
+        case format::ApiCallId::ApiCall_ID3D10Blob_GetBufferSize:
+            return "ID3D10Blob_GetBufferSize";
+        case format::ApiCallId::ApiCall_ID3DDestructionNotifier_RegisterDestructionCallback:
+            return "ID3DDestructionNotifier_RegisterDestructionCallback";
+        case format::ApiCallId::ApiCall_ID3DDestructionNotifier_UnregisterDestructionCallback:
+            return "ID3DDestructionNotifier_UnregisterDestructionCallback";
+        case format::ApiCallId::ApiCall_ID3D12Debug_EnableDebugLayer:
+            return "ID3D12Debug_EnableDebugLayer";
+        case format::ApiCallId::ApiCall_ID3D12Debug1_EnableDebugLayer:
+            return "ID3D12Debug1_EnableDebugLayer";
+        case format::ApiCallId::ApiCall_ID3D12Debug1_SetEnableGPUBasedValidation:
+            return "ID3D12Debug1_SetEnableGPUBasedValidation";
+        case format::ApiCallId::ApiCall_ID3D12Debug1_SetEnableSynchronizedCommandQueueValidation:
+            return "ID3D12Debug1_SetEnableSynchronizedCommandQueueValidation";
+        case format::ApiCallId::ApiCall_ID3D12Debug2_SetGPUBasedValidationFlags:
+            return "ID3D12Debug2_SetGPUBasedValidationFlags";
+        case format::ApiCallId::ApiCall_ID3D12Debug3_SetEnableGPUBasedValidation:
+            return "ID3D12Debug3_SetEnableGPUBasedValidation";
+        case format::ApiCallId::ApiCall_ID3D12Debug3_SetEnableSynchronizedCommandQueueValidation:
+            return "ID3D12Debug3_SetEnableSynchronizedCommandQueueValidation";
+        case format::ApiCallId::ApiCall_ID3D12Debug3_SetGPUBasedValidationFlags:
+            return "ID3D12Debug3_SetGPUBasedValidationFlags";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice1_SetDebugParameter:
+            return "ID3D12DebugDevice1_SetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice1_GetDebugParameter:
+            return "ID3D12DebugDevice1_GetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice1_ReportLiveDeviceObjects:
+            return "ID3D12DebugDevice1_ReportLiveDeviceObjects";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice_SetFeatureMask:
+            return "ID3D12DebugDevice_SetFeatureMask";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice_GetFeatureMask:
+            return "ID3D12DebugDevice_GetFeatureMask";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice_ReportLiveDeviceObjects:
+            return "ID3D12DebugDevice_ReportLiveDeviceObjects";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice2_SetDebugParameter:
+            return "ID3D12DebugDevice2_SetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugDevice2_GetDebugParameter:
+            return "ID3D12DebugDevice2_GetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandQueue_AssertResourceState:
+            return "ID3D12DebugCommandQueue_AssertResourceState";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList1_AssertResourceState:
+            return "ID3D12DebugCommandList1_AssertResourceState";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList1_SetDebugParameter:
+            return "ID3D12DebugCommandList1_SetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList1_GetDebugParameter:
+            return "ID3D12DebugCommandList1_GetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList_AssertResourceState:
+            return "ID3D12DebugCommandList_AssertResourceState";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList_SetFeatureMask:
+            return "ID3D12DebugCommandList_SetFeatureMask";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList_GetFeatureMask:
+            return "ID3D12DebugCommandList_GetFeatureMask";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList2_SetDebugParameter:
+            return "ID3D12DebugCommandList2_SetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList2_GetDebugParameter:
+            return "ID3D12DebugCommandList2_GetDebugParameter";
+        case format::ApiCallId::ApiCall_ID3D12SharingContract_Present:
+            return "ID3D12SharingContract_Present";
+        case format::ApiCallId::ApiCall_ID3D12SharingContract_SharedFenceSignal:
+            return "ID3D12SharingContract_SharedFenceSignal";
+        case format::ApiCallId::ApiCall_ID3D12SharingContract_BeginCapturableWork:
+            return "ID3D12SharingContract_BeginCapturableWork";
+        case format::ApiCallId::ApiCall_ID3D12SharingContract_EndCapturableWork:
+            return "ID3D12SharingContract_EndCapturableWork";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_SetMessageCountLimit:
+            return "ID3D12InfoQueue_SetMessageCountLimit";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_ClearStoredMessages:
+            return "ID3D12InfoQueue_ClearStoredMessages";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetMessage:
+            return "ID3D12InfoQueue_GetMessage";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFilter:
+            return "ID3D12InfoQueue_GetNumMessagesAllowedByStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilter:
+            return "ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetNumStoredMessages:
+            return "ID3D12InfoQueue_GetNumStoredMessages";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetrievalFilter:
+            return "ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageCountLimit:
+            return "ID3D12InfoQueue_GetNumMessagesDiscardedByMessageCountLimit";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetMessageCountLimit:
+            return "ID3D12InfoQueue_GetMessageCountLimit";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_AddStorageFilterEntries:
+            return "ID3D12InfoQueue_AddStorageFilterEntries";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetStorageFilter:
+            return "ID3D12InfoQueue_GetStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_ClearStorageFilter:
+            return "ID3D12InfoQueue_ClearStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushEmptyStorageFilter:
+            return "ID3D12InfoQueue_PushEmptyStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushCopyOfStorageFilter:
+            return "ID3D12InfoQueue_PushCopyOfStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushStorageFilter:
+            return "ID3D12InfoQueue_PushStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PopStorageFilter:
+            return "ID3D12InfoQueue_PopStorageFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetStorageFilterStackSize:
+            return "ID3D12InfoQueue_GetStorageFilterStackSize";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_AddRetrievalFilterEntries:
+            return "ID3D12InfoQueue_AddRetrievalFilterEntries";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetRetrievalFilter:
+            return "ID3D12InfoQueue_GetRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_ClearRetrievalFilter:
+            return "ID3D12InfoQueue_ClearRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushEmptyRetrievalFilter:
+            return "ID3D12InfoQueue_PushEmptyRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushCopyOfRetrievalFilter:
+            return "ID3D12InfoQueue_PushCopyOfRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PushRetrievalFilter:
+            return "ID3D12InfoQueue_PushRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_PopRetrievalFilter:
+            return "ID3D12InfoQueue_PopRetrievalFilter";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetRetrievalFilterStackSize:
+            return "ID3D12InfoQueue_GetRetrievalFilterStackSize";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_AddMessage:
+            return "ID3D12InfoQueue_AddMessage";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_AddApplicationMessage:
+            return "ID3D12InfoQueue_AddApplicationMessage";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_SetBreakOnCategory:
+            return "ID3D12InfoQueue_SetBreakOnCategory";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_SetBreakOnSeverity:
+            return "ID3D12InfoQueue_SetBreakOnSeverity";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_SetBreakOnID:
+            return "ID3D12InfoQueue_SetBreakOnID";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetBreakOnCategory:
+            return "ID3D12InfoQueue_GetBreakOnCategory";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetBreakOnSeverity:
+            return "ID3D12InfoQueue_GetBreakOnSeverity";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetBreakOnID:
+            return "ID3D12InfoQueue_GetBreakOnID";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_SetMuteDebugOutput:
+            return "ID3D12InfoQueue_SetMuteDebugOutput";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue_GetMuteDebugOutput:
+            return "ID3D12InfoQueue_GetMuteDebugOutput";
+        case format::ApiCallId::ApiCall_D3D12GetInterface:
+            return "D3D12GetInterface";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllocationOutput2:
+            return "ID3D12DeviceRemovedExtendedData2_GetPageFaultAllocationOutput2";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedData2_GetDeviceState:
+            return "ID3D12DeviceRemovedExtendedData2_GetDeviceState";
+        case format::ApiCallId::ApiCall_ID3D12ShaderCacheSession_FindValue:
+            return "ID3D12ShaderCacheSession_FindValue";
+        case format::ApiCallId::ApiCall_ID3D12ShaderCacheSession_StoreValue:
+            return "ID3D12ShaderCacheSession_StoreValue";
+        case format::ApiCallId::ApiCall_ID3D12ShaderCacheSession_SetDeleteOnDestroy:
+            return "ID3D12ShaderCacheSession_SetDeleteOnDestroy";
+        case format::ApiCallId::ApiCall_ID3D12ShaderCacheSession_GetDesc:
+            return "ID3D12ShaderCacheSession_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12Device9_CreateShaderCacheSession:
+            return "ID3D12Device9_CreateShaderCacheSession";
+        case format::ApiCallId::ApiCall_ID3D12Device9_ShaderCacheControl:
+            return "ID3D12Device9_ShaderCacheControl";
+        case format::ApiCallId::ApiCall_ID3D12Device9_CreateCommandQueue1:
+            return "ID3D12Device9_CreateCommandQueue1";
+        case format::ApiCallId::ApiCall_ID3D12SDKConfiguration_SetSDKVersion:
+            return "ID3D12SDKConfiguration_SetSDKVersion";
+        case format::ApiCallId::ApiCall_ID3D12Debug4_DisableDebugLayer:
+            return "ID3D12Debug4_DisableDebugLayer";
+        case format::ApiCallId::ApiCall_ID3D12Debug5_SetEnableAutoName:
+            return "ID3D12Debug5_SetEnableAutoName";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue1_UnregisterMessageCallback:
+            return "ID3D12InfoQueue1_UnregisterMessageCallback";
+        case format::ApiCallId::ApiCall_ID3D12InfoQueue1_RegisterMessageCallback:
+            return "ID3D12InfoQueue1_RegisterMessageCallback";
+        case format::ApiCallId::ApiCall_ID3D12Device10_CreateCommittedResource3:
+            return "ID3D12Device10_CreateCommittedResource3";
+        case format::ApiCallId::ApiCall_ID3D12Device10_CreatePlacedResource2:
+            return "ID3D12Device10_CreatePlacedResource2";
+        case format::ApiCallId::ApiCall_ID3D12Device10_CreateReservedResource2:
+            return "ID3D12Device10_CreateReservedResource2";
+        case format::ApiCallId::ApiCall_ID3D12Device11_CreateSampler2:
+            return "ID3D12Device11_CreateSampler2";
+        case format::ApiCallId::ApiCall_ID3D12VirtualizationGuestDevice_ShareWithHost:
+            return "ID3D12VirtualizationGuestDevice_ShareWithHost";
+        case format::ApiCallId::ApiCall_ID3D12VirtualizationGuestDevice_CreateFenceFd:
+            return "ID3D12VirtualizationGuestDevice_CreateFenceFd";
+        case format::ApiCallId::ApiCall_ID3D12SDKConfiguration1_CreateDeviceFactory:
+            return "ID3D12SDKConfiguration1_CreateDeviceFactory";
+        case format::ApiCallId::ApiCall_ID3D12SDKConfiguration1_FreeUnusedSDKs:
+            return "ID3D12SDKConfiguration1_FreeUnusedSDKs";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_InitializeFromGlobalState:
+            return "ID3D12DeviceFactory_InitializeFromGlobalState";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_ApplyToGlobalState:
+            return "ID3D12DeviceFactory_ApplyToGlobalState";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_SetFlags:
+            return "ID3D12DeviceFactory_SetFlags";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_GetFlags:
+            return "ID3D12DeviceFactory_GetFlags";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_GetConfigurationInterface:
+            return "ID3D12DeviceFactory_GetConfigurationInterface";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_EnableExperimentalFeatures:
+            return "ID3D12DeviceFactory_EnableExperimentalFeatures";
+        case format::ApiCallId::ApiCall_ID3D12DeviceFactory_CreateDevice:
+            return "ID3D12DeviceFactory_CreateDevice";
+        case format::ApiCallId::ApiCall_ID3D12DeviceConfiguration_GetDesc:
+            return "ID3D12DeviceConfiguration_GetDesc";
+        case format::ApiCallId::ApiCall_ID3D12DeviceConfiguration_GetEnabledExperimentalFeatures:
+            return "ID3D12DeviceConfiguration_GetEnabledExperimentalFeatures";
+        case format::ApiCallId::ApiCall_ID3D12DeviceConfiguration_SerializeVersionedRootSignature:
+            return "ID3D12DeviceConfiguration_SerializeVersionedRootSignature";
+        case format::ApiCallId::ApiCall_ID3D12DeviceConfiguration_CreateVersionedRootSignatureDeserializer:
+            return "ID3D12DeviceConfiguration_CreateVersionedRootSignatureDeserializer";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList7_Barrier:
+            return "ID3D12GraphicsCommandList7_Barrier";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList8_OMSetFrontAndBackStencilRef:
+            return "ID3D12GraphicsCommandList8_OMSetFrontAndBackStencilRef";
+        case format::ApiCallId::ApiCall_ID3D12DeviceRemovedExtendedDataSettings2_UseMarkersOnlyAutoBreadcrumbs:
+            return "ID3D12DeviceRemovedExtendedDataSettings2_UseMarkersOnlyAutoBreadcrumbs";
+        case format::ApiCallId::ApiCall_ID3D12Debug6_SetForceLegacyBarrierValidation:
+            return "ID3D12Debug6_SetForceLegacyBarrierValidation";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandQueue1_AssertResourceAccess:
+            return "ID3D12DebugCommandQueue1_AssertResourceAccess";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandQueue1_AssertTextureLayout:
+            return "ID3D12DebugCommandQueue1_AssertTextureLayout";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList3_AssertResourceAccess:
+            return "ID3D12DebugCommandList3_AssertResourceAccess";
+        case format::ApiCallId::ApiCall_ID3D12DebugCommandList3_AssertTextureLayout:
+            return "ID3D12DebugCommandList3_AssertTextureLayout";
+        case format::ApiCallId::ApiCall_ID3D12Device12_GetResourceAllocationInfo3:
+            return "ID3D12Device12_GetResourceAllocationInfo3";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList9_RSSetDepthBias:
+            return "ID3D12GraphicsCommandList9_RSSetDepthBias";
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList9_IASetIndexBufferStripCutValue:
+            return "ID3D12GraphicsCommandList9_IASetIndexBufferStripCutValue";
+        case format::ApiCallId::ApiCall_ID3D12DSRDeviceFactory_CreateDSRDevice:
+            return "ID3D12DSRDeviceFactory_CreateDSRDevice";
+        case format::ApiCallId::ApiCall_ID3D12ManualWriteTrackingResource_TrackWrite:
+            return "ID3D12ManualWriteTrackingResource_TrackWrite";
+        case format::ApiCallId::ApiCall_Ags_agsInitialize_6_0_1:
+            return "Ags_agsInitialize_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDeInitialize_6_0_1:
+            return "Ags_agsDeInitialize_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_CreateDevice_6_0_1:
+            return "Ags_agsDriverExtensionsDX12_CreateDevice_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_DestroyDevice_6_0_1:
+            return "Ags_agsDriverExtensionsDX12_DestroyDevice_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsCheckDriverVersion_6_0_1:
+            return "Ags_agsCheckDriverVersion_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsGetVersionNumber_6_0_1:
+            return "Ags_agsGetVersionNumber_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsSetDisplayMode_6_0_1:
+            return "Ags_agsSetDisplayMode_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_PushMarker_6_0_1:
+            return "Ags_agsDriverExtensionsDX12_PushMarker_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_PopMarker_6_0_1:
+            return "Ags_agsDriverExtensionsDX12_PopMarker_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_SetMarker_6_0_1:
+            return "Ags_agsDriverExtensionsDX12_SetMarker_6_0_1";
+        case format::ApiCallId::ApiCall_Ags_agsDriverExtensionsDX12_CreateDevice_6_2_0:
+            return "Ags_agsDriverExtensionsDX12_CreateDevice_6_2_0";
+        default:
+            return nullptr;
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_GENERATED_API_CALL_ID_TO_STRING_H
@@ -31,6 +31,7 @@
 #define  GFXRECON_GENERATED_LAYER_FUNC_TABLE_H
 
 #include "encode/custom_vulkan_api_call_encoders.h"
+#include "generated/generated_layer_func_table_names.h"
 #include "generated/generated_vulkan_api_call_encoders.h"
 #include "layer/trace_layer.h"
 #include "util/defines.h"
@@ -44,688 +45,695 @@
 #include "vk_video/vulkan_video_codec_h265std_encode.h"
 #include "vk_video/vulkan_video_codecs_common.h"
 
-#include <unordered_map>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
-const std::unordered_map<std::string, PFN_vkVoidFunction> vulkan_func_table = {
-    { "vkCreateInstance",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateInstance) },
-    { "vkDestroyInstance",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyInstance) },
-    { "vkEnumeratePhysicalDevices",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDevices) },
-    { "vkGetPhysicalDeviceFeatures",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures) },
-    { "vkGetPhysicalDeviceFormatProperties",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties) },
-    { "vkGetPhysicalDeviceImageFormatProperties",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties) },
-    { "vkGetPhysicalDeviceProperties",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties) },
-    { "vkGetPhysicalDeviceQueueFamilyProperties",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties) },
-    { "vkGetPhysicalDeviceMemoryProperties",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties) },
-    { "vkGetInstanceProcAddr",                                                                               reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetInstanceProcAddr) },
-    { "vkGetDeviceProcAddr",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetDeviceProcAddr) },
-    { "vkCreateDevice",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDevice) },
-    { "vkDestroyDevice",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDevice) },
-    { "vkEnumerateInstanceExtensionProperties",                                                              reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateInstanceExtensionProperties) },
-    { "vkEnumerateDeviceExtensionProperties",                                                                reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateDeviceExtensionProperties) },
-    { "vkEnumerateInstanceLayerProperties",                                                                  reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateInstanceLayerProperties) },
-    { "vkEnumerateDeviceLayerProperties",                                                                    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateDeviceLayerProperties) },
-    { "vkGetDeviceQueue",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceQueue) },
-    { "vkQueueSubmit",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit) },
-    { "vkQueueWaitIdle",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::QueueWaitIdle) },
-    { "vkDeviceWaitIdle",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::DeviceWaitIdle) },
-    { "vkAllocateMemory",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateMemory) },
-    { "vkFreeMemory",                                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::FreeMemory) },
-    { "vkMapMemory",                                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory) },
-    { "vkUnmapMemory",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory) },
-    { "vkFlushMappedMemoryRanges",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::FlushMappedMemoryRanges) },
-    { "vkInvalidateMappedMemoryRanges",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::InvalidateMappedMemoryRanges) },
-    { "vkGetDeviceMemoryCommitment",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryCommitment) },
-    { "vkBindBufferMemory",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory) },
-    { "vkBindImageMemory",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory) },
-    { "vkGetBufferMemoryRequirements",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements) },
-    { "vkGetImageMemoryRequirements",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements) },
-    { "vkGetImageSparseMemoryRequirements",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements) },
-    { "vkGetPhysicalDeviceSparseImageFormatProperties",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties) },
-    { "vkQueueBindSparse",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::QueueBindSparse) },
-    { "vkCreateFence",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CreateFence) },
-    { "vkDestroyFence",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyFence) },
-    { "vkResetFences",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::ResetFences) },
-    { "vkGetFenceStatus",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceStatus) },
-    { "vkWaitForFences",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::WaitForFences) },
-    { "vkCreateSemaphore",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSemaphore) },
-    { "vkDestroySemaphore",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySemaphore) },
-    { "vkCreateEvent",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CreateEvent) },
-    { "vkDestroyEvent",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyEvent) },
-    { "vkGetEventStatus",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetEventStatus) },
-    { "vkSetEvent",                                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::SetEvent) },
-    { "vkResetEvent",                                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::ResetEvent) },
-    { "vkCreateQueryPool",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateQueryPool) },
-    { "vkDestroyQueryPool",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyQueryPool) },
-    { "vkGetQueryPoolResults",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueryPoolResults) },
-    { "vkCreateBuffer",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateBuffer) },
-    { "vkDestroyBuffer",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyBuffer) },
-    { "vkCreateBufferView",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CreateBufferView) },
-    { "vkDestroyBufferView",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyBufferView) },
-    { "vkCreateImage",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImage) },
-    { "vkDestroyImage",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyImage) },
-    { "vkGetImageSubresourceLayout",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout) },
-    { "vkCreateImageView",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImageView) },
-    { "vkDestroyImageView",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyImageView) },
-    { "vkCreateShaderModule",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CreateShaderModule) },
-    { "vkDestroyShaderModule",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyShaderModule) },
-    { "vkCreatePipelineCache",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineCache) },
-    { "vkDestroyPipelineCache",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineCache) },
-    { "vkGetPipelineCacheData",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineCacheData) },
-    { "vkMergePipelineCaches",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::MergePipelineCaches) },
-    { "vkCreateGraphicsPipelines",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CreateGraphicsPipelines) },
-    { "vkCreateComputePipelines",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CreateComputePipelines) },
-    { "vkDestroyPipeline",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipeline) },
-    { "vkCreatePipelineLayout",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineLayout) },
-    { "vkDestroyPipelineLayout",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineLayout) },
-    { "vkCreateSampler",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSampler) },
-    { "vkDestroySampler",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySampler) },
-    { "vkCreateDescriptorSetLayout",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorSetLayout) },
-    { "vkDestroyDescriptorSetLayout",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorSetLayout) },
-    { "vkCreateDescriptorPool",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorPool) },
-    { "vkDestroyDescriptorPool",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorPool) },
-    { "vkResetDescriptorPool",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::ResetDescriptorPool) },
-    { "vkAllocateDescriptorSets",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateDescriptorSets) },
-    { "vkFreeDescriptorSets",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::FreeDescriptorSets) },
-    { "vkUpdateDescriptorSets",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSets) },
-    { "vkCreateFramebuffer",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateFramebuffer) },
-    { "vkDestroyFramebuffer",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyFramebuffer) },
-    { "vkCreateRenderPass",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass) },
-    { "vkDestroyRenderPass",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyRenderPass) },
-    { "vkGetRenderAreaGranularity",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderAreaGranularity) },
-    { "vkCreateCommandPool",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateCommandPool) },
-    { "vkDestroyCommandPool",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyCommandPool) },
-    { "vkResetCommandPool",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::ResetCommandPool) },
-    { "vkAllocateCommandBuffers",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateCommandBuffers) },
-    { "vkFreeCommandBuffers",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::FreeCommandBuffers) },
-    { "vkBeginCommandBuffer",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::BeginCommandBuffer) },
-    { "vkEndCommandBuffer",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::EndCommandBuffer) },
-    { "vkResetCommandBuffer",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::ResetCommandBuffer) },
-    { "vkCmdBindPipeline",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindPipeline) },
-    { "vkCmdSetViewport",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewport) },
-    { "vkCmdSetScissor",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissor) },
-    { "vkCmdSetLineWidth",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineWidth) },
-    { "vkCmdSetDepthBias",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBias) },
-    { "vkCmdSetBlendConstants",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetBlendConstants) },
-    { "vkCmdSetDepthBounds",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBounds) },
-    { "vkCmdSetStencilCompareMask",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilCompareMask) },
-    { "vkCmdSetStencilWriteMask",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilWriteMask) },
-    { "vkCmdSetStencilReference",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilReference) },
-    { "vkCmdBindDescriptorSets",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets) },
-    { "vkCmdBindIndexBuffer",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer) },
-    { "vkCmdBindVertexBuffers",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers) },
-    { "vkCmdDraw",                                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDraw) },
-    { "vkCmdDrawIndexed",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexed) },
-    { "vkCmdDrawIndirect",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirect) },
-    { "vkCmdDrawIndexedIndirect",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirect) },
-    { "vkCmdDispatch",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatch) },
-    { "vkCmdDispatchIndirect",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchIndirect) },
-    { "vkCmdCopyBuffer",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer) },
-    { "vkCmdCopyImage",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage) },
-    { "vkCmdBlitImage",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage) },
-    { "vkCmdCopyBufferToImage",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage) },
-    { "vkCmdCopyImageToBuffer",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer) },
-    { "vkCmdUpdateBuffer",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdUpdateBuffer) },
-    { "vkCmdFillBuffer",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdFillBuffer) },
-    { "vkCmdClearColorImage",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearColorImage) },
-    { "vkCmdClearDepthStencilImage",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearDepthStencilImage) },
-    { "vkCmdClearAttachments",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearAttachments) },
-    { "vkCmdResolveImage",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage) },
-    { "vkCmdSetEvent",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent) },
-    { "vkCmdResetEvent",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent) },
-    { "vkCmdWaitEvents",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents) },
-    { "vkCmdPipelineBarrier",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier) },
-    { "vkCmdBeginQuery",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginQuery) },
-    { "vkCmdEndQuery",                                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndQuery) },
-    { "vkCmdResetQueryPool",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetQueryPool) },
-    { "vkCmdWriteTimestamp",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp) },
-    { "vkCmdCopyQueryPoolResults",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyQueryPoolResults) },
-    { "vkCmdPushConstants",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants) },
-    { "vkCmdBeginRenderPass",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass) },
-    { "vkCmdNextSubpass",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass) },
-    { "vkCmdEndRenderPass",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass) },
-    { "vkCmdExecuteCommands",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteCommands) },
-    { "vkBindBufferMemory2",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory2) },
-    { "vkBindImageMemory2",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory2) },
-    { "vkGetDeviceGroupPeerMemoryFeatures",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPeerMemoryFeatures) },
-    { "vkCmdSetDeviceMask",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDeviceMask) },
-    { "vkCmdDispatchBase",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchBase) },
-    { "vkEnumeratePhysicalDeviceGroups",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceGroups) },
-    { "vkGetImageMemoryRequirements2",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements2) },
-    { "vkGetBufferMemoryRequirements2",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements2) },
-    { "vkGetImageSparseMemoryRequirements2",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements2) },
-    { "vkGetPhysicalDeviceFeatures2",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures2) },
-    { "vkGetPhysicalDeviceProperties2",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties2) },
-    { "vkGetPhysicalDeviceFormatProperties2",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties2) },
-    { "vkGetPhysicalDeviceImageFormatProperties2",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties2) },
-    { "vkGetPhysicalDeviceQueueFamilyProperties2",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties2) },
-    { "vkGetPhysicalDeviceMemoryProperties2",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties2) },
-    { "vkGetPhysicalDeviceSparseImageFormatProperties2",                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties2) },
-    { "vkTrimCommandPool",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::TrimCommandPool) },
-    { "vkGetDeviceQueue2",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceQueue2) },
-    { "vkCreateSamplerYcbcrConversion",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSamplerYcbcrConversion) },
-    { "vkDestroySamplerYcbcrConversion",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySamplerYcbcrConversion) },
-    { "vkCreateDescriptorUpdateTemplate",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorUpdateTemplate) },
-    { "vkDestroyDescriptorUpdateTemplate",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorUpdateTemplate) },
-    { "vkUpdateDescriptorSetWithTemplate",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSetWithTemplate) },
-    { "vkGetPhysicalDeviceExternalBufferProperties",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalBufferProperties) },
-    { "vkGetPhysicalDeviceExternalFenceProperties",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalFenceProperties) },
-    { "vkGetPhysicalDeviceExternalSemaphoreProperties",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalSemaphoreProperties) },
-    { "vkGetDescriptorSetLayoutSupport",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutSupport) },
-    { "vkCmdDrawIndirectCount",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCount) },
-    { "vkCmdDrawIndexedIndirectCount",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCount) },
-    { "vkCreateRenderPass2",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass2) },
-    { "vkCmdBeginRenderPass2",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass2) },
-    { "vkCmdNextSubpass2",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass2) },
-    { "vkCmdEndRenderPass2",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass2) },
-    { "vkResetQueryPool",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetQueryPool) },
-    { "vkGetSemaphoreCounterValue",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreCounterValue) },
-    { "vkWaitSemaphores",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::WaitSemaphores) },
-    { "vkSignalSemaphore",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::SignalSemaphore) },
-    { "vkGetBufferDeviceAddress",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddress) },
-    { "vkGetBufferOpaqueCaptureAddress",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferOpaqueCaptureAddress) },
-    { "vkGetDeviceMemoryOpaqueCaptureAddress",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryOpaqueCaptureAddress) },
-    { "vkGetPhysicalDeviceToolProperties",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceToolProperties) },
-    { "vkCreatePrivateDataSlot",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePrivateDataSlot) },
-    { "vkDestroyPrivateDataSlot",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPrivateDataSlot) },
-    { "vkSetPrivateData",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::SetPrivateData) },
-    { "vkGetPrivateData",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPrivateData) },
-    { "vkCmdSetEvent2",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent2) },
-    { "vkCmdResetEvent2",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent2) },
-    { "vkCmdWaitEvents2",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents2) },
-    { "vkCmdPipelineBarrier2",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier2) },
-    { "vkCmdWriteTimestamp2",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp2) },
-    { "vkQueueSubmit2",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit2) },
-    { "vkCmdCopyBuffer2",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer2) },
-    { "vkCmdCopyImage2",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage2) },
-    { "vkCmdCopyBufferToImage2",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage2) },
-    { "vkCmdCopyImageToBuffer2",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer2) },
-    { "vkCmdBlitImage2",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage2) },
-    { "vkCmdResolveImage2",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage2) },
-    { "vkCmdBeginRendering",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRendering) },
-    { "vkCmdEndRendering",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRendering) },
-    { "vkCmdSetCullMode",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCullMode) },
-    { "vkCmdSetFrontFace",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFrontFace) },
-    { "vkCmdSetPrimitiveTopology",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveTopology) },
-    { "vkCmdSetViewportWithCount",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWithCount) },
-    { "vkCmdSetScissorWithCount",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissorWithCount) },
-    { "vkCmdBindVertexBuffers2",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers2) },
-    { "vkCmdSetDepthTestEnable",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthTestEnable) },
-    { "vkCmdSetDepthWriteEnable",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthWriteEnable) },
-    { "vkCmdSetDepthCompareOp",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthCompareOp) },
-    { "vkCmdSetDepthBoundsTestEnable",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBoundsTestEnable) },
-    { "vkCmdSetStencilTestEnable",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilTestEnable) },
-    { "vkCmdSetStencilOp",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilOp) },
-    { "vkCmdSetRasterizerDiscardEnable",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizerDiscardEnable) },
-    { "vkCmdSetDepthBiasEnable",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBiasEnable) },
-    { "vkCmdSetPrimitiveRestartEnable",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveRestartEnable) },
-    { "vkGetDeviceBufferMemoryRequirements",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceBufferMemoryRequirements) },
-    { "vkGetDeviceImageMemoryRequirements",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageMemoryRequirements) },
-    { "vkGetDeviceImageSparseMemoryRequirements",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSparseMemoryRequirements) },
-    { "vkCmdSetLineStipple",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStipple) },
-    { "vkMapMemory2",                                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory2) },
-    { "vkUnmapMemory2",                                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory2) },
-    { "vkCmdBindIndexBuffer2",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer2) },
-    { "vkGetRenderingAreaGranularity",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderingAreaGranularity) },
-    { "vkGetDeviceImageSubresourceLayout",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSubresourceLayout) },
-    { "vkGetImageSubresourceLayout2",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2) },
-    { "vkCmdPushDescriptorSet",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet) },
-    { "vkCmdPushDescriptorSetWithTemplate",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate) },
-    { "vkCmdSetRenderingAttachmentLocations",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingAttachmentLocations) },
-    { "vkCmdSetRenderingInputAttachmentIndices",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingInputAttachmentIndices) },
-    { "vkCmdBindDescriptorSets2",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets2) },
-    { "vkCmdPushConstants2",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants2) },
-    { "vkCmdPushDescriptorSet2",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet2) },
-    { "vkCmdPushDescriptorSetWithTemplate2",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate2) },
-    { "vkCopyMemoryToImage",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToImage) },
-    { "vkCopyImageToMemory",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToMemory) },
-    { "vkCopyImageToImage",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToImage) },
-    { "vkTransitionImageLayout",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::TransitionImageLayout) },
-    { "vkDestroySurfaceKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySurfaceKHR) },
-    { "vkGetPhysicalDeviceSurfaceSupportKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceSupportKHR) },
-    { "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilitiesKHR) },
-    { "vkGetPhysicalDeviceSurfaceFormatsKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceFormatsKHR) },
-    { "vkGetPhysicalDeviceSurfacePresentModesKHR",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfacePresentModesKHR) },
-    { "vkCreateSwapchainKHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSwapchainKHR) },
-    { "vkDestroySwapchainKHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySwapchainKHR) },
-    { "vkGetSwapchainImagesKHR",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainImagesKHR) },
-    { "vkAcquireNextImageKHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireNextImageKHR) },
-    { "vkQueuePresentKHR",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::QueuePresentKHR) },
-    { "vkGetDeviceGroupPresentCapabilitiesKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPresentCapabilitiesKHR) },
-    { "vkGetDeviceGroupSurfacePresentModesKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupSurfacePresentModesKHR) },
-    { "vkGetPhysicalDevicePresentRectanglesKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDevicePresentRectanglesKHR) },
-    { "vkAcquireNextImage2KHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireNextImage2KHR) },
-    { "vkGetPhysicalDeviceDisplayPropertiesKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPropertiesKHR) },
-    { "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPlanePropertiesKHR) },
-    { "vkGetDisplayPlaneSupportedDisplaysKHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneSupportedDisplaysKHR) },
-    { "vkGetDisplayModePropertiesKHR",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayModePropertiesKHR) },
-    { "vkCreateDisplayModeKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDisplayModeKHR) },
-    { "vkGetDisplayPlaneCapabilitiesKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneCapabilitiesKHR) },
-    { "vkCreateDisplayPlaneSurfaceKHR",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDisplayPlaneSurfaceKHR) },
-    { "vkCreateSharedSwapchainsKHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSharedSwapchainsKHR) },
-    { "vkCreateXlibSurfaceKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CreateXlibSurfaceKHR) },
-    { "vkGetPhysicalDeviceXlibPresentationSupportKHR",                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceXlibPresentationSupportKHR) },
-    { "vkCreateXcbSurfaceKHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CreateXcbSurfaceKHR) },
-    { "vkGetPhysicalDeviceXcbPresentationSupportKHR",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceXcbPresentationSupportKHR) },
-    { "vkCreateWaylandSurfaceKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CreateWaylandSurfaceKHR) },
-    { "vkGetPhysicalDeviceWaylandPresentationSupportKHR",                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceWaylandPresentationSupportKHR) },
-    { "vkCreateAndroidSurfaceKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAndroidSurfaceKHR) },
-    { "vkCreateWin32SurfaceKHR",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CreateWin32SurfaceKHR) },
-    { "vkGetPhysicalDeviceWin32PresentationSupportKHR",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceWin32PresentationSupportKHR) },
-    { "vkGetPhysicalDeviceVideoCapabilitiesKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoCapabilitiesKHR) },
-    { "vkGetPhysicalDeviceVideoFormatPropertiesKHR",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoFormatPropertiesKHR) },
-    { "vkCreateVideoSessionKHR",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CreateVideoSessionKHR) },
-    { "vkDestroyVideoSessionKHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyVideoSessionKHR) },
-    { "vkGetVideoSessionMemoryRequirementsKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetVideoSessionMemoryRequirementsKHR) },
-    { "vkBindVideoSessionMemoryKHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::BindVideoSessionMemoryKHR) },
-    { "vkCreateVideoSessionParametersKHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateVideoSessionParametersKHR) },
-    { "vkUpdateVideoSessionParametersKHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateVideoSessionParametersKHR) },
-    { "vkDestroyVideoSessionParametersKHR",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyVideoSessionParametersKHR) },
-    { "vkCmdBeginVideoCodingKHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginVideoCodingKHR) },
-    { "vkCmdEndVideoCodingKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndVideoCodingKHR) },
-    { "vkCmdControlVideoCodingKHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdControlVideoCodingKHR) },
-    { "vkCmdDecodeVideoKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDecodeVideoKHR) },
-    { "vkCmdBeginRenderingKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderingKHR) },
-    { "vkCmdEndRenderingKHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderingKHR) },
-    { "vkGetPhysicalDeviceFeatures2KHR",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures2KHR) },
-    { "vkGetPhysicalDeviceProperties2KHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties2KHR) },
-    { "vkGetPhysicalDeviceFormatProperties2KHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties2KHR) },
-    { "vkGetPhysicalDeviceImageFormatProperties2KHR",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties2KHR) },
-    { "vkGetPhysicalDeviceQueueFamilyProperties2KHR",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties2KHR) },
-    { "vkGetPhysicalDeviceMemoryProperties2KHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties2KHR) },
-    { "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties2KHR) },
-    { "vkGetDeviceGroupPeerMemoryFeaturesKHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPeerMemoryFeaturesKHR) },
-    { "vkCmdSetDeviceMaskKHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDeviceMaskKHR) },
-    { "vkCmdDispatchBaseKHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchBaseKHR) },
-    { "vkTrimCommandPoolKHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::TrimCommandPoolKHR) },
-    { "vkEnumeratePhysicalDeviceGroupsKHR",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceGroupsKHR) },
-    { "vkGetPhysicalDeviceExternalBufferPropertiesKHR",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalBufferPropertiesKHR) },
-    { "vkGetMemoryWin32HandleKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandleKHR) },
-    { "vkGetMemoryWin32HandlePropertiesKHR",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandlePropertiesKHR) },
-    { "vkGetMemoryFdKHR",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryFdKHR) },
-    { "vkGetMemoryFdPropertiesKHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryFdPropertiesKHR) },
-    { "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalSemaphorePropertiesKHR) },
-    { "vkImportSemaphoreWin32HandleKHR",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreWin32HandleKHR) },
-    { "vkGetSemaphoreWin32HandleKHR",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreWin32HandleKHR) },
-    { "vkImportSemaphoreFdKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreFdKHR) },
-    { "vkGetSemaphoreFdKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreFdKHR) },
-    { "vkCmdPushDescriptorSetKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetKHR) },
-    { "vkCmdPushDescriptorSetWithTemplateKHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplateKHR) },
-    { "vkCreateDescriptorUpdateTemplateKHR",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorUpdateTemplateKHR) },
-    { "vkDestroyDescriptorUpdateTemplateKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorUpdateTemplateKHR) },
-    { "vkUpdateDescriptorSetWithTemplateKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSetWithTemplateKHR) },
-    { "vkCreateRenderPass2KHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass2KHR) },
-    { "vkCmdBeginRenderPass2KHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass2KHR) },
-    { "vkCmdNextSubpass2KHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass2KHR) },
-    { "vkCmdEndRenderPass2KHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass2KHR) },
-    { "vkGetSwapchainStatusKHR",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainStatusKHR) },
-    { "vkGetPhysicalDeviceExternalFencePropertiesKHR",                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalFencePropertiesKHR) },
-    { "vkImportFenceWin32HandleKHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::ImportFenceWin32HandleKHR) },
-    { "vkGetFenceWin32HandleKHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceWin32HandleKHR) },
-    { "vkImportFenceFdKHR",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::ImportFenceFdKHR) },
-    { "vkGetFenceFdKHR",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceFdKHR) },
-    { "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",                                     reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR) },
-    { "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR) },
-    { "vkAcquireProfilingLockKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireProfilingLockKHR) },
-    { "vkReleaseProfilingLockKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseProfilingLockKHR) },
-    { "vkGetPhysicalDeviceSurfaceCapabilities2KHR",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilities2KHR) },
-    { "vkGetPhysicalDeviceSurfaceFormats2KHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceFormats2KHR) },
-    { "vkGetPhysicalDeviceDisplayProperties2KHR",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayProperties2KHR) },
-    { "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPlaneProperties2KHR) },
-    { "vkGetDisplayModeProperties2KHR",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayModeProperties2KHR) },
-    { "vkGetDisplayPlaneCapabilities2KHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneCapabilities2KHR) },
-    { "vkGetImageMemoryRequirements2KHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements2KHR) },
-    { "vkGetBufferMemoryRequirements2KHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements2KHR) },
-    { "vkGetImageSparseMemoryRequirements2KHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements2KHR) },
-    { "vkCreateSamplerYcbcrConversionKHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSamplerYcbcrConversionKHR) },
-    { "vkDestroySamplerYcbcrConversionKHR",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySamplerYcbcrConversionKHR) },
-    { "vkBindBufferMemory2KHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory2KHR) },
-    { "vkBindImageMemory2KHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory2KHR) },
-    { "vkGetDescriptorSetLayoutSupportKHR",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutSupportKHR) },
-    { "vkCmdDrawIndirectCountKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCountKHR) },
-    { "vkCmdDrawIndexedIndirectCountKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCountKHR) },
-    { "vkGetSemaphoreCounterValueKHR",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreCounterValueKHR) },
-    { "vkWaitSemaphoresKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::WaitSemaphoresKHR) },
-    { "vkSignalSemaphoreKHR",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::SignalSemaphoreKHR) },
-    { "vkGetPhysicalDeviceFragmentShadingRatesKHR",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFragmentShadingRatesKHR) },
-    { "vkCmdSetFragmentShadingRateKHR",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFragmentShadingRateKHR) },
-    { "vkCmdSetRenderingAttachmentLocationsKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingAttachmentLocationsKHR) },
-    { "vkCmdSetRenderingInputAttachmentIndicesKHR",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingInputAttachmentIndicesKHR) },
-    { "vkWaitForPresentKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::WaitForPresentKHR) },
-    { "vkGetBufferDeviceAddressKHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddressKHR) },
-    { "vkGetBufferOpaqueCaptureAddressKHR",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferOpaqueCaptureAddressKHR) },
-    { "vkGetDeviceMemoryOpaqueCaptureAddressKHR",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryOpaqueCaptureAddressKHR) },
-    { "vkCreateDeferredOperationKHR",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDeferredOperationKHR) },
-    { "vkDestroyDeferredOperationKHR",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDeferredOperationKHR) },
-    { "vkGetDeferredOperationMaxConcurrencyKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeferredOperationMaxConcurrencyKHR) },
-    { "vkGetDeferredOperationResultKHR",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeferredOperationResultKHR) },
-    { "vkDeferredOperationJoinKHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::DeferredOperationJoinKHR) },
-    { "vkGetPipelineExecutablePropertiesKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutablePropertiesKHR) },
-    { "vkGetPipelineExecutableStatisticsKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutableStatisticsKHR) },
-    { "vkGetPipelineExecutableInternalRepresentationsKHR",                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutableInternalRepresentationsKHR) },
-    { "vkMapMemory2KHR",                                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory2KHR) },
-    { "vkUnmapMemory2KHR",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory2KHR) },
-    { "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR) },
-    { "vkGetEncodedVideoSessionParametersKHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetEncodedVideoSessionParametersKHR) },
-    { "vkCmdEncodeVideoKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEncodeVideoKHR) },
-    { "vkCmdSetEvent2KHR",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent2KHR) },
-    { "vkCmdResetEvent2KHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent2KHR) },
-    { "vkCmdWaitEvents2KHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents2KHR) },
-    { "vkCmdPipelineBarrier2KHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier2KHR) },
-    { "vkCmdWriteTimestamp2KHR",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp2KHR) },
-    { "vkQueueSubmit2KHR",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit2KHR) },
-    { "vkCmdCopyBuffer2KHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer2KHR) },
-    { "vkCmdCopyImage2KHR",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage2KHR) },
-    { "vkCmdCopyBufferToImage2KHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage2KHR) },
-    { "vkCmdCopyImageToBuffer2KHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer2KHR) },
-    { "vkCmdBlitImage2KHR",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage2KHR) },
-    { "vkCmdResolveImage2KHR",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage2KHR) },
-    { "vkCmdTraceRaysIndirect2KHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysIndirect2KHR) },
-    { "vkGetDeviceBufferMemoryRequirementsKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceBufferMemoryRequirementsKHR) },
-    { "vkGetDeviceImageMemoryRequirementsKHR",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageMemoryRequirementsKHR) },
-    { "vkGetDeviceImageSparseMemoryRequirementsKHR",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSparseMemoryRequirementsKHR) },
-    { "vkCmdBindIndexBuffer2KHR",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer2KHR) },
-    { "vkGetRenderingAreaGranularityKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderingAreaGranularityKHR) },
-    { "vkGetDeviceImageSubresourceLayoutKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSubresourceLayoutKHR) },
-    { "vkGetImageSubresourceLayout2KHR",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2KHR) },
-    { "vkCreatePipelineBinariesKHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineBinariesKHR) },
-    { "vkDestroyPipelineBinaryKHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineBinaryKHR) },
-    { "vkGetPipelineKeyKHR",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineKeyKHR) },
-    { "vkGetPipelineBinaryDataKHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineBinaryDataKHR) },
-    { "vkReleaseCapturedPipelineDataKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseCapturedPipelineDataKHR) },
-    { "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR",                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixPropertiesKHR) },
-    { "vkCmdSetLineStippleKHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleKHR) },
-    { "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCalibrateableTimeDomainsKHR) },
-    { "vkGetCalibratedTimestampsKHR",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetCalibratedTimestampsKHR) },
-    { "vkCmdBindDescriptorSets2KHR",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets2KHR) },
-    { "vkCmdPushConstants2KHR",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants2KHR) },
-    { "vkCmdPushDescriptorSet2KHR",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet2KHR) },
-    { "vkCmdPushDescriptorSetWithTemplate2KHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate2KHR) },
-    { "vkCmdSetDescriptorBufferOffsets2EXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDescriptorBufferOffsets2EXT) },
-    { "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT",                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorBufferEmbeddedSamplers2EXT) },
-    { "vkFrameBoundaryANDROID",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::FrameBoundaryANDROID) },
-    { "vkCreateDebugReportCallbackEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDebugReportCallbackEXT) },
-    { "vkDestroyDebugReportCallbackEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDebugReportCallbackEXT) },
-    { "vkDebugReportMessageEXT",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::DebugReportMessageEXT) },
-    { "vkDebugMarkerSetObjectTagEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::DebugMarkerSetObjectTagEXT) },
-    { "vkDebugMarkerSetObjectNameEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::DebugMarkerSetObjectNameEXT) },
-    { "vkCmdDebugMarkerBeginEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerBeginEXT) },
-    { "vkCmdDebugMarkerEndEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerEndEXT) },
-    { "vkCmdDebugMarkerInsertEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerInsertEXT) },
-    { "vkCmdBindTransformFeedbackBuffersEXT",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindTransformFeedbackBuffersEXT) },
-    { "vkCmdBeginTransformFeedbackEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginTransformFeedbackEXT) },
-    { "vkCmdEndTransformFeedbackEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndTransformFeedbackEXT) },
-    { "vkCmdBeginQueryIndexedEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginQueryIndexedEXT) },
-    { "vkCmdEndQueryIndexedEXT",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndQueryIndexedEXT) },
-    { "vkCmdDrawIndirectByteCountEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectByteCountEXT) },
-    { "vkGetImageViewHandleNVX",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewHandleNVX) },
-    { "vkGetImageViewHandle64NVX",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewHandle64NVX) },
-    { "vkGetImageViewAddressNVX",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewAddressNVX) },
-    { "vkCmdDrawIndirectCountAMD",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCountAMD) },
-    { "vkCmdDrawIndexedIndirectCountAMD",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCountAMD) },
-    { "vkGetShaderInfoAMD",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderInfoAMD) },
-    { "vkCreateStreamDescriptorSurfaceGGP",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CreateStreamDescriptorSurfaceGGP) },
-    { "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalImageFormatPropertiesNV) },
-    { "vkGetMemoryWin32HandleNV",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandleNV) },
-    { "vkCreateViSurfaceNN",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateViSurfaceNN) },
-    { "vkCmdBeginConditionalRenderingEXT",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginConditionalRenderingEXT) },
-    { "vkCmdEndConditionalRenderingEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndConditionalRenderingEXT) },
-    { "vkCmdSetViewportWScalingNV",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWScalingNV) },
-    { "vkReleaseDisplayEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseDisplayEXT) },
-    { "vkAcquireXlibDisplayEXT",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireXlibDisplayEXT) },
-    { "vkGetRandROutputDisplayEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetRandROutputDisplayEXT) },
-    { "vkGetPhysicalDeviceSurfaceCapabilities2EXT",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilities2EXT) },
-    { "vkDisplayPowerControlEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::DisplayPowerControlEXT) },
-    { "vkRegisterDeviceEventEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::RegisterDeviceEventEXT) },
-    { "vkRegisterDisplayEventEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::RegisterDisplayEventEXT) },
-    { "vkGetSwapchainCounterEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainCounterEXT) },
-    { "vkGetRefreshCycleDurationGOOGLE",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetRefreshCycleDurationGOOGLE) },
-    { "vkGetPastPresentationTimingGOOGLE",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPastPresentationTimingGOOGLE) },
-    { "vkCmdSetDiscardRectangleEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleEXT) },
-    { "vkCmdSetDiscardRectangleEnableEXT",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleEnableEXT) },
-    { "vkCmdSetDiscardRectangleModeEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleModeEXT) },
-    { "vkSetHdrMetadataEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::SetHdrMetadataEXT) },
-    { "vkCreateIOSSurfaceMVK",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIOSSurfaceMVK) },
-    { "vkCreateMacOSSurfaceMVK",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMacOSSurfaceMVK) },
-    { "vkSetDebugUtilsObjectNameEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::SetDebugUtilsObjectNameEXT) },
-    { "vkSetDebugUtilsObjectTagEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::SetDebugUtilsObjectTagEXT) },
-    { "vkQueueBeginDebugUtilsLabelEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::QueueBeginDebugUtilsLabelEXT) },
-    { "vkQueueEndDebugUtilsLabelEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::QueueEndDebugUtilsLabelEXT) },
-    { "vkQueueInsertDebugUtilsLabelEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::QueueInsertDebugUtilsLabelEXT) },
-    { "vkCmdBeginDebugUtilsLabelEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginDebugUtilsLabelEXT) },
-    { "vkCmdEndDebugUtilsLabelEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndDebugUtilsLabelEXT) },
-    { "vkCmdInsertDebugUtilsLabelEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdInsertDebugUtilsLabelEXT) },
-    { "vkCreateDebugUtilsMessengerEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDebugUtilsMessengerEXT) },
-    { "vkDestroyDebugUtilsMessengerEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDebugUtilsMessengerEXT) },
-    { "vkSubmitDebugUtilsMessageEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::SubmitDebugUtilsMessageEXT) },
-    { "vkGetAndroidHardwareBufferPropertiesANDROID",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetAndroidHardwareBufferPropertiesANDROID) },
-    { "vkGetMemoryAndroidHardwareBufferANDROID",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryAndroidHardwareBufferANDROID) },
-    { "vkCmdSetSampleLocationsEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleLocationsEXT) },
-    { "vkGetPhysicalDeviceMultisamplePropertiesEXT",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMultisamplePropertiesEXT) },
-    { "vkGetImageDrmFormatModifierPropertiesEXT",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageDrmFormatModifierPropertiesEXT) },
-    { "vkCreateValidationCacheEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CreateValidationCacheEXT) },
-    { "vkDestroyValidationCacheEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyValidationCacheEXT) },
-    { "vkMergeValidationCachesEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::MergeValidationCachesEXT) },
-    { "vkGetValidationCacheDataEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetValidationCacheDataEXT) },
-    { "vkCmdBindShadingRateImageNV",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindShadingRateImageNV) },
-    { "vkCmdSetViewportShadingRatePaletteNV",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportShadingRatePaletteNV) },
-    { "vkCmdSetCoarseSampleOrderNV",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoarseSampleOrderNV) },
-    { "vkCreateAccelerationStructureNV",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAccelerationStructureNV) },
-    { "vkDestroyAccelerationStructureNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyAccelerationStructureNV) },
-    { "vkGetAccelerationStructureMemoryRequirementsNV",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureMemoryRequirementsNV) },
-    { "vkBindAccelerationStructureMemoryNV",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::BindAccelerationStructureMemoryNV) },
-    { "vkCmdBuildAccelerationStructureNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructureNV) },
-    { "vkCmdCopyAccelerationStructureNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureNV) },
-    { "vkCmdTraceRaysNV",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysNV) },
-    { "vkCreateRayTracingPipelinesNV",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRayTracingPipelinesNV) },
-    { "vkGetRayTracingShaderGroupHandlesKHR",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupHandlesKHR) },
-    { "vkGetRayTracingShaderGroupHandlesNV",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupHandlesNV) },
-    { "vkGetAccelerationStructureHandleNV",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureHandleNV) },
-    { "vkCmdWriteAccelerationStructuresPropertiesNV",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteAccelerationStructuresPropertiesNV) },
-    { "vkCompileDeferredNV",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CompileDeferredNV) },
-    { "vkGetMemoryHostPointerPropertiesEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryHostPointerPropertiesEXT) },
-    { "vkCmdWriteBufferMarkerAMD",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteBufferMarkerAMD) },
-    { "vkCmdWriteBufferMarker2AMD",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteBufferMarker2AMD) },
-    { "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCalibrateableTimeDomainsEXT) },
-    { "vkGetCalibratedTimestampsEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetCalibratedTimestampsEXT) },
-    { "vkCmdDrawMeshTasksNV",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksNV) },
-    { "vkCmdDrawMeshTasksIndirectNV",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectNV) },
-    { "vkCmdDrawMeshTasksIndirectCountNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectCountNV) },
-    { "vkCmdSetExclusiveScissorEnableNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExclusiveScissorEnableNV) },
-    { "vkCmdSetExclusiveScissorNV",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExclusiveScissorNV) },
-    { "vkCmdSetCheckpointNV",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCheckpointNV) },
-    { "vkGetQueueCheckpointDataNV",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueueCheckpointDataNV) },
-    { "vkGetQueueCheckpointData2NV",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueueCheckpointData2NV) },
-    { "vkInitializePerformanceApiINTEL",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::InitializePerformanceApiINTEL) },
-    { "vkUninitializePerformanceApiINTEL",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::UninitializePerformanceApiINTEL) },
-    { "vkCmdSetPerformanceMarkerINTEL",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceMarkerINTEL) },
-    { "vkCmdSetPerformanceStreamMarkerINTEL",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceStreamMarkerINTEL) },
-    { "vkCmdSetPerformanceOverrideINTEL",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceOverrideINTEL) },
-    { "vkAcquirePerformanceConfigurationINTEL",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::AcquirePerformanceConfigurationINTEL) },
-    { "vkReleasePerformanceConfigurationINTEL",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::ReleasePerformanceConfigurationINTEL) },
-    { "vkQueueSetPerformanceConfigurationINTEL",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSetPerformanceConfigurationINTEL) },
-    { "vkGetPerformanceParameterINTEL",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetPerformanceParameterINTEL) },
-    { "vkSetLocalDimmingAMD",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::SetLocalDimmingAMD) },
-    { "vkCreateImagePipeSurfaceFUCHSIA",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImagePipeSurfaceFUCHSIA) },
-    { "vkCreateMetalSurfaceEXT",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMetalSurfaceEXT) },
-    { "vkGetBufferDeviceAddressEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddressEXT) },
-    { "vkGetPhysicalDeviceToolPropertiesEXT",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceToolPropertiesEXT) },
-    { "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixPropertiesNV) },
-    { "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV) },
-    { "vkGetPhysicalDeviceSurfacePresentModes2EXT",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfacePresentModes2EXT) },
-    { "vkAcquireFullScreenExclusiveModeEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireFullScreenExclusiveModeEXT) },
-    { "vkReleaseFullScreenExclusiveModeEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseFullScreenExclusiveModeEXT) },
-    { "vkGetDeviceGroupSurfacePresentModes2EXT",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupSurfacePresentModes2EXT) },
-    { "vkCreateHeadlessSurfaceEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CreateHeadlessSurfaceEXT) },
-    { "vkCmdSetLineStippleEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleEXT) },
-    { "vkResetQueryPoolEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::ResetQueryPoolEXT) },
-    { "vkCmdSetCullModeEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCullModeEXT) },
-    { "vkCmdSetFrontFaceEXT",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFrontFaceEXT) },
-    { "vkCmdSetPrimitiveTopologyEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveTopologyEXT) },
-    { "vkCmdSetViewportWithCountEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWithCountEXT) },
-    { "vkCmdSetScissorWithCountEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissorWithCountEXT) },
-    { "vkCmdBindVertexBuffers2EXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers2EXT) },
-    { "vkCmdSetDepthTestEnableEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthTestEnableEXT) },
-    { "vkCmdSetDepthWriteEnableEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthWriteEnableEXT) },
-    { "vkCmdSetDepthCompareOpEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthCompareOpEXT) },
-    { "vkCmdSetDepthBoundsTestEnableEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBoundsTestEnableEXT) },
-    { "vkCmdSetStencilTestEnableEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilTestEnableEXT) },
-    { "vkCmdSetStencilOpEXT",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilOpEXT) },
-    { "vkCopyMemoryToImageEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToImageEXT) },
-    { "vkCopyImageToMemoryEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToMemoryEXT) },
-    { "vkCopyImageToImageEXT",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToImageEXT) },
-    { "vkTransitionImageLayoutEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::TransitionImageLayoutEXT) },
-    { "vkGetImageSubresourceLayout2EXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2EXT) },
-    { "vkReleaseSwapchainImagesEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseSwapchainImagesEXT) },
-    { "vkGetGeneratedCommandsMemoryRequirementsNV",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetGeneratedCommandsMemoryRequirementsNV) },
-    { "vkCmdPreprocessGeneratedCommandsNV",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPreprocessGeneratedCommandsNV) },
-    { "vkCmdExecuteGeneratedCommandsNV",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteGeneratedCommandsNV) },
-    { "vkCmdBindPipelineShaderGroupNV",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindPipelineShaderGroupNV) },
-    { "vkCreateIndirectCommandsLayoutNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectCommandsLayoutNV) },
-    { "vkDestroyIndirectCommandsLayoutNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectCommandsLayoutNV) },
-    { "vkCmdSetDepthBias2EXT",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBias2EXT) },
-    { "vkAcquireDrmDisplayEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireDrmDisplayEXT) },
-    { "vkGetDrmDisplayEXT",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetDrmDisplayEXT) },
-    { "vkCreatePrivateDataSlotEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePrivateDataSlotEXT) },
-    { "vkDestroyPrivateDataSlotEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPrivateDataSlotEXT) },
-    { "vkSetPrivateDataEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::SetPrivateDataEXT) },
-    { "vkGetPrivateDataEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetPrivateDataEXT) },
-    { "vkCmdSetFragmentShadingRateEnumNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFragmentShadingRateEnumNV) },
-    { "vkGetDeviceFaultInfoEXT",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceFaultInfoEXT) },
-    { "vkAcquireWinrtDisplayNV",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireWinrtDisplayNV) },
-    { "vkGetWinrtDisplayNV",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetWinrtDisplayNV) },
-    { "vkCreateDirectFBSurfaceEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDirectFBSurfaceEXT) },
-    { "vkGetPhysicalDeviceDirectFBPresentationSupportEXT",                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDirectFBPresentationSupportEXT) },
-    { "vkCmdSetVertexInputEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetVertexInputEXT) },
-    { "vkGetMemoryZirconHandleFUCHSIA",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryZirconHandleFUCHSIA) },
-    { "vkGetMemoryZirconHandlePropertiesFUCHSIA",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryZirconHandlePropertiesFUCHSIA) },
-    { "vkImportSemaphoreZirconHandleFUCHSIA",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreZirconHandleFUCHSIA) },
-    { "vkGetSemaphoreZirconHandleFUCHSIA",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreZirconHandleFUCHSIA) },
-    { "vkCmdBindInvocationMaskHUAWEI",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindInvocationMaskHUAWEI) },
-    { "vkGetMemoryRemoteAddressNV",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryRemoteAddressNV) },
-    { "vkCmdSetPatchControlPointsEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPatchControlPointsEXT) },
-    { "vkCmdSetRasterizerDiscardEnableEXT",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizerDiscardEnableEXT) },
-    { "vkCmdSetDepthBiasEnableEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBiasEnableEXT) },
-    { "vkCmdSetLogicOpEXT",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLogicOpEXT) },
-    { "vkCmdSetPrimitiveRestartEnableEXT",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveRestartEnableEXT) },
-    { "vkCreateScreenSurfaceQNX",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CreateScreenSurfaceQNX) },
-    { "vkGetPhysicalDeviceScreenPresentationSupportQNX",                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceScreenPresentationSupportQNX) },
-    { "vkCmdSetColorWriteEnableEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorWriteEnableEXT) },
-    { "vkCmdDrawMultiEXT",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMultiEXT) },
-    { "vkCmdDrawMultiIndexedEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMultiIndexedEXT) },
-    { "vkCreateMicromapEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMicromapEXT) },
-    { "vkDestroyMicromapEXT",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyMicromapEXT) },
-    { "vkCmdBuildMicromapsEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildMicromapsEXT) },
-    { "vkBuildMicromapsEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::BuildMicromapsEXT) },
-    { "vkCopyMicromapEXT",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMicromapEXT) },
-    { "vkCopyMicromapToMemoryEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMicromapToMemoryEXT) },
-    { "vkCopyMemoryToMicromapEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToMicromapEXT) },
-    { "vkWriteMicromapsPropertiesEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::WriteMicromapsPropertiesEXT) },
-    { "vkCmdCopyMicromapEXT",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMicromapEXT) },
-    { "vkCmdCopyMicromapToMemoryEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMicromapToMemoryEXT) },
-    { "vkCmdCopyMemoryToMicromapEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMemoryToMicromapEXT) },
-    { "vkCmdWriteMicromapsPropertiesEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteMicromapsPropertiesEXT) },
-    { "vkGetDeviceMicromapCompatibilityEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMicromapCompatibilityEXT) },
-    { "vkGetMicromapBuildSizesEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetMicromapBuildSizesEXT) },
-    { "vkCmdDrawClusterHUAWEI",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawClusterHUAWEI) },
-    { "vkCmdDrawClusterIndirectHUAWEI",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawClusterIndirectHUAWEI) },
-    { "vkSetDeviceMemoryPriorityEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::SetDeviceMemoryPriorityEXT) },
-    { "vkGetDescriptorSetLayoutHostMappingInfoVALVE",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutHostMappingInfoVALVE) },
-    { "vkGetDescriptorSetHostMappingVALVE",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetHostMappingVALVE) },
-    { "vkGetPipelineIndirectMemoryRequirementsNV",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineIndirectMemoryRequirementsNV) },
-    { "vkCmdUpdatePipelineIndirectBufferNV",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdUpdatePipelineIndirectBufferNV) },
-    { "vkGetPipelineIndirectDeviceAddressNV",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineIndirectDeviceAddressNV) },
-    { "vkCmdSetDepthClampEnableEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClampEnableEXT) },
-    { "vkCmdSetPolygonModeEXT",                                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPolygonModeEXT) },
-    { "vkCmdSetRasterizationSamplesEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizationSamplesEXT) },
-    { "vkCmdSetSampleMaskEXT",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleMaskEXT) },
-    { "vkCmdSetAlphaToCoverageEnableEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAlphaToCoverageEnableEXT) },
-    { "vkCmdSetAlphaToOneEnableEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAlphaToOneEnableEXT) },
-    { "vkCmdSetLogicOpEnableEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLogicOpEnableEXT) },
-    { "vkCmdSetColorBlendEnableEXT",                                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendEnableEXT) },
-    { "vkCmdSetColorBlendEquationEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendEquationEXT) },
-    { "vkCmdSetColorWriteMaskEXT",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorWriteMaskEXT) },
-    { "vkCmdSetTessellationDomainOriginEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetTessellationDomainOriginEXT) },
-    { "vkCmdSetRasterizationStreamEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizationStreamEXT) },
-    { "vkCmdSetConservativeRasterizationModeEXT",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetConservativeRasterizationModeEXT) },
-    { "vkCmdSetExtraPrimitiveOverestimationSizeEXT",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExtraPrimitiveOverestimationSizeEXT) },
-    { "vkCmdSetDepthClipEnableEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClipEnableEXT) },
-    { "vkCmdSetSampleLocationsEnableEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleLocationsEnableEXT) },
-    { "vkCmdSetColorBlendAdvancedEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendAdvancedEXT) },
-    { "vkCmdSetProvokingVertexModeEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetProvokingVertexModeEXT) },
-    { "vkCmdSetLineRasterizationModeEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineRasterizationModeEXT) },
-    { "vkCmdSetLineStippleEnableEXT",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleEnableEXT) },
-    { "vkCmdSetDepthClipNegativeOneToOneEXT",                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClipNegativeOneToOneEXT) },
-    { "vkCmdSetViewportWScalingEnableNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWScalingEnableNV) },
-    { "vkCmdSetViewportSwizzleNV",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportSwizzleNV) },
-    { "vkCmdSetCoverageToColorEnableNV",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageToColorEnableNV) },
-    { "vkCmdSetCoverageToColorLocationNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageToColorLocationNV) },
-    { "vkCmdSetCoverageModulationModeNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationModeNV) },
-    { "vkCmdSetCoverageModulationTableEnableNV",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationTableEnableNV) },
-    { "vkCmdSetCoverageModulationTableNV",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationTableNV) },
-    { "vkCmdSetShadingRateImageEnableNV",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetShadingRateImageEnableNV) },
-    { "vkCmdSetRepresentativeFragmentTestEnableNV",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRepresentativeFragmentTestEnableNV) },
-    { "vkCmdSetCoverageReductionModeNV",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageReductionModeNV) },
-    { "vkGetShaderModuleIdentifierEXT",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderModuleIdentifierEXT) },
-    { "vkGetShaderModuleCreateInfoIdentifierEXT",                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderModuleCreateInfoIdentifierEXT) },
-    { "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceOpticalFlowImageFormatsNV) },
-    { "vkCreateOpticalFlowSessionNV",                                                                        reinterpret_cast<PFN_vkVoidFunction>(encode::CreateOpticalFlowSessionNV) },
-    { "vkDestroyOpticalFlowSessionNV",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyOpticalFlowSessionNV) },
-    { "vkBindOpticalFlowSessionImageNV",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::BindOpticalFlowSessionImageNV) },
-    { "vkCmdOpticalFlowExecuteNV",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdOpticalFlowExecuteNV) },
-    { "vkAntiLagUpdateAMD",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::AntiLagUpdateAMD) },
-    { "vkCreateShadersEXT",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CreateShadersEXT) },
-    { "vkDestroyShaderEXT",                                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyShaderEXT) },
-    { "vkGetShaderBinaryDataEXT",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderBinaryDataEXT) },
-    { "vkCmdBindShadersEXT",                                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindShadersEXT) },
-    { "vkCmdSetDepthClampRangeEXT",                                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClampRangeEXT) },
-    { "vkGetFramebufferTilePropertiesQCOM",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetFramebufferTilePropertiesQCOM) },
-    { "vkGetDynamicRenderingTilePropertiesQCOM",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetDynamicRenderingTilePropertiesQCOM) },
-    { "vkSetLatencySleepModeNV",                                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::SetLatencySleepModeNV) },
-    { "vkLatencySleepNV",                                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::LatencySleepNV) },
-    { "vkSetLatencyMarkerNV",                                                                                reinterpret_cast<PFN_vkVoidFunction>(encode::SetLatencyMarkerNV) },
-    { "vkGetLatencyTimingsNV",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::GetLatencyTimingsNV) },
-    { "vkQueueNotifyOutOfBandNV",                                                                            reinterpret_cast<PFN_vkVoidFunction>(encode::QueueNotifyOutOfBandNV) },
-    { "vkCmdSetAttachmentFeedbackLoopEnableEXT",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAttachmentFeedbackLoopEnableEXT) },
-    { "vkGetGeneratedCommandsMemoryRequirementsEXT",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::GetGeneratedCommandsMemoryRequirementsEXT) },
-    { "vkCmdPreprocessGeneratedCommandsEXT",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPreprocessGeneratedCommandsEXT) },
-    { "vkCmdExecuteGeneratedCommandsEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteGeneratedCommandsEXT) },
-    { "vkCreateIndirectCommandsLayoutEXT",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectCommandsLayoutEXT) },
-    { "vkDestroyIndirectCommandsLayoutEXT",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectCommandsLayoutEXT) },
-    { "vkCreateIndirectExecutionSetEXT",                                                                     reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectExecutionSetEXT) },
-    { "vkDestroyIndirectExecutionSetEXT",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectExecutionSetEXT) },
-    { "vkUpdateIndirectExecutionSetPipelineEXT",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateIndirectExecutionSetPipelineEXT) },
-    { "vkUpdateIndirectExecutionSetShaderEXT",                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateIndirectExecutionSetShaderEXT) },
-    { "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",                                  reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV) },
-    { "vkCreateAccelerationStructureKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAccelerationStructureKHR) },
-    { "vkDestroyAccelerationStructureKHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyAccelerationStructureKHR) },
-    { "vkCmdBuildAccelerationStructuresKHR",                                                                 reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructuresKHR) },
-    { "vkCmdBuildAccelerationStructuresIndirectKHR",                                                         reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructuresIndirectKHR) },
-    { "vkBuildAccelerationStructuresKHR",                                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::BuildAccelerationStructuresKHR) },
-    { "vkCopyAccelerationStructureKHR",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CopyAccelerationStructureKHR) },
-    { "vkCopyAccelerationStructureToMemoryKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CopyAccelerationStructureToMemoryKHR) },
-    { "vkCopyMemoryToAccelerationStructureKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToAccelerationStructureKHR) },
-    { "vkWriteAccelerationStructuresPropertiesKHR",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::WriteAccelerationStructuresPropertiesKHR) },
-    { "vkCmdCopyAccelerationStructureKHR",                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureKHR) },
-    { "vkCmdCopyAccelerationStructureToMemoryKHR",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureToMemoryKHR) },
-    { "vkCmdCopyMemoryToAccelerationStructureKHR",                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMemoryToAccelerationStructureKHR) },
-    { "vkGetAccelerationStructureDeviceAddressKHR",                                                          reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureDeviceAddressKHR) },
-    { "vkCmdWriteAccelerationStructuresPropertiesKHR",                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteAccelerationStructuresPropertiesKHR) },
-    { "vkGetDeviceAccelerationStructureCompatibilityKHR",                                                    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceAccelerationStructureCompatibilityKHR) },
-    { "vkGetAccelerationStructureBuildSizesKHR",                                                             reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureBuildSizesKHR) },
-    { "vkCmdTraceRaysKHR",                                                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysKHR) },
-    { "vkCreateRayTracingPipelinesKHR",                                                                      reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRayTracingPipelinesKHR) },
-    { "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",                                                   reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingCaptureReplayShaderGroupHandlesKHR) },
-    { "vkCmdTraceRaysIndirectKHR",                                                                           reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysIndirectKHR) },
-    { "vkGetRayTracingShaderGroupStackSizeKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupStackSizeKHR) },
-    { "vkCmdSetRayTracingPipelineStackSizeKHR",                                                              reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRayTracingPipelineStackSizeKHR) },
-    { "vkCmdDrawMeshTasksEXT",                                                                               reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksEXT) },
-    { "vkCmdDrawMeshTasksIndirectEXT",                                                                       reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectEXT) },
-    { "vkCmdDrawMeshTasksIndirectCountEXT",                                                                  reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectCountEXT) },
-    { "vk_layerGetPhysicalDeviceProcAddr",                                                                   reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetPhysicalDeviceProcAddr) },
+const PFN_vkVoidFunction kVulkanFuncTableFunctions[kVulkanFuncTableSize] = {
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateDeviceLayerProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySemaphore),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawClusterHUAWEI),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageToColorEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceBufferMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdInsertDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceOverrideINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCalibrateableTimeDomainsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerInsertEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructuresKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginTransformFeedbackEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueuePresentKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMultiIndexedEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearDepthStencilImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilOpEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateViSurfaceNN),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseProfilingLockKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetDeviceProcAddr),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyShaderEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureBuildSizesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectCommandsLayoutEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceGroups),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysIndirect2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateOpticalFlowSessionNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClipEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetDeviceMemoryPriorityEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetLatencyMarkerNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::MergePipelineCaches),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WaitForFences),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdUpdatePipelineIndirectBufferNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveTopologyEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteAccelerationStructuresPropertiesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceToolPropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIOSSurfaceMVK),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WaitSemaphoresKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizationStreamEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyVideoSessionParametersKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthTestEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseSwapchainImagesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::TrimCommandPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineIndirectMemoryRequirementsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DebugMarkerSetObjectTagEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainStatusKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationTableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireWinrtDisplayNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorUpdateTemplate),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDebugReportCallbackEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryHostPointerPropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineKeyKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSetWithTemplate),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetHdrMetadataEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchBase),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::FlushMappedMemoryRanges),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindInvocationMaskHUAWEI),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateCommandBuffers),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMacOSSurfaceMVK),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySamplerYcbcrConversionKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceToolProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryAndroidHardwareBufferANDROID),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyAccelerationStructureToMemoryKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSetWithTemplateKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndConditionalRenderingEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::EndCommandBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleMaskEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMemoryToAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreWin32HandleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyFramebuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRayTracingPipelinesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExclusiveScissorEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfacePresentModes2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImagePipeSurfaceFUCHSIA),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissorWithCountEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendEquationEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateDeviceExtensionProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetCalibratedTimestampsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingInputAttachmentIndices),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::FreeCommandBuffers),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteBufferMarkerAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderingKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePrivateDataSlotEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetEventStatus),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteBufferMarker2AMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingInputAttachmentIndicesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetShadingRateImageEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthCompareOpEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSwapchainKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetPrivateDataEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorBufferEmbeddedSamplers2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalBufferProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewport),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetQueryPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::LatencySleepNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetWinrtDisplayNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteGeneratedCommandsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueryPoolResults),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDebugReportCallbackEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectCountNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutableInternalRepresentationsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCountKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseCapturedPipelineDataKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyBufferView),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateInstance),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRepresentativeFragmentTestEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryFdPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPreprocessGeneratedCommandsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetPrivateData),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoFormatPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDirectFBSurfaceEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClampEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateXlibSurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAttachmentFeedbackLoopEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceImageFormatProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureMemoryRequirementsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorSetLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureToMemoryKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreZirconHandleFUCHSIA),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteMicromapsPropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineIndirectDeviceAddressNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalBufferPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDevice),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandleNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPastPresentationTimingGOOGLE),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCalibrateableTimeDomainsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireFullScreenExclusiveModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetFramebufferTilePropertiesQCOM),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDebugUtilsMessengerEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineBinaryKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteGeneratedCommandsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueueCheckpointData2NV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireNextImageKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindPipelineShaderGroupNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDeviceMaskKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthTestEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryZirconHandleFUCHSIA),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::MergeValidationCachesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizerDiscardEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCountKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupHandlesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateXcbSurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPolygonModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStipple),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilitiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueInsertDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingAttachmentLocations),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCullMode),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderBinaryDataEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSubresourceLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyOpticalFlowSessionNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateValidationCacheEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SignalSemaphore),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryZirconHandlePropertiesFUCHSIA),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfacePresentModesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRendering),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoCapabilitiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseDisplayEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexed),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetDebugUtilsObjectTagEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRayTracingPipelineStackSizeKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPrivateDataSlotEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WaitForPresentKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPreprocessGeneratedCommandsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWithCountEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetVertexInputEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BeginCommandBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceQueue),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetQueryPoolEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireXlibDisplayEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveTopology),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateWaylandSurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysIndirectKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetQueueCheckpointDataNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSamplerYcbcrConversionKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetCommandBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorUpdateTemplateKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearColorImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSparseMemoryRequirementsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDevice),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateWin32SurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilTestEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceWaylandPresentationSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLogicOpEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::TrimCommandPoolKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::TransitionImageLayoutEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetDebugUtilsObjectNameEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectByteCountEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorBlendAdvancedEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceFormats2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBounds),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImageView),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineCacheData),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindPipeline),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdFillBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineStippleEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindOpticalFlowSessionImageNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateIndirectExecutionSetPipelineEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWithCount),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AllocateDescriptorSets),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDirectFBPresentationSupportEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineCache),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchIndirect),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRefreshCycleDurationGOOGLE),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdUpdateBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateIndirectExecutionSetShaderEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ImportFenceWin32HandleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetPhysicalDeviceProcAddr),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetAndroidHardwareBufferPropertiesANDROID),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateVideoSessionKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindShadersEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissor),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindShadingRateImageNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::TransitionImageLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateShaderModule),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WaitSemaphores),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySampler),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureDeviceAddressKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPlaneProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRenderPass2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveRestartEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerBeginEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSamplerYcbcrConversion),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ImportFenceFdKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImageToBuffer2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMemoryToMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAlphaToOneEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginVideoCodingKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatchBaseKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePrivateDataSlot),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCount),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplate2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::InvalidateMappedMemoryRanges),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceBufferMemoryRequirementsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToImageEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDraw),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFrontFace),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCount),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPeerMemoryFeaturesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceXcbPresentationSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::FreeMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdControlVideoCodingKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueEndDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalSemaphorePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteAccelerationStructuresPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetHostMappingVALVE),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindAccelerationStructureMemoryNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMicromapToMemoryEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndTransformFeedbackEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineWidth),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorUpdateTemplateKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDisplayModeKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CompileDeferredNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWScalingNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRenderingAttachmentLocationsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdOpticalFlowExecuteNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BuildAccelerationStructuresKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayModeProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDecodeVideoKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDebugUtilsMessengerEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizerDiscardEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryFdKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::MapMemory2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructuresIndirectKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceWin32PresentationSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderingKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyValidationCacheEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateVideoSessionParametersKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDeferredOperationKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndQuery),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UninitializePerformanceApiINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirectCountAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDrmDisplayEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryCommitment),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateCommandPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDeferredOperationKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetGeneratedCommandsMemoryRequirementsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineBinariesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderModuleCreateInfoIdentifierEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDispatch),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateFence),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySwapchainKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceFormatsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyRenderPass),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceQueueFamilyProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupHandlesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceCooperativeMatrixPropertiesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewAddressNVX),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilCompareMask),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageDrmFormatModifierPropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPresentCapabilitiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WriteAccelerationStructuresPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAndroidSurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMicromapToMemoryEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalSemaphoreProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageMemoryRequirementsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationTableEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryOpaqueCaptureAddress),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetScissorWithCount),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateRayTracingPipelinesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceFaultInfoEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindVideoSessionMemoryKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreFdKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLineRasterizationModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleaseFullScreenExclusiveModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAccelerationStructureKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectExecutionSetEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySamplerYcbcrConversion),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetAccelerationStructureHandleNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetValidationCacheDataEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyImage2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceScreenPresentationSupportQNX),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBiasEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdTraceRaysKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDevicePresentRectanglesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetBlendConstants),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutablePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginQueryIndexedEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWriteTimestamp),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPrivateDataSlot),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutHostMappingInfoVALVE),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdExecuteCommands),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawClusterIndirectHUAWEI),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyInstance),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindImageMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceOpticalFlowImageFormatsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDisplayPlaneSurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFragmentShadingRateEnumNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateHeadlessSurfaceEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBufferToImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetLatencySleepModeNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateScreenSurfaceQNX),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPerformanceParameterINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFeatures2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectCommandsLayoutNV),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateInstanceExtensionProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryRemoteAddressNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleLocationsEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineExecutableStatisticsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceWin32HandleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyFence),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupSurfacePresentModesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreCounterValueKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceDisplayPlanePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPrimitiveRestartEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDeviceGroupsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DebugReportMessageEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildMicromapsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRandROutputDisplayEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyQueryPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBuildAccelerationStructureNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBlitImage2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineCache),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyAccelerationStructureNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectExecutionSetEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetLatencyTimingsNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdClearAttachments),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetSampleLocationsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindDescriptorSets2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirect),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageModulationModeNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateAccelerationStructureNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::RegisterDisplayEventEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndexedIndirect),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DeviceWaitIdle),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceQueue2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMicromapBuildSizesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BuildMicromapsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingCaptureReplayShaderGroupHandlesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyImageView),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDynamicRenderingTilePropertiesQCOM),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSetWithTemplateKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageToColorLocationNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetRasterizationSamplesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneCapabilitiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueNotifyOutOfBandNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthWriteEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPipelineBinaryDataKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DebugMarkerSetObjectNameEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireNextImage2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipelineLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPrivateDataEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetVideoSessionMemoryRequirementsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderingAreaGranularity),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateGraphicsPipelines),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateBufferView),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPatchControlPointsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilOp),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportWScalingEnableNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyIndirectCommandsLayoutNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginQuery),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBiasEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMemoryOpaqueCaptureAddressKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::FreeDescriptorSets),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewHandleNVX),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMultisamplePropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetCommandPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireDrmDisplayEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyShaderModule),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEncodeVideoKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroySurfaceKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::RegisterDeviceEventEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindVertexBuffers2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorWriteEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddress),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageMemoryRequirements2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateIndirectCommandsLayoutEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCheckpointNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferOpaqueCaptureAddress),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::EnumeratePhysicalDevices),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndVideoCodingKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateMetalSurfaceEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyPipeline),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPipelineBarrier2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDiscardRectangleModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRendering),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeferredOperationResultKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetEncodedVideoSessionParametersKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDebugMarkerEndEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceMemoryProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportShadingRatePaletteNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ImportSemaphoreFdKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMemoryToImageEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreZirconHandleFUCHSIA),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSparseImageFormatProperties2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSubresourceLayoutKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindTransformFeedbackBuffersEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetProvokingVertexModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceAccelerationStructureCompatibilityKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthCompareOp),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMeshTasksIndirectCountEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SubmitDebugUtilsMessageEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderingAreaGranularityKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetQueryPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UnmapMemory2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainCounterEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquireProfilingLockKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSemaphore),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneSupportedDisplaysKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateComputePipelines),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetViewportSwizzleNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceStatus),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::FrameBoundaryANDROID),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdNextSubpass),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRayTracingShaderGroupStackSizeKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetMemoryWin32HandlePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::InitializePerformanceApiINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClampRangeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndRenderPass),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddressEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateShadersEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferMemoryRequirements2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyImageToMemoryEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetGeneratedCommandsMemoryRequirementsEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawIndirectCountAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueBindSparse),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetCalibratedTimestampsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndQueryIndexedEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetTessellationDomainOriginEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayPlaneCapabilities2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdDrawMultiEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthWriteEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPrivateData),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::EnumerateInstanceLayerProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CopyMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFormatProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoverageReductionModeNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyQueryPoolResults),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyVideoSessionKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderInfoAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ReleasePerformanceConfigurationINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueWaitIdle),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBoundsTestEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageViewHandle64NVX),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceXlibPresentationSupportKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateQueryPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueBeginDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBias2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetInstanceProcAddr),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DeferredOperationJoinKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSetPerformanceConfigurationINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFrontFaceEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::QueueSubmit2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBoundsTestEnable),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDescriptorBufferOffsets2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::BindBufferMemory2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateDescriptorSets),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupSurfacePresentModes2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreWin32HandleKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExclusiveScissorNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::UpdateVideoSessionParametersKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceGroupPeerMemoryFeatures),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceFragmentShadingRatesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceProperties2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetDescriptorPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetAlphaToCoverageEnableEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferOpaqueCaptureAddressKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdCopyBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SignalSemaphoreKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateFramebuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AntiLagUpdateAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginConditionalRenderingEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCullModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResolveImage2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthClipNegativeOneToOneEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetLogicOpEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetShaderModuleIdentifierEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSparseMemoryRequirements2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetFragmentShadingRateKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilities2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDisplayModePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateImage),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceImageSparseMemoryRequirements),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceStreamMarkerINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushDescriptorSet),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyMicromapEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceSurfaceCapabilities2EXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreatePipelineLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyDescriptorUpdateTemplate),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::SetLocalDimmingAMD),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdEndDebugUtilsLabelEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSharedSwapchainsKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetExtraPrimitiveOverestimationSizeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetPerformanceMarkerINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdWaitEvents2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateStreamDescriptorSurfaceGGP),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::AcquirePerformanceConfigurationINTEL),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeviceMicromapCompatibilityEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdResetEvent),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilWriteMask),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyCommandPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetRenderAreaGranularity),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBeginRenderPass2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalFenceProperties),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetCoarseSampleOrderNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::WriteMicromapsPropertiesEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDepthBias),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDescriptorSetLayoutSupport),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateSampler),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DisplayPowerControlEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorSetLayout),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdBindIndexBuffer2KHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CreateDescriptorPool),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetFenceFdKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetColorWriteMaskEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSwapchainImagesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetBufferDeviceAddressKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::ResetFences),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetImageSubresourceLayout2),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalFencePropertiesKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilReference),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdPushConstants),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetSemaphoreCounterValue),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::DestroyBuffer),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetPhysicalDeviceExternalImageFormatPropertiesNV),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetDeviceMask),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::GetDeferredOperationMaxConcurrencyKHR),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetConservativeRasterizationModeEXT),
+    reinterpret_cast<PFN_vkVoidFunction>(encode::CmdSetStencilTestEnable),
 };
 
+// Returns the layer's implementation of the named Vulkan API call, or nullptr.
+inline PFN_vkVoidFunction GetVulkanFuncTableEntry(const char* name)
+{
+    const uint32_t index = GetVulkanFuncTableIndex(name);
+    return (index < kVulkanFuncTableSize) ? kVulkanFuncTableFunctions[index] : nullptr;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
 
 #endif
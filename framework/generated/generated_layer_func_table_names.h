@@ -0,0 +1,779 @@
+/*
+** Copyright (c) 2018-2023 Valve Corporation
+** Copyright (c) 2018-2023 LunarG, Inc.
+** Copyright (c) 2023 Advanced Micro Devices, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+** This file is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#ifndef  GFXRECON_GENERATED_LAYER_FUNC_TABLE_NAMES_H
+#define  GFXRECON_GENERATED_LAYER_FUNC_TABLE_NAMES_H
+
+#include "util/defines.h"
+#include "util/hash.h"
+
+#include <cstdint>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Minimal perfect hash table of the Vulkan API calls exported by the layer.
+constexpr uint32_t kVulkanFuncTableSize      = 675;
+constexpr uint32_t kVulkanFuncTableSeedCount = 338;
+
+constexpr uint32_t kVulkanFuncTableSeeds[kVulkanFuncTableSeedCount] = {
+    2, 0, 1, 5, 0, 0, 8, 7,
+    33, 2, 2, 3, 3, 0, 0, 3,
+    0, 0, 2, 0, 0, 0, 0, 1,
+    1, 1, 5, 0, 1, 0, 1, 0,
+    15, 14, 0, 8, 12, 0, 9, 0,
+    3, 7, 1, 3, 17, 3, 4, 22,
+    0, 14, 4, 14, 0, 0, 0, 12,
+    0, 0, 18, 0, 0, 2, 3, 13,
+    0, 37, 5, 1, 0, 4, 18, 0,
+    12, 0, 2, 3, 3, 3, 9, 6,
+    0, 0, 17, 3, 11, 13, 22, 0,
+    26, 0, 5, 0, 0, 2, 1, 9,
+    0, 2, 3, 26, 0, 6, 6, 1,
+    4, 22, 0, 2, 7, 0, 1, 0,
+    0, 7, 0, 5, 23, 1, 0, 18,
+    0, 15, 0, 1, 0, 49, 3, 0,
+    4, 19, 2, 8, 20, 0, 19, 3,
+    0, 42, 4, 40, 1, 44, 10, 0,
+    3, 0, 4, 3, 0, 0, 1, 0,
+    3, 14, 11, 0, 4, 0, 1, 7,
+    6, 0, 7, 19, 1, 40, 7, 14,
+    5, 0, 5, 1, 44, 2, 9, 11,
+    0, 1, 14, 8, 6, 111, 3, 16,
+    3, 1, 0, 0, 5, 22, 2, 0,
+    11, 1, 9, 71, 0, 3, 0, 2,
+    0, 1, 2, 1, 0, 34, 6, 0,
+    0, 0, 0, 6, 2, 14, 1, 0,
+    0, 0, 0, 4, 6, 0, 41, 42,
+    0, 53, 6, 0, 11, 24, 55, 0,
+    0, 1, 0, 22, 1, 0, 1, 3,
+    11, 18, 33, 6, 55, 13, 12, 2,
+    23, 14, 1, 0, 0, 68, 0, 30,
+    0, 0, 0, 12, 14, 70, 69, 33,
+    0, 22, 0, 0, 22, 20, 0, 32,
+    15, 7, 19, 9, 38, 35, 7, 15,
+    5, 4, 24, 1, 0, 90, 56, 142,
+    47, 2, 7, 192, 70, 12, 11, 0,
+    1, 29, 22, 20, 72, 0, 25, 63,
+    43, 0, 0, 11, 38, 2, 32, 16,
+    0, 271, 94, 17, 0, 72, 4, 23,
+    38, 208, 2, 0, 294, 15, 275, 0,
+    295, 15, 552, 178, 14, 8, 3, 0,
+    43, 3,
+};
+
+constexpr const char* kVulkanFuncTableNames[kVulkanFuncTableSize] = {
+    "vkEnumerateDeviceLayerProperties",
+    "vkGetImageSubresourceLayout2KHR",
+    "vkDestroySemaphore",
+    "vkCmdDrawClusterHUAWEI",
+    "vkCmdSetCoverageToColorEnableNV",
+    "vkGetDeviceBufferMemoryRequirements",
+    "vkCmdInsertDebugUtilsLabelEXT",
+    "vkCmdSetPerformanceOverrideINTEL",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR",
+    "vkCmdCopyImageToBuffer2",
+    "vkQueueSubmit2KHR",
+    "vkCmdDebugMarkerInsertEXT",
+    "vkCmdBuildAccelerationStructuresKHR",
+    "vkCmdBeginTransformFeedbackEXT",
+    "vkCmdWriteTimestamp2",
+    "vkCopyImageToImage",
+    "vkQueuePresentKHR",
+    "vkCmdDrawMultiIndexedEXT",
+    "vkCopyAccelerationStructureKHR",
+    "vkCmdClearDepthStencilImage",
+    "vkGetPhysicalDeviceImageFormatProperties",
+    "vkCmdSetStencilOpEXT",
+    "vkCreateViSurfaceNN",
+    "vkReleaseProfilingLockKHR",
+    "vkGetDeviceProcAddr",
+    "vkDestroyShaderEXT",
+    "vkGetAccelerationStructureBuildSizesKHR",
+    "vkDestroyIndirectCommandsLayoutEXT",
+    "vkEnumeratePhysicalDeviceGroups",
+    "vkCmdTraceRaysIndirect2KHR",
+    "vkCreateOpticalFlowSessionNV",
+    "vkCmdSetDepthClipEnableEXT",
+    "vkSetDeviceMemoryPriorityEXT",
+    "vkCmdBindVertexBuffers2EXT",
+    "vkSetLatencyMarkerNV",
+    "vkMergePipelineCaches",
+    "vkWaitForFences",
+    "vkCmdUpdatePipelineIndirectBufferNV",
+    "vkCmdSetPrimitiveTopologyEXT",
+    "vkCmdWriteAccelerationStructuresPropertiesNV",
+    "vkGetPhysicalDeviceToolPropertiesEXT",
+    "vkCreateIOSSurfaceMVK",
+    "vkWaitSemaphoresKHR",
+    "vkCmdSetRasterizationStreamEXT",
+    "vkDestroyVideoSessionParametersKHR",
+    "vkCmdSetDepthTestEnable",
+    "vkGetBufferMemoryRequirements",
+    "vkReleaseSwapchainImagesEXT",
+    "vkTrimCommandPool",
+    "vkCmdPipelineBarrier",
+    "vkGetPipelineIndirectMemoryRequirementsNV",
+    "vkDebugMarkerSetObjectTagEXT",
+    "vkGetSwapchainStatusKHR",
+    "vkCmdSetCoverageModulationTableNV",
+    "vkAcquireWinrtDisplayNV",
+    "vkCreateDescriptorUpdateTemplate",
+    "vkCreateDebugReportCallbackEXT",
+    "vkCmdCopyBuffer2KHR",
+    "vkGetMemoryHostPointerPropertiesEXT",
+    "vkGetPipelineKeyKHR",
+    "vkCopyImageToMemory",
+    "vkUpdateDescriptorSetWithTemplate",
+    "vkSetHdrMetadataEXT",
+    "vkCmdDispatchBase",
+    "vkFlushMappedMemoryRanges",
+    "vkCmdBindInvocationMaskHUAWEI",
+    "vkAllocateCommandBuffers",
+    "vkCreateMacOSSurfaceMVK",
+    "vkDestroySamplerYcbcrConversionKHR",
+    "vkGetPhysicalDeviceToolProperties",
+    "vkGetMemoryAndroidHardwareBufferANDROID",
+    "vkGetPhysicalDeviceDisplayPropertiesKHR",
+    "vkCopyAccelerationStructureToMemoryKHR",
+    "vkUpdateDescriptorSetWithTemplateKHR",
+    "vkCmdEndConditionalRenderingEXT",
+    "vkGetPhysicalDeviceImageFormatProperties2KHR",
+    "vkEndCommandBuffer",
+    "vkCmdSetSampleMaskEXT",
+    "vkCmdCopyMemoryToAccelerationStructureKHR",
+    "vkCmdSetColorBlendEnableEXT",
+    "vkImportSemaphoreWin32HandleKHR",
+    "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV",
+    "vkUnmapMemory2",
+    "vkDestroyFramebuffer",
+    "vkCreateRayTracingPipelinesKHR",
+    "vkCmdSetExclusiveScissorEnableNV",
+    "vkGetPhysicalDeviceSurfacePresentModes2EXT",
+    "vkGetPhysicalDeviceFeatures",
+    "vkCreateImagePipeSurfaceFUCHSIA",
+    "vkCmdSetScissorWithCountEXT",
+    "vkCmdCopyImage2",
+    "vkCmdSetColorBlendEquationEXT",
+    "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+    "vkEnumerateDeviceExtensionProperties",
+    "vkBindImageMemory2KHR",
+    "vkGetCalibratedTimestampsEXT",
+    "vkAllocateMemory",
+    "vkCmdSetRenderingInputAttachmentIndices",
+    "vkGetImageSparseMemoryRequirements2",
+    "vkFreeCommandBuffers",
+    "vkCmdWriteBufferMarkerAMD",
+    "vkCmdEndRenderingKHR",
+    "vkCreatePrivateDataSlotEXT",
+    "vkGetEventStatus",
+    "vkMapMemory2",
+    "vkCmdWriteBufferMarker2AMD",
+    "vkCmdSetRenderingInputAttachmentIndicesKHR",
+    "vkCmdSetShadingRateImageEnableNV",
+    "vkCmdSetDepthCompareOpEXT",
+    "vkCreateSwapchainKHR",
+    "vkSetPrivateDataEXT",
+    "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT",
+    "vkGetPhysicalDeviceExternalBufferProperties",
+    "vkCmdSetViewport",
+    "vkCmdCopyAccelerationStructureNV",
+    "vkCmdResetQueryPool",
+    "vkLatencySleepNV",
+    "vkCmdBindDescriptorSets",
+    "vkGetWinrtDisplayNV",
+    "vkMapMemory",
+    "vkCmdExecuteGeneratedCommandsNV",
+    "vkCmdPushDescriptorSetWithTemplate2KHR",
+    "vkCmdSetLineStippleKHR",
+    "vkGetQueryPoolResults",
+    "vkDestroyDebugReportCallbackEXT",
+    "vkCmdDrawMeshTasksIndirectCountNV",
+    "vkGetPipelineExecutableInternalRepresentationsKHR",
+    "vkCreateRenderPass2KHR",
+    "vkCmdDrawIndirectCountKHR",
+    "vkReleaseCapturedPipelineDataKHR",
+    "vkDestroyBufferView",
+    "vkCreateInstance",
+    "vkCmdSetRepresentativeFragmentTestEnableNV",
+    "vkCmdBeginRenderPass2KHR",
+    "vkGetMemoryFdPropertiesKHR",
+    "vkCmdPreprocessGeneratedCommandsEXT",
+    "vkSetPrivateData",
+    "vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+    "vkCreateDirectFBSurfaceEXT",
+    "vkCmdSetDepthClampEnableEXT",
+    "vkCreateXlibSurfaceKHR",
+    "vkCmdCopyImageToBuffer",
+    "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+    "vkCmdNextSubpass2KHR",
+    "vkGetPhysicalDeviceImageFormatProperties2",
+    "vkGetPhysicalDeviceProperties2KHR",
+    "vkGetAccelerationStructureMemoryRequirementsNV",
+    "vkDestroyDescriptorSetLayout",
+    "vkCmdCopyAccelerationStructureToMemoryKHR",
+    "vkImportSemaphoreZirconHandleFUCHSIA",
+    "vkCmdWriteMicromapsPropertiesEXT",
+    "vkGetPipelineIndirectDeviceAddressNV",
+    "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+    "vkCreateDevice",
+    "vkGetMemoryWin32HandleNV",
+    "vkGetPastPresentationTimingGOOGLE",
+    "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+    "vkAcquireFullScreenExclusiveModeEXT",
+    "vkGetFramebufferTilePropertiesQCOM",
+    "vkBindImageMemory2",
+    "vkDestroyDebugUtilsMessengerEXT",
+    "vkDestroyPipelineBinaryKHR",
+    "vkGetPhysicalDeviceMemoryProperties2KHR",
+    "vkCmdExecuteGeneratedCommandsEXT",
+    "vkGetQueueCheckpointData2NV",
+    "vkAcquireNextImageKHR",
+    "vkCmdBindPipelineShaderGroupNV",
+    "vkCmdSetDeviceMaskKHR",
+    "vkCmdSetDepthTestEnableEXT",
+    "vkGetMemoryZirconHandleFUCHSIA",
+    "vkMergeValidationCachesEXT",
+    "vkCmdSetRasterizerDiscardEnableEXT",
+    "vkCmdDrawIndexedIndirectCountKHR",
+    "vkGetImageSubresourceLayout",
+    "vkGetRayTracingShaderGroupHandlesNV",
+    "vkCreateXcbSurfaceKHR",
+    "vkCmdSetPolygonModeEXT",
+    "vkCmdSetLineStipple",
+    "vkCmdSetDiscardRectangleEXT",
+    "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+    "vkCmdBeginRenderPass",
+    "vkQueueInsertDebugUtilsLabelEXT",
+    "vkCmdWriteTimestamp2KHR",
+    "vkGetImageSparseMemoryRequirements",
+    "vkCmdSetEvent2",
+    "vkCmdSetRenderingAttachmentLocations",
+    "vkCmdSetCullMode",
+    "vkGetShaderBinaryDataEXT",
+    "vkGetDeviceImageSubresourceLayout",
+    "vkCreateRenderPass",
+    "vkCmdPipelineBarrier2",
+    "vkGetImageMemoryRequirements2",
+    "vkDestroyOpticalFlowSessionNV",
+    "vkCreateValidationCacheEXT",
+    "vkSignalSemaphore",
+    "vkGetMemoryZirconHandlePropertiesFUCHSIA",
+    "vkGetPhysicalDeviceSurfacePresentModesKHR",
+    "vkCmdSetLineStippleEXT",
+    "vkDestroyEvent",
+    "vkCmdEndRendering",
+    "vkGetPhysicalDeviceVideoCapabilitiesKHR",
+    "vkReleaseDisplayEXT",
+    "vkCmdDrawIndexed",
+    "vkSetDebugUtilsObjectTagEXT",
+    "vkCmdSetRayTracingPipelineStackSizeKHR",
+    "vkDestroyPrivateDataSlotEXT",
+    "vkWaitForPresentKHR",
+    "vkCmdPreprocessGeneratedCommandsNV",
+    "vkCmdSetViewportWithCountEXT",
+    "vkCmdSetVertexInputEXT",
+    "vkCmdNextSubpass2",
+    "vkCmdCopyBufferToImage2",
+    "vkCmdSetEvent2KHR",
+    "vkBeginCommandBuffer",
+    "vkGetDeviceQueue",
+    "vkResetQueryPoolEXT",
+    "vkAcquireXlibDisplayEXT",
+    "vkCmdSetPrimitiveTopology",
+    "vkCreateWaylandSurfaceKHR",
+    "vkCmdTraceRaysIndirectKHR",
+    "vkGetQueueCheckpointDataNV",
+    "vkCreateSamplerYcbcrConversionKHR",
+    "vkResetCommandBuffer",
+    "vkCreateDescriptorUpdateTemplateKHR",
+    "vkCmdPushDescriptorSetWithTemplate",
+    "vkCmdClearColorImage",
+    "vkCmdPushConstants2KHR",
+    "vkCmdBeginDebugUtilsLabelEXT",
+    "vkGetDescriptorSetLayoutSupportKHR",
+    "vkGetDeviceImageSparseMemoryRequirementsKHR",
+    "vkDestroyDevice",
+    "vkCmdPushDescriptorSet2",
+    "vkCreateWin32SurfaceKHR",
+    "vkCmdSetStencilTestEnableEXT",
+    "vkGetDeviceImageMemoryRequirements",
+    "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+    "vkCmdPushConstants2",
+    "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+    "vkCmdSetLogicOpEnableEXT",
+    "vkTrimCommandPoolKHR",
+    "vkTransitionImageLayoutEXT",
+    "vkSetDebugUtilsObjectNameEXT",
+    "vkUnmapMemory",
+    "vkCmdDrawIndirectByteCountEXT",
+    "vkGetPhysicalDeviceFormatProperties2KHR",
+    "vkCmdSetColorBlendAdvancedEXT",
+    "vkGetPhysicalDeviceSurfaceFormats2KHR",
+    "vkCmdResolveImage2KHR",
+    "vkCmdSetDepthBounds",
+    "vkCreateImageView",
+    "vkGetPipelineCacheData",
+    "vkCmdBindPipeline",
+    "vkCmdFillBuffer",
+    "vkCmdSetLineStippleEnableEXT",
+    "vkBindOpticalFlowSessionImageNV",
+    "vkCreateMicromapEXT",
+    "vkUpdateIndirectExecutionSetPipelineEXT",
+    "vkCmdSetViewportWithCount",
+    "vkAllocateDescriptorSets",
+    "vkGetPhysicalDeviceDirectFBPresentationSupportEXT",
+    "vkDestroyPipelineCache",
+    "vkCmdDispatchIndirect",
+    "vkGetRefreshCycleDurationGOOGLE",
+    "vkCmdUpdateBuffer",
+    "vkUpdateIndirectExecutionSetShaderEXT",
+    "vkImportFenceWin32HandleKHR",
+    "vk_layerGetPhysicalDeviceProcAddr",
+    "vkGetAndroidHardwareBufferPropertiesANDROID",
+    "vkCmdDrawMeshTasksEXT",
+    "vkGetPhysicalDeviceSparseImageFormatProperties",
+    "vkGetPhysicalDeviceMemoryProperties",
+    "vkCreateVideoSessionKHR",
+    "vkCmdBindShadersEXT",
+    "vkCmdSetScissor",
+    "vkCmdBindShadingRateImageNV",
+    "vkTransitionImageLayout",
+    "vkCreateShaderModule",
+    "vkWaitSemaphores",
+    "vkDestroySampler",
+    "vkGetAccelerationStructureDeviceAddressKHR",
+    "vkDestroyAccelerationStructureKHR",
+    "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+    "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+    "vkCreateRenderPass2",
+    "vkCmdSetPrimitiveRestartEnableEXT",
+    "vkCmdSetDiscardRectangleEnableEXT",
+    "vkCmdDebugMarkerBeginEXT",
+    "vkCreateSamplerYcbcrConversion",
+    "vkImportFenceFdKHR",
+    "vkSetEvent",
+    "vkGetPhysicalDeviceDisplayProperties2KHR",
+    "vkCmdCopyImageToBuffer2KHR",
+    "vkCmdCopyMemoryToMicromapEXT",
+    "vkCmdSetAlphaToOneEnableEXT",
+    "vkCmdBeginVideoCodingKHR",
+    "vkCmdDispatchBaseKHR",
+    "vkCreatePrivateDataSlot",
+    "vkDestroyDescriptorPool",
+    "vkCmdBlitImage",
+    "vkCmdDrawIndirectCount",
+    "vkCmdPushDescriptorSetKHR",
+    "vkCmdPushDescriptorSetWithTemplate2",
+    "vkInvalidateMappedMemoryRanges",
+    "vkCmdCopyImage",
+    "vkGetMemoryWin32HandleKHR",
+    "vkGetDeviceBufferMemoryRequirementsKHR",
+    "vkCopyImageToImageEXT",
+    "vkDestroyImage",
+    "vkCmdDraw",
+    "vkCmdSetFrontFace",
+    "vkCmdBindIndexBuffer2",
+    "vkCmdDrawIndexedIndirectCount",
+    "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+    "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+    "vkCmdSetEvent",
+    "vkFreeMemory",
+    "vkCmdControlVideoCodingKHR",
+    "vkQueueEndDebugUtilsLabelEXT",
+    "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+    "vkCmdWriteAccelerationStructuresPropertiesKHR",
+    "vkGetDescriptorSetHostMappingVALVE",
+    "vkBindAccelerationStructureMemoryNV",
+    "vkCopyMicromapToMemoryEXT",
+    "vkCmdEndTransformFeedbackEXT",
+    "vkCmdDrawMeshTasksIndirectNV",
+    "vkCmdSetLineWidth",
+    "vkDestroyDescriptorUpdateTemplateKHR",
+    "vkCreateDisplayModeKHR",
+    "vkCompileDeferredNV",
+    "vkCmdWaitEvents2KHR",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2",
+    "vkCmdSetViewportWScalingNV",
+    "vkCmdSetRenderingAttachmentLocationsKHR",
+    "vkCmdOpticalFlowExecuteNV",
+    "vkBuildAccelerationStructuresKHR",
+    "vkGetDisplayModeProperties2KHR",
+    "vkCmdDecodeVideoKHR",
+    "vkCreateDebugUtilsMessengerEXT",
+    "vkCmdSetRasterizerDiscardEnable",
+    "vkCreateEvent",
+    "vkGetBufferMemoryRequirements2",
+    "vkGetMemoryFdKHR",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR",
+    "vkMapMemory2KHR",
+    "vkCmdBuildAccelerationStructuresIndirectKHR",
+    "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+    "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkCmdBeginRenderingKHR",
+    "vkCmdEndRenderPass2",
+    "vkDestroyValidationCacheEXT",
+    "vkCreateVideoSessionParametersKHR",
+    "vkCmdTraceRaysNV",
+    "vkCreateDeferredOperationKHR",
+    "vkCmdBindVertexBuffers",
+    "vkCmdEndQuery",
+    "vkUninitializePerformanceApiINTEL",
+    "vkCmdDrawIndexedIndirectCountAMD",
+    "vkGetDrmDisplayEXT",
+    "vkGetDeviceMemoryCommitment",
+    "vkCreateCommandPool",
+    "vkDestroyDeferredOperationKHR",
+    "vkGetGeneratedCommandsMemoryRequirementsNV",
+    "vkCreatePipelineBinariesKHR",
+    "vkGetShaderModuleCreateInfoIdentifierEXT",
+    "vkCmdDispatch",
+    "vkCreateFence",
+    "vkDestroySwapchainKHR",
+    "vkGetPhysicalDeviceSurfaceFormatsKHR",
+    "vkCmdCopyBufferToImage2KHR",
+    "vkDestroyRenderPass",
+    "vkCopyMemoryToMicromapEXT",
+    "vkGetPhysicalDeviceQueueFamilyProperties2",
+    "vkGetRayTracingShaderGroupHandlesKHR",
+    "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+    "vkGetImageViewAddressNVX",
+    "vkCmdSetStencilCompareMask",
+    "vkGetImageDrmFormatModifierPropertiesEXT",
+    "vkCmdBindIndexBuffer",
+    "vkCmdDrawMeshTasksNV",
+    "vkBindBufferMemory2KHR",
+    "vkGetDeviceGroupPresentCapabilitiesKHR",
+    "vkGetPhysicalDeviceFeatures2KHR",
+    "vkCopyMemoryToAccelerationStructureKHR",
+    "vkWriteAccelerationStructuresPropertiesKHR",
+    "vkCreateAndroidSurfaceKHR",
+    "vkCmdCopyAccelerationStructureKHR",
+    "vkCmdCopyMicromapToMemoryEXT",
+    "vkGetPhysicalDeviceExternalSemaphoreProperties",
+    "vkGetDeviceImageMemoryRequirementsKHR",
+    "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+    "vkCmdSetCoverageModulationTableEnableNV",
+    "vkGetDeviceMemoryOpaqueCaptureAddress",
+    "vkCmdSetScissorWithCount",
+    "vkCopyMemoryToImage",
+    "vkCreateRayTracingPipelinesNV",
+    "vkGetDeviceFaultInfoEXT",
+    "vkBindVideoSessionMemoryKHR",
+    "vkGetSemaphoreFdKHR",
+    "vkCmdCopyBuffer2",
+    "vkCmdSetLineRasterizationModeEXT",
+    "vkReleaseFullScreenExclusiveModeEXT",
+    "vkCreateAccelerationStructureKHR",
+    "vkDestroyIndirectExecutionSetEXT",
+    "vkDestroySamplerYcbcrConversion",
+    "vkCmdEndRenderPass2KHR",
+    "vkGetAccelerationStructureHandleNV",
+    "vkGetValidationCacheDataEXT",
+    "vkCmdCopyImage2KHR",
+    "vkGetPhysicalDeviceScreenPresentationSupportQNX",
+    "vkCmdSetDepthBiasEnable",
+    "vkCmdTraceRaysKHR",
+    "vkGetPhysicalDevicePresentRectanglesKHR",
+    "vkCmdSetBlendConstants",
+    "vkGetPipelineExecutablePropertiesKHR",
+    "vkCmdBeginQueryIndexedEXT",
+    "vkCmdWriteTimestamp",
+    "vkDestroyPrivateDataSlot",
+    "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+    "vkCmdExecuteCommands",
+    "vkCmdDrawClusterIndirectHUAWEI",
+    "vkDestroyInstance",
+    "vkBindImageMemory",
+    "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+    "vkCreateDisplayPlaneSurfaceKHR",
+    "vkCmdSetFragmentShadingRateEnumNV",
+    "vkCmdBindDescriptorSets2",
+    "vkCreateHeadlessSurfaceEXT",
+    "vkCmdCopyBufferToImage",
+    "vkCmdDrawMeshTasksIndirectEXT",
+    "vkSetLatencySleepModeNV",
+    "vkCreateScreenSurfaceQNX",
+    "vkGetPerformanceParameterINTEL",
+    "vkGetPhysicalDeviceFeatures2",
+    "vkCreateIndirectCommandsLayoutNV",
+    "vkEnumerateInstanceExtensionProperties",
+    "vkGetMemoryRemoteAddressNV",
+    "vkCmdSetSampleLocationsEnableEXT",
+    "vkCmdBlitImage2",
+    "vkGetPipelineExecutableStatisticsKHR",
+    "vkGetFenceWin32HandleKHR",
+    "vkDestroyFence",
+    "vkCmdPushDescriptorSet2KHR",
+    "vkGetDeviceGroupSurfacePresentModesKHR",
+    "vkGetSemaphoreCounterValueKHR",
+    "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+    "vkCmdSetPrimitiveRestartEnable",
+    "vkEnumeratePhysicalDeviceGroupsKHR",
+    "vkCmdResetEvent2",
+    "vkDebugReportMessageEXT",
+    "vkCmdBuildMicromapsEXT",
+    "vkGetRandROutputDisplayEXT",
+    "vkDestroyQueryPool",
+    "vkCmdBuildAccelerationStructureNV",
+    "vkCmdBlitImage2KHR",
+    "vkCreatePipelineCache",
+    "vkDestroyAccelerationStructureNV",
+    "vkCreateIndirectExecutionSetEXT",
+    "vkGetLatencyTimingsNV",
+    "vkCmdClearAttachments",
+    "vkCmdSetSampleLocationsEXT",
+    "vkGetPhysicalDeviceProperties",
+    "vkCmdBindDescriptorSets2KHR",
+    "vkCmdDrawIndirect",
+    "vkCmdSetCoverageModulationModeNV",
+    "vkCreateAccelerationStructureNV",
+    "vkRegisterDisplayEventEXT",
+    "vkCmdDrawIndexedIndirect",
+    "vkDeviceWaitIdle",
+    "vkGetDeviceQueue2",
+    "vkGetMicromapBuildSizesEXT",
+    "vkBuildMicromapsEXT",
+    "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+    "vkDestroyImageView",
+    "vkGetDynamicRenderingTilePropertiesQCOM",
+    "vkCmdPushDescriptorSetWithTemplateKHR",
+    "vkCmdSetCoverageToColorLocationNV",
+    "vkCmdSetRasterizationSamplesEXT",
+    "vkGetDisplayPlaneCapabilitiesKHR",
+    "vkGetImageSubresourceLayout2EXT",
+    "vkQueueNotifyOutOfBandNV",
+    "vkCmdSetDepthWriteEnable",
+    "vkGetPipelineBinaryDataKHR",
+    "vkDebugMarkerSetObjectNameEXT",
+    "vkAcquireNextImage2KHR",
+    "vkDestroyPipelineLayout",
+    "vkGetPrivateDataEXT",
+    "vkGetVideoSessionMemoryRequirementsKHR",
+    "vkGetRenderingAreaGranularity",
+    "vkCreateGraphicsPipelines",
+    "vkCreateBufferView",
+    "vkCreateBuffer",
+    "vkCmdSetPatchControlPointsEXT",
+    "vkCmdSetStencilOp",
+    "vkCmdSetViewportWScalingEnableNV",
+    "vkDestroyIndirectCommandsLayoutNV",
+    "vkCmdBeginQuery",
+    "vkCmdSetDepthBiasEnableEXT",
+    "vkQueueSubmit",
+    "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+    "vkFreeDescriptorSets",
+    "vkGetPhysicalDeviceSurfaceSupportKHR",
+    "vkGetImageViewHandleNVX",
+    "vkGetImageMemoryRequirements",
+    "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+    "vkResetCommandPool",
+    "vkAcquireDrmDisplayEXT",
+    "vkDestroyShaderModule",
+    "vkCmdEncodeVideoKHR",
+    "vkDestroySurfaceKHR",
+    "vkRegisterDeviceEventEXT",
+    "vkCmdBindVertexBuffers2",
+    "vkCmdSetColorWriteEnableEXT",
+    "vkGetBufferDeviceAddress",
+    "vkGetImageMemoryRequirements2KHR",
+    "vkCreateIndirectCommandsLayoutEXT",
+    "vkGetPhysicalDeviceFormatProperties2",
+    "vkCmdSetCheckpointNV",
+    "vkGetBufferOpaqueCaptureAddress",
+    "vkCmdCopyMicromapEXT",
+    "vkEnumeratePhysicalDevices",
+    "vkCmdEndVideoCodingKHR",
+    "vkCreateMetalSurfaceEXT",
+    "vkDestroyPipeline",
+    "vkCmdPipelineBarrier2KHR",
+    "vkCmdSetDiscardRectangleModeEXT",
+    "vkCmdBeginRendering",
+    "vkGetDeferredOperationResultKHR",
+    "vkGetEncodedVideoSessionParametersKHR",
+    "vkCmdDebugMarkerEndEXT",
+    "vkGetPhysicalDeviceMemoryProperties2",
+    "vkCmdSetViewportShadingRatePaletteNV",
+    "vkImportSemaphoreFdKHR",
+    "vkCopyMemoryToImageEXT",
+    "vkGetSemaphoreZirconHandleFUCHSIA",
+    "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+    "vkGetDeviceImageSubresourceLayoutKHR",
+    "vkCmdBindTransformFeedbackBuffersEXT",
+    "vkCmdSetProvokingVertexModeEXT",
+    "vkGetDeviceAccelerationStructureCompatibilityKHR",
+    "vkCmdSetDepthCompareOp",
+    "vkCmdDrawMeshTasksIndirectCountEXT",
+    "vkSubmitDebugUtilsMessageEXT",
+    "vkGetRenderingAreaGranularityKHR",
+    "vkResetQueryPool",
+    "vkUnmapMemory2KHR",
+    "vkGetSwapchainCounterEXT",
+    "vkAcquireProfilingLockKHR",
+    "vkCreateSemaphore",
+    "vkGetDisplayPlaneSupportedDisplaysKHR",
+    "vkCreateComputePipelines",
+    "vkCmdSetViewportSwizzleNV",
+    "vkGetFenceStatus",
+    "vkResetEvent",
+    "vkFrameBoundaryANDROID",
+    "vkCmdNextSubpass",
+    "vkGetRayTracingShaderGroupStackSizeKHR",
+    "vkCmdResolveImage",
+    "vkGetMemoryWin32HandlePropertiesKHR",
+    "vkInitializePerformanceApiINTEL",
+    "vkCmdSetDepthClampRangeEXT",
+    "vkCmdEndRenderPass",
+    "vkGetBufferDeviceAddressEXT",
+    "vkCreateShadersEXT",
+    "vkGetBufferMemoryRequirements2KHR",
+    "vkCopyImageToMemoryEXT",
+    "vkGetGeneratedCommandsMemoryRequirementsEXT",
+    "vkCmdDrawIndirectCountAMD",
+    "vkQueueBindSparse",
+    "vkGetCalibratedTimestampsKHR",
+    "vkCmdEndQueryIndexedEXT",
+    "vkCmdSetTessellationDomainOriginEXT",
+    "vkGetDisplayPlaneCapabilities2KHR",
+    "vkCmdDrawMultiEXT",
+    "vkCmdSetDepthWriteEnableEXT",
+    "vkGetPrivateData",
+    "vkEnumerateInstanceLayerProperties",
+    "vkCopyMicromapEXT",
+    "vkGetPhysicalDeviceFormatProperties",
+    "vkCmdSetCoverageReductionModeNV",
+    "vkCmdCopyQueryPoolResults",
+    "vkDestroyVideoSessionKHR",
+    "vkGetShaderInfoAMD",
+    "vkReleasePerformanceConfigurationINTEL",
+    "vkQueueWaitIdle",
+    "vkBindBufferMemory",
+    "vkCmdSetDepthBoundsTestEnableEXT",
+    "vkGetImageViewHandle64NVX",
+    "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+    "vkCreateQueryPool",
+    "vkCmdResetEvent2KHR",
+    "vkQueueBeginDebugUtilsLabelEXT",
+    "vkCmdSetDepthBias2EXT",
+    "vkGetInstanceProcAddr",
+    "vkDeferredOperationJoinKHR",
+    "vkQueueSetPerformanceConfigurationINTEL",
+    "vkCmdSetFrontFaceEXT",
+    "vkQueueSubmit2",
+    "vkCmdSetDepthBoundsTestEnable",
+    "vkCmdSetDescriptorBufferOffsets2EXT",
+    "vkBindBufferMemory2",
+    "vkUpdateDescriptorSets",
+    "vkGetDeviceGroupSurfacePresentModes2EXT",
+    "vkGetSemaphoreWin32HandleKHR",
+    "vkCmdSetExclusiveScissorNV",
+    "vkUpdateVideoSessionParametersKHR",
+    "vkGetDeviceGroupPeerMemoryFeatures",
+    "vkGetPhysicalDeviceFragmentShadingRatesKHR",
+    "vkGetPhysicalDeviceProperties2",
+    "vkResetDescriptorPool",
+    "vkCmdSetAlphaToCoverageEnableEXT",
+    "vkGetBufferOpaqueCaptureAddressKHR",
+    "vkCmdCopyBuffer",
+    "vkSignalSemaphoreKHR",
+    "vkCreateFramebuffer",
+    "vkAntiLagUpdateAMD",
+    "vkCmdBeginConditionalRenderingEXT",
+    "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+    "vkCmdSetCullModeEXT",
+    "vkCmdResolveImage2",
+    "vkCmdSetDepthClipNegativeOneToOneEXT",
+    "vkCmdSetLogicOpEXT",
+    "vkGetShaderModuleIdentifierEXT",
+    "vkGetImageSparseMemoryRequirements2KHR",
+    "vkCmdSetFragmentShadingRateKHR",
+    "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+    "vkGetDisplayModePropertiesKHR",
+    "vkCreateImage",
+    "vkGetDeviceImageSparseMemoryRequirements",
+    "vkCmdSetPerformanceStreamMarkerINTEL",
+    "vkCmdPushDescriptorSet",
+    "vkDestroyMicromapEXT",
+    "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+    "vkCreatePipelineLayout",
+    "vkDestroyDescriptorUpdateTemplate",
+    "vkCmdWaitEvents",
+    "vkSetLocalDimmingAMD",
+    "vkCmdEndDebugUtilsLabelEXT",
+    "vkCreateSharedSwapchainsKHR",
+    "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+    "vkCmdSetPerformanceMarkerINTEL",
+    "vkCmdWaitEvents2",
+    "vkCreateStreamDescriptorSurfaceGGP",
+    "vkAcquirePerformanceConfigurationINTEL",
+    "vkGetDeviceMicromapCompatibilityEXT",
+    "vkCmdResetEvent",
+    "vkCmdSetStencilWriteMask",
+    "vkDestroyCommandPool",
+    "vkGetRenderAreaGranularity",
+    "vkCmdBeginRenderPass2",
+    "vkGetPhysicalDeviceExternalFenceProperties",
+    "vkCmdSetCoarseSampleOrderNV",
+    "vkWriteMicromapsPropertiesEXT",
+    "vkCmdSetDepthBias",
+    "vkGetDescriptorSetLayoutSupport",
+    "vkCreateSampler",
+    "vkDisplayPowerControlEXT",
+    "vkCreateDescriptorSetLayout",
+    "vkCmdBindIndexBuffer2KHR",
+    "vkCreateDescriptorPool",
+    "vkGetFenceFdKHR",
+    "vkCmdSetColorWriteMaskEXT",
+    "vkGetSwapchainImagesKHR",
+    "vkGetBufferDeviceAddressKHR",
+    "vkResetFences",
+    "vkGetImageSubresourceLayout2",
+    "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+    "vkCmdSetStencilReference",
+    "vkCmdPushConstants",
+    "vkGetSemaphoreCounterValue",
+    "vkDestroyBuffer",
+    "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+    "vkCmdSetDeviceMask",
+    "vkGetDeferredOperationMaxConcurrencyKHR",
+    "vkCmdSetConservativeRasterizationModeEXT",
+    "vkCmdSetStencilTestEnable",
+};
+
+// Returns the table index of the named Vulkan API call, or kVulkanFuncTableSize if the layer does not export it.
+inline uint32_t GetVulkanFuncTableIndex(const char* name)
+{
+    const uint32_t index = util::hash::perfect_hash_index(
+        util::hash::fnv1a_64(name), kVulkanFuncTableSeeds, kVulkanFuncTableSeedCount, kVulkanFuncTableSize);
+    return (std::strcmp(kVulkanFuncTableNames[index], name) == 0) ? index : kVulkanFuncTableSize;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif
@@ -91,54 +91,54 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void AddVkVideoSessionKHRInfo(VulkanVideoSessionKHRInfo&& info) { AddVkObjectInfo(std::move(info), &videoSessionKHR_map_); }
     void AddVkVideoSessionParametersKHRInfo(VulkanVideoSessionParametersKHRInfo&& info) { AddVkObjectInfo(std::move(info), &videoSessionParametersKHR_map_); }
 
-    void RemoveVkAccelerationStructureKHRInfo(format::HandleId id) { accelerationStructureKHR_map_.erase(id); }
-    void RemoveVkAccelerationStructureNVInfo(format::HandleId id) { accelerationStructureNV_map_.erase(id); }
-    void RemoveVkBufferInfo(format::HandleId id) { buffer_map_.erase(id); }
-    void RemoveVkBufferViewInfo(format::HandleId id) { bufferView_map_.erase(id); }
-    void RemoveVkCommandBufferInfo(format::HandleId id) { commandBuffer_map_.erase(id); }
-    void RemoveVkCommandPoolInfo(format::HandleId id) { commandPool_map_.erase(id); }
-    void RemoveVkDebugReportCallbackEXTInfo(format::HandleId id) { debugReportCallbackEXT_map_.erase(id); }
-    void RemoveVkDebugUtilsMessengerEXTInfo(format::HandleId id) { debugUtilsMessengerEXT_map_.erase(id); }
-    void RemoveVkDeferredOperationKHRInfo(format::HandleId id) { deferredOperationKHR_map_.erase(id); }
-    void RemoveVkDescriptorPoolInfo(format::HandleId id) { descriptorPool_map_.erase(id); }
-    void RemoveVkDescriptorSetInfo(format::HandleId id) { descriptorSet_map_.erase(id); }
-    void RemoveVkDescriptorSetLayoutInfo(format::HandleId id) { descriptorSetLayout_map_.erase(id); }
-    void RemoveVkDescriptorUpdateTemplateInfo(format::HandleId id) { descriptorUpdateTemplate_map_.erase(id); }
-    void RemoveVkDeviceInfo(format::HandleId id) { device_map_.erase(id); }
-    void RemoveVkDeviceMemoryInfo(format::HandleId id) { deviceMemory_map_.erase(id); }
-    void RemoveVkDisplayKHRInfo(format::HandleId id) { displayKHR_map_.erase(id); }
-    void RemoveVkDisplayModeKHRInfo(format::HandleId id) { displayModeKHR_map_.erase(id); }
-    void RemoveVkEventInfo(format::HandleId id) { event_map_.erase(id); }
-    void RemoveVkFenceInfo(format::HandleId id) { fence_map_.erase(id); }
-    void RemoveVkFramebufferInfo(format::HandleId id) { framebuffer_map_.erase(id); }
-    void RemoveVkImageInfo(format::HandleId id) { image_map_.erase(id); }
-    void RemoveVkImageViewInfo(format::HandleId id) { imageView_map_.erase(id); }
-    void RemoveVkIndirectCommandsLayoutEXTInfo(format::HandleId id) { indirectCommandsLayoutEXT_map_.erase(id); }
-    void RemoveVkIndirectCommandsLayoutNVInfo(format::HandleId id) { indirectCommandsLayoutNV_map_.erase(id); }
-    void RemoveVkIndirectExecutionSetEXTInfo(format::HandleId id) { indirectExecutionSetEXT_map_.erase(id); }
-    void RemoveVkInstanceInfo(format::HandleId id) { instance_map_.erase(id); }
-    void RemoveVkMicromapEXTInfo(format::HandleId id) { micromapEXT_map_.erase(id); }
-    void RemoveVkOpticalFlowSessionNVInfo(format::HandleId id) { opticalFlowSessionNV_map_.erase(id); }
-    void RemoveVkPerformanceConfigurationINTELInfo(format::HandleId id) { performanceConfigurationINTEL_map_.erase(id); }
-    void RemoveVkPhysicalDeviceInfo(format::HandleId id) { physicalDevice_map_.erase(id); }
-    void RemoveVkPipelineInfo(format::HandleId id) { pipeline_map_.erase(id); }
-    void RemoveVkPipelineBinaryKHRInfo(format::HandleId id) { pipelineBinaryKHR_map_.erase(id); }
-    void RemoveVkPipelineCacheInfo(format::HandleId id) { pipelineCache_map_.erase(id); }
-    void RemoveVkPipelineLayoutInfo(format::HandleId id) { pipelineLayout_map_.erase(id); }
-    void RemoveVkPrivateDataSlotInfo(format::HandleId id) { privateDataSlot_map_.erase(id); }
-    void RemoveVkQueryPoolInfo(format::HandleId id) { queryPool_map_.erase(id); }
-    void RemoveVkQueueInfo(format::HandleId id) { queue_map_.erase(id); }
-    void RemoveVkRenderPassInfo(format::HandleId id) { renderPass_map_.erase(id); }
-    void RemoveVkSamplerInfo(format::HandleId id) { sampler_map_.erase(id); }
-    void RemoveVkSamplerYcbcrConversionInfo(format::HandleId id) { samplerYcbcrConversion_map_.erase(id); }
-    void RemoveVkSemaphoreInfo(format::HandleId id) { semaphore_map_.erase(id); }
-    void RemoveVkShaderEXTInfo(format::HandleId id) { shaderEXT_map_.erase(id); }
-    void RemoveVkShaderModuleInfo(format::HandleId id) { shaderModule_map_.erase(id); }
-    void RemoveVkSurfaceKHRInfo(format::HandleId id) { surfaceKHR_map_.erase(id); }
-    void RemoveVkSwapchainKHRInfo(format::HandleId id) { swapchainKHR_map_.erase(id); }
-    void RemoveVkValidationCacheEXTInfo(format::HandleId id) { validationCacheEXT_map_.erase(id); }
-    void RemoveVkVideoSessionKHRInfo(format::HandleId id) { videoSessionKHR_map_.erase(id); }
-    void RemoveVkVideoSessionParametersKHRInfo(format::HandleId id) { videoSessionParametersKHR_map_.erase(id); }
+    void RemoveVkAccelerationStructureKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &accelerationStructureKHR_map_); }
+    void RemoveVkAccelerationStructureNVInfo(format::HandleId id) { RemoveVkObjectInfo(id, &accelerationStructureNV_map_); }
+    void RemoveVkBufferInfo(format::HandleId id) { RemoveVkObjectInfo(id, &buffer_map_); }
+    void RemoveVkBufferViewInfo(format::HandleId id) { RemoveVkObjectInfo(id, &bufferView_map_); }
+    void RemoveVkCommandBufferInfo(format::HandleId id) { RemoveVkObjectInfo(id, &commandBuffer_map_); }
+    void RemoveVkCommandPoolInfo(format::HandleId id) { RemoveVkObjectInfo(id, &commandPool_map_); }
+    void RemoveVkDebugReportCallbackEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &debugReportCallbackEXT_map_); }
+    void RemoveVkDebugUtilsMessengerEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &debugUtilsMessengerEXT_map_); }
+    void RemoveVkDeferredOperationKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &deferredOperationKHR_map_); }
+    void RemoveVkDescriptorPoolInfo(format::HandleId id) { RemoveVkObjectInfo(id, &descriptorPool_map_); }
+    void RemoveVkDescriptorSetInfo(format::HandleId id) { RemoveVkObjectInfo(id, &descriptorSet_map_); }
+    void RemoveVkDescriptorSetLayoutInfo(format::HandleId id) { RemoveVkObjectInfo(id, &descriptorSetLayout_map_); }
+    void RemoveVkDescriptorUpdateTemplateInfo(format::HandleId id) { RemoveVkObjectInfo(id, &descriptorUpdateTemplate_map_); }
+    void RemoveVkDeviceInfo(format::HandleId id) { RemoveVkObjectInfo(id, &device_map_); }
+    void RemoveVkDeviceMemoryInfo(format::HandleId id) { RemoveVkObjectInfo(id, &deviceMemory_map_); }
+    void RemoveVkDisplayKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &displayKHR_map_); }
+    void RemoveVkDisplayModeKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &displayModeKHR_map_); }
+    void RemoveVkEventInfo(format::HandleId id) { RemoveVkObjectInfo(id, &event_map_); }
+    void RemoveVkFenceInfo(format::HandleId id) { RemoveVkObjectInfo(id, &fence_map_); }
+    void RemoveVkFramebufferInfo(format::HandleId id) { RemoveVkObjectInfo(id, &framebuffer_map_); }
+    void RemoveVkImageInfo(format::HandleId id) { RemoveVkObjectInfo(id, &image_map_); }
+    void RemoveVkImageViewInfo(format::HandleId id) { RemoveVkObjectInfo(id, &imageView_map_); }
+    void RemoveVkIndirectCommandsLayoutEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &indirectCommandsLayoutEXT_map_); }
+    void RemoveVkIndirectCommandsLayoutNVInfo(format::HandleId id) { RemoveVkObjectInfo(id, &indirectCommandsLayoutNV_map_); }
+    void RemoveVkIndirectExecutionSetEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &indirectExecutionSetEXT_map_); }
+    void RemoveVkInstanceInfo(format::HandleId id) { RemoveVkObjectInfo(id, &instance_map_); }
+    void RemoveVkMicromapEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &micromapEXT_map_); }
+    void RemoveVkOpticalFlowSessionNVInfo(format::HandleId id) { RemoveVkObjectInfo(id, &opticalFlowSessionNV_map_); }
+    void RemoveVkPerformanceConfigurationINTELInfo(format::HandleId id) { RemoveVkObjectInfo(id, &performanceConfigurationINTEL_map_); }
+    void RemoveVkPhysicalDeviceInfo(format::HandleId id) { RemoveVkObjectInfo(id, &physicalDevice_map_); }
+    void RemoveVkPipelineInfo(format::HandleId id) { RemoveVkObjectInfo(id, &pipeline_map_); }
+    void RemoveVkPipelineBinaryKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &pipelineBinaryKHR_map_); }
+    void RemoveVkPipelineCacheInfo(format::HandleId id) { RemoveVkObjectInfo(id, &pipelineCache_map_); }
+    void RemoveVkPipelineLayoutInfo(format::HandleId id) { RemoveVkObjectInfo(id, &pipelineLayout_map_); }
+    void RemoveVkPrivateDataSlotInfo(format::HandleId id) { RemoveVkObjectInfo(id, &privateDataSlot_map_); }
+    void RemoveVkQueryPoolInfo(format::HandleId id) { RemoveVkObjectInfo(id, &queryPool_map_); }
+    void RemoveVkQueueInfo(format::HandleId id) { RemoveVkObjectInfo(id, &queue_map_); }
+    void RemoveVkRenderPassInfo(format::HandleId id) { RemoveVkObjectInfo(id, &renderPass_map_); }
+    void RemoveVkSamplerInfo(format::HandleId id) { RemoveVkObjectInfo(id, &sampler_map_); }
+    void RemoveVkSamplerYcbcrConversionInfo(format::HandleId id) { RemoveVkObjectInfo(id, &samplerYcbcrConversion_map_); }
+    void RemoveVkSemaphoreInfo(format::HandleId id) { RemoveVkObjectInfo(id, &semaphore_map_); }
+    void RemoveVkShaderEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &shaderEXT_map_); }
+    void RemoveVkShaderModuleInfo(format::HandleId id) { RemoveVkObjectInfo(id, &shaderModule_map_); }
+    void RemoveVkSurfaceKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &surfaceKHR_map_); }
+    void RemoveVkSwapchainKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &swapchainKHR_map_); }
+    void RemoveVkValidationCacheEXTInfo(format::HandleId id) { RemoveVkObjectInfo(id, &validationCacheEXT_map_); }
+    void RemoveVkVideoSessionKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &videoSessionKHR_map_); }
+    void RemoveVkVideoSessionParametersKHRInfo(format::HandleId id) { RemoveVkObjectInfo(id, &videoSessionParametersKHR_map_); }
 
     const VulkanAccelerationStructureKHRInfo* GetVkAccelerationStructureKHRInfo(format::HandleId id) const { return GetVkObjectInfo<VulkanAccelerationStructureKHRInfo>(id, &accelerationStructureKHR_map_); }
     const VulkanAccelerationStructureNVInfo* GetVkAccelerationStructureNVInfo(format::HandleId id) const { return GetVkObjectInfo<VulkanAccelerationStructureNVInfo>(id, &accelerationStructureNV_map_); }
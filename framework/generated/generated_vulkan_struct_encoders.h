@@ -44,6 +44,7 @@
 #include "vk_video/vulkan_video_codecs_common.h"
 
 #include <cstdint>
+#include <type_traits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -1428,6 +1429,94 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFea
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandEXT& value);
 
+// Structs with an encoded representation that matches their memory layout, which are encoded with a
+// single copy when in an array.  A size mismatch falls back to member-wise encoding.
+template <> struct IsTriviallyEncodable<StdVideoEncodeH264WeightTableFlags> : std::bool_constant<sizeof(StdVideoEncodeH264WeightTableFlags) == 16> {};
+template <> struct IsTriviallyEncodable<VkExtent2D> : std::bool_constant<sizeof(VkExtent2D) == 8> {};
+template <> struct IsTriviallyEncodable<VkExtent3D> : std::bool_constant<sizeof(VkExtent3D) == 12> {};
+template <> struct IsTriviallyEncodable<VkOffset2D> : std::bool_constant<sizeof(VkOffset2D) == 8> {};
+template <> struct IsTriviallyEncodable<VkOffset3D> : std::bool_constant<sizeof(VkOffset3D) == 12> {};
+template <> struct IsTriviallyEncodable<VkRect2D> : std::bool_constant<sizeof(VkRect2D) == 16> {};
+template <> struct IsTriviallyEncodable<VkDispatchIndirectCommand> : std::bool_constant<sizeof(VkDispatchIndirectCommand) == 12> {};
+template <> struct IsTriviallyEncodable<VkDrawIndexedIndirectCommand> : std::bool_constant<sizeof(VkDrawIndexedIndirectCommand) == 20> {};
+template <> struct IsTriviallyEncodable<VkDrawIndirectCommand> : std::bool_constant<sizeof(VkDrawIndirectCommand) == 16> {};
+template <> struct IsTriviallyEncodable<VkImageSubresourceRange> : std::bool_constant<sizeof(VkImageSubresourceRange) == 20> {};
+template <> struct IsTriviallyEncodable<VkFormatProperties> : std::bool_constant<sizeof(VkFormatProperties) == 12> {};
+template <> struct IsTriviallyEncodable<VkImageFormatProperties> : std::bool_constant<sizeof(VkImageFormatProperties) == 32> {};
+template <> struct IsTriviallyEncodable<VkMemoryType> : std::bool_constant<sizeof(VkMemoryType) == 8> {};
+template <> struct IsTriviallyEncodable<VkPhysicalDeviceFeatures> : std::bool_constant<sizeof(VkPhysicalDeviceFeatures) == 220> {};
+template <> struct IsTriviallyEncodable<VkPhysicalDeviceSparseProperties> : std::bool_constant<sizeof(VkPhysicalDeviceSparseProperties) == 20> {};
+template <> struct IsTriviallyEncodable<VkQueueFamilyProperties> : std::bool_constant<sizeof(VkQueueFamilyProperties) == 24> {};
+template <> struct IsTriviallyEncodable<VkImageSubresource> : std::bool_constant<sizeof(VkImageSubresource) == 12> {};
+template <> struct IsTriviallyEncodable<VkSparseImageFormatProperties> : std::bool_constant<sizeof(VkSparseImageFormatProperties) == 20> {};
+template <> struct IsTriviallyEncodable<VkSparseImageMemoryRequirements> : std::bool_constant<sizeof(VkSparseImageMemoryRequirements) == 48> {};
+template <> struct IsTriviallyEncodable<VkSubresourceLayout> : std::bool_constant<sizeof(VkSubresourceLayout) == 40> {};
+template <> struct IsTriviallyEncodable<VkComponentMapping> : std::bool_constant<sizeof(VkComponentMapping) == 16> {};
+template <> struct IsTriviallyEncodable<VkVertexInputBindingDescription> : std::bool_constant<sizeof(VkVertexInputBindingDescription) == 12> {};
+template <> struct IsTriviallyEncodable<VkVertexInputAttributeDescription> : std::bool_constant<sizeof(VkVertexInputAttributeDescription) == 16> {};
+template <> struct IsTriviallyEncodable<VkViewport> : std::bool_constant<sizeof(VkViewport) == 24> {};
+template <> struct IsTriviallyEncodable<VkStencilOpState> : std::bool_constant<sizeof(VkStencilOpState) == 28> {};
+template <> struct IsTriviallyEncodable<VkPipelineColorBlendAttachmentState> : std::bool_constant<sizeof(VkPipelineColorBlendAttachmentState) == 32> {};
+template <> struct IsTriviallyEncodable<VkPushConstantRange> : std::bool_constant<sizeof(VkPushConstantRange) == 12> {};
+template <> struct IsTriviallyEncodable<VkDescriptorPoolSize> : std::bool_constant<sizeof(VkDescriptorPoolSize) == 8> {};
+template <> struct IsTriviallyEncodable<VkAttachmentDescription> : std::bool_constant<sizeof(VkAttachmentDescription) == 36> {};
+template <> struct IsTriviallyEncodable<VkAttachmentReference> : std::bool_constant<sizeof(VkAttachmentReference) == 8> {};
+template <> struct IsTriviallyEncodable<VkSubpassDependency> : std::bool_constant<sizeof(VkSubpassDependency) == 28> {};
+template <> struct IsTriviallyEncodable<VkBufferCopy> : std::bool_constant<sizeof(VkBufferCopy) == 24> {};
+template <> struct IsTriviallyEncodable<VkImageSubresourceLayers> : std::bool_constant<sizeof(VkImageSubresourceLayers) == 16> {};
+template <> struct IsTriviallyEncodable<VkBufferImageCopy> : std::bool_constant<sizeof(VkBufferImageCopy) == 56> {};
+template <> struct IsTriviallyEncodable<VkClearDepthStencilValue> : std::bool_constant<sizeof(VkClearDepthStencilValue) == 8> {};
+template <> struct IsTriviallyEncodable<VkClearRect> : std::bool_constant<sizeof(VkClearRect) == 24> {};
+template <> struct IsTriviallyEncodable<VkImageCopy> : std::bool_constant<sizeof(VkImageCopy) == 68> {};
+template <> struct IsTriviallyEncodable<VkImageResolve> : std::bool_constant<sizeof(VkImageResolve) == 68> {};
+template <> struct IsTriviallyEncodable<VkInputAttachmentAspectReference> : std::bool_constant<sizeof(VkInputAttachmentAspectReference) == 12> {};
+template <> struct IsTriviallyEncodable<VkExternalMemoryProperties> : std::bool_constant<sizeof(VkExternalMemoryProperties) == 12> {};
+template <> struct IsTriviallyEncodable<VkVertexInputBindingDivisorDescription> : std::bool_constant<sizeof(VkVertexInputBindingDivisorDescription) == 8> {};
+template <> struct IsTriviallyEncodable<VkSurfaceCapabilitiesKHR> : std::bool_constant<sizeof(VkSurfaceCapabilitiesKHR) == 52> {};
+template <> struct IsTriviallyEncodable<VkSurfaceFormatKHR> : std::bool_constant<sizeof(VkSurfaceFormatKHR) == 8> {};
+template <> struct IsTriviallyEncodable<VkDisplayModeParametersKHR> : std::bool_constant<sizeof(VkDisplayModeParametersKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkDisplayPlaneCapabilitiesKHR> : std::bool_constant<sizeof(VkDisplayPlaneCapabilitiesKHR) == 68> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeH264QpKHR> : std::bool_constant<sizeof(VkVideoEncodeH264QpKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeH264FrameSizeKHR> : std::bool_constant<sizeof(VkVideoEncodeH264FrameSizeKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeH265QpKHR> : std::bool_constant<sizeof(VkVideoEncodeH265QpKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeH265FrameSizeKHR> : std::bool_constant<sizeof(VkVideoEncodeH265FrameSizeKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkRectLayerKHR> : std::bool_constant<sizeof(VkRectLayerKHR) == 20> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeAV1QIndexKHR> : std::bool_constant<sizeof(VkVideoEncodeAV1QIndexKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkVideoEncodeAV1FrameSizeKHR> : std::bool_constant<sizeof(VkVideoEncodeAV1FrameSizeKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkViewportWScalingNV> : std::bool_constant<sizeof(VkViewportWScalingNV) == 8> {};
+template <> struct IsTriviallyEncodable<VkRefreshCycleDurationGOOGLE> : std::bool_constant<sizeof(VkRefreshCycleDurationGOOGLE) == 8> {};
+template <> struct IsTriviallyEncodable<VkViewportSwizzleNV> : std::bool_constant<sizeof(VkViewportSwizzleNV) == 16> {};
+template <> struct IsTriviallyEncodable<VkXYColorEXT> : std::bool_constant<sizeof(VkXYColorEXT) == 8> {};
+template <> struct IsTriviallyEncodable<VkSampleLocationEXT> : std::bool_constant<sizeof(VkSampleLocationEXT) == 8> {};
+template <> struct IsTriviallyEncodable<VkDrmFormatModifierPropertiesEXT> : std::bool_constant<sizeof(VkDrmFormatModifierPropertiesEXT) == 16> {};
+template <> struct IsTriviallyEncodable<VkCoarseSampleLocationNV> : std::bool_constant<sizeof(VkCoarseSampleLocationNV) == 12> {};
+template <> struct IsTriviallyEncodable<VkAabbPositionsKHR> : std::bool_constant<sizeof(VkAabbPositionsKHR) == 24> {};
+template <> struct IsTriviallyEncodable<VkDrawMeshTasksIndirectCommandNV> : std::bool_constant<sizeof(VkDrawMeshTasksIndirectCommandNV) == 8> {};
+template <> struct IsTriviallyEncodable<VkBindShaderGroupIndirectCommandNV> : std::bool_constant<sizeof(VkBindShaderGroupIndirectCommandNV) == 4> {};
+template <> struct IsTriviallyEncodable<VkBindIndexBufferIndirectCommandNV> : std::bool_constant<sizeof(VkBindIndexBufferIndirectCommandNV) == 16> {};
+template <> struct IsTriviallyEncodable<VkBindVertexBufferIndirectCommandNV> : std::bool_constant<sizeof(VkBindVertexBufferIndirectCommandNV) == 16> {};
+template <> struct IsTriviallyEncodable<VkSetStateFlagsIndirectCommandNV> : std::bool_constant<sizeof(VkSetStateFlagsIndirectCommandNV) == 4> {};
+template <> struct IsTriviallyEncodable<VkSRTDataNV> : std::bool_constant<sizeof(VkSRTDataNV) == 64> {};
+template <> struct IsTriviallyEncodable<VkMultiDrawInfoEXT> : std::bool_constant<sizeof(VkMultiDrawInfoEXT) == 8> {};
+template <> struct IsTriviallyEncodable<VkMultiDrawIndexedInfoEXT> : std::bool_constant<sizeof(VkMultiDrawIndexedInfoEXT) == 12> {};
+template <> struct IsTriviallyEncodable<VkMicromapUsageEXT> : std::bool_constant<sizeof(VkMicromapUsageEXT) == 12> {};
+template <> struct IsTriviallyEncodable<VkBindPipelineIndirectCommandNV> : std::bool_constant<sizeof(VkBindPipelineIndirectCommandNV) == 8> {};
+template <> struct IsTriviallyEncodable<VkColorBlendEquationEXT> : std::bool_constant<sizeof(VkColorBlendEquationEXT) == 24> {};
+template <> struct IsTriviallyEncodable<VkColorBlendAdvancedEXT> : std::bool_constant<sizeof(VkColorBlendAdvancedEXT) == 20> {};
+template <> struct IsTriviallyEncodable<VkRenderPassCreationFeedbackInfoEXT> : std::bool_constant<sizeof(VkRenderPassCreationFeedbackInfoEXT) == 4> {};
+template <> struct IsTriviallyEncodable<VkDepthClampRangeEXT> : std::bool_constant<sizeof(VkDepthClampRangeEXT) == 8> {};
+template <> struct IsTriviallyEncodable<VkIndirectCommandsPushConstantTokenEXT> : std::bool_constant<sizeof(VkIndirectCommandsPushConstantTokenEXT) == 12> {};
+template <> struct IsTriviallyEncodable<VkIndirectCommandsVertexBufferTokenEXT> : std::bool_constant<sizeof(VkIndirectCommandsVertexBufferTokenEXT) == 4> {};
+template <> struct IsTriviallyEncodable<VkIndirectCommandsIndexBufferTokenEXT> : std::bool_constant<sizeof(VkIndirectCommandsIndexBufferTokenEXT) == 4> {};
+template <> struct IsTriviallyEncodable<VkIndirectCommandsExecutionSetTokenEXT> : std::bool_constant<sizeof(VkIndirectCommandsExecutionSetTokenEXT) == 8> {};
+template <> struct IsTriviallyEncodable<VkDrawIndirectCountIndirectCommandEXT> : std::bool_constant<sizeof(VkDrawIndirectCountIndirectCommandEXT) == 16> {};
+template <> struct IsTriviallyEncodable<VkBindVertexBufferIndirectCommandEXT> : std::bool_constant<sizeof(VkBindVertexBufferIndirectCommandEXT) == 16> {};
+template <> struct IsTriviallyEncodable<VkBindIndexBufferIndirectCommandEXT> : std::bool_constant<sizeof(VkBindIndexBufferIndirectCommandEXT) == 16> {};
+template <> struct IsTriviallyEncodable<VkAccelerationStructureBuildRangeInfoKHR> : std::bool_constant<sizeof(VkAccelerationStructureBuildRangeInfoKHR) == 16> {};
+template <> struct IsTriviallyEncodable<VkStridedDeviceAddressRegionKHR> : std::bool_constant<sizeof(VkStridedDeviceAddressRegionKHR) == 24> {};
+template <> struct IsTriviallyEncodable<VkTraceRaysIndirectCommandKHR> : std::bool_constant<sizeof(VkTraceRaysIndirectCommandKHR) == 12> {};
+template <> struct IsTriviallyEncodable<VkDrawMeshTasksIndirectCommandEXT> : std::bool_constant<sizeof(VkDrawMeshTasksIndirectCommandEXT) == 12> {};
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -652,6 +652,19 @@ def make_gen_opts(args):
         )
     ]
 
+    gen_opts['generated_layer_func_table_names.h'] = [
+        LayerFuncTableGenerator,
+        LayerFuncTableGeneratorOptions(
+            filename='generated_layer_func_table_names.h',
+            directory=directory,
+            prefix_text=prefix_strings + vk_prefix_strings,
+            protect_file=True,
+            protect_feature=False,
+            extraVulkanHeaders=extraVulkanHeaders,
+            names_only=True
+        )
+    ]
+
     #
     # Struct encoder generators
     gen_opts['generated_vulkan_struct_encoders.cpp'] = [
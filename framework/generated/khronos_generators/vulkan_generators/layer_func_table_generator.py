@@ -29,6 +29,7 @@ class LayerFuncTableGeneratorOptions(BaseGeneratorOptions):
     """Eliminates JSON black_lists and platform_types files, which are not necessary for
     function table generation.
     Options for Vulkan layer function table C++ code generation.
+    names_only - Generate only the hash table of API call names, which has no Vulkan or layer dependencies.
     """
 
     def __init__(
@@ -38,7 +39,8 @@ class LayerFuncTableGeneratorOptions(BaseGeneratorOptions):
         prefix_text='',
         protect_file=False,
         protect_feature=True,
-        extraVulkanHeaders=[]
+        extraVulkanHeaders=[],
+        names_only=False
     ):
         BaseGeneratorOptions.__init__(
             self,
@@ -51,6 +53,7 @@ class LayerFuncTableGeneratorOptions(BaseGeneratorOptions):
             protect_feature,
             extraVulkanHeaders=extraVulkanHeaders
         )
+        self.names_only = names_only
 
 
 class LayerFuncTableGenerator(BaseGenerator):
@@ -88,36 +91,56 @@ class LayerFuncTableGenerator(BaseGenerator):
         """Method override."""
         BaseGenerator.beginFile(self, gen_opts)
 
-        write(
-            '#include "encode/custom_vulkan_api_call_encoders.h"',
-            file=self.outFile
-        )
-        write(
-            '#include "generated/generated_vulkan_api_call_encoders.h"',
-            file=self.outFile
-        )
-        write('#include "layer/trace_layer.h"', file=self.outFile)
-        write('#include "util/defines.h"', file=self.outFile)
-        self.newline()
-        self.includeVulkanHeaders(gen_opts)
-        self.newline()
-        write('#include <unordered_map>', file=self.outFile)
+        self.names_only = gen_opts.names_only
+
+        if self.names_only:
+            write('#include "util/defines.h"', file=self.outFile)
+            write('#include "util/hash.h"', file=self.outFile)
+            self.newline()
+            write('#include <cstdint>', file=self.outFile)
+            write('#include <cstring>', file=self.outFile)
+        else:
+            write(
+                '#include "encode/custom_vulkan_api_call_encoders.h"',
+                file=self.outFile
+            )
+            write(
+                '#include "generated/generated_layer_func_table_names.h"',
+                file=self.outFile
+            )
+            write(
+                '#include "generated/generated_vulkan_api_call_encoders.h"',
+                file=self.outFile
+            )
+            write('#include "layer/trace_layer.h"', file=self.outFile)
+            write('#include "util/defines.h"', file=self.outFile)
+            self.newline()
+            self.includeVulkanHeaders(gen_opts)
+            self.newline()
+            write('#include <cstdint>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         self.newline()
-        write(
-            'const std::unordered_map<std::string, PFN_vkVoidFunction> vulkan_func_table = {',
-            file=self.outFile
-        )
+
+        # List of (name, function) pairs for the table.
+        self.table_entries = []
 
     def endFile(self):
         """Method override."""
-        # Manually output the physical device proc address function as its name doesn't
+        # Manually add the physical device proc address function as its name doesn't
         # match the scheme used by self.LAYER_FUNCTIONS:
-        align = 100 - len('vk_layerGetPhysicalDeviceProcAddr')
-        write('    { "vk_layerGetPhysicalDeviceProcAddr",%sreinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::GetPhysicalDeviceProcAddr) },' % (' ' * align), file=self.outFile)
+        self.table_entries.append(
+            (
+                'vk_layerGetPhysicalDeviceProcAddr',
+                'vulkan_entry::GetPhysicalDeviceProcAddr'
+            )
+        )
+
+        if self.names_only:
+            self.write_perfect_hash_table()
+        else:
+            self.write_function_table()
 
-        write('};', file=self.outFile)
         self.newline()
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
 
@@ -133,13 +156,109 @@ class LayerFuncTableGenerator(BaseGenerator):
     def generate_feature(self):
         """Performs C++ code generation for the feature."""
         for cmd in self.get_filtered_cmd_names():
-            align = 100 - len(cmd)
             if (cmd in self.LAYER_FUNCTIONS):
-                body = '    {{ "{}",{}reinterpret_cast<PFN_vkVoidFunction>(vulkan_entry::{}) }},'.format(
-                    cmd, (' ' * align), cmd[2:]
-                )
+                self.table_entries.append((cmd, 'vulkan_entry::{}'.format(cmd[2:])))
             else:
-                body = '    {{ "{}",{}reinterpret_cast<PFN_vkVoidFunction>(encode::{}) }},'.format(
-                    cmd, (' ' * align), cmd[2:]
-                )
-            write(body, file=self.outFile)
+                self.table_entries.append((cmd, 'encode::{}'.format(cmd[2:])))
+
+    @staticmethod
+    def fnv1a_64(name):
+        """Matches util::hash::fnv1a_64."""
+        value = 0xcbf29ce484222325
+        for c in name.encode('utf-8'):
+            value ^= c
+            value = (value * 0x100000001b3) & 0xffffffffffffffff
+        return value
+
+    @staticmethod
+    def perfect_hash_index(value, seed, table_size):
+        """Matches util::hash::perfect_hash_index, with the bucket seed already selected."""
+        k = (value & 0xffffffff) ^ seed
+        k ^= k >> 16
+        k = (k * 0x85ebca6b) & 0xffffffff
+        k ^= k >> 13
+        k = (k * 0xc2b2ae35) & 0xffffffff
+        k ^= k >> 16
+        return k % table_size
+
+    @staticmethod
+    def build_perfect_hash(names):
+        """Builds a minimal perfect hash table with the hash and displace method.  Returns the list of per-bucket seeds
+        and the list of names in table order."""
+        table_size = len(names)
+        seed_count = max(1, (table_size + 1) // 2)
+        hashes = {name: LayerFuncTableGenerator.fnv1a_64(name) for name in names}
+
+        buckets = [[] for _ in range(seed_count)]
+        for name in names:
+            buckets[(hashes[name] >> 32) % seed_count].append(name)
+
+        seeds = [0] * seed_count
+        slots = [None] * table_size
+
+        # Place the largest buckets first, while the table has the most free slots.
+        for bucket_index in sorted(range(seed_count), key=lambda i: len(buckets[i]), reverse=True):
+            bucket = buckets[bucket_index]
+            if not bucket:
+                break
+
+            seed = 0
+            while True:
+                indices = [
+                    LayerFuncTableGenerator.perfect_hash_index(hashes[name], seed, table_size) for name in bucket
+                ]
+                if len(set(indices)) == len(indices) and all(slots[i] is None for i in indices):
+                    break
+                seed += 1
+                if seed > 0xffffffff:
+                    raise RuntimeError('Failed to build perfect hash table for the layer function table')
+
+            seeds[bucket_index] = seed
+            for name, index in zip(bucket, indices):
+                slots[index] = name
+
+        return seeds, slots
+
+    def write_perfect_hash_table(self):
+        """Writes the names of the API calls as a minimal perfect hash table, so a lookup is one string hash and one
+        string compare."""
+        seeds, slots = self.build_perfect_hash([entry[0] for entry in self.table_entries])
+
+        write('// Minimal perfect hash table of the Vulkan API calls exported by the layer.', file=self.outFile)
+        write('constexpr uint32_t kVulkanFuncTableSize      = {};'.format(len(slots)), file=self.outFile)
+        write('constexpr uint32_t kVulkanFuncTableSeedCount = {};'.format(len(seeds)), file=self.outFile)
+        self.newline()
+        write('constexpr uint32_t kVulkanFuncTableSeeds[kVulkanFuncTableSeedCount] = {', file=self.outFile)
+        for i in range(0, len(seeds), 8):
+            write('    ' + ' '.join('{},'.format(seed) for seed in seeds[i:i + 8]), file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
+        write('constexpr const char* kVulkanFuncTableNames[kVulkanFuncTableSize] = {', file=self.outFile)
+        for name in slots:
+            write('    "{}",'.format(name), file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
+        write('// Returns the table index of the named Vulkan API call, or kVulkanFuncTableSize if the layer does not export it.', file=self.outFile)
+        write('inline uint32_t GetVulkanFuncTableIndex(const char* name)', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    const uint32_t index = util::hash::perfect_hash_index(', file=self.outFile)
+        write('        util::hash::fnv1a_64(name), kVulkanFuncTableSeeds, kVulkanFuncTableSeedCount, kVulkanFuncTableSize);', file=self.outFile)
+        write('    return (std::strcmp(kVulkanFuncTableNames[index], name) == 0) ? index : kVulkanFuncTableSize;', file=self.outFile)
+        write('}', file=self.outFile)
+
+    def write_function_table(self):
+        """Writes the layer's function pointers in the slot order of the table written by write_perfect_hash_table."""
+        functions = dict(self.table_entries)
+        _, slots = self.build_perfect_hash([entry[0] for entry in self.table_entries])
+
+        write('const PFN_vkVoidFunction kVulkanFuncTableFunctions[kVulkanFuncTableSize] = {', file=self.outFile)
+        for name in slots:
+            write('    reinterpret_cast<PFN_vkVoidFunction>({}),'.format(functions[name]), file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
+        write('// Returns the layer\'s implementation of the named Vulkan API call, or nullptr.', file=self.outFile)
+        write('inline PFN_vkVoidFunction GetVulkanFuncTableEntry(const char* name)', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    const uint32_t index = GetVulkanFuncTableIndex(name);', file=self.outFile)
+        write('    return (index < kVulkanFuncTableSize) ? kVulkanFuncTableFunctions[index] : nullptr;', file=self.outFile)
+        write('}', file=self.outFile)
@@ -58,6 +58,20 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
     Generate C++ function declarations for Vulkan struct encoding.
     """
 
+    # Types that are encoded with the same size and representation that they have in memory.
+    TRIVIAL_TYPE_SIZES = {
+        'float': 4,
+        'int32_t': 4,
+        'uint32_t': 4,
+        'VkBool32': 4,
+        'VkSampleMask': 4,
+        'double': 8,
+        'int64_t': 8,
+        'uint64_t': 8,
+        'VkDeviceSize': 8,
+        'VkDeviceAddress': 8
+    }
+
     def __init__(
         self, err_file=sys.stderr, warn_file=sys.stderr, diag_file=sys.stdout
     ):
@@ -71,6 +85,9 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
             diag_file=diag_file
         )
 
+        # Map of trivially encodable struct names to their (size, alignment).
+        self.trivially_encodable_structs = dict()
+
     def beginFile(self, gen_opts):
         """Method override."""
         BaseGenerator.beginFile(self, gen_opts)
@@ -82,6 +99,7 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
         self.includeVulkanHeaders(gen_opts)
         self.newline()
         write('#include <cstdint>', file=self.outFile)
+        write('#include <type_traits>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         write('GFXRECON_BEGIN_NAMESPACE(encode)', file=self.outFile)
@@ -93,6 +111,23 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
 
     def endFile(self):
         """Method override."""
+        if self.trivially_encodable_structs:
+            self.newline()
+            write(
+                '// Structs with an encoded representation that matches their memory layout, which are encoded with a',
+                file=self.outFile
+            )
+            write(
+                '// single copy when in an array.  A size mismatch falls back to member-wise encoding.',
+                file=self.outFile
+            )
+            for struct, layout in self.trivially_encodable_structs.items():
+                write(
+                    'template <> struct IsTriviallyEncodable<{0}> : std::bool_constant<sizeof({0}) == {1}> {{}};'
+                    .format(struct, layout[0]),
+                    file=self.outFile
+                )
+
         self.newline()
         write('GFXRECON_END_NAMESPACE(encode)', file=self.outFile)
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
@@ -114,3 +149,44 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
                 .format(struct),
                 file=self.outFile
             )
+
+            layout = self.get_trivial_layout(self.feature_struct_members[struct])
+            if layout:
+                self.trivially_encodable_structs[struct] = layout
+
+    def get_trivial_layout(self, members):
+        """Returns the (size, alignment) of a struct that is encoded as a direct copy of its memory, or None if the
+        struct contains members that require conversion, such as pointers, handles, pNext chains, arrays, and size_t
+        values, or if the struct contains padding.
+        """
+        offset = 0
+        max_alignment = 1
+
+        for value in members:
+            if value.is_pointer or value.is_array or value.bitfield_width:
+                return None
+
+            if value.base_type in self.TRIVIAL_TYPE_SIZES:
+                size = self.TRIVIAL_TYPE_SIZES[value.base_type]
+                alignment = size
+            elif self.is_enum(value.base_type):
+                size = 4
+                alignment = 4
+            elif self.is_flags(value.base_type):
+                size = 8 if self.is_64bit_flags(value.base_type) else 4
+                alignment = size
+            elif value.base_type in self.trivially_encodable_structs:
+                size, alignment = self.trivially_encodable_structs[value.base_type]
+            else:
+                return None
+
+            if (offset % alignment) != 0:
+                return None
+
+            offset += size
+            max_alignment = max(max_alignment, alignment)
+
+        if (offset == 0) or ((offset % max_alignment) != 0):
+            return None
+
+        return (offset, max_alignment)
@@ -29,7 +29,11 @@
 #include "util/json_util.h"
 
 #include "nlohmann/json.hpp"
+
+#include <algorithm>
 #include <cinttypes>
+#include <cmath>
+#include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -58,6 +62,47 @@ WriteFpsToConsole(const char* prefix, uint64_t start_frame, uint64_t end_frame,
                            end_frame);
 }
 
+// Returns the nearest-rank percentile (0.0 to 1.0) of a sorted list of durations, in milliseconds.
+static double GetPercentileMilliseconds(const std::vector<int64_t>& sorted_durations, double percentile)
+{
+    assert(!sorted_durations.empty());
+
+    size_t rank  = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted_durations.size())));
+    size_t index = (rank > 0) ? std::min(rank - 1, sorted_durations.size() - 1) : 0;
+    return util::datetime::ConvertTimestampToMilliseconds(sorted_durations[index]);
+}
+
+static bool WriteFileContent(const std::string& file_name, const std::string& content, const char* description)
+{
+    FILE*   file_pointer = nullptr;
+    int32_t result       = util::platform::FileOpen(&file_pointer, file_name.c_str(), "w");
+    if (result == 0)
+    {
+        // It either writes a fully valid file, or it doesn't write anything !
+        bool success = util::platform::FileWrite(content.data(), content.size(), file_pointer);
+        util::platform::FileClose(file_pointer);
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to write to %s file '%s'.", description, file_name.c_str());
+
+            // Try to delete the partial file from disk using <cstdio>
+            const int remove_result = std::remove(file_name.c_str());
+            if (remove_result != 0)
+            {
+                GFXRECON_LOG_ERROR(
+                    "Failed to remove %s file '%s' (Error %i).", description, file_name.c_str(), remove_result);
+            }
+        }
+
+        return success;
+    }
+
+    GFXRECON_LOG_ERROR("Failed to open %s file '%s' (Error %i).", description, file_name.c_str(), result);
+    GFXRECON_LOG_ERROR("%s", std::strerror(result));
+    return false;
+}
+
 FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  uint64_t               measurement_end_frame,
                  bool                   has_measurement_range,
@@ -67,14 +112,16 @@ FpsInfo::FpsInfo(uint64_t               measurement_start_frame,
                  bool                   preload_measurement_range,
                  const std::string_view measurement_file_name,
                  bool                   quit_after_frame,
-                 uint64_t               quit_frame) :
+                 uint64_t               quit_frame,
+                 const std::string_view frame_time_file_name) :
     measurement_start_frame_(measurement_start_frame),
     measurement_end_frame_(measurement_end_frame), measurement_start_time_(0), measurement_end_time_(0),
     has_measurement_range_(has_measurement_range), quit_after_range_(quit_after_range),
     flush_measurement_range_(flush_measurement_range), flush_inside_measurement_range_(flush_inside_measurement_range),
     started_measurement_(false), ended_measurement_(false), frame_start_time_(0), frame_durations_(),
-    measurement_file_name_(measurement_file_name), preload_measurement_range_(preload_measurement_range),
-    quit_after_frame_(quit_after_frame), quit_frame_(quit_frame)
+    first_duration_frame_(0), measurement_file_name_(measurement_file_name),
+    preload_measurement_range_(preload_measurement_range), quit_after_frame_(quit_after_frame), quit_frame_(quit_frame),
+    frame_time_file_name_(frame_time_file_name)
 {
     if (has_measurement_range_)
     {
@@ -86,6 +133,14 @@ void FpsInfo::BeginFile()
 {
     replay_start_frame_ = 1;
     replay_start_time_ = start_time_ = static_cast<uint64_t>(util::datetime::GetTimestamp());
+
+    size_t capacity = kDefaultFrameDurationCapacity;
+    if (measurement_end_frame_ != std::numeric_limits<uint64_t>::max())
+    {
+        capacity = static_cast<size_t>(
+            std::min<uint64_t>(measurement_end_frame_ - measurement_start_frame_ + 1, kMaxFrameDurationCapacity));
+    }
+    frame_durations_.reserve(capacity);
 }
 
 bool FpsInfo::ShouldWaitIdleBeforeFrame(uint64_t frame)
@@ -107,6 +162,7 @@ void FpsInfo::BeginFrame(uint64_t frame)
         {
             measurement_start_time_ = util::datetime::GetTimestamp();
             started_measurement_    = true;
+            first_duration_frame_   = frame;
             frame_durations_.clear();
         }
     }
@@ -121,7 +177,7 @@ void FpsInfo::EndFrame(uint64_t frame)
         frame_durations_.push_back(util::datetime::DiffTimestamps(frame_start_time_, util::datetime::GetTimestamp()));
 
         // Measurement frame range end is non-inclusive, as opposed to trim frame range
-        if (frame >= measurement_end_frame_ - 1)
+        if ((frame >= measurement_end_frame_ - 1) && (++completed_measurement_loops_ >= measurement_loop_count_))
         {
             measurement_end_time_ = util::datetime::GetTimestamp();
             ended_measurement_    = true;
@@ -133,48 +189,34 @@ void FpsInfo::EndFrame(uint64_t frame)
                 double   end_time     = util::datetime::ConvertTimestampToSeconds(measurement_end_time_);
                 double   diff_time    = GetElapsedSeconds(static_cast<uint64_t>(measurement_start_time_),
                                                      static_cast<uint64_t>(measurement_end_time_));
-                uint64_t total_frames = measurement_end_frame_ - measurement_start_frame_;
+                uint64_t total_frames = GetMeasuredFrameCount();
                 double   fps          = static_cast<double>(total_frames) / diff_time;
 
                 nlohmann::json file_content = { { "frame_range",
                                                   { { "start_frame", measurement_start_frame_ },
                                                     { "end_frame", measurement_end_frame_ },
                                                     { "frame_count", total_frames },
+                                                    { "loop_count", measurement_loop_count_ },
                                                     { "start_time_monotonic", start_time },
                                                     { "end_time_monotonic", end_time },
                                                     { "duration", diff_time },
                                                     { "fps", fps },
                                                     { "frame_durations", frame_durations_ } } } };
 
-                FILE*   file_pointer = nullptr;
-                int32_t result       = util::platform::FileOpen(&file_pointer, measurement_file_name_.c_str(), "w");
-                if (result == 0)
+                if (!frame_durations_.empty())
                 {
-                    const std::string json_string = file_content.dump(util::kJsonIndentWidth);
-
-                    // It either writes a fully valid file, or it doesn't write anything !
-                    if (!util::platform::FileWrite(json_string.data(), json_string.size(), file_pointer))
-                    {
-                        GFXRECON_LOG_ERROR("Failed to write to measurements file '%s'.",
-                                           measurement_file_name_.c_str());
-
-                        // Try to delete the partial file from disk using <cstdio>
-                        const int remove_result = std::remove(measurement_file_name_.c_str());
-                        if (remove_result != 0)
-                        {
-                            GFXRECON_LOG_ERROR("Failed to remove measurements file '%s' (Error %i).",
-                                               measurement_file_name_.c_str(),
-                                               remove_result);
-                        }
-                    }
-                    util::platform::FileClose(file_pointer);
-                }
-                else
-                {
-                    GFXRECON_LOG_ERROR(
-                        "Failed to open measurements file '%s' (Error %i).", measurement_file_name_.c_str(), result);
-                    GFXRECON_LOG_ERROR("%s", std::strerror(result));
+                    FrameTimeStatistics statistics = GetFrameTimeStatistics();
+
+                    file_content["frame_range"]["frame_time_ms"] = { { "min", statistics.min_ms },
+                                                                     { "max", statistics.max_ms },
+                                                                     { "mean", statistics.mean_ms },
+                                                                     { "p50", statistics.p50_ms },
+                                                                     { "p90", statistics.p90_ms },
+                                                                     { "p99", statistics.p99_ms },
+                                                                     { "p99.9", statistics.p999_ms } };
                 }
+
+                WriteFileContent(measurement_file_name_, file_content.dump(util::kJsonIndentWidth), "measurements");
             }
         }
     }
@@ -194,6 +236,11 @@ void FpsInfo::EndFile(uint64_t frame)
         measurement_end_time_  = gfxrecon::util::datetime::GetTimestamp();
         measurement_end_frame_ = frame;
     }
+
+    if (!frame_time_file_name_.empty())
+    {
+        WriteFrameTimeFile();
+    }
 }
 
 void FpsInfo::ProcessStateEndMarker(uint64_t frame_number)
@@ -228,22 +275,182 @@ void FpsInfo::LogToConsole()
         // measurement range
         double   diff_time_sec = GetElapsedSeconds(static_cast<uint64_t>(measurement_start_time_),
                                                  static_cast<uint64_t>(measurement_end_time_));
-        uint64_t total_frames  = measurement_end_frame_ - measurement_start_frame_;
+        uint64_t total_frames  = GetMeasuredFrameCount();
         double   fps           = static_cast<double>(total_frames) / diff_time_sec;
-        GFXRECON_WRITE_CONSOLE("Measurement range FPS: %f fps, %f seconds, %lu frame%s, 1 loop, framerange [%lu-%lu)",
-                               fps,
-                               diff_time_sec,
-                               total_frames,
-                               total_frames > 1 ? "s" : "",
-                               measurement_start_frame_,
-                               measurement_end_frame_);
+        GFXRECON_WRITE_CONSOLE(
+            "Measurement range FPS: %f fps, %f seconds, %lu frame%s, %u loop%s, framerange [%lu-%lu)",
+            fps,
+            diff_time_sec,
+            total_frames,
+            total_frames > 1 ? "s" : "",
+            measurement_loop_count_,
+            measurement_loop_count_ > 1 ? "s" : "",
+            measurement_start_frame_,
+            measurement_end_frame_);
     }
+
+    LogFrameTimeStatistics();
+}
+
+FpsInfo::FrameTimeStatistics FpsInfo::GetFrameTimeStatistics() const
+{
+    FrameTimeStatistics statistics;
+
+    if (!frame_durations_.empty())
+    {
+        std::vector<int64_t> sorted_durations(frame_durations_);
+        std::sort(sorted_durations.begin(), sorted_durations.end());
+
+        int64_t total = std::accumulate(sorted_durations.begin(), sorted_durations.end(), int64_t{ 0 });
+
+        statistics.frame_count = sorted_durations.size();
+        statistics.min_ms      = util::datetime::ConvertTimestampToMilliseconds(sorted_durations.front());
+        statistics.max_ms      = util::datetime::ConvertTimestampToMilliseconds(sorted_durations.back());
+        statistics.mean_ms =
+            util::datetime::ConvertTimestampToMilliseconds(total) / static_cast<double>(sorted_durations.size());
+        statistics.p50_ms  = GetPercentileMilliseconds(sorted_durations, 0.5);
+        statistics.p90_ms  = GetPercentileMilliseconds(sorted_durations, 0.9);
+        statistics.p99_ms  = GetPercentileMilliseconds(sorted_durations, 0.99);
+        statistics.p999_ms = GetPercentileMilliseconds(sorted_durations, 0.999);
+
+        // Find the longest frames, keeping their frame numbers.
+        std::vector<size_t> indices(frame_durations_.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        size_t hitch_count = std::min(kHitchReportCount, indices.size());
+        std::partial_sort(indices.begin(),
+                          indices.begin() + hitch_count,
+                          indices.end(),
+                          [this](size_t lhs, size_t rhs) { return frame_durations_[lhs] > frame_durations_[rhs]; });
+
+        for (size_t i = 0; i < hitch_count; ++i)
+        {
+            statistics.hitches.emplace_back(
+                GetFrameDurationFrameNumber(indices[i]),
+                util::datetime::ConvertTimestampToMilliseconds(frame_durations_[indices[i]]));
+        }
+    }
+
+    return statistics;
+}
+
+uint64_t FpsInfo::GetFrameDurationFrameNumber(size_t index) const
+{
+    // When the measurement range is looped, the durations of each iteration follow each other.
+    if ((measurement_loop_count_ > 1) && (measurement_end_frame_ > first_duration_frame_))
+    {
+        index %= static_cast<size_t>(measurement_end_frame_ - first_duration_frame_);
+    }
+
+    return first_duration_frame_ + index;
+}
+
+uint64_t FpsInfo::GetMeasuredFrameCount() const
+{
+    return (measurement_end_frame_ - measurement_start_frame_) * measurement_loop_count_;
+}
+
+void FpsInfo::LogFrameTimeStatistics() const
+{
+    if (!frame_durations_.empty())
+    {
+        FrameTimeStatistics statistics = GetFrameTimeStatistics();
+
+        GFXRECON_WRITE_CONSOLE("Frame time: min %.3f ms, mean %.3f ms, max %.3f ms, %" PRIu64 " frame%s",
+                               statistics.min_ms,
+                               statistics.mean_ms,
+                               statistics.max_ms,
+                               statistics.frame_count,
+                               statistics.frame_count > 1 ? "s" : "");
+        GFXRECON_WRITE_CONSOLE("Frame time percentiles: p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, p99.9 %.3f ms",
+                               statistics.p50_ms,
+                               statistics.p90_ms,
+                               statistics.p99_ms,
+                               statistics.p999_ms);
+
+        std::string hitches;
+        for (const auto& hitch : statistics.hitches)
+        {
+            char entry[64];
+            snprintf(entry,
+                     sizeof(entry),
+                     "%s%" PRIu64 " (%.3f ms)",
+                     hitches.empty() ? "" : ", ",
+                     hitch.first,
+                     hitch.second);
+            hitches += entry;
+        }
+        GFXRECON_WRITE_CONSOLE("Longest frames: %s", hitches.c_str());
+    }
+}
+
+void FpsInfo::WriteFrameTimeFile() const
+{
+    std::string content;
+
+    // The file format is selected by the file extension, with JSON as the default.
+    std::string extension;
+    size_t      dot = frame_time_file_name_.rfind('.');
+    if (dot != std::string::npos)
+    {
+        extension = frame_time_file_name_.substr(dot);
+        std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    }
+
+    if (extension == ".csv")
+    {
+        content = "frame,duration_ms\n";
+
+        char line[64];
+        for (size_t i = 0; i < frame_durations_.size(); ++i)
+        {
+            snprintf(line,
+                     sizeof(line),
+                     "%" PRIu64 ",%.6f\n",
+                     GetFrameDurationFrameNumber(i),
+                     util::datetime::ConvertTimestampToMilliseconds(frame_durations_[i]));
+            content += line;
+        }
+    }
+    else
+    {
+        FrameTimeStatistics statistics = GetFrameTimeStatistics();
+
+        nlohmann::json hitches = nlohmann::json::array();
+        for (const auto& hitch : statistics.hitches)
+        {
+            hitches.push_back({ { "frame", hitch.first }, { "duration_ms", hitch.second } });
+        }
+
+        nlohmann::json frame_times = nlohmann::json::array();
+        for (int64_t duration : frame_durations_)
+        {
+            frame_times.push_back(util::datetime::ConvertTimestampToMilliseconds(duration));
+        }
+
+        nlohmann::json file_content = { { "first_frame", first_duration_frame_ },
+                                        { "frame_count", statistics.frame_count },
+                                        { "loop_count", measurement_loop_count_ },
+                                        { "min_ms", statistics.min_ms },
+                                        { "max_ms", statistics.max_ms },
+                                        { "mean_ms", statistics.mean_ms },
+                                        { "p50_ms", statistics.p50_ms },
+                                        { "p90_ms", statistics.p90_ms },
+                                        { "p99_ms", statistics.p99_ms },
+                                        { "p99.9_ms", statistics.p999_ms },
+                                        { "longest_frames", hitches },
+                                        { "frame_times_ms", frame_times } };
+
+        content = file_content.dump(util::kJsonIndentWidth);
+    }
+
+    WriteFileContent(frame_time_file_name_, content, "frame time");
 }
 
 uint64_t FpsInfo::ShouldPreloadFrames(uint64_t current_frame) const
 {
     uint64_t result = 0;
-    if (preload_measurement_range_ && current_frame == measurement_start_frame_)
+    if (preload_measurement_range_ && !started_measurement_ && current_frame == measurement_start_frame_)
     {
         result = measurement_end_frame_ - measurement_start_frame_;
     }
@@ -28,7 +28,9 @@
 #include "decode/file_processor.h"
 
 #include <limits>
+#include <string>
 #include <string_view>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(graphics)
@@ -36,6 +38,14 @@ GFXRECON_BEGIN_NAMESPACE(graphics)
 class FpsInfo
 {
   public:
+    // Frame durations are stored in a buffer that is allocated before replay starts, so that recording them does not
+    // allocate memory inside the measured range.  Ranges without a known end start with this capacity.
+    static constexpr size_t kDefaultFrameDurationCapacity = 64 * 1024;
+    static constexpr size_t kMaxFrameDurationCapacity     = 1024 * 1024;
+
+    // Number of longest frames reported as hitches.
+    static constexpr size_t kHitchReportCount = 5;
+
     explicit FpsInfo(uint64_t         measurement_start_frame        = 1,
                      uint64_t         measurement_end_frame          = std::numeric_limits<uint64_t>::max(),
                      bool             has_measurement_range          = false,
@@ -45,10 +55,14 @@ class FpsInfo
                      bool             preload_measurement_range      = false,
                      std::string_view measurement_file_name          = "",
                      bool             quit_after_frame               = false,
-                     uint64_t         quit_frame                     = std::numeric_limits<uint64_t>::max());
+                     uint64_t         quit_frame                     = std::numeric_limits<uint64_t>::max(),
+                     std::string_view frame_time_file_name           = "");
 
     void LogToConsole();
 
+    // Sets the number of times the measurement range is replayed before the measurement ends.
+    void SetMeasurementLoopCount(uint32_t loop_count) { measurement_loop_count_ = (loop_count > 0) ? loop_count : 1; }
+
     void                   BeginFile();
     bool                   ShouldWaitIdleBeforeFrame(uint64_t file_processor_frame);
     bool                   ShouldWaitIdleAfterFrame(uint64_t file_processor_frame);
@@ -59,6 +73,30 @@ class FpsInfo
     void                   ProcessStateEndMarker(uint64_t file_processor_frame);
     [[nodiscard]] uint64_t ShouldPreloadFrames(uint64_t current_frame) const;
 
+  private:
+    struct FrameTimeStatistics
+    {
+        uint64_t                                  frame_count{ 0 };
+        double                                    min_ms{ 0.0 };
+        double                                    max_ms{ 0.0 };
+        double                                    mean_ms{ 0.0 };
+        double                                    p50_ms{ 0.0 };
+        double                                    p90_ms{ 0.0 };
+        double                                    p99_ms{ 0.0 };
+        double                                    p999_ms{ 0.0 };
+        std::vector<std::pair<uint64_t, double>> hitches; // Frame number and duration, longest first.
+    };
+
+    FrameTimeStatistics GetFrameTimeStatistics() const;
+
+    uint64_t GetFrameDurationFrameNumber(size_t index) const;
+
+    uint64_t GetMeasuredFrameCount() const;
+
+    void LogFrameTimeStatistics() const;
+
+    void WriteFrameTimeFile() const;
+
   private:
     uint64_t start_time_{};
 
@@ -81,6 +119,7 @@ class FpsInfo
 
     int64_t              frame_start_time_;
     std::vector<int64_t> frame_durations_;
+    uint64_t             first_duration_frame_;
 
     std::string measurement_file_name_;
 
@@ -88,6 +127,11 @@ class FpsInfo
 
     bool     quit_after_frame_;
     uint64_t quit_frame_;
+
+    std::string frame_time_file_name_;
+
+    uint32_t measurement_loop_count_{ 1 };
+    uint32_t completed_measurement_loops_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(graphics)
@@ -871,13 +871,19 @@ uint64_t VulkanResourcesUtil::GetImageResourceSizesOptimal(VkImage
 
 VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 {
+    return CreateStagingBuffer(size, &staging_buffer_);
+}
+
+VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer)
+{
+    assert(staging_buffer != nullptr);
     assert(size);
 
-    if (staging_buffer_.buffer != VK_NULL_HANDLE)
+    if (staging_buffer->buffer != VK_NULL_HANDLE)
     {
-        if (staging_buffer_.size < size)
+        if (staging_buffer->size < size)
         {
-            DestroyStagingBuffer();
+            DestroyStagingBuffer(staging_buffer);
         }
         else
         {
@@ -885,7 +891,7 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
         }
     }
 
-    assert(staging_buffer_.buffer == VK_NULL_HANDLE && staging_buffer_.size == 0);
+    assert(staging_buffer->buffer == VK_NULL_HANDLE && staging_buffer->size == 0);
 
     VkBufferCreateInfo create_info    = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
     create_info.pNext                 = nullptr;
@@ -896,19 +902,19 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
     create_info.queueFamilyIndexCount = 0;
     create_info.pQueueFamilyIndices   = nullptr;
 
-    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer_.buffer);
+    VkResult result = device_table_.CreateBuffer(device_, &create_info, nullptr, &staging_buffer->buffer);
     if (result == VK_SUCCESS)
     {
         uint32_t             memory_type_index = std::numeric_limits<uint32_t>::max();
         VkMemoryRequirements memory_requirements;
 
-        device_table_.GetBufferMemoryRequirements(device_, staging_buffer_.buffer, &memory_requirements);
+        device_table_.GetBufferMemoryRequirements(device_, staging_buffer->buffer, &memory_requirements);
 
         bool found = FindMemoryTypeIndex(memory_properties_,
                                          memory_requirements.memoryTypeBits,
                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
                                          &memory_type_index,
-                                         &staging_buffer_.memory_property_flags);
+                                         &staging_buffer->memory_property_flags);
         if (!found)
         {
             // If we are here it is likely that we lack support for HOST_CACHED, fallback to COHERENT
@@ -916,7 +922,7 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
                                         memory_requirements.memoryTypeBits,
                                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
                                         &memory_type_index,
-                                        &staging_buffer_.memory_property_flags);
+                                        &staging_buffer->memory_property_flags);
         }
 
         if (found)
@@ -926,17 +932,17 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
             alloc_info.allocationSize       = memory_requirements.size;
             alloc_info.memoryTypeIndex      = memory_type_index;
 
-            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer_.memory);
+            result = device_table_.AllocateMemory(device_, &alloc_info, nullptr, &staging_buffer->memory);
             if (result == VK_SUCCESS)
             {
-                device_table_.BindBufferMemory(device_, staging_buffer_.buffer, staging_buffer_.memory, 0);
+                device_table_.BindBufferMemory(device_, staging_buffer->buffer, staging_buffer->memory, 0);
             }
             else
             {
                 GFXRECON_LOG_ERROR("Failed to allocate staging buffer memory for resource memory snapshot");
 
-                device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-                staging_buffer_.buffer = VK_NULL_HANDLE;
+                device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+                staging_buffer->buffer = VK_NULL_HANDLE;
             }
         }
         else
@@ -949,8 +955,8 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
 
         if (result == VK_SUCCESS)
         {
-            staging_buffer_.size       = size;
-            staging_buffer_.mapped_ptr = nullptr;
+            staging_buffer->size       = size;
+            staging_buffer->mapped_ptr = nullptr;
         }
     }
     else
@@ -961,18 +967,18 @@ VkResult VulkanResourcesUtil::CreateStagingBuffer(VkDeviceSize size)
     return result;
 }
 
-VkResult VulkanResourcesUtil::MapStagingBuffer()
+VkResult VulkanResourcesUtil::MapStagingBuffer(StagingBufferContext* staging_buffer)
 {
-    assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-    assert(staging_buffer_.memory != VK_NULL_HANDLE);
-    assert(staging_buffer_.size);
+    assert(staging_buffer->buffer != VK_NULL_HANDLE);
+    assert(staging_buffer->memory != VK_NULL_HANDLE);
+    assert(staging_buffer->size);
 
     VkResult result = VK_SUCCESS;
 
-    if (staging_buffer_.mapped_ptr == nullptr)
+    if (staging_buffer->mapped_ptr == nullptr)
     {
         result =
-            device_table_.MapMemory(device_, staging_buffer_.memory, 0, VK_WHOLE_SIZE, 0, &staging_buffer_.mapped_ptr);
+            device_table_.MapMemory(device_, staging_buffer->memory, 0, VK_WHOLE_SIZE, 0, &staging_buffer->mapped_ptr);
 
         if (result != VK_SUCCESS)
         {
@@ -983,55 +989,55 @@ VkResult VulkanResourcesUtil::MapStagingBuffer()
     return result;
 }
 
-void VulkanResourcesUtil::UnmapStagingBuffer()
+void VulkanResourcesUtil::UnmapStagingBuffer(StagingBufferContext* staging_buffer)
 {
-    if (staging_buffer_.mapped_ptr != nullptr)
+    if (staging_buffer->mapped_ptr != nullptr)
     {
-        assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-        assert(staging_buffer_.memory != VK_NULL_HANDLE);
-        assert(staging_buffer_.size);
+        assert(staging_buffer->buffer != VK_NULL_HANDLE);
+        assert(staging_buffer->memory != VK_NULL_HANDLE);
+        assert(staging_buffer->size);
 
-        device_table_.UnmapMemory(device_, staging_buffer_.memory);
-        staging_buffer_.mapped_ptr = nullptr;
+        device_table_.UnmapMemory(device_, staging_buffer->memory);
+        staging_buffer->mapped_ptr = nullptr;
     }
 }
 
-void VulkanResourcesUtil::InvalidateStagingBuffer()
+void VulkanResourcesUtil::InvalidateStagingBuffer(const StagingBufferContext& staging_buffer)
 {
-    assert(staging_buffer_.buffer != VK_NULL_HANDLE);
-    assert(staging_buffer_.memory != VK_NULL_HANDLE);
-    assert(staging_buffer_.size);
+    assert(staging_buffer.buffer != VK_NULL_HANDLE);
+    assert(staging_buffer.memory != VK_NULL_HANDLE);
+    assert(staging_buffer.size);
 
-    if (!IsMemoryCoherent(staging_buffer_.memory_property_flags))
+    if (!IsMemoryCoherent(staging_buffer.memory_property_flags))
     {
-        assert(staging_buffer_.mapped_ptr != nullptr);
+        assert(staging_buffer.mapped_ptr != nullptr);
 
         const VkMappedMemoryRange range{
-            VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, staging_buffer_.memory, 0, staging_buffer_.size
+            VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, staging_buffer.memory, 0, staging_buffer.size
         };
 
         device_table_.InvalidateMappedMemoryRanges(device_, 1, &range);
     }
 }
 
-void VulkanResourcesUtil::DestroyStagingBuffer()
+void VulkanResourcesUtil::DestroyStagingBuffer(StagingBufferContext* staging_buffer)
 {
-    UnmapStagingBuffer();
+    UnmapStagingBuffer(staging_buffer);
 
-    if (staging_buffer_.buffer != VK_NULL_HANDLE)
+    if (staging_buffer->buffer != VK_NULL_HANDLE)
     {
-        device_table_.DestroyBuffer(device_, staging_buffer_.buffer, nullptr);
-        staging_buffer_.buffer = VK_NULL_HANDLE;
+        device_table_.DestroyBuffer(device_, staging_buffer->buffer, nullptr);
+        staging_buffer->buffer = VK_NULL_HANDLE;
     }
 
-    if (staging_buffer_.memory != VK_NULL_HANDLE)
+    if (staging_buffer->memory != VK_NULL_HANDLE)
     {
-        device_table_.FreeMemory(device_, staging_buffer_.memory, nullptr);
-        staging_buffer_.memory = VK_NULL_HANDLE;
+        device_table_.FreeMemory(device_, staging_buffer->memory, nullptr);
+        staging_buffer->memory = VK_NULL_HANDLE;
     }
 
-    staging_buffer_.memory_property_flags = VkMemoryPropertyFlags(0);
-    staging_buffer_.size                  = 0;
+    staging_buffer->memory_property_flags = VkMemoryPropertyFlags(0);
+    staging_buffer->size                  = 0;
 }
 
 void VulkanResourcesUtil::InvalidateMappedMemoryRange(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size)
@@ -1966,6 +1972,368 @@ VkResult VulkanResourcesUtil::ReadFromBufferResource(
     return result;
 }
 
+VkResult VulkanResourcesUtil::ReadFromBufferResourceAsync(
+    VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, ReadbackCallback callback)
+{
+    assert(buffer != VK_NULL_HANDLE);
+    assert(size);
+    assert(callback);
+
+    if (readback_batches_.empty())
+    {
+        readback_batches_.resize(kReadbackBatchCount);
+    }
+
+    // Requests are placed at 16 byte aligned offsets so that callbacks receive suitably aligned data.
+    const VkDeviceSize kRequestAlignment = 16;
+
+    VkResult       result = VK_SUCCESS;
+    ReadbackBatch* batch  = &readback_batches_[current_readback_batch_];
+
+    if (batch->recording)
+    {
+        const VkDeviceSize staging_offset = (batch->used_size + kRequestAlignment - 1) & ~(kRequestAlignment - 1);
+
+        if ((batch->queue_family_index != queue_family_index) ||
+            ((staging_offset + size) > kReadbackBatchStagingSize))
+        {
+            // A failed submission has already been reported to the callbacks of the submitted requests.
+            SubmitReadbackBatch(batch);
+            batch = &readback_batches_[current_readback_batch_];
+        }
+    }
+
+    if (!batch->recording)
+    {
+        result = BeginReadbackBatch(batch, queue_family_index);
+        if (result != VK_SUCCESS)
+        {
+            callback(result, nullptr, size);
+            return result;
+        }
+    }
+
+    const VkDeviceSize staging_offset = (batch->used_size + kRequestAlignment - 1) & ~(kRequestAlignment - 1);
+
+    // The copy is recorded when the batch is submitted, once the size of its staging memory is known.
+    batch->requests.push_back({ buffer, offset, staging_offset, size, std::move(callback) });
+    batch->used_size = staging_offset + size;
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::FlushReadbacks()
+{
+    if (readback_batches_.empty())
+    {
+        return VK_SUCCESS;
+    }
+
+    VkResult result = VK_SUCCESS;
+
+    ReadbackBatch* batch = &readback_batches_[current_readback_batch_];
+    if (batch->recording)
+    {
+        result = SubmitReadbackBatch(batch);
+    }
+
+    // After the last submission, the current batch is the oldest batch in flight.
+    for (uint32_t i = 0; i < kReadbackBatchCount; ++i)
+    {
+        batch = &readback_batches_[(current_readback_batch_ + i) % kReadbackBatchCount];
+        if (batch->in_flight)
+        {
+            VkResult complete_result = CompleteReadbackBatch(batch);
+            if (result == VK_SUCCESS)
+            {
+                result = complete_result;
+            }
+        }
+    }
+
+    return result;
+}
+
+VkDeviceSize VulkanResourcesUtil::GetReadbackStagingSize() const
+{
+    VkDeviceSize staging_size = 0;
+
+    for (const auto& batch : readback_batches_)
+    {
+        staging_size += batch.staging_buffer.size;
+    }
+
+    return staging_size;
+}
+
+VkResult VulkanResourcesUtil::BeginReadbackBatch(ReadbackBatch* batch, uint32_t queue_family_index)
+{
+    assert(batch != nullptr);
+    assert(!batch->recording);
+
+    VkResult result = VK_SUCCESS;
+
+    // Wait for the batch that previously used this slot of the ring.
+    if (batch->in_flight)
+    {
+        CompleteReadbackBatch(batch);
+    }
+
+    if ((batch->command_pool != VK_NULL_HANDLE) && (batch->queue_family_index != queue_family_index))
+    {
+        // Destroying the pool frees the command buffer allocated from it.
+        device_table_.DestroyCommandPool(device_, batch->command_pool, nullptr);
+        batch->command_pool   = VK_NULL_HANDLE;
+        batch->command_buffer = VK_NULL_HANDLE;
+    }
+
+    if (batch->command_pool == VK_NULL_HANDLE)
+    {
+        VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        pool_create_info.pNext                   = nullptr;
+        pool_create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_create_info.queueFamilyIndex        = queue_family_index;
+
+        result = device_table_.CreateCommandPool(device_, &pool_create_info, nullptr, &batch->command_pool);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create a command pool for resource readback");
+            return result;
+        }
+
+        VkCommandBufferAllocateInfo alloc_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        alloc_info.pNext                       = nullptr;
+        alloc_info.commandPool                 = batch->command_pool;
+        alloc_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount          = 1;
+
+        result = device_table_.AllocateCommandBuffers(device_, &alloc_info, &batch->command_buffer);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create a command buffer for resource readback");
+            device_table_.DestroyCommandPool(device_, batch->command_pool, nullptr);
+            batch->command_pool = VK_NULL_HANDLE;
+            return result;
+        }
+
+        // Because this command buffer was not allocated through the loader, it must be assigned a dispatch table.
+        *reinterpret_cast<void**>(batch->command_buffer) = *reinterpret_cast<void**>(device_);
+
+        batch->queue = GetQueue(queue_family_index, 0);
+        if (batch->queue == VK_NULL_HANDLE)
+        {
+            device_table_.DestroyCommandPool(device_, batch->command_pool, nullptr);
+            batch->command_pool   = VK_NULL_HANDLE;
+            batch->command_buffer = VK_NULL_HANDLE;
+            return VK_ERROR_INITIALIZATION_FAILED;
+        }
+
+        batch->queue_family_index = queue_family_index;
+    }
+
+    if (batch->fence == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_create_info.pNext             = nullptr;
+        fence_create_info.flags             = 0;
+
+        result = device_table_.CreateFence(device_, &fence_create_info, nullptr, &batch->fence);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to create a fence for resource readback");
+            return result;
+        }
+    }
+
+    batch->used_size = 0;
+    batch->recording = true;
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::PrepareReadbackStaging(ReadbackBatch* batch)
+{
+    assert(batch != nullptr);
+
+    // Staging memory is rounded up to a power of two, so that memory kept from an earlier batch can be reused by
+    // batches of similar size. Memory grown for a request larger than the batch limit is released once it is no
+    // longer needed.
+    VkDeviceSize staging_size = batch->used_size;
+    if (staging_size < kReadbackBatchStagingSize)
+    {
+        VkDeviceSize rounded_size = 1;
+        while (rounded_size < staging_size)
+        {
+            rounded_size <<= 1;
+        }
+
+        staging_size = std::min(rounded_size, kReadbackBatchStagingSize);
+    }
+
+    if ((batch->staging_buffer.buffer != VK_NULL_HANDLE) &&
+        ((batch->staging_buffer.size < staging_size) ||
+         ((batch->staging_buffer.size > kReadbackBatchStagingSize) && (batch->staging_buffer.size != staging_size))))
+    {
+        DestroyStagingBuffer(&batch->staging_buffer);
+    }
+
+    if (batch->staging_buffer.buffer == VK_NULL_HANDLE)
+    {
+        VkResult result = CreateStagingBuffer(staging_size, &batch->staging_buffer);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        // Staging memory remains mapped for the lifetime of the batch.
+        result = MapStagingBuffer(&batch->staging_buffer);
+        if (result != VK_SUCCESS)
+        {
+            DestroyStagingBuffer(&batch->staging_buffer);
+            return result;
+        }
+    }
+
+    return VK_SUCCESS;
+}
+
+VkResult VulkanResourcesUtil::SubmitReadbackBatch(ReadbackBatch* batch)
+{
+    assert(batch != nullptr);
+    assert(batch->recording);
+
+    batch->recording = false;
+
+    VkResult result = PrepareReadbackStaging(batch);
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        result = device_table_.BeginCommandBuffer(batch->command_buffer, &begin_info);
+        if (result != VK_SUCCESS)
+        {
+            GFXRECON_LOG_ERROR("Failed to begin a command buffer for resource readback");
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        for (const auto& request : batch->requests)
+        {
+            VkBufferCopy copy_region;
+            copy_region.srcOffset = request.offset;
+            copy_region.dstOffset = request.staging_offset;
+            copy_region.size      = request.size;
+
+            device_table_.CmdCopyBuffer(
+                batch->command_buffer, request.buffer, batch->staging_buffer.buffer, 1, &copy_region);
+        }
+
+        result = device_table_.EndCommandBuffer(batch->command_buffer);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submit_info.pNext                = nullptr;
+        submit_info.waitSemaphoreCount   = 0;
+        submit_info.pWaitSemaphores      = nullptr;
+        submit_info.pWaitDstStageMask    = nullptr;
+        submit_info.commandBufferCount   = 1;
+        submit_info.pCommandBuffers      = &batch->command_buffer;
+        submit_info.signalSemaphoreCount = 0;
+        submit_info.pSignalSemaphores    = nullptr;
+
+        result = device_table_.QueueSubmit(batch->queue, 1, &submit_info, batch->fence);
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        batch->in_flight = true;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to submit a resource readback batch (%d)", result);
+
+        for (const auto& request : batch->requests)
+        {
+            request.callback(result, nullptr, request.size);
+        }
+
+        batch->requests.clear();
+    }
+
+    current_readback_batch_ = (current_readback_batch_ + 1) % kReadbackBatchCount;
+
+    return result;
+}
+
+VkResult VulkanResourcesUtil::CompleteReadbackBatch(ReadbackBatch* batch)
+{
+    assert(batch != nullptr);
+    assert(batch->in_flight);
+
+    batch->in_flight = false;
+
+    VkResult result = device_table_.WaitForFences(device_, 1, &batch->fence, VK_TRUE, UINT64_MAX);
+    if (result == VK_SUCCESS)
+    {
+        device_table_.ResetFences(device_, 1, &batch->fence);
+        InvalidateStagingBuffer(batch->staging_buffer);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("WaitForFences returned %d while completing a resource readback batch", result);
+    }
+
+    const uint8_t* staging_data = reinterpret_cast<const uint8_t*>(batch->staging_buffer.mapped_ptr);
+
+    for (const auto& request : batch->requests)
+    {
+        const uint8_t* data = (result == VK_SUCCESS) ? (staging_data + request.staging_offset) : nullptr;
+        request.callback(result, data, request.size);
+    }
+
+    batch->requests.clear();
+
+    return result;
+}
+
+void VulkanResourcesUtil::DestroyReadbackBatches()
+{
+    for (auto& batch : readback_batches_)
+    {
+        if (!batch.requests.empty())
+        {
+            GFXRECON_LOG_WARNING("Discarding %" PRIuPTR " resource readback requests that were not flushed",
+                                 batch.requests.size());
+        }
+
+        if (batch.in_flight)
+        {
+            device_table_.WaitForFences(device_, 1, &batch.fence, VK_TRUE, UINT64_MAX);
+        }
+
+        if (batch.fence != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyFence(device_, batch.fence, nullptr);
+        }
+
+        if (batch.command_pool != VK_NULL_HANDLE)
+        {
+            device_table_.DestroyCommandPool(device_, batch.command_pool, nullptr);
+        }
+
+        DestroyStagingBuffer(&batch.staging_buffer);
+    }
+
+    readback_batches_.clear();
+    current_readback_batch_ = 0;
+}
+
 VkResult VulkanResourcesUtil::WriteToImageResourceStaging(VkImage                      image,
                                                           VkFormat                     format,
                                                           VkImageType                  type,
@@ -30,6 +30,7 @@
 #include "vulkan/vulkan.h"
 #include "vulkan/vulkan_core.h"
 
+#include <functional>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -54,7 +55,7 @@ class VulkanResourcesUtil
         device_(device),
         device_table_(device_table), physical_device_(physical_device), instance_table_(instance_table),
         memory_properties_(memory_properties), queue_family_index_(UINT32_MAX), command_pool_(VK_NULL_HANDLE),
-        command_buffer_(VK_NULL_HANDLE)
+        command_buffer_(VK_NULL_HANDLE), current_readback_batch_(0)
     {
         assert(device != VK_NULL_HANDLE);
         assert(memory_properties.memoryHeapCount <= VK_MAX_MEMORY_HEAPS);
@@ -63,11 +64,23 @@ class VulkanResourcesUtil
 
     ~VulkanResourcesUtil()
     {
+        DestroyReadbackBatches();
         DestroyStagingBuffer();
         DestroyCommandBuffer();
         DestroyCommandPool();
     }
 
+    // Receives the content of a buffer range queued with ReadFromBufferResourceAsync(). The data pointer references
+    // persistently mapped staging memory and is only valid for the duration of the call. It is nullptr when result is
+    // not VK_SUCCESS.
+    typedef std::function<void(VkResult result, const uint8_t* data, uint64_t size)> ReadbackCallback;
+
+    // Number of readback batches that can be in flight at the same time, and the amount of queued data at which a batch
+    // is submitted. Staging memory is allocated when a batch is submitted and is sized to the data it holds, so a
+    // small readback does not allocate the full batch size. A single request larger than the limit forms its own batch.
+    static constexpr uint32_t     kReadbackBatchCount       = 3;
+    static constexpr VkDeviceSize kReadbackBatchStagingSize = 32 * 1024 * 1024;
+
     // This function creates a staging buffer that will be used by the ReadFromImageResourceStaging() and
     // ReadFromBufferResource() functions. It is not necessary to do so but can be useful when dumping multiple
     // resource and the size of the biggest staging buffer necessary is known in advance.
@@ -153,6 +166,20 @@ class VulkanResourcesUtil
     VkResult ReadFromBufferResource(
         VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, std::vector<uint8_t>& data);
 
+    // Queues a copy of a buffer range to staging memory and returns without waiting for the copy. Copies are packed
+    // into a batch that is submitted once its staging memory is full, a request targets a different queue family, or
+    // FlushReadbacks() is called, while the previously submitted batches continue to execute. Callbacks are invoked in
+    // request order when their batch completes, from within this function or FlushReadbacks().
+    VkResult ReadFromBufferResourceAsync(
+        VkBuffer buffer, uint64_t size, uint64_t offset, uint32_t queue_family_index, ReadbackCallback callback);
+
+    // Submits the batch being recorded and waits for all batches in flight, invoking the callbacks of every queued
+    // request. Returns the first error encountered while submitting or waiting.
+    VkResult FlushReadbacks();
+
+    // Returns the size of the staging memory currently held by the readback batches.
+    VkDeviceSize GetReadbackStagingSize() const;
+
     bool IsBlitSupported(VkFormat       src_format,
                          VkImageTiling  src_image_tiling,
                          VkFormat       dst_format,
@@ -166,6 +193,42 @@ class VulkanResourcesUtil
                             float             scale) const;
 
   private:
+    struct StagingBufferContext
+    {
+        StagingBufferContext() = default;
+
+        VkBuffer              buffer                = VK_NULL_HANDLE;
+        VkDeviceMemory        memory                = VK_NULL_HANDLE;
+        VkDeviceSize          size                  = 0;
+        VkMemoryPropertyFlags memory_property_flags = VkMemoryPropertyFlags(0);
+        void*                 mapped_ptr            = nullptr;
+    };
+
+    struct ReadbackRequest
+    {
+        VkBuffer         buffer;
+        VkDeviceSize     offset;
+        VkDeviceSize     staging_offset;
+        uint64_t         size;
+        ReadbackCallback callback;
+    };
+
+    struct ReadbackBatch
+    {
+        StagingBufferContext         staging_buffer;
+        VkCommandPool                command_pool{ VK_NULL_HANDLE };
+        VkCommandBuffer              command_buffer{ VK_NULL_HANDLE };
+        VkFence                      fence{ VK_NULL_HANDLE };
+        VkQueue                      queue{ VK_NULL_HANDLE };
+        uint32_t                     queue_family_index{ UINT32_MAX };
+        VkDeviceSize                 used_size{ 0 };
+        bool                         recording{ false };
+        bool                         in_flight{ false };
+        std::vector<ReadbackRequest> requests;
+    };
+
+    VkResult CreateStagingBuffer(VkDeviceSize size, StagingBufferContext* staging_buffer);
+
     VkResult CreateCommandPool(uint32_t queue_family_index);
 
     void DestroyCommandPool();
@@ -180,13 +243,31 @@ class VulkanResourcesUtil
 
     void DestroyCommandBuffer();
 
-    VkResult MapStagingBuffer();
+    VkResult MapStagingBuffer() { return MapStagingBuffer(&staging_buffer_); }
+
+    VkResult MapStagingBuffer(StagingBufferContext* staging_buffer);
+
+    void UnmapStagingBuffer() { UnmapStagingBuffer(&staging_buffer_); }
+
+    void UnmapStagingBuffer(StagingBufferContext* staging_buffer);
+
+    void InvalidateStagingBuffer() { InvalidateStagingBuffer(staging_buffer_); }
+
+    void InvalidateStagingBuffer(const StagingBufferContext& staging_buffer);
 
-    void UnmapStagingBuffer();
+    void DestroyStagingBuffer() { DestroyStagingBuffer(&staging_buffer_); }
 
-    void InvalidateStagingBuffer();
+    void DestroyStagingBuffer(StagingBufferContext* staging_buffer);
 
-    void DestroyStagingBuffer();
+    VkResult BeginReadbackBatch(ReadbackBatch* batch, uint32_t queue_family_index);
+
+    VkResult PrepareReadbackStaging(ReadbackBatch* batch);
+
+    VkResult SubmitReadbackBatch(ReadbackBatch* batch);
+
+    VkResult CompleteReadbackBatch(ReadbackBatch* batch);
+
+    void DestroyReadbackBatches();
 
     void TransitionImageToTransferOptimal(VkImage            image,
                                           VkImageLayout      current_layout,
@@ -244,17 +325,6 @@ class VulkanResourcesUtil
                        VkImage&              scaled_image,
                        VkDeviceMemory&       scaled_image_mem);
 
-    struct StagingBufferContext
-    {
-        StagingBufferContext() = default;
-
-        VkBuffer              buffer                = VK_NULL_HANDLE;
-        VkDeviceMemory        memory                = VK_NULL_HANDLE;
-        VkDeviceSize          size                  = 0;
-        VkMemoryPropertyFlags memory_property_flags = VkMemoryPropertyFlags(0);
-        void*                 mapped_ptr            = nullptr;
-    };
-
     VkDevice                                device_;
     const encode::VulkanDeviceTable&        device_table_;
     VkPhysicalDevice                        physical_device_;
@@ -264,6 +334,8 @@ class VulkanResourcesUtil
     VkCommandPool                           command_pool_;
     VkCommandBuffer                         command_buffer_;
     StagingBufferContext                    staging_buffer_;
+    std::vector<ReadbackBatch>              readback_batches_;
+    uint32_t                                current_readback_batch_;
 };
 
 void GetFormatAspects(VkFormat                            format,
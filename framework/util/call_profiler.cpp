@@ -0,0 +1,437 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/call_profiler.h"
+
+#include "util/json_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+static std::atomic<uint64_t> next_profiler_instance_id{ 1 };
+
+// Cache of the most recently used profiler and its data for the current thread.
+static thread_local uint64_t tls_profiler_instance_id = 0;
+static thread_local void*    tls_profiler_thread_data = nullptr;
+
+static std::string EscapeJsonString(const std::string& value)
+{
+    std::string escaped;
+    escaped.reserve(value.size());
+
+    for (char c : value)
+    {
+        if ((c == '"') || (c == '\\'))
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+
+    return escaped;
+}
+
+static double ConvertToMicroseconds(uint64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1000.0;
+}
+
+void CallProfiler::Statistics::Add(uint64_t duration)
+{
+    ++count;
+    total_time += duration;
+    min_time = std::min(min_time, duration);
+    max_time = std::max(max_time, duration);
+    ++buckets[GetBucketIndex(duration)];
+}
+
+void CallProfiler::Statistics::Merge(const Statistics& other)
+{
+    count += other.count;
+    total_time += other.total_time;
+    min_time = std::min(min_time, other.min_time);
+    max_time = std::max(max_time, other.max_time);
+
+    for (uint32_t i = 0; i < kNumBuckets; ++i)
+    {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+uint64_t CallProfiler::Statistics::GetPercentile(double percentile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(count)));
+    target          = std::max<uint64_t>(target, 1);
+
+    uint64_t accumulated = 0;
+    for (uint32_t i = 0; i < kNumBuckets; ++i)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= target)
+        {
+            return std::min(GetBucketUpperBound(i), max_time);
+        }
+    }
+
+    return max_time;
+}
+
+CallProfiler::CallProfiler(std::vector<std::string> stage_names, size_t events_per_thread) :
+    instance_id_(next_profiler_instance_id++), stage_names_(std::move(stage_names)),
+    events_per_thread_(events_per_thread), base_time_(GetTimestamp()), current_frame_(0)
+{}
+
+CallProfiler::~CallProfiler()
+{
+    if (tls_profiler_instance_id == instance_id_)
+    {
+        tls_profiler_instance_id = 0;
+        tls_profiler_thread_data = nullptr;
+    }
+}
+
+uint32_t CallProfiler::GetBucketIndex(uint64_t duration)
+{
+    if (duration < kSubBuckets)
+    {
+        return static_cast<uint32_t>(duration);
+    }
+
+    uint32_t msb = 0;
+    for (uint64_t value = duration; value > 1; value >>= 1)
+    {
+        ++msb;
+    }
+
+    uint32_t sub_bucket = static_cast<uint32_t>(duration >> (msb - kSubBucketBits)) & (kSubBuckets - 1);
+    return ((msb - kSubBucketBits + 1) * kSubBuckets) + sub_bucket;
+}
+
+uint64_t CallProfiler::GetBucketUpperBound(uint32_t index)
+{
+    if (index < kSubBuckets)
+    {
+        return index;
+    }
+
+    uint32_t msb        = (index / kSubBuckets) + kSubBucketBits - 1;
+    uint64_t sub_bucket = index % kSubBuckets;
+    uint64_t width      = uint64_t{ 1 } << (msb - kSubBucketBits);
+    uint64_t lower      = (uint64_t{ 1 } << msb) + (sub_bucket * width);
+
+    return (lower > (UINT64_MAX - width)) ? UINT64_MAX : (lower + width - 1);
+}
+
+CallProfiler::ThreadData* CallProfiler::GetThreadData()
+{
+    if (tls_profiler_instance_id == instance_id_)
+    {
+        return reinterpret_cast<ThreadData*>(tls_profiler_thread_data);
+    }
+
+    ThreadData* thread_data = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(thread_data_lock_);
+
+        const auto thread_id = std::this_thread::get_id();
+        for (const auto& entry : thread_data_)
+        {
+            if (entry->thread_id == thread_id)
+            {
+                thread_data = entry.get();
+                break;
+            }
+        }
+
+        if (thread_data == nullptr)
+        {
+            auto new_data          = std::make_unique<ThreadData>();
+            new_data->thread_id    = thread_id;
+            new_data->thread_index = thread_data_.size();
+            new_data->events.resize(events_per_thread_);
+
+            thread_data = new_data.get();
+            thread_data_.emplace_back(std::move(new_data));
+        }
+    }
+
+    tls_profiler_instance_id = instance_id_;
+    tls_profiler_thread_data = thread_data;
+
+    return thread_data;
+}
+
+void CallProfiler::Record(uint16_t stage, uint32_t id, int64_t start_time, int64_t end_time)
+{
+    ThreadData* thread_data = GetThreadData();
+    uint64_t    duration    = (end_time > start_time) ? static_cast<uint64_t>(end_time - start_time) : 0;
+
+    if (!thread_data->events.empty())
+    {
+        Event& event     = thread_data->events[thread_data->next_event];
+        event.start_time = start_time;
+        event.end_time   = end_time;
+        event.frame      = current_frame_.load(std::memory_order_relaxed);
+        event.id         = id;
+        event.stage      = stage;
+
+        if (++thread_data->next_event == thread_data->events.size())
+        {
+            thread_data->next_event = 0;
+        }
+    }
+
+    ++thread_data->total_events;
+
+    const uint64_t key        = (static_cast<uint64_t>(stage) << 32) | id;
+    auto           stat_entry = thread_data->statistics.find(key);
+    if (stat_entry == thread_data->statistics.end())
+    {
+        stat_entry              = thread_data->statistics.emplace(key, Statistics{}).first;
+        stat_entry->second.stage = stage;
+        stat_entry->second.id    = id;
+    }
+
+    stat_entry->second.Add(duration);
+}
+
+const std::string& CallProfiler::GetStageName(uint16_t stage) const
+{
+    static const std::string kUnknownStage = "unknown";
+    return (stage < stage_names_.size()) ? stage_names_[stage] : kUnknownStage;
+}
+
+std::vector<CallProfiler::Statistics> CallProfiler::GetStatistics() const
+{
+    std::unordered_map<uint64_t, Statistics> merged;
+
+    {
+        std::lock_guard<std::mutex> lock(thread_data_lock_);
+        for (const auto& thread_data : thread_data_)
+        {
+            for (const auto& entry : thread_data->statistics)
+            {
+                auto merged_entry = merged.find(entry.first);
+                if (merged_entry == merged.end())
+                {
+                    merged.emplace(entry.first, entry.second);
+                }
+                else
+                {
+                    merged_entry->second.Merge(entry.second);
+                }
+            }
+        }
+    }
+
+    std::vector<Statistics> result;
+    result.reserve(merged.size());
+    for (const auto& entry : merged)
+    {
+        result.push_back(entry.second);
+    }
+
+    std::sort(result.begin(), result.end(), [](const Statistics& lhs, const Statistics& rhs) {
+        return lhs.total_time > rhs.total_time;
+    });
+
+    return result;
+}
+
+bool CallProfiler::WriteChromeTrace(const std::string& filename, const EventNameFunc& name_func) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = platform::FileOpen(&file, filename.c_str(), "w");
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open CPU profile trace file '%s' (Error %i).", filename.c_str(), result);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(thread_data_lock_);
+
+    bool        success     = true;
+    bool        first_event = true;
+    std::string line        = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    uint64_t dropped_events = 0;
+    for (const auto& thread_data : thread_data_)
+    {
+        const size_t capacity = thread_data->events.size();
+        const size_t count    = static_cast<size_t>(std::min<uint64_t>(thread_data->total_events, capacity));
+        const size_t first    = (thread_data->total_events > capacity) ? thread_data->next_event : 0;
+
+        dropped_events += thread_data->total_events - count;
+
+        for (size_t i = 0; (i < count) && success; ++i)
+        {
+            const Event& event = thread_data->events[(first + i) % capacity];
+            const double start = ConvertToMicroseconds(static_cast<uint64_t>(event.start_time - base_time_));
+            const double duration =
+                ConvertToMicroseconds(static_cast<uint64_t>(std::max<int64_t>(event.end_time - event.start_time, 0)));
+
+            if (!first_event)
+            {
+                line += ",";
+            }
+            first_event = false;
+
+            char buffer[128];
+            snprintf(buffer,
+                     sizeof(buffer),
+                     "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%" PRIu64 ",\"args\":{\"frame\":%" PRIu64
+                     "}}",
+                     start,
+                     duration,
+                     thread_data->thread_index,
+                     event.frame);
+
+            line += "\n{\"name\":\"";
+            line += EscapeJsonString(name_func(event.stage, event.id));
+            line += "\",\"cat\":\"";
+            line += EscapeJsonString(GetStageName(event.stage));
+            line += buffer;
+
+            if (line.size() >= (64 * 1024))
+            {
+                success = platform::FileWrite(line.data(), line.size(), file);
+                line.clear();
+            }
+        }
+    }
+
+    line += "\n]}\n";
+    success = success && platform::FileWrite(line.data(), line.size(), file);
+    platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write CPU profile trace file '%s'.", filename.c_str());
+    }
+    else if (dropped_events > 0)
+    {
+        GFXRECON_LOG_WARNING("CPU profile trace buffers overflowed; the oldest %" PRIu64
+                             " events were not written to '%s'.",
+                             dropped_events,
+                             filename.c_str());
+    }
+
+    return success;
+}
+
+bool CallProfiler::WriteHistograms(const std::string& filename, const EventNameFunc& name_func) const
+{
+    nlohmann::json entries = nlohmann::json::array();
+
+    for (const auto& stats : GetStatistics())
+    {
+        nlohmann::json histogram = nlohmann::json::array();
+        for (uint32_t i = 0; i < kNumBuckets; ++i)
+        {
+            if (stats.buckets[i] > 0)
+            {
+                histogram.push_back({ { "upper_bound_ns", GetBucketUpperBound(i) }, { "count", stats.buckets[i] } });
+            }
+        }
+
+        entries.push_back({ { "stage", GetStageName(stats.stage) },
+                            { "id", stats.id },
+                            { "name", name_func(stats.stage, stats.id) },
+                            { "count", stats.count },
+                            { "total_ms", datetime::ConvertTimestampToMilliseconds(static_cast<int64_t>(stats.total_time)) },
+                            { "mean_us", ConvertToMicroseconds(stats.total_time / stats.count) },
+                            { "min_us", ConvertToMicroseconds(stats.min_time) },
+                            { "max_us", ConvertToMicroseconds(stats.max_time) },
+                            { "p50_us", ConvertToMicroseconds(stats.GetPercentile(0.5)) },
+                            { "p90_us", ConvertToMicroseconds(stats.GetPercentile(0.9)) },
+                            { "p99_us", ConvertToMicroseconds(stats.GetPercentile(0.99)) },
+                            { "histogram", histogram } });
+    }
+
+    nlohmann::json file_content = { { "stages", stage_names_ }, { "entries", entries } };
+
+    FILE*   file   = nullptr;
+    int32_t result = platform::FileOpen(&file, filename.c_str(), "w");
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open CPU profile histogram file '%s' (Error %i).", filename.c_str(), result);
+        return false;
+    }
+
+    const std::string json_string = file_content.dump(kJsonIndentWidth);
+    bool              success     = platform::FileWrite(json_string.data(), json_string.size(), file);
+    platform::FileClose(file);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write CPU profile histogram file '%s'.", filename.c_str());
+    }
+
+    return success;
+}
+
+void CallProfiler::LogSummary(const EventNameFunc& name_func, size_t max_entries) const
+{
+    const auto statistics = GetStatistics();
+    const auto count      = std::min(max_entries, statistics.size());
+
+    GFXRECON_WRITE_CONSOLE("CPU profile: top %zu of %zu entries by total time", count, statistics.size());
+    GFXRECON_WRITE_CONSOLE("  %-12s %-48s %12s %12s %10s %10s %10s",
+                           "stage",
+                           "name",
+                           "count",
+                           "total (ms)",
+                           "mean (us)",
+                           "p99 (us)",
+                           "max (us)");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Statistics& stats = statistics[i];
+        GFXRECON_WRITE_CONSOLE("  %-12s %-48s %12" PRIu64 " %12.3f %10.3f %10.3f %10.3f",
+                               GetStageName(stats.stage).c_str(),
+                               name_func(stats.stage, stats.id).c_str(),
+                               stats.count,
+                               datetime::ConvertTimestampToMilliseconds(static_cast<int64_t>(stats.total_time)),
+                               ConvertToMicroseconds(stats.total_time / stats.count),
+                               ConvertToMicroseconds(stats.GetPercentile(0.99)),
+                               ConvertToMicroseconds(stats.max_time));
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
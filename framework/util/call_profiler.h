@@ -0,0 +1,181 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_CALL_PROFILER_H
+#define GFXRECON_UTIL_CALL_PROFILER_H
+
+#include "util/date_time.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Lightweight CPU timing instrumentation for API call processing.
+//
+// Each recording thread owns a fixed size ring buffer of timed events and a table of per (stage, id) duration
+// statistics, so recording never takes a lock after the first event of a thread.  The ring buffer holds the most
+// recent events for Chrome trace export, while the statistics cover every recorded event.
+//
+// Stages are small integers with names supplied at construction (e.g. "read", "decompress", "decode"), and ids are
+// typically format::ApiCallId or format::MetaDataId values.
+class CallProfiler
+{
+  public:
+    static constexpr size_t kDefaultEventsPerThread = 1024 * 1024;
+
+    // Durations are accumulated into log2 buckets, with each power of two split into kSubBuckets linear buckets.
+    static constexpr uint32_t kSubBucketBits = 2;
+    static constexpr uint32_t kSubBuckets    = 1 << kSubBucketBits;
+    static constexpr uint32_t kNumBuckets    = 64 * kSubBuckets;
+
+    typedef std::function<std::string(uint16_t stage, uint32_t id)> EventNameFunc;
+
+    struct Event
+    {
+        int64_t  start_time;
+        int64_t  end_time;
+        uint64_t frame;
+        uint32_t id;
+        uint16_t stage;
+    };
+
+    struct Statistics
+    {
+        uint16_t stage{ 0 };
+        uint32_t id{ 0 };
+        uint64_t count{ 0 };
+        uint64_t total_time{ 0 };
+        uint64_t min_time{ UINT64_MAX };
+        uint64_t max_time{ 0 };
+        uint64_t buckets[kNumBuckets]{};
+
+        void Add(uint64_t duration);
+
+        void Merge(const Statistics& other);
+
+        // Returns an approximation of the requested percentile (0.0 to 1.0), in nanoseconds.
+        uint64_t GetPercentile(double percentile) const;
+    };
+
+  public:
+    // An events_per_thread of 0 disables event recording, for statistics only profiling.
+    CallProfiler(std::vector<std::string> stage_names, size_t events_per_thread = kDefaultEventsPerThread);
+
+    ~CallProfiler();
+
+    static int64_t GetTimestamp() { return static_cast<int64_t>(datetime::GetTimestamp()); }
+
+    void SetCurrentFrame(uint64_t frame) { current_frame_.store(frame, std::memory_order_relaxed); }
+
+    uint64_t GetCurrentFrame() const { return current_frame_.load(std::memory_order_relaxed); }
+
+    void Record(uint16_t stage, uint32_t id, int64_t start_time, int64_t end_time);
+
+    // The following functions read the data of all recording threads, and must only be called once the threads
+    // that record to this profiler are idle.
+
+    // Returns the merged statistics for all threads, sorted by descending total time.
+    std::vector<Statistics> GetStatistics() const;
+
+    bool WriteChromeTrace(const std::string& filename, const EventNameFunc& name_func) const;
+
+    bool WriteHistograms(const std::string& filename, const EventNameFunc& name_func) const;
+
+    void LogSummary(const EventNameFunc& name_func, size_t max_entries) const;
+
+    const std::string& GetStageName(uint16_t stage) const;
+
+    // Returns the histogram bucket for a duration, and the largest duration that the bucket holds.
+    static uint32_t GetBucketIndex(uint64_t duration);
+
+    static uint64_t GetBucketUpperBound(uint32_t index);
+
+  private:
+    struct ThreadData
+    {
+        std::thread::id                          thread_id;
+        uint64_t                                 thread_index{ 0 };
+        std::vector<Event>                       events;
+        size_t                                   next_event{ 0 };
+        uint64_t                                 total_events{ 0 };
+        std::unordered_map<uint64_t, Statistics> statistics;
+    };
+
+    ThreadData* GetThreadData();
+
+  private:
+    const uint64_t                           instance_id_;
+    const std::vector<std::string>           stage_names_;
+    const size_t                             events_per_thread_;
+    const int64_t                            base_time_;
+    std::atomic<uint64_t>                    current_frame_;
+    mutable std::mutex                       thread_data_lock_;
+    std::vector<std::unique_ptr<ThreadData>> thread_data_;
+};
+
+// Records the duration of its scope with the specified profiler.  A null profiler disables all work, so instrumented
+// code paths only pay for a branch when profiling is not enabled.
+class ScopedCallTimer
+{
+  public:
+    ScopedCallTimer(CallProfiler* profiler, uint16_t stage, uint32_t id) :
+        profiler_(profiler), stage_(stage), id_(id), start_time_(0)
+    {
+        if (profiler_ != nullptr)
+        {
+            start_time_ = CallProfiler::GetTimestamp();
+        }
+    }
+
+    ~ScopedCallTimer()
+    {
+        if (profiler_ != nullptr)
+        {
+            profiler_->Record(stage_, id_, start_time_, CallProfiler::GetTimestamp());
+        }
+    }
+
+    ScopedCallTimer(const ScopedCallTimer&) = delete;
+
+    ScopedCallTimer& operator=(const ScopedCallTimer&) = delete;
+
+  private:
+    CallProfiler* profiler_;
+    uint16_t      stage_;
+    uint32_t      id_;
+    int64_t       start_time_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CALL_PROFILER_H
@@ -0,0 +1,192 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/chunked_buffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+ChunkPool::ChunkPool(size_t max_chunk_size, size_t min_chunk_size) :
+    max_chunk_size_((max_chunk_size > 0) ? max_chunk_size : kDefaultMaxChunkSize),
+    min_chunk_size_(std::min(max_chunk_size_, (min_chunk_size > 0) ? min_chunk_size : kDefaultMinChunkSize))
+{
+    free_chunks_.resize(GetSizeClass(max_chunk_size_) + 1);
+}
+
+size_t ChunkPool::GetChunkSize(size_t size) const
+{
+    assert(size <= max_chunk_size_);
+
+    size_t chunk_size = min_chunk_size_;
+    while (chunk_size < size)
+    {
+        chunk_size = std::min(chunk_size * 2, max_chunk_size_);
+    }
+
+    return chunk_size;
+}
+
+size_t ChunkPool::GetFreeChunkCount() const
+{
+    size_t count = 0;
+    for (const auto& size_class : free_chunks_)
+    {
+        count += size_class.size();
+    }
+
+    return count;
+}
+
+std::unique_ptr<uint8_t[]> ChunkPool::AcquireChunk(size_t chunk_size)
+{
+    auto& size_class = free_chunks_[GetSizeClass(chunk_size)];
+
+    if (size_class.empty())
+    {
+        return std::make_unique<uint8_t[]>(chunk_size);
+    }
+
+    std::unique_ptr<uint8_t[]> chunk = std::move(size_class.back());
+    size_class.pop_back();
+    return chunk;
+}
+
+void ChunkPool::ReleaseChunk(std::unique_ptr<uint8_t[]> chunk, size_t chunk_size)
+{
+    if (chunk != nullptr)
+    {
+        free_chunks_[GetSizeClass(chunk_size)].emplace_back(std::move(chunk));
+    }
+}
+
+void ChunkPool::FreeUnusedChunks()
+{
+    for (auto& size_class : free_chunks_)
+    {
+        size_class.clear();
+        size_class.shrink_to_fit();
+    }
+}
+
+size_t ChunkPool::GetSizeClass(size_t chunk_size) const
+{
+    // The maximum chunk size is its own class when it is not a power of two multiple of the minimum size.
+    size_t size_class = 0;
+    for (size_t class_size = min_chunk_size_; class_size < chunk_size; class_size *= 2)
+    {
+        ++size_class;
+    }
+
+    assert(chunk_size == GetChunkSize(chunk_size));
+    return size_class;
+}
+
+ChunkedBuffer::ChunkedBuffer() : ChunkedBuffer(nullptr) {}
+
+ChunkedBuffer::ChunkedBuffer(std::shared_ptr<ChunkPool> pool) :
+    pool_(std::move(pool)), data_size_(0), next_chunk_size_(0)
+{}
+
+ChunkedBuffer::~ChunkedBuffer()
+{
+    Clear();
+}
+
+void ChunkedBuffer::SetPool(std::shared_ptr<ChunkPool> pool)
+{
+    Clear();
+    pool_ = std::move(pool);
+}
+
+uint8_t* ChunkedBuffer::AllocateRecord(size_t size)
+{
+    if (chunks_.empty() || ((chunks_.back().capacity - chunks_.back().size) < size))
+    {
+        if (pool_ == nullptr)
+        {
+            pool_ = std::make_shared<ChunkPool>();
+        }
+
+        Chunk chunk;
+
+        if (size <= pool_->GetMaxChunkSize())
+        {
+            // Each chunk doubles the size of the previous pooled chunk, up to the pool's maximum chunk size.
+            size_t chunk_size = std::min(std::max(next_chunk_size_, size), pool_->GetMaxChunkSize());
+            chunk_size        = pool_->GetChunkSize(chunk_size);
+
+            chunk.data       = pool_->AcquireChunk(chunk_size);
+            chunk.capacity   = chunk_size;
+            chunk.pooled     = true;
+            next_chunk_size_ = chunk_size * 2;
+        }
+        else
+        {
+            chunk.data     = std::make_unique<uint8_t[]>(size);
+            chunk.capacity = size;
+        }
+
+        chunks_.emplace_back(std::move(chunk));
+    }
+
+    Chunk&   current = chunks_.back();
+    uint8_t* record  = current.data.get() + current.size;
+
+    current.size += size;
+    data_size_ += size;
+
+    return record;
+}
+
+void ChunkedBuffer::WriteRecord(const void* data, size_t size)
+{
+    assert((data != nullptr) || (size == 0));
+
+    uint8_t* record = AllocateRecord(size);
+    if (size > 0)
+    {
+        std::memcpy(record, data, size);
+    }
+}
+
+void ChunkedBuffer::Clear()
+{
+    for (auto& chunk : chunks_)
+    {
+        if (chunk.pooled)
+        {
+            pool_->ReleaseChunk(std::move(chunk.data), chunk.capacity);
+        }
+    }
+
+    chunks_.clear();
+    data_size_       = 0;
+    next_chunk_size_ = 0;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,132 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_CHUNKED_BUFFER_H
+#define GFXRECON_UTIL_CHUNKED_BUFFER_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Free lists of memory chunks that are recycled between the ChunkedBuffer objects that share the pool.  Chunk sizes
+// are powers of two multiples of the minimum chunk size, up to the maximum chunk size.  The pool is not thread safe,
+// and is intended to be shared by objects that are externally synchronized with each other, such as the command
+// buffers allocated from a single Vulkan command pool.
+class ChunkPool
+{
+  public:
+    static constexpr size_t kDefaultMaxChunkSize = 64 * 1024;
+    static constexpr size_t kDefaultMinChunkSize = 1024;
+
+  public:
+    ChunkPool(size_t max_chunk_size = kDefaultMaxChunkSize, size_t min_chunk_size = kDefaultMinChunkSize);
+
+    ~ChunkPool() = default;
+
+    size_t GetMaxChunkSize() const { return max_chunk_size_; }
+
+    size_t GetMinChunkSize() const { return min_chunk_size_; }
+
+    // Returns the smallest chunk size that can hold size bytes, which must not exceed the maximum chunk size.
+    size_t GetChunkSize(size_t size) const;
+
+    size_t GetFreeChunkCount() const;
+
+    // The chunk size must be a size returned by GetChunkSize.
+    std::unique_ptr<uint8_t[]> AcquireChunk(size_t chunk_size);
+
+    void ReleaseChunk(std::unique_ptr<uint8_t[]> chunk, size_t chunk_size);
+
+    // Frees the memory for all chunks that are not currently in use.
+    void FreeUnusedChunks();
+
+  private:
+    size_t GetSizeClass(size_t chunk_size) const;
+
+  private:
+    const size_t                                         max_chunk_size_;
+    const size_t                                         min_chunk_size_;
+    std::vector<std::vector<std::unique_ptr<uint8_t[]>>> free_chunks_;
+};
+
+// Append-only storage for variable size records, allocated from chunks that are acquired from a ChunkPool.  Unlike a
+// MemoryOutputStream, existing data is never relocated when the buffer grows, and chunks are returned to the pool for
+// reuse when the buffer is cleared.  The first chunk has the pool's minimum chunk size, and each following chunk is
+// twice the size of the previous one, up to the pool's maximum chunk size, so that small buffers stay small.  A record
+// never spans chunks; records larger than the pool's maximum chunk size are stored in a dedicated allocation that is
+// freed on clear.
+class ChunkedBuffer
+{
+  public:
+    struct Chunk
+    {
+        std::unique_ptr<uint8_t[]> data;
+        size_t                     size{ 0 };
+        size_t                     capacity{ 0 };
+        bool                       pooled{ false };
+    };
+
+  public:
+    ChunkedBuffer();
+
+    ChunkedBuffer(std::shared_ptr<ChunkPool> pool);
+
+    ~ChunkedBuffer();
+
+    ChunkedBuffer(const ChunkedBuffer&) = delete;
+
+    ChunkedBuffer& operator=(const ChunkedBuffer&) = delete;
+
+    // Releases the current data and switches to a different pool.
+    void SetPool(std::shared_ptr<ChunkPool> pool);
+
+    // Returns contiguous storage for a record of the specified size, which remains valid until the buffer is cleared.
+    uint8_t* AllocateRecord(size_t size);
+
+    void WriteRecord(const void* data, size_t size);
+
+    void Clear();
+
+    bool IsEmpty() const { return data_size_ == 0; }
+
+    size_t GetDataSize() const { return data_size_; }
+
+    const std::vector<Chunk>& GetChunks() const { return chunks_; }
+
+  private:
+    std::shared_ptr<ChunkPool> pool_;
+    std::vector<Chunk>         chunks_;
+    size_t                     data_size_;
+    size_t                     next_chunk_size_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_CHUNKED_BUFFER_H
@@ -0,0 +1,556 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/dump_archive.h"
+
+#include "util/buffer_writer.h"
+#include "util/file_path.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+static constexpr uint32_t kDumpArchiveMagic       = 0x41584647; // "GFXA"
+static constexpr uint32_t kDumpArchiveRecordMagic = 0x45584647; // "GFXE"
+static constexpr uint32_t kDumpArchiveVersion     = 2;
+
+static constexpr uint32_t kDumpArchiveFlagHasAlpha      = 0x1;
+static constexpr uint32_t kDumpArchiveFlagSeparateAlpha = 0x2;
+static constexpr uint32_t kDumpArchiveFlagDataFollows   = 0x4;
+
+struct DumpArchiveFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct DumpArchiveIndexEntry
+{
+    uint64_t data_offset;
+    uint64_t data_size;
+    uint64_t hash_low;
+    uint64_t hash_high;
+    uint32_t type;
+    uint32_t encoding;
+    uint32_t data_format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+    uint32_t row_pitch;
+    uint32_t flags;
+    uint8_t  block_width;
+    uint8_t  block_height;
+    uint8_t  block_depth;
+    uint8_t  reserved;
+    uint32_t name_length;
+};
+
+struct DumpArchiveFileFooter
+{
+    uint64_t index_offset;
+    uint64_t entry_count;
+    uint32_t magic;
+    uint32_t version;
+};
+
+static DumpArchiveIndexEntry EncodeIndexEntry(const DumpArchiveEntry& entry, uint32_t flags)
+{
+    flags |= (entry.image_info.has_alpha ? kDumpArchiveFlagHasAlpha : 0) |
+             (entry.image_info.separate_alpha ? kDumpArchiveFlagSeparateAlpha : 0);
+
+    DumpArchiveIndexEntry index_entry{};
+    index_entry.data_offset  = entry.data_offset;
+    index_entry.data_size    = entry.data_size;
+    index_entry.hash_low     = entry.data_hash.low;
+    index_entry.hash_high    = entry.data_hash.high;
+    index_entry.type         = static_cast<uint32_t>(entry.type);
+    index_entry.encoding     = static_cast<uint32_t>(entry.image_info.encoding);
+    index_entry.data_format  = static_cast<uint32_t>(entry.image_info.data_format);
+    index_entry.width        = entry.image_info.width;
+    index_entry.height       = entry.image_info.height;
+    index_entry.depth        = entry.image_info.depth;
+    index_entry.row_pitch    = entry.image_info.row_pitch;
+    index_entry.flags        = flags;
+    index_entry.block_width  = entry.image_info.block_width;
+    index_entry.block_height = entry.image_info.block_height;
+    index_entry.block_depth  = entry.image_info.block_depth;
+    index_entry.name_length  = static_cast<uint32_t>(entry.name.size());
+
+    return index_entry;
+}
+
+static void DecodeIndexEntry(const DumpArchiveIndexEntry& index_entry, DumpArchiveEntry* entry)
+{
+    assert(entry != nullptr);
+
+    entry->name.resize(index_entry.name_length);
+    entry->data_offset               = index_entry.data_offset;
+    entry->data_size                 = index_entry.data_size;
+    entry->data_hash.low             = index_entry.hash_low;
+    entry->data_hash.high            = index_entry.hash_high;
+    entry->type                      = static_cast<DumpArchiveEntryType>(index_entry.type);
+    entry->image_info.encoding       = static_cast<DumpArchiveImageEncoding>(index_entry.encoding);
+    entry->image_info.data_format    = static_cast<imagewriter::DataFormats>(index_entry.data_format);
+    entry->image_info.width          = index_entry.width;
+    entry->image_info.height         = index_entry.height;
+    entry->image_info.depth          = index_entry.depth;
+    entry->image_info.row_pitch      = index_entry.row_pitch;
+    entry->image_info.block_width    = index_entry.block_width;
+    entry->image_info.block_height   = index_entry.block_height;
+    entry->image_info.block_depth    = index_entry.block_depth;
+    entry->image_info.has_alpha      = (index_entry.flags & kDumpArchiveFlagHasAlpha) != 0;
+    entry->image_info.separate_alpha = (index_entry.flags & kDumpArchiveFlagSeparateAlpha) != 0;
+}
+
+DumpArchiveWriter::DumpArchiveWriter() : file_(nullptr), write_offset_(0), stored_size_(0), deduplicated_size_(0) {}
+
+DumpArchiveWriter::~DumpArchiveWriter()
+{
+    Close();
+}
+
+bool DumpArchiveWriter::Open(const std::string& filename)
+{
+    Close();
+
+    int32_t result = platform::FileOpen(&file_, filename.c_str(), "wb");
+    if (result != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open dump archive file %s", filename.c_str());
+        file_ = nullptr;
+        return false;
+    }
+
+    const DumpArchiveFileHeader header{ kDumpArchiveMagic, kDumpArchiveVersion };
+    if (!platform::FileWrite(&header, sizeof(header), file_))
+    {
+        GFXRECON_LOG_ERROR("Failed to write dump archive file %s", filename.c_str());
+        platform::FileClose(file_);
+        file_ = nullptr;
+        return false;
+    }
+
+    filename_          = filename;
+    write_offset_      = sizeof(header);
+    stored_size_       = 0;
+    deduplicated_size_ = 0;
+    entries_.clear();
+    stored_entries_.clear();
+
+    return true;
+}
+
+bool DumpArchiveWriter::AddBuffer(const std::string& name, const void* data, size_t size)
+{
+    DumpArchiveEntry entry;
+    entry.name      = filepath::GetFilename(name);
+    entry.data_size = size;
+    entry.type      = DumpArchiveEntryType::kBuffer;
+
+    return AddEntry(&entry, data);
+}
+
+bool DumpArchiveWriter::AddImage(const std::string&          name,
+                                 const void*                 data,
+                                 size_t                      size,
+                                 const DumpArchiveImageInfo& image_info)
+{
+    DumpArchiveEntry entry;
+    entry.name       = filepath::GetFilename(name);
+    entry.data_size  = size;
+    entry.type       = DumpArchiveEntryType::kImage;
+    entry.image_info = image_info;
+
+    return AddEntry(&entry, data);
+}
+
+bool DumpArchiveWriter::AddEntry(DumpArchiveEntry* entry, const void* data)
+{
+    assert(entry != nullptr);
+
+    if (file_ == nullptr)
+    {
+        return false;
+    }
+
+    assert((data != nullptr) || (entry->data_size == 0));
+
+    entry->data_hash = hash::murmur3_128(data, static_cast<size_t>(entry->data_size));
+
+    // The content is stored after the entry record, unless identical content was already written, in which case the
+    // record references it.
+    auto       stored     = stored_entries_.find(entry->data_hash);
+    const bool store_data =
+        (stored == stored_entries_.end()) || (entries_[stored->second].data_size != entry->data_size);
+
+    const uint64_t record_size = sizeof(kDumpArchiveRecordMagic) + sizeof(DumpArchiveIndexEntry) + entry->name.size();
+
+    entry->data_offset = store_data ? (write_offset_ + record_size) : entries_[stored->second].data_offset;
+
+    const DumpArchiveIndexEntry record = EncodeIndexEntry(*entry, store_data ? kDumpArchiveFlagDataFollows : 0);
+
+    if (!platform::FileWrite(&kDumpArchiveRecordMagic, sizeof(kDumpArchiveRecordMagic), file_) ||
+        !platform::FileWrite(&record, sizeof(record), file_) ||
+        !platform::FileWrite(entry->name.data(), entry->name.size(), file_) ||
+        (store_data && !platform::FileWrite(data, static_cast<size_t>(entry->data_size), file_)))
+    {
+        GFXRECON_LOG_ERROR("Failed to write entry %s to dump archive file %s", entry->name.c_str(), filename_.c_str());
+        return false;
+    }
+
+    write_offset_ += record_size;
+
+    if (store_data)
+    {
+        write_offset_ += entry->data_size;
+        stored_size_ += entry->data_size;
+
+        stored_entries_[entry->data_hash] = entries_.size();
+    }
+    else
+    {
+        deduplicated_size_ += entry->data_size;
+    }
+
+    entries_.emplace_back(std::move(*entry));
+
+    return true;
+}
+
+void DumpArchiveWriter::Close()
+{
+    if (file_ == nullptr)
+    {
+        return;
+    }
+
+    bool success = true;
+
+    for (const auto& entry : entries_)
+    {
+        const DumpArchiveIndexEntry index_entry = EncodeIndexEntry(entry, 0);
+
+        success = success && platform::FileWrite(&index_entry, sizeof(index_entry), file_) &&
+                  platform::FileWrite(entry.name.data(), entry.name.size(), file_);
+    }
+
+    const DumpArchiveFileFooter footer{ write_offset_, entries_.size(), kDumpArchiveMagic, kDumpArchiveVersion };
+    success = success && platform::FileWrite(&footer, sizeof(footer), file_);
+
+    if (success)
+    {
+        GFXRECON_LOG_INFO("Wrote %" PRIuPTR " entries to dump archive %s (%" PRIu64 " bytes stored, %" PRIu64
+                          " duplicate bytes omitted)",
+                          entries_.size(),
+                          filename_.c_str(),
+                          stored_size_,
+                          deduplicated_size_);
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to write the index of dump archive file %s", filename_.c_str());
+    }
+
+    platform::FileClose(file_);
+    file_ = nullptr;
+
+    entries_.clear();
+    stored_entries_.clear();
+}
+
+DumpArchiveReader::DumpArchiveReader() : file_(nullptr), recovered_(false) {}
+
+DumpArchiveReader::~DumpArchiveReader()
+{
+    Close();
+}
+
+bool DumpArchiveReader::Open(const std::string& filename)
+{
+    Close();
+
+    int32_t result = platform::FileOpen(&file_, filename.c_str(), "rb");
+    if (result != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open dump archive file %s", filename.c_str());
+        file_ = nullptr;
+        return false;
+    }
+
+    DumpArchiveFileHeader header{};
+    if (!platform::FileRead(&header, sizeof(header), file_) || (header.magic != kDumpArchiveMagic))
+    {
+        GFXRECON_LOG_ERROR("File %s is not a dump archive", filename.c_str());
+        Close();
+        return false;
+    }
+
+    if (header.version != kDumpArchiveVersion)
+    {
+        GFXRECON_LOG_ERROR("Dump archive file %s has unsupported version %u", filename.c_str(), header.version);
+        Close();
+        return false;
+    }
+
+    int64_t file_size = -1;
+    if (platform::FileSeek(file_, 0, platform::FileSeekEnd))
+    {
+        file_size = platform::FileTell(file_);
+    }
+
+    if (file_size < static_cast<int64_t>(sizeof(header)))
+    {
+        GFXRECON_LOG_ERROR("Failed to determine the size of dump archive file %s", filename.c_str());
+        Close();
+        return false;
+    }
+
+    // The footer is only present when the archive was closed.
+    DumpArchiveFileFooter footer{};
+
+    const bool has_footer =
+        (static_cast<uint64_t>(file_size) >= (sizeof(header) + sizeof(footer))) &&
+        platform::FileSeek(file_, -static_cast<int64_t>(sizeof(footer)), platform::FileSeekEnd) &&
+        platform::FileRead(&footer, sizeof(footer), file_) && (footer.magic == kDumpArchiveMagic) &&
+        (footer.version == kDumpArchiveVersion) && (footer.index_offset >= sizeof(header)) &&
+        (footer.index_offset <= (static_cast<uint64_t>(file_size) - sizeof(footer)));
+
+    bool success = false;
+
+    if (has_footer)
+    {
+        success = ReadIndex(footer.index_offset, footer.entry_count);
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to read the index of dump archive file %s", filename.c_str());
+        }
+    }
+    else
+    {
+        success    = ScanRecords(static_cast<uint64_t>(file_size));
+        recovered_ = success;
+        if (success)
+        {
+            GFXRECON_LOG_WARNING("Dump archive file %s was not closed, recovered %" PRIuPTR " entries",
+                                 filename.c_str(),
+                                 entries_.size());
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to recover the entries of dump archive file %s", filename.c_str());
+        }
+    }
+
+    if (!success)
+    {
+        Close();
+    }
+
+    return success;
+}
+
+bool DumpArchiveReader::ReadIndex(uint64_t index_offset, uint64_t entry_count)
+{
+    bool success = platform::FileSeek(file_, static_cast<int64_t>(index_offset), platform::FileSeekSet);
+
+    for (uint64_t i = 0; success && (i < entry_count); ++i)
+    {
+        DumpArchiveIndexEntry index_entry{};
+
+        success = platform::FileRead(&index_entry, sizeof(index_entry), file_);
+        if (success)
+        {
+            DumpArchiveEntry entry;
+            DecodeIndexEntry(index_entry, &entry);
+
+            success = (index_entry.name_length == 0) ||
+                      platform::FileRead(&entry.name[0], index_entry.name_length, file_);
+            if (success)
+            {
+                entries_.emplace_back(std::move(entry));
+            }
+        }
+    }
+
+    return success;
+}
+
+bool DumpArchiveReader::ScanRecords(uint64_t file_size)
+{
+    uint64_t offset = sizeof(DumpArchiveFileHeader);
+
+    if (!platform::FileSeek(file_, static_cast<int64_t>(offset), platform::FileSeekSet))
+    {
+        return false;
+    }
+
+    // Records are read until the end of the file, or until a record that was only partially written.
+    const uint64_t record_header_size = sizeof(kDumpArchiveRecordMagic) + sizeof(DumpArchiveIndexEntry);
+
+    while ((file_size - offset) >= record_header_size)
+    {
+        uint32_t              magic = 0;
+        DumpArchiveIndexEntry record{};
+
+        if (!platform::FileRead(&magic, sizeof(magic), file_) || (magic != kDumpArchiveRecordMagic) ||
+            !platform::FileRead(&record, sizeof(record), file_))
+        {
+            break;
+        }
+
+        offset += record_header_size;
+
+        const bool     data_follows = (record.flags & kDumpArchiveFlagDataFollows) != 0;
+        const uint64_t data_size    = data_follows ? record.data_size : 0;
+        const uint64_t remaining    = file_size - offset;
+
+        if ((record.name_length > remaining) || (data_size > (remaining - record.name_length)))
+        {
+            break;
+        }
+
+        // Stored content immediately follows the record name, and deduplicated content references an earlier record.
+        if (data_follows ? (record.data_offset != (offset + record.name_length))
+                         : ((record.data_offset > offset) || (record.data_size > (offset - record.data_offset))))
+        {
+            break;
+        }
+
+        DumpArchiveEntry entry;
+        DecodeIndexEntry(record, &entry);
+
+        if ((record.name_length > 0) && !platform::FileRead(&entry.name[0], record.name_length, file_))
+        {
+            break;
+        }
+
+        offset += record.name_length + data_size;
+
+        if ((data_size > 0) && !platform::FileSeek(file_, static_cast<int64_t>(offset), platform::FileSeekSet))
+        {
+            break;
+        }
+
+        entries_.emplace_back(std::move(entry));
+    }
+
+    return true;
+}
+
+void DumpArchiveReader::Close()
+{
+    if (file_ != nullptr)
+    {
+        platform::FileClose(file_);
+        file_ = nullptr;
+    }
+
+    entries_.clear();
+    recovered_ = false;
+}
+
+bool DumpArchiveReader::ReadEntryData(const DumpArchiveEntry& entry, std::vector<uint8_t>* data)
+{
+    assert(data != nullptr);
+
+    if (file_ == nullptr)
+    {
+        return false;
+    }
+
+    data->resize(static_cast<size_t>(entry.data_size));
+
+    return (entry.data_size == 0) ||
+           (platform::FileSeek(file_, static_cast<int64_t>(entry.data_offset), platform::FileSeekSet) &&
+            platform::FileRead(data->data(), data->size(), file_));
+}
+
+bool DumpArchiveReader::ExtractEntry(const DumpArchiveEntry& entry, const std::string& directory)
+{
+    if (!ReadEntryData(entry, &data_))
+    {
+        GFXRECON_LOG_ERROR("Failed to read dump archive entry %s", entry.name.c_str());
+        return false;
+    }
+
+    const std::string           filename = filepath::Join(directory, entry.name);
+    const DumpArchiveImageInfo& image    = entry.image_info;
+
+    if (entry.type == DumpArchiveEntryType::kBuffer)
+    {
+        return bufferwriter::WriteBuffer(filename, data_.data(), data_.size());
+    }
+    else if (image.encoding == DumpArchiveImageEncoding::kAstc)
+    {
+        return imagewriter::WriteAstcImage(filename,
+                                           image.width,
+                                           image.height,
+                                           image.depth,
+                                           image.block_width,
+                                           image.block_height,
+                                           image.block_depth,
+                                           data_.data(),
+                                           data_.size());
+    }
+    else if (image.encoding == DumpArchiveImageEncoding::kPng)
+    {
+        if (image.separate_alpha)
+        {
+            return imagewriter::WritePngImageSeparateAlpha(
+                filename, image.width, image.height, data_.size(), data_.data(), image.row_pitch, image.data_format);
+        }
+
+        return imagewriter::WritePngImage(filename,
+                                          image.width,
+                                          image.height,
+                                          data_.size(),
+                                          data_.data(),
+                                          image.row_pitch,
+                                          image.data_format,
+                                          image.has_alpha);
+    }
+    else
+    {
+        if (image.separate_alpha)
+        {
+            return imagewriter::WriteBmpImageSeparateAlpha(
+                filename, image.width, image.height, data_.size(), data_.data(), image.row_pitch, image.data_format);
+        }
+
+        return imagewriter::WriteBmpImage(filename,
+                                          image.width,
+                                          image.height,
+                                          data_.size(),
+                                          data_.data(),
+                                          image.row_pitch,
+                                          image.data_format,
+                                          image.has_alpha);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,162 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_DUMP_ARCHIVE_H
+#define GFXRECON_UTIL_DUMP_ARCHIVE_H
+
+#include "util/defines.h"
+#include "util/hash.h"
+#include "util/image_writer.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// A dump archive stores the files produced by a resource dump in a single append-only file. Each entry is appended as
+// a record holding its name, size, hash and format, followed by its content unless identical content was already
+// stored by an earlier record. An index of all entries is written at the end of the file when the archive is closed,
+// followed by a footer that locates the index. An archive that was not closed, for example because the dump crashed,
+// is recovered by scanning the entry records up to the last complete one.
+//
+// Image entries hold the uncompressed texels and are only encoded as BMP, PNG or ASTC files when extracted.
+
+enum class DumpArchiveEntryType : uint32_t
+{
+    kBuffer = 0,
+    kImage  = 1
+};
+
+enum class DumpArchiveImageEncoding : uint32_t
+{
+    kBmp  = 0,
+    kPng  = 1,
+    kAstc = 2
+};
+
+struct DumpArchiveImageInfo
+{
+    DumpArchiveImageEncoding encoding{ DumpArchiveImageEncoding::kBmp };
+    imagewriter::DataFormats data_format{ imagewriter::kFormat_UNSPECIFIED };
+    uint32_t                 width{ 0 };
+    uint32_t                 height{ 0 };
+    uint32_t                 depth{ 1 };
+    uint32_t                 row_pitch{ 0 };
+    uint8_t                  block_width{ 0 };
+    uint8_t                  block_height{ 0 };
+    uint8_t                  block_depth{ 0 };
+    bool                     has_alpha{ false };
+    bool                     separate_alpha{ false };
+};
+
+struct DumpArchiveEntry
+{
+    std::string          name;
+    uint64_t             data_offset{ 0 };
+    uint64_t             data_size{ 0 };
+    hash::Hash128        data_hash;
+    DumpArchiveEntryType type{ DumpArchiveEntryType::kBuffer };
+    DumpArchiveImageInfo image_info;
+};
+
+class DumpArchiveWriter
+{
+  public:
+    DumpArchiveWriter();
+
+    ~DumpArchiveWriter();
+
+    bool Open(const std::string& filename);
+
+    bool IsOpen() const { return file_ != nullptr; }
+
+    // Entry names are stored without their directory.
+    bool AddBuffer(const std::string& name, const void* data, size_t size);
+
+    bool AddImage(const std::string& name, const void* data, size_t size, const DumpArchiveImageInfo& image_info);
+
+    // Writes the index and closes the archive file.
+    void Close();
+
+    size_t GetEntryCount() const { return entries_.size(); }
+
+    uint64_t GetStoredSize() const { return stored_size_; }
+
+    uint64_t GetDeduplicatedSize() const { return deduplicated_size_; }
+
+  private:
+    bool AddEntry(DumpArchiveEntry* entry, const void* data);
+
+  private:
+    FILE*                                                           file_;
+    std::string                                                     filename_;
+    uint64_t                                                        write_offset_;
+    uint64_t                                                        stored_size_;
+    uint64_t                                                        deduplicated_size_;
+    std::vector<DumpArchiveEntry>                                   entries_;
+    std::unordered_map<hash::Hash128, size_t, hash::Hash128Hasher> stored_entries_;
+};
+
+class DumpArchiveReader
+{
+  public:
+    DumpArchiveReader();
+
+    ~DumpArchiveReader();
+
+    // Opens an archive and reads its index, or recovers the entries of an archive that was not closed.
+    bool Open(const std::string& filename);
+
+    // Returns true when the entries were recovered from an archive that was not closed.
+    bool IsRecovered() const { return recovered_; }
+
+    void Close();
+
+    const std::vector<DumpArchiveEntry>& GetEntries() const { return entries_; }
+
+    bool ReadEntryData(const DumpArchiveEntry& entry, std::vector<uint8_t>* data);
+
+    // Writes an entry to a file named after the entry in the specified directory, encoding image entries with the
+    // format they were dumped with.
+    bool ExtractEntry(const DumpArchiveEntry& entry, const std::string& directory);
+
+  private:
+    bool ReadIndex(uint64_t index_offset, uint64_t entry_count);
+
+    bool ScanRecords(uint64_t file_size);
+
+  private:
+    FILE*                         file_;
+    std::vector<DumpArchiveEntry> entries_;
+    std::vector<uint8_t>          data_;
+    bool                          recovered_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_DUMP_ARCHIVE_H
@@ -29,7 +29,10 @@
 
 #include "util/defines.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -154,6 +157,242 @@ static inline uint32_t murmur3_32(const K& key, uint32_t seed)
     return h;
 }
 
+// 128-bit hash value, as produced by murmur3_128.
+struct Hash128
+{
+    uint64_t low{ 0 };
+    uint64_t high{ 0 };
+
+    bool operator==(const Hash128& other) const { return (low == other.low) && (high == other.high); }
+
+    bool operator!=(const Hash128& other) const { return !(*this == other); }
+};
+
+// Hasher for using Hash128 values as keys in unordered containers.
+struct Hash128Hasher
+{
+    size_t operator()(const Hash128& value) const { return static_cast<size_t>(value.low); }
+};
+
+inline uint64_t murmur_64_rotl(uint64_t x, uint32_t r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t murmur_64_fmix(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+/**
+ * @brief   murmur3_128 computes the 128-bit MurmurHash3 (x64 variant) of an arbitrary block of memory.
+ *
+ * Data is read in little-endian order, matching the reference implementation on little-endian platforms.
+ *
+ * @param   data    pointer to the data to hash
+ * @param   size    size of the data in bytes
+ * @param   seed    a seed value
+ * @return  the 128-bit hash value
+ */
+inline Hash128 murmur3_128(const void* data, size_t size, uint32_t seed = 0)
+{
+    constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+    constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+
+    const uint8_t* bytes       = static_cast<const uint8_t*>(data);
+    const size_t   block_count = size / 16;
+
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+
+    for (size_t i = 0; i < block_count; ++i)
+    {
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+        std::memcpy(&k1, bytes + (i * 16), sizeof(k1));
+        std::memcpy(&k2, bytes + (i * 16) + 8, sizeof(k2));
+
+        k1 *= c1;
+        k1 = murmur_64_rotl(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+
+        h1 = murmur_64_rotl(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+
+        k2 *= c2;
+        k2 = murmur_64_rotl(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+
+        h2 = murmur_64_rotl(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    // tail
+    const uint8_t* tail      = bytes + (block_count * 16);
+    const size_t   tail_size = size & 15;
+
+    if (tail_size > 8)
+    {
+        uint64_t k2 = 0;
+        for (size_t i = tail_size; i > 8; --i)
+        {
+            k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+        }
+
+        k2 *= c2;
+        k2 = murmur_64_rotl(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+
+    if (tail_size > 0)
+    {
+        uint64_t k1 = 0;
+        for (size_t i = std::min<size_t>(tail_size, 8); i > 0; --i)
+        {
+            k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+        }
+
+        k1 *= c1;
+        k1 = murmur_64_rotl(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+
+    // finalize
+    h1 ^= static_cast<uint64_t>(size);
+    h2 ^= static_cast<uint64_t>(size);
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = murmur_64_fmix(h1);
+    h2 = murmur_64_fmix(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    return { h1, h2 };
+}
+
+/**
+ * @brief   stripe_hash_64 computes a 64-bit hash of a block of memory, intended for fast change detection.
+ *
+ * The input is processed in 64-byte stripes that update eight independent accumulators with 32x32->64 bit multiplies,
+ * in the style of the XXH3 long input loop, which allows compilers to vectorize the loop (SSE2/AVX2/NEON).  Values
+ * are not compatible with XXH3 and are not stable across platforms with different endianness, so they must not be
+ * persisted.
+ *
+ * @param   data    pointer to the data to hash
+ * @param   size    size of the data in bytes
+ * @param   seed    a seed value
+ * @return  the 64-bit hash value
+ */
+inline uint64_t stripe_hash_64(const void* data, size_t size, uint64_t seed = 0)
+{
+    constexpr size_t   kLanes              = 8;
+    constexpr size_t   kStripeSize         = kLanes * sizeof(uint64_t);
+    constexpr size_t   kStripesPerScramble = 16;
+    constexpr uint64_t kPrime32            = 0x9e3779b1ULL;
+    constexpr uint64_t kPrime64            = 0x9e3779b185ebca87ULL;
+    constexpr uint64_t kSecret[kLanes]     = { 0xbe4ba423396cfeb8ULL, 0x1cad21f72c81017cULL, 0xdb979083e96dd4deULL,
+                                               0x1f67b3b7a4a44072ULL, 0x78e5c0cc4ee679cbULL, 0x2172ffcc7dd05a82ULL,
+                                               0x8e2443f7744608b8ULL, 0x4c263a81e69035e0ULL };
+
+    uint64_t acc[kLanes] = { 0x00000000c2b2ae3dULL, 0x9e3779b185ebca87ULL, 0xc2b2ae3d27d4eb4fULL,
+                             0x165667b19e3779f9ULL, 0x85ebca77c2b2ae63ULL, 0x0000000085ebca77ULL,
+                             0x27d4eb2f165667c5ULL, 0x000000009e3779b1ULL };
+
+    for (size_t i = 0; i < kLanes; ++i)
+    {
+        acc[i] += seed;
+    }
+
+    auto accumulate = [&acc, &kSecret](const uint64_t* lanes) {
+        for (size_t i = 0; i < kLanes; ++i)
+        {
+            const uint64_t data_key = lanes[i] ^ kSecret[i];
+            acc[i ^ 1] += lanes[i];
+            acc[i] += (data_key & 0xffffffffULL) * (data_key >> 32);
+        }
+    };
+
+    const uint8_t* bytes        = static_cast<const uint8_t*>(data);
+    const size_t   stripe_count = size / kStripeSize;
+    uint64_t       lanes[kLanes];
+
+    for (size_t stripe = 0; stripe < stripe_count; ++stripe)
+    {
+        std::memcpy(lanes, bytes + (stripe * kStripeSize), kStripeSize);
+        accumulate(lanes);
+
+        if (((stripe + 1) % kStripesPerScramble) == 0)
+        {
+            for (size_t i = 0; i < kLanes; ++i)
+            {
+                acc[i] ^= acc[i] >> 47;
+                acc[i] ^= kSecret[i];
+                acc[i] *= kPrime32;
+            }
+        }
+    }
+
+    // The last partial stripe is zero padded; the size is mixed into the result to distinguish the padding.
+    const size_t tail_size = size % kStripeSize;
+    if (tail_size > 0)
+    {
+        std::memset(lanes, 0, kStripeSize);
+        std::memcpy(lanes, bytes + (stripe_count * kStripeSize), tail_size);
+        accumulate(lanes);
+    }
+
+    uint64_t result = static_cast<uint64_t>(size) * kPrime64 + seed;
+    for (size_t i = 0; i < kLanes; ++i)
+    {
+        result = murmur_64_rotl(result ^ murmur_64_fmix(acc[i]), 27) * kPrime64;
+    }
+
+    return murmur_64_fmix(result);
+}
+
+// 64-bit FNV-1a hash of a null terminated string, which can be evaluated at compile time.
+constexpr uint64_t fnv1a_64(const char* str)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    while (*str != '\0')
+    {
+        hash ^= static_cast<uint8_t>(*str++);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Returns the slot of a key in a perfect hash table built with the hash and displace method, where the upper half of
+// the key's 64-bit hash selects a bucket and the bucket's seed displaces the lower half to a unique slot.  The same
+// computation is performed by the code generator that builds the tables.
+constexpr uint32_t perfect_hash_index(uint64_t hash, const uint32_t* seeds, uint32_t seed_count, uint32_t table_size)
+{
+    uint32_t k = static_cast<uint32_t>(hash) ^ seeds[static_cast<uint32_t>(hash >> 32) % seed_count];
+
+    // MurmurHash3 fmix32
+    k ^= k >> 16;
+    k *= 0x85ebca6bU;
+    k ^= k >> 13;
+    k *= 0xc2b2ae35U;
+    k ^= k >> 16;
+
+    return k % table_size;
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,149 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_hash_tracker.h"
+
+#include "util/hash.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+MemoryHashTracker::MemoryHashTracker(size_t block_size, size_t num_threads) :
+    block_size_((block_size > 0) ? block_size : kDefaultBlockSize), thread_pool_(num_threads)
+{}
+
+void MemoryHashTracker::ProcessMemory(uint64_t                  memory_id,
+                                      const void*               data,
+                                      size_t                    size,
+                                      const ModifiedMemoryFunc& handle_modified)
+{
+    if ((data == nullptr) || (size == 0))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const uint8_t* bytes       = static_cast<const uint8_t*>(data);
+    const size_t   block_count = (size + block_size_ - 1) / block_size_;
+    auto&          hashes      = memory_hashes_[memory_id];
+    bool           is_new      = false;
+
+    if (hashes.size != size)
+    {
+        hashes.size = size;
+        hashes.block_hashes.assign(block_count, 0);
+        is_new = true;
+    }
+
+    modified_blocks_.resize(block_count);
+
+    if ((size < kParallelHashThreshold) || (thread_pool_.numthreads() == 0))
+    {
+        HashBlocks(bytes, size, 0, block_count, is_new, hashes.block_hashes.data(), modified_blocks_.data());
+    }
+    else
+    {
+        // Split the region into one task per worker, with a few extra tasks to balance uneven progress.
+        const size_t task_count      = thread_pool_.numthreads() * 4;
+        const size_t blocks_per_task = std::max<size_t>(1, (block_count + task_count - 1) / task_count);
+
+        for (size_t first_block = 0; first_block < block_count; first_block += blocks_per_task)
+        {
+            const size_t end_block       = std::min(block_count, first_block + blocks_per_task);
+            uint64_t*    block_hashes    = hashes.block_hashes.data();
+            uint8_t*     modified_blocks = modified_blocks_.data();
+
+            pending_tasks_.emplace_back(thread_pool_.post(
+                [this, bytes, size, first_block, end_block, is_new, block_hashes, modified_blocks]() {
+                    HashBlocks(bytes, size, first_block, end_block, is_new, block_hashes, modified_blocks);
+                }));
+        }
+
+        for (auto& task : pending_tasks_)
+        {
+            task.wait();
+        }
+
+        pending_tasks_.clear();
+    }
+
+    // Report ranges of consecutive modified blocks.
+    size_t block_index = 0;
+    while (block_index < block_count)
+    {
+        if (modified_blocks_[block_index] == 0)
+        {
+            ++block_index;
+            continue;
+        }
+
+        const size_t first_block = block_index;
+        while ((block_index < block_count) && (modified_blocks_[block_index] != 0))
+        {
+            ++block_index;
+        }
+
+        const size_t offset     = first_block * block_size_;
+        const size_t range_size = std::min(size, block_index * block_size_) - offset;
+        handle_modified(memory_id, offset, range_size);
+    }
+}
+
+void MemoryHashTracker::RemoveMemory(uint64_t memory_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_hashes_.erase(memory_id);
+}
+
+void MemoryHashTracker::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    memory_hashes_.clear();
+}
+
+void MemoryHashTracker::HashBlocks(const uint8_t* data,
+                                   size_t         size,
+                                   size_t         first_block,
+                                   size_t         end_block,
+                                   bool           force_modified,
+                                   uint64_t*      block_hashes,
+                                   uint8_t*       modified_blocks) const
+{
+    assert((data != nullptr) && (block_hashes != nullptr) && (modified_blocks != nullptr));
+
+    for (size_t block_index = first_block; block_index < end_block; ++block_index)
+    {
+        const size_t   offset     = block_index * block_size_;
+        const size_t   block_size = std::min(block_size_, size - offset);
+        const uint64_t hash       = hash::stripe_hash_64(data + offset, block_size);
+
+        modified_blocks[block_index] = (force_modified || (hash != block_hashes[block_index])) ? 1 : 0;
+        block_hashes[block_index]    = hash;
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
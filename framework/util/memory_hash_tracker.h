@@ -0,0 +1,96 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_HASH_TRACKER_H
+#define GFXRECON_UTIL_MEMORY_HASH_TRACKER_H
+
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Detects modifications to memory regions that cannot be monitored with page guards by comparing a hash of each fixed
+// size block of the region with the hash computed for the previous call.  Large regions are hashed on a worker pool.
+class MemoryHashTracker
+{
+  public:
+    static constexpr size_t kDefaultBlockSize = 4096;
+
+    // Regions smaller than this are hashed on the calling thread.
+    static constexpr size_t kParallelHashThreshold = 4 * 1024 * 1024;
+
+    // Receives the offset and size of a range of consecutive modified blocks.
+    typedef std::function<void(uint64_t memory_id, size_t offset, size_t size)> ModifiedMemoryFunc;
+
+  public:
+    MemoryHashTracker(size_t block_size, size_t num_threads);
+
+    ~MemoryHashTracker() = default;
+
+    // Reports the ranges of the region that changed since the previous call for the same memory id.  The entire region
+    // is reported by the first call for a memory id, or when the size of the region changed.
+    void ProcessMemory(uint64_t memory_id, const void* data, size_t size, const ModifiedMemoryFunc& handle_modified);
+
+    // Discards the hashes for a memory id, which must be called when the memory is unmapped or freed.
+    void RemoveMemory(uint64_t memory_id);
+
+    // Discards the hashes for all memory ids, so that the next call for each memory id reports the entire region.
+    void Clear();
+
+    size_t GetBlockSize() const { return block_size_; }
+
+  private:
+    struct MemoryHashes
+    {
+        size_t                size{ 0 };
+        std::vector<uint64_t> block_hashes;
+    };
+
+    void HashBlocks(const uint8_t* data,
+                    size_t         size,
+                    size_t         first_block,
+                    size_t         end_block,
+                    bool           force_modified,
+                    uint64_t*      block_hashes,
+                    uint8_t*       modified_blocks) const;
+
+  private:
+    const size_t                               block_size_;
+    std::mutex                                 mutex_;
+    std::unordered_map<uint64_t, MemoryHashes> memory_hashes_;
+    std::vector<uint8_t>                       modified_blocks_;
+    std::vector<std::future<void>>             pending_tasks_;
+    ThreadPool                                 thread_pool_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_HASH_TRACKER_H
@@ -43,6 +43,7 @@ void MonotonicAllocator::Clear(bool free_system_memory)
 
     // Free oversized allocations
     oversized_allocations_.clear();
+    oversized_bytes_ = 0;
 
     current_block_            = 0;
     current_block_free_bytes_ = block_size_;
@@ -84,6 +85,7 @@ void* MonotonicAllocator::Allocate(size_t object_bytes, size_t alignment_bytes)
         // Custom allocation
         oversized_allocations_.emplace_back(new unsigned char[object_bytes]);
         result = oversized_allocations_.back().get();
+        oversized_bytes_ += object_bytes;
     }
 
     return result;
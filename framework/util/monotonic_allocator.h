@@ -74,6 +74,9 @@ class MonotonicAllocator
     // memory
     void Clear(bool free_system_memory);
 
+    // Returns the number of bytes of system memory currently held by the allocator, including oversized allocations.
+    size_t GetSystemMemorySize() const { return (memory_blocks_.size() * block_size_) + oversized_bytes_; }
+
   private:
     void* Allocate(size_t object_bytes, size_t alignment_bytes);
     void* AllocateToBlock(size_t object_bytes, size_t alignment_bytes);
@@ -92,6 +95,7 @@ class MonotonicAllocator
     const size_t                                  block_size_;
     size_t                                        current_block_;
     size_t                                        current_block_free_bytes_;
+    size_t                                        oversized_bytes_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(util)
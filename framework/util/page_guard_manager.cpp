@@ -28,6 +28,8 @@
 #include "util/page_status_tracker.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <csetjmp>
 #include <cinttypes>
@@ -258,7 +260,8 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
     signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores),
     enable_read_write_same_page_(expect_read_write_same_page), protection_mode_(protection_mode), uffd_is_init_(false)
 {
-    if (kUserFaultFdMode == protection_mode_ && !USERFAULTFD_SUPPORTED)
+    if ((kUserFaultFdMode == protection_mode_ || kUserFaultFdAsyncMode == protection_mode_) &&
+        !USERFAULTFD_SUPPORTED)
     {
         GFXRECON_LOG_WARNING("Kernel does not support all features for userfaultfd memory tracking mode. Falling back "
                              "to mprotect mode.");
@@ -808,6 +811,23 @@ void PageGuardManager::LoadActiveWriteStates(MemoryInfo* memory_info)
 #endif
 }
 
+void PageGuardManager::LoadModifiedStates(MemoryInfo* memory_info)
+{
+    assert(memory_info != nullptr);
+
+    if (memory_info->use_write_watch)
+    {
+        // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
+        // When not using shadow memory, we need to query for active write status.
+        LoadActiveWriteStates(memory_info);
+    }
+    else if (protection_mode_ == kUserFaultFdAsyncMode)
+    {
+        // Written pages are tracked by the kernel and retrieved in bulk, without blocking the faulting threads.
+        UffdLoadWrittenPages(memory_info);
+    }
+}
+
 void PageGuardManager::ProcessEntry(uint64_t                  memory_id,
                                     MemoryInfo*               memory_info,
                                     const ModifiedMemoryFunc& handle_modified)
@@ -1032,7 +1052,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             {
                 aligned_address = shadow_memory;
 
-                if (enable_copy_on_map_ && kUserFaultFdMode != protection_mode_)
+                if (enable_copy_on_map_ && kMProtectMode == protection_mode_)
                 {
                     MemoryCopy(shadow_memory, mapped_memory, mapped_range);
                 }
@@ -1074,7 +1094,7 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
         size_t guard_range = mapped_range + aligned_offset;
 
         // Userfaultfd requires the registered region to be multiples of the page size
-        if (kUserFaultFdMode == protection_mode_ && guard_range != GetAlignedSize(guard_range))
+        if (kMProtectMode != protection_mode_ && guard_range != GetAlignedSize(guard_range))
         {
             if (!use_shadow_memory)
             {
@@ -1306,12 +1326,7 @@ void PageGuardManager::ProcessMemoryEntry(uint64_t memory_id, const ModifiedMemo
     {
         auto memory_info = &entry->second;
 
-        if (memory_info->use_write_watch)
-        {
-            // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
-            // When not using shadow memory, we need to query for active write status.
-            LoadActiveWriteStates(memory_info);
-        }
+        LoadModifiedStates(memory_info);
 
         if (memory_info->is_modified)
         {
@@ -1340,12 +1355,7 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     {
         auto memory_info = &entry->second;
 
-        if (memory_info->use_write_watch)
-        {
-            // Active memory tracking with VirtualProtect()/mprotect() is only applied to shadow memory.
-            // When not using shadow memory, we need to query for active write status.
-            LoadActiveWriteStates(memory_info);
-        }
+        LoadModifiedStates(memory_info);
 
         if (memory_info->is_modified)
         {
@@ -1360,6 +1370,84 @@ void PageGuardManager::ProcessMemoryEntries(const ModifiedMemoryFunc& handle_mod
     }
 }
 
+void PageGuardManager::ProcessMemoryEntries(const IndexedModifiedMemoryFunc& handle_modified,
+                                            const EntryProcessedFunc&        entry_processed,
+                                            ThreadPool*                      thread_pool)
+{
+    assert(thread_pool != nullptr);
+
+    std::lock_guard<std::mutex> lock(tracked_memory_lock_);
+
+    uint32_t n_threads_to_wait = 0;
+    if (protection_mode_ == kUserFaultFdMode)
+    {
+        n_threads_to_wait = UffdBlockFaultingThreads();
+    }
+
+    std::vector<std::pair<uint64_t, MemoryInfo*>> entries;
+    entries.reserve(memory_info_.size());
+    for (auto& entry : memory_info_)
+    {
+        entries.emplace_back(entry.first, &entry.second);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // Entries are handed out in sorted order, so the workers process objects that are close together in the order in
+    // which their results are emitted.  Each memory object is only accessed by the worker that scans, copies, and
+    // reports its modified ranges.
+    std::atomic<size_t> next_entry{ 0 };
+
+    auto process_entries = [this, &entries, &next_entry, &handle_modified, &entry_processed]() {
+        for (size_t entry_index = next_entry++; entry_index < entries.size(); entry_index = next_entry++)
+        {
+            const uint64_t memory_id   = entries[entry_index].first;
+            MemoryInfo*    memory_info = entries[entry_index].second;
+
+            LoadModifiedStates(memory_info);
+
+            if (memory_info->is_modified)
+            {
+                ProcessEntry(memory_id,
+                             memory_info,
+                             [entry_index, &handle_modified](
+                                 uint64_t modified_id, void* start_address, size_t offset, size_t size) {
+                                 handle_modified(entry_index, modified_id, start_address, offset, size);
+                             });
+            }
+
+            entry_processed(entry_index);
+        }
+    };
+
+    const size_t thread_count = std::min(thread_pool->numthreads(), entries.size());
+
+    if (thread_count <= 1)
+    {
+        process_entries();
+    }
+    else
+    {
+        std::vector<std::future<void>> tasks;
+
+        for (size_t i = 0; i < thread_count; ++i)
+        {
+            tasks.emplace_back(thread_pool->post(process_entries));
+        }
+
+        for (auto& task : tasks)
+        {
+            task.wait();
+        }
+    }
+
+    // Unblock threads
+    if (protection_mode_ == kUserFaultFdMode)
+    {
+        UffdUnblockFaultingThreads(n_threads_to_wait);
+    }
+}
+
 bool PageGuardManager::HandleGuardPageViolation(void* address, bool is_write, bool clear_guard)
 {
     assert(protection_mode_ == kMProtectMode);
@@ -28,6 +28,7 @@
 #include "util/defines.h"
 #include "util/page_status_tracker.h"
 #include "util/platform.h"
+#include "util/threadpool.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -76,7 +77,12 @@ class PageGuardManager
     enum MemoryProtectionMode
     {
         kMProtectMode,
-        kUserFaultFdMode
+        kUserFaultFdMode,
+        // Same as kUserFaultFdMode for the first access to a page, but pages are then write-protected with
+        // UFFD_FEATURE_WP_ASYNC, so that the kernel records writes without notifying the handler thread.  Written
+        // pages are retrieved, and write-protected again, with the PAGEMAP_SCAN ioctl when memory is processed.
+        // Falls back to kUserFaultFdMode when the kernel does not support these features.
+        kUserFaultFdAsyncMode
     };
 
     static const bool                 kDefaultEnableCopyOnMap                 = true;
@@ -95,6 +101,14 @@ class PageGuardManager
     // the modified range pointer, and the size of the modified range.
     typedef std::function<void(uint64_t, void*, size_t, size_t)> ModifiedMemoryFunc;
 
+    // Callback for processing modified memory from worker threads.  The first parameter is the position of the memory
+    // object in the processing order, followed by the ModifiedMemoryFunc parameters.
+    typedef std::function<void(size_t, uint64_t, void*, size_t, size_t)> IndexedModifiedMemoryFunc;
+
+    // Callback invoked by the worker thread after it has processed a memory object, with the position of the object in
+    // the processing order.  It is invoked for every object, including objects without modified memory.
+    typedef std::function<void(size_t)> EntryProcessedFunc;
+
   public:
     static void Create(bool                 enable_copy_on_map,
                        bool                 enable_separate_read,
@@ -138,6 +152,15 @@ class PageGuardManager
 
     void ProcessMemoryEntries(const ModifiedMemoryFunc& handle_modified);
 
+    // Parallel version of ProcessMemoryEntries.  The tracked memory objects are sorted by ID, and the scan, copy, and
+    // handle_modified invocations for each object are performed by the worker threads of thread_pool, which take the
+    // objects in sorted order.  The callbacks are invoked concurrently for different memory objects, but sequentially
+    // for a single object, with the position of the object in the sorted order so that the results can be emitted in
+    // a deterministic order.  entry_processed is invoked after the last handle_modified call for an object.
+    void ProcessMemoryEntries(const IndexedModifiedMemoryFunc& handle_modified,
+                              const EntryProcessedFunc&        entry_processed,
+                              ThreadPool*                      thread_pool);
+
     bool HandleGuardPageViolation(void* address, bool is_write, bool clear_guard);
 
     size_t GetAlignedSize(size_t size) const;
@@ -254,6 +277,7 @@ class PageGuardManager
     bool   FindMemory(void* address, MemoryInfo** watched_memory_info);
     bool   SetMemoryProtection(void* protect_address, size_t protect_size, uint32_t protect_mask);
     void   LoadActiveWriteStates(MemoryInfo* memory_info);
+    void   LoadModifiedStates(MemoryInfo* memory_info);
     void   ProcessEntry(uint64_t memory_id, MemoryInfo* memory_info, const ModifiedMemoryFunc& handle_modified);
     void   ProcessActiveRange(uint64_t                  memory_id,
                               MemoryInfo*               memory_info,
@@ -305,6 +329,7 @@ class PageGuardManager
     int                          uffd_rt_signal_used_;
     sigset_t                     uffd_signal_set_;
     int                          uffd_fd_;
+    int                          uffd_pagemap_fd_;
     pthread_t                    uffd_handler_thread_;
     static std::atomic<bool>     is_uffd_handler_thread_running_;
     static std::atomic<bool>     stop_uffd_handler_thread_;
@@ -325,9 +350,12 @@ class PageGuardManager
     bool     UffdRegisterMemory(const void* address, size_t length);
     void     UffdUnregisterMemory(const void* address, size_t length);
     bool     UffdResetRegion(void* guard_address, size_t guard_range);
+    void     UffdLoadWrittenPages(MemoryInfo* memory_info);
 
 #if USERFAULTFD_SUPPORTED == 1
     bool         UffdInit();
+    bool         UffdSupportsAsyncWriteProtect();
+    bool         UffdWriteProtectMemory(const void* address, size_t length);
     bool         UffdSetSignalHandler();
     void         UffdRemoveSignalHandler();
     bool         UffdStartHandlerThread();
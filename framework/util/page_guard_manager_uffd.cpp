@@ -35,6 +35,44 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <poll.h>
+#include <linux/fs.h>
+
+// UFFD_FEATURE_WP_ASYNC and the PAGEMAP_SCAN ioctl were added with Linux 6.7.  The definitions are provided here when
+// building with older kernel headers, and kernel support is checked at runtime.
+#ifndef UFFD_FEATURE_WP_ASYNC
+#define UFFD_FEATURE_WP_ASYNC (1 << 15)
+#endif
+
+#ifndef PAGEMAP_SCAN
+#define PAGE_IS_WRITTEN (1 << 1)
+#define PM_SCAN_WP_MATCHING (1 << 0)
+#define PM_SCAN_CHECK_WPASYNC (1 << 1)
+
+struct page_region
+{
+    __u64 start;
+    __u64 end;
+    __u64 categories;
+};
+
+struct pm_scan_arg
+{
+    __u64 size;
+    __u64 flags;
+    __u64 start;
+    __u64 end;
+    __u64 walk_end;
+    __u64 vec;
+    __u64 vec_len;
+    __u64 max_pages;
+    __u64 category_inverted;
+    __u64 category_mask;
+    __u64 category_anyof_mask;
+    __u64 return_mask;
+};
+
+#define PAGEMAP_SCAN _IOWR('f', 16, struct pm_scan_arg)
+#endif
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -297,6 +335,12 @@ void PageGuardManager::UffdTerminate()
         uffd_fd_ = -1;
     }
 
+    if (uffd_pagemap_fd_ != -1)
+    {
+        close(uffd_pagemap_fd_);
+        uffd_pagemap_fd_ = -1;
+    }
+
     if (uffd_rt_signal_used_ != -1)
     {
         UffdRemoveSignalHandler();
@@ -308,9 +352,10 @@ void PageGuardManager::UffdTerminate()
 
 bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address, uint64_t flags, bool wake_thread)
 {
-    assert(protection_mode_ == kUserFaultFdMode);
+    assert((protection_mode_ == kUserFaultFdMode) || (protection_mode_ == kUserFaultFdAsyncMode));
 
-    // Pages are not touched before they are registed so only missing page faults are expected to happen
+    // Pages are not touched before they are registed so only missing page faults are expected to happen.  Write
+    // protect faults are resolved by the kernel when UFFD_FEATURE_WP_ASYNC is enabled.
     assert((flags & UFFD_PAGEFAULT_FLAG_WP) != UFFD_PAGEFAULT_FLAG_WP);
 
     memory_info->is_modified = true;
@@ -376,6 +421,12 @@ bool PageGuardManager::UffdHandleFault(MemoryInfo* memory_info, uint64_t address
     copy.len  = system_page_size_;
     copy.mode = wake_thread ? 0 : UFFDIO_COPY_MODE_DONTWAKE;
 
+    if (protection_mode_ == kUserFaultFdAsyncMode)
+    {
+        // Install the page write-protected so that the kernel records the next write to the page.
+        copy.mode |= UFFDIO_COPY_MODE_WP;
+    }
+
     if (ioctl(uffd_fd_, UFFDIO_COPY, &copy))
     {
         if (errno != EEXIST)
@@ -521,10 +572,68 @@ bool PageGuardManager::UffdStartHandlerThread()
     return true;
 }
 
+bool PageGuardManager::UffdSupportsAsyncWriteProtect()
+{
+    // Query the supported features with a separate userfaultfd, as the API handshake can only be performed once.
+    int probe_fd = static_cast<int>(syscall(SYS_userfaultfd, UFFD_USER_MODE_ONLY | O_CLOEXEC));
+    if (probe_fd == -1)
+    {
+        return false;
+    }
+
+    struct uffdio_api uffdio_api;
+    uffdio_api.api      = UFFD_API;
+    uffdio_api.features = 0;
+    const bool api_result = (ioctl(probe_fd, UFFDIO_API, &uffdio_api) != -1);
+    close(probe_fd);
+
+    const uint64_t required_features = UFFD_FEATURE_WP_ASYNC;
+    if (!api_result || ((uffdio_api.features & required_features) != required_features))
+    {
+        return false;
+    }
+
+    uffd_pagemap_fd_ = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (uffd_pagemap_fd_ == -1)
+    {
+        return false;
+    }
+
+    // Scan a single page that is not registered with userfaultfd to check for PAGEMAP_SCAN support.
+    const uint64_t page_size = static_cast<uint64_t>(util::platform::GetSystemPageSize());
+
+    struct page_region region;
+    struct pm_scan_arg scan_arg = {};
+    scan_arg.size               = sizeof(scan_arg);
+    scan_arg.start              = GFXRECON_PTR_TO_UINT64(uffd_page_size_tmp_buff_.get()) & ~(page_size - 1);
+    scan_arg.end                = scan_arg.start + page_size;
+    scan_arg.vec                = GFXRECON_PTR_TO_UINT64(&region);
+    scan_arg.vec_len            = 1;
+    scan_arg.category_mask      = PAGE_IS_WRITTEN;
+    scan_arg.return_mask        = PAGE_IS_WRITTEN;
+
+    if (ioctl(uffd_pagemap_fd_, PAGEMAP_SCAN, &scan_arg) == -1)
+    {
+        close(uffd_pagemap_fd_);
+        uffd_pagemap_fd_ = -1;
+
+        return false;
+    }
+
+    return true;
+}
+
 bool PageGuardManager::UffdInit()
 {
     assert(uffd_fd_ == -1);
 
+    if ((protection_mode_ == kUserFaultFdAsyncMode) && !UffdSupportsAsyncWriteProtect())
+    {
+        GFXRECON_LOG_WARNING("userfaultfd asynchronous write protection is not supported by the kernel (Linux 6.7 or "
+                             "later is required). Falling back to userfaultfd missing page tracking.");
+        protection_mode_ = kUserFaultFdMode;
+    }
+
     // open the userfault fd
     uffd_fd_ = static_cast<int>(syscall(SYS_userfaultfd, UFFD_USER_MODE_ONLY | O_CLOEXEC));
     if (uffd_fd_ == -1)
@@ -537,6 +646,11 @@ bool PageGuardManager::UffdInit()
     struct uffdio_api uffdio_api;
     uffdio_api.api      = UFFD_API;
     uffdio_api.features = UFFD_FEATURE_THREAD_ID;
+    if (protection_mode_ == kUserFaultFdAsyncMode)
+    {
+        uffdio_api.features |= UFFD_FEATURE_WP_ASYNC;
+    }
+
     if (ioctl(uffd_fd_, UFFDIO_API, &uffdio_api) == -1)
     {
         GFXRECON_LOG_ERROR("ioctl/uffdio_api: %s", strerror(errno));
@@ -582,6 +696,7 @@ bool PageGuardManager::InitializeUserFaultFd()
 
     uffd_rt_signal_used_     = -1;
     uffd_fd_                 = -1;
+    uffd_pagemap_fd_         = -1;
     uffd_page_size_tmp_buff_ = std::make_unique<uint8_t[]>(util::platform::GetSystemPageSize());
 
     if (!UffdInit())
@@ -635,6 +750,11 @@ bool PageGuardManager::UffdRegisterMemory(const void* address, size_t length)
     uffdio_register.range.start = GFXRECON_PTR_TO_UINT64(address);
     uffdio_register.range.len   = length;
     uffdio_register.mode        = UFFDIO_REGISTER_MODE_MISSING;
+    if (protection_mode_ == kUserFaultFdAsyncMode)
+    {
+        uffdio_register.mode |= UFFDIO_REGISTER_MODE_WP;
+    }
+
     if (ioctl(uffd_fd_, UFFDIO_REGISTER, &uffdio_register) == -1)
     {
         GFXRECON_LOG_ERROR("ioctl/uffdio_register: %s", strerror(errno));
@@ -652,9 +772,89 @@ bool PageGuardManager::UffdRegisterMemory(const void* address, size_t length)
         return false;
     }
 
+    if (protection_mode_ == kUserFaultFdAsyncMode)
+    {
+        // Pages that were populated before registration, such as persistent shadow memory initialized with the
+        // content of the mapped memory, do not fault and need to be write-protected explicitly.
+        return UffdWriteProtectMemory(address, length);
+    }
+
+    return true;
+}
+
+bool PageGuardManager::UffdWriteProtectMemory(const void* address, size_t length)
+{
+    struct uffdio_writeprotect uffdio_wp;
+    uffdio_wp.range.start = GFXRECON_PTR_TO_UINT64(address);
+    uffdio_wp.range.len   = static_cast<uint64_t>(length);
+    uffdio_wp.mode        = UFFDIO_WRITEPROTECT_MODE_WP;
+    if (ioctl(uffd_fd_, UFFDIO_WRITEPROTECT, &uffdio_wp) == -1)
+    {
+        GFXRECON_LOG_ERROR("ioctl/uffdio_writeprotect: %s", strerror(errno));
+        GFXRECON_LOG_ERROR("uffdio_writeprotect.range.start: 0x%" PRIx64, uffdio_wp.range.start);
+        GFXRECON_LOG_ERROR("uffdio_writeprotect.range.len: %" PRId64, uffdio_wp.range.len);
+        return false;
+    }
+
     return true;
 }
 
+void PageGuardManager::UffdLoadWrittenPages(MemoryInfo* memory_info)
+{
+    assert(protection_mode_ == kUserFaultFdAsyncMode);
+    assert((memory_info != nullptr) && (memory_info->aligned_address != nullptr));
+    assert(uffd_pagemap_fd_ != -1);
+
+    const size_t   kMaxRegions = 64;
+    page_region    regions[kMaxRegions];
+    const uint64_t base_address_value = GFXRECON_PTR_TO_UINT64(memory_info->aligned_address);
+
+    // Retrieve the pages that were written since the last scan, and write-protect them again, in a single pass.
+    struct pm_scan_arg scan_arg = {};
+    scan_arg.size               = sizeof(scan_arg);
+    scan_arg.flags              = PM_SCAN_WP_MATCHING | PM_SCAN_CHECK_WPASYNC;
+    scan_arg.start              = base_address_value;
+    scan_arg.end                = scan_arg.start + (memory_info->total_pages << system_page_pot_shift_);
+    scan_arg.vec                = GFXRECON_PTR_TO_UINT64(regions);
+    scan_arg.vec_len            = kMaxRegions;
+    scan_arg.category_mask      = PAGE_IS_WRITTEN;
+    scan_arg.return_mask        = PAGE_IS_WRITTEN;
+
+    while (scan_arg.start < scan_arg.end)
+    {
+        int region_count = ioctl(uffd_pagemap_fd_, PAGEMAP_SCAN, &scan_arg);
+        if (region_count < 0)
+        {
+            GFXRECON_LOG_ERROR("ioctl/pagemap_scan: %s", strerror(errno));
+
+            // Conservatively treat every page as modified when the written state cannot be retrieved.
+            for (size_t i = 0; i < memory_info->total_pages; ++i)
+            {
+                memory_info->status_tracker.SetActiveWriteBlock(i, true);
+            }
+
+            memory_info->is_modified = true;
+            return;
+        }
+
+        for (int i = 0; i < region_count; ++i)
+        {
+            const size_t first_page = (regions[i].start - base_address_value) >> system_page_pot_shift_;
+            const size_t end_page   = (regions[i].end - base_address_value) >> system_page_pot_shift_;
+
+            for (size_t page_index = first_page; page_index < end_page; ++page_index)
+            {
+                memory_info->status_tracker.SetActiveWriteBlock(page_index, true);
+            }
+
+            memory_info->is_modified = true;
+        }
+
+        // The scan stops early when the region vector is full.
+        scan_arg.start = scan_arg.walk_end;
+    }
+}
+
 void PageGuardManager::UffdUnregisterMemory(const void* address, size_t length)
 {
     assert(uffd_fd_ != -1);
@@ -912,6 +1112,11 @@ bool PageGuardManager::UffdResetRegion(void* guard_address, size_t guard_range)
     return true;
 }
 
+void PageGuardManager::UffdLoadWrittenPages(MemoryInfo* memory_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(memory_info);
+}
+
 void PageGuardManager::UffdBlockRtSignal() {}
 
 void PageGuardManager::UffdUnblockRtSignal() {}
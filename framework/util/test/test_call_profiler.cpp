@@ -0,0 +1,161 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+#include "util/call_profiler.h"
+#include <cstdint>
+#include <vector>
+
+using gfxrecon::util::CallProfiler;
+
+TEST_CASE("CallProfiler - bucket bounds contain their durations", "[]")
+{
+    // Small durations have exact buckets.
+    for (uint64_t duration = 0; duration < CallProfiler::kSubBuckets; ++duration)
+    {
+        REQUIRE(CallProfiler::GetBucketIndex(duration) == duration);
+        REQUIRE(CallProfiler::GetBucketUpperBound(CallProfiler::GetBucketIndex(duration)) == duration);
+    }
+
+    std::vector<uint64_t> durations;
+    for (uint32_t bit = 0; bit < 64; ++bit)
+    {
+        const uint64_t power = uint64_t{ 1 } << bit;
+        durations.push_back(power);
+        durations.push_back(power + (power / 3));
+        durations.push_back((power * 2) - 1);
+    }
+
+    for (uint64_t duration : durations)
+    {
+        const uint32_t index = CallProfiler::GetBucketIndex(duration);
+        const uint64_t upper = CallProfiler::GetBucketUpperBound(index);
+
+        REQUIRE(index < CallProfiler::kNumBuckets);
+        REQUIRE(upper >= duration);
+
+        // The duration is above the previous bucket, and the bucket width is within 1/kSubBuckets of the value.
+        if (index > 0)
+        {
+            REQUIRE(CallProfiler::GetBucketUpperBound(index - 1) < duration);
+        }
+
+        REQUIRE((upper - duration) <= (duration / CallProfiler::kSubBuckets));
+    }
+
+    REQUIRE(CallProfiler::GetBucketUpperBound(CallProfiler::GetBucketIndex(UINT64_MAX)) == UINT64_MAX);
+}
+
+TEST_CASE("CallProfiler - bucket indices are monotonic", "[]")
+{
+    uint32_t previous_index = 0;
+    for (uint64_t duration = 0; duration < 100000; ++duration)
+    {
+        const uint32_t index = CallProfiler::GetBucketIndex(duration);
+        REQUIRE(index >= previous_index);
+        REQUIRE(index <= (previous_index + 1));
+        previous_index = index;
+    }
+}
+
+TEST_CASE("CallProfiler - statistics percentiles", "[]")
+{
+    CallProfiler::Statistics empty;
+    REQUIRE(empty.GetPercentile(0.5) == 0);
+
+    CallProfiler::Statistics single;
+    single.Add(1000);
+    REQUIRE(single.count == 1);
+    REQUIRE(single.min_time == 1000);
+    REQUIRE(single.max_time == 1000);
+    REQUIRE(single.GetPercentile(0.0) == 1000);
+    REQUIRE(single.GetPercentile(0.5) == 1000);
+    REQUIRE(single.GetPercentile(1.0) == 1000);
+
+    CallProfiler::Statistics stats;
+    for (uint64_t duration = 1; duration <= 1000; ++duration)
+    {
+        stats.Add(duration);
+    }
+
+    REQUIRE(stats.count == 1000);
+    REQUIRE(stats.total_time == 500500);
+    REQUIRE(stats.min_time == 1);
+    REQUIRE(stats.max_time == 1000);
+
+    // Percentiles are reported as the upper bound of the bucket holding the target sample.
+    const uint64_t p50 = stats.GetPercentile(0.5);
+    const uint64_t p90 = stats.GetPercentile(0.9);
+    const uint64_t p99 = stats.GetPercentile(0.99);
+
+    REQUIRE(p50 >= 500);
+    REQUIRE(p50 <= 500 + (500 / CallProfiler::kSubBuckets));
+    REQUIRE(p90 >= 900);
+    REQUIRE(p90 <= 1000);
+    REQUIRE(p99 >= 990);
+    REQUIRE(p99 <= 1000);
+    REQUIRE(stats.GetPercentile(1.0) == 1000);
+    REQUIRE(p50 <= p90);
+    REQUIRE(p90 <= p99);
+}
+
+TEST_CASE("CallProfiler - statistics merge", "[]")
+{
+    CallProfiler::Statistics first;
+    CallProfiler::Statistics second;
+
+    for (uint64_t duration = 1; duration <= 100; ++duration)
+    {
+        first.Add(duration);
+        second.Add(duration * 10);
+    }
+
+    first.Merge(second);
+
+    uint64_t bucket_total = 0;
+    for (uint32_t i = 0; i < CallProfiler::kNumBuckets; ++i)
+    {
+        bucket_total += first.buckets[i];
+    }
+
+    REQUIRE(first.count == 200);
+    REQUIRE(bucket_total == 200);
+    REQUIRE(first.total_time == (5050 + 50500));
+    REQUIRE(first.min_time == 1);
+    REQUIRE(first.max_time == 1000);
+}
+
+TEST_CASE("CallProfiler - statistics only profiling", "[]")
+{
+    CallProfiler profiler({ "stage" }, 0);
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        profiler.Record(0, 7, 100, 100 + i);
+    }
+
+    const auto statistics = profiler.GetStatistics();
+    REQUIRE(statistics.size() == 1);
+    REQUIRE(statistics[0].id == 7);
+    REQUIRE(statistics[0].count == 10);
+    REQUIRE(statistics[0].max_time == 9);
+}
@@ -0,0 +1,162 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/chunked_buffer.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+TEST_CASE("ChunkedBuffer - records are stored contiguously without relocation", "[]")
+{
+    auto                              pool = std::make_shared<gfxrecon::util::ChunkPool>(64);
+    gfxrecon::util::ChunkedBuffer     buffer(pool);
+    std::vector<const uint8_t*>       records;
+    std::vector<std::vector<uint8_t>> expected;
+
+    for (uint8_t i = 0; i < 32; ++i)
+    {
+        std::vector<uint8_t> data(static_cast<size_t>(i % 7) * 5 + 1, i);
+        buffer.WriteRecord(data.data(), data.size());
+        expected.emplace_back(std::move(data));
+
+        // Locate the record that was just written, which must be at the end of the last chunk.
+        const auto& chunk = buffer.GetChunks().back();
+        records.push_back(chunk.data.get() + chunk.size - expected.back().size());
+    }
+
+    // Earlier records must not have moved as the buffer grew.
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        REQUIRE(std::vector<uint8_t>(records[i], records[i] + expected[i].size()) == expected[i]);
+    }
+
+    size_t total_size = 0;
+    for (const auto& chunk : buffer.GetChunks())
+    {
+        REQUIRE(chunk.size <= chunk.capacity);
+        REQUIRE(chunk.capacity == 64);
+        total_size += chunk.size;
+    }
+
+    REQUIRE(total_size == buffer.GetDataSize());
+}
+
+TEST_CASE("ChunkedBuffer - chunks are recycled through the pool", "[]")
+{
+    auto                          pool = std::make_shared<gfxrecon::util::ChunkPool>(64);
+    gfxrecon::util::ChunkedBuffer first(pool);
+    gfxrecon::util::ChunkedBuffer second(pool);
+    std::vector<uint8_t>          data(48, 0xab);
+
+    first.WriteRecord(data.data(), data.size());
+    first.WriteRecord(data.data(), data.size());
+    REQUIRE(first.GetChunks().size() == 2);
+    const uint8_t* last_chunk = first.GetChunks()[1].data.get();
+
+    first.Clear();
+    REQUIRE(first.IsEmpty());
+    REQUIRE(pool->GetFreeChunkCount() == 2);
+
+    second.WriteRecord(data.data(), data.size());
+    REQUIRE(pool->GetFreeChunkCount() == 1);
+    REQUIRE(second.GetChunks()[0].data.get() == last_chunk);
+
+    // Oversized records use a dedicated allocation that is not returned to the pool.
+    std::vector<uint8_t> large(256, 0xcd);
+    uint8_t*             record = second.AllocateRecord(large.size());
+    REQUIRE(record != nullptr);
+    REQUIRE(second.GetChunks().back().capacity == large.size());
+
+    second.Clear();
+    REQUIRE(pool->GetFreeChunkCount() == 2);
+}
+
+TEST_CASE("ChunkedBuffer - chunk sizes grow from the minimum chunk size", "[]")
+{
+    auto                          pool = std::make_shared<gfxrecon::util::ChunkPool>(1024, 64);
+    gfxrecon::util::ChunkedBuffer buffer(pool);
+    std::vector<uint8_t>          data(60, 0x12);
+
+    // Small buffers only use a small chunk.
+    buffer.WriteRecord(data.data(), data.size());
+    REQUIRE(buffer.GetChunks().size() == 1);
+    REQUIRE(buffer.GetChunks()[0].capacity == 64);
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        buffer.WriteRecord(data.data(), data.size());
+    }
+
+    // Each chunk doubles the previous chunk size until the maximum chunk size is reached.
+    const auto&         chunks = buffer.GetChunks();
+    std::vector<size_t> expected_capacities{ 64, 128, 256, 512, 1024 };
+    REQUIRE(chunks.size() > expected_capacities.size());
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        const size_t expected = (i < expected_capacities.size()) ? expected_capacities[i] : 1024;
+        REQUIRE(chunks[i].capacity == expected);
+        REQUIRE(chunks[i].pooled);
+    }
+
+    // A record larger than the next chunk size starts a chunk that can hold it.
+    gfxrecon::util::ChunkedBuffer other(pool);
+    other.AllocateRecord(300);
+    REQUIRE(other.GetChunks()[0].capacity == 512);
+
+    // Cleared buffers start over with the minimum chunk size, reusing the chunks released to the pool.
+    const size_t chunk_count = chunks.size();
+    buffer.Clear();
+    REQUIRE(pool->GetFreeChunkCount() == chunk_count);
+
+    buffer.WriteRecord(data.data(), data.size());
+    REQUIRE(buffer.GetChunks()[0].capacity == 64);
+    REQUIRE(pool->GetFreeChunkCount() == (chunk_count - 1));
+}
+
+TEST_CASE("ChunkPool - unused chunks are freed", "[]")
+{
+    auto                          pool = std::make_shared<gfxrecon::util::ChunkPool>(256, 64);
+    gfxrecon::util::ChunkedBuffer first(pool);
+    gfxrecon::util::ChunkedBuffer second(pool);
+    std::vector<uint8_t>          data(64, 0x34);
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        first.WriteRecord(data.data(), data.size());
+        second.WriteRecord(data.data(), data.size());
+    }
+
+    const size_t first_chunk_count = first.GetChunks().size();
+    first.Clear();
+    REQUIRE(pool->GetFreeChunkCount() == first_chunk_count);
+
+    // Chunks in use by other buffers are not affected.
+    pool->FreeUnusedChunks();
+    REQUIRE(pool->GetFreeChunkCount() == 0);
+    REQUIRE(second.GetDataSize() == (8 * data.size()));
+
+    const size_t second_chunk_count = second.GetChunks().size();
+    second.Clear();
+    REQUIRE(pool->GetFreeChunkCount() == second_chunk_count);
+}
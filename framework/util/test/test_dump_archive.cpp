@@ -0,0 +1,276 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include <catch2/catch.hpp>
+#include "util/dump_archive.h"
+#include "util/logging.h"
+#include "util/platform.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using gfxrecon::util::DumpArchiveEntry;
+using gfxrecon::util::DumpArchiveEntryType;
+using gfxrecon::util::DumpArchiveImageEncoding;
+using gfxrecon::util::DumpArchiveImageInfo;
+using gfxrecon::util::DumpArchiveReader;
+using gfxrecon::util::DumpArchiveWriter;
+
+namespace
+{
+
+const char kArchiveFilename[]   = "test_dump_archive.gfxa";
+const char kTruncatedFilename[] = "test_dump_archive_truncated.gfxa";
+
+std::vector<uint8_t> MakeData(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(seed + (i * 7));
+    }
+    return data;
+}
+
+std::vector<uint8_t> ReadFile(const std::string& filename)
+{
+    std::vector<uint8_t> bytes;
+    FILE*                file = nullptr;
+
+    if (gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "rb") == 0)
+    {
+        uint8_t byte = 0;
+        while (gfxrecon::util::platform::FileRead(&byte, 1, file))
+        {
+            bytes.push_back(byte);
+        }
+        gfxrecon::util::platform::FileClose(file);
+    }
+
+    return bytes;
+}
+
+void WriteFile(const std::string& filename, const std::vector<uint8_t>& bytes, size_t size)
+{
+    FILE* file = nullptr;
+    REQUIRE(gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "wb") == 0);
+    REQUIRE(((size == 0) || gfxrecon::util::platform::FileWrite(bytes.data(), size, file)));
+    gfxrecon::util::platform::FileClose(file);
+}
+
+// Writes three buffers, one of which duplicates the content of the first, and an image.
+void WriteTestArchive(const std::vector<uint8_t>& first,
+                      const std::vector<uint8_t>& second,
+                      const std::vector<uint8_t>& texels,
+                      const DumpArchiveImageInfo& image_info)
+{
+    DumpArchiveWriter writer;
+    REQUIRE(writer.Open(kArchiveFilename));
+    REQUIRE(writer.AddBuffer("dir/buffer_0.bin", first.data(), first.size()));
+    REQUIRE(writer.AddBuffer("buffer_1.bin", second.data(), second.size()));
+    REQUIRE(writer.AddBuffer("buffer_2.bin", first.data(), first.size()));
+    REQUIRE(writer.AddImage("image_0.png", texels.data(), texels.size(), image_info));
+
+    REQUIRE(writer.GetEntryCount() == 4);
+    REQUIRE(writer.GetStoredSize() == (first.size() + second.size() + texels.size()));
+    REQUIRE(writer.GetDeduplicatedSize() == first.size());
+
+    writer.Close();
+}
+
+void CheckEntry(DumpArchiveReader& reader, const DumpArchiveEntry& entry, const std::vector<uint8_t>& expected)
+{
+    std::vector<uint8_t> data;
+    REQUIRE(reader.ReadEntryData(entry, &data));
+    REQUIRE(data == expected);
+}
+
+} // namespace
+
+TEST_CASE("DumpArchive - entries round trip through a closed archive", "[]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    const std::vector<uint8_t> first  = MakeData(1000, 1);
+    const std::vector<uint8_t> second = MakeData(333, 2);
+    const std::vector<uint8_t> texels = MakeData(4 * 8 * 8, 3);
+
+    DumpArchiveImageInfo image_info;
+    image_info.encoding       = DumpArchiveImageEncoding::kPng;
+    image_info.data_format    = gfxrecon::util::imagewriter::kFormat_RGBA;
+    image_info.width          = 8;
+    image_info.height         = 8;
+    image_info.row_pitch      = 32;
+    image_info.has_alpha      = true;
+    image_info.separate_alpha = true;
+
+    WriteTestArchive(first, second, texels, image_info);
+
+    DumpArchiveReader reader;
+    REQUIRE(reader.Open(kArchiveFilename));
+    REQUIRE(!reader.IsRecovered());
+
+    const std::vector<DumpArchiveEntry>& entries = reader.GetEntries();
+    REQUIRE(entries.size() == 4);
+
+    // Names are stored without their directory.
+    REQUIRE(entries[0].name == "buffer_0.bin");
+    REQUIRE(entries[1].name == "buffer_1.bin");
+    REQUIRE(entries[2].name == "buffer_2.bin");
+    REQUIRE(entries[3].name == "image_0.png");
+
+    REQUIRE(entries[0].type == DumpArchiveEntryType::kBuffer);
+    REQUIRE(entries[0].data_size == first.size());
+    REQUIRE(entries[2].data_offset == entries[0].data_offset);
+    REQUIRE(entries[2].data_hash == entries[0].data_hash);
+
+    CheckEntry(reader, entries[0], first);
+    CheckEntry(reader, entries[1], second);
+    CheckEntry(reader, entries[2], first);
+    CheckEntry(reader, entries[3], texels);
+
+    const DumpArchiveImageInfo& read_info = entries[3].image_info;
+    REQUIRE(entries[3].type == DumpArchiveEntryType::kImage);
+    REQUIRE(read_info.encoding == DumpArchiveImageEncoding::kPng);
+    REQUIRE(read_info.data_format == gfxrecon::util::imagewriter::kFormat_RGBA);
+    REQUIRE(read_info.width == 8);
+    REQUIRE(read_info.height == 8);
+    REQUIRE(read_info.depth == 1);
+    REQUIRE(read_info.row_pitch == 32);
+    REQUIRE(read_info.has_alpha);
+    REQUIRE(read_info.separate_alpha);
+
+    reader.Close();
+    std::remove(kArchiveFilename);
+
+    gfxrecon::util::Log::Release();
+}
+
+TEST_CASE("DumpArchive - entries are recovered from an archive that was not closed", "[]")
+{
+    gfxrecon::util::Log::Init(gfxrecon::util::Log::kErrorSeverity);
+
+    const std::vector<uint8_t> first  = MakeData(1000, 4);
+    const std::vector<uint8_t> second = MakeData(333, 5);
+    const std::vector<uint8_t> texels = MakeData(4 * 4 * 4, 6);
+
+    DumpArchiveImageInfo image_info;
+    image_info.data_format = gfxrecon::util::imagewriter::kFormat_BGRA;
+    image_info.width       = 4;
+    image_info.height      = 4;
+    image_info.row_pitch   = 16;
+
+    WriteTestArchive(first, second, texels, image_info);
+
+    const std::vector<uint8_t> archive = ReadFile(kArchiveFilename);
+    std::remove(kArchiveFilename);
+
+    // Locate the end of the entry records, which is where the index starts.
+    size_t records_end = 0;
+    {
+        DumpArchiveReader reader;
+        WriteFile(kTruncatedFilename, archive, archive.size());
+        REQUIRE(reader.Open(kTruncatedFilename));
+
+        const DumpArchiveEntry& last = reader.GetEntries().back();
+        records_end                  = static_cast<size_t>(last.data_offset + last.data_size);
+    }
+
+    REQUIRE(records_end < archive.size());
+
+    SECTION("all records were written")
+    {
+        WriteFile(kTruncatedFilename, archive, records_end);
+
+        DumpArchiveReader reader;
+        REQUIRE(reader.Open(kTruncatedFilename));
+        REQUIRE(reader.IsRecovered());
+
+        const std::vector<DumpArchiveEntry>& entries = reader.GetEntries();
+        REQUIRE(entries.size() == 4);
+        REQUIRE(entries[0].name == "buffer_0.bin");
+        REQUIRE(entries[3].name == "image_0.png");
+        REQUIRE(entries[3].type == DumpArchiveEntryType::kImage);
+        REQUIRE(entries[3].image_info.width == 4);
+        REQUIRE(entries[3].image_info.data_format == gfxrecon::util::imagewriter::kFormat_BGRA);
+
+        CheckEntry(reader, entries[0], first);
+        CheckEntry(reader, entries[1], second);
+        CheckEntry(reader, entries[2], first);
+        CheckEntry(reader, entries[3], texels);
+    }
+
+    SECTION("the index was partially written")
+    {
+        WriteFile(kTruncatedFilename, archive, records_end + 10);
+
+        DumpArchiveReader reader;
+        REQUIRE(reader.Open(kTruncatedFilename));
+        REQUIRE(reader.IsRecovered());
+        REQUIRE(reader.GetEntries().size() == 4);
+    }
+
+    SECTION("the last record was partially written")
+    {
+        // Cut the file within the image texels, and then within the image record header.
+        for (size_t size : { records_end - 1, records_end - texels.size() - 20 })
+        {
+            WriteFile(kTruncatedFilename, archive, size);
+
+            DumpArchiveReader reader;
+            REQUIRE(reader.Open(kTruncatedFilename));
+            REQUIRE(reader.IsRecovered());
+
+            const std::vector<DumpArchiveEntry>& entries = reader.GetEntries();
+            REQUIRE(entries.size() == 3);
+            CheckEntry(reader, entries[0], first);
+            CheckEntry(reader, entries[1], second);
+            CheckEntry(reader, entries[2], first);
+        }
+    }
+
+    SECTION("no record was written")
+    {
+        WriteFile(kTruncatedFilename, archive, 8);
+
+        DumpArchiveReader reader;
+        REQUIRE(reader.Open(kTruncatedFilename));
+        REQUIRE(reader.IsRecovered());
+        REQUIRE(reader.GetEntries().empty());
+    }
+
+    SECTION("the file is not an archive")
+    {
+        std::vector<uint8_t> bytes = archive;
+        bytes[0]                   = 0;
+        WriteFile(kTruncatedFilename, bytes, records_end);
+
+        DumpArchiveReader reader;
+        REQUIRE(!reader.Open(kTruncatedFilename));
+    }
+
+    std::remove(kTruncatedFilename);
+
+    gfxrecon::util::Log::Release();
+}
@@ -0,0 +1,164 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+#include "generated/generated_layer_func_table_names.h"
+#include "util/hash.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST_CASE("murmur3_128 - reference values", "[]")
+{
+    gfxrecon::util::hash::Hash128 empty = gfxrecon::util::hash::murmur3_128(nullptr, 0);
+    REQUIRE(empty.low == 0);
+    REQUIRE(empty.high == 0);
+
+    const char* text = "The quick brown fox jumps over the lazy dog";
+    auto        hash = gfxrecon::util::hash::murmur3_128(text, std::strlen(text));
+    REQUIRE(hash.low == 0xe34bbc7bbc071b6cULL);
+    REQUIRE(hash.high == 0x7a433ca9c49a9347ULL);
+}
+
+TEST_CASE("murmur3_128 - tail sizes and seeds", "[]")
+{
+    std::vector<uint8_t> data(64);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    // Every size, covering all tail lengths, must produce a distinct value.
+    std::vector<gfxrecon::util::hash::Hash128> hashes;
+    for (size_t size = 0; size <= data.size(); ++size)
+    {
+        auto hash = gfxrecon::util::hash::murmur3_128(data.data(), size);
+        for (const auto& previous : hashes)
+        {
+            REQUIRE(hash != previous);
+        }
+        hashes.push_back(hash);
+    }
+
+    REQUIRE(gfxrecon::util::hash::murmur3_128(data.data(), data.size(), 1) !=
+            gfxrecon::util::hash::murmur3_128(data.data(), data.size(), 0));
+}
+
+TEST_CASE("fnv1a_64 - reference values", "[]")
+{
+    static_assert(gfxrecon::util::hash::fnv1a_64("") == 0xcbf29ce484222325ULL, "fnv1a_64 must be constexpr");
+    REQUIRE(gfxrecon::util::hash::fnv1a_64("a") == 0xaf63dc4c8601ec8cULL);
+    REQUIRE(gfxrecon::util::hash::fnv1a_64("foobar") == 0x85944171f73967e8ULL);
+}
+
+TEST_CASE("perfect_hash_index - layer function table names map to their own slots", "[]")
+{
+    static_assert(gfxrecon::kVulkanFuncTableSeedCount == ((gfxrecon::kVulkanFuncTableSize + 1) / 2),
+                  "The layer function table must use one seed per two names");
+
+    std::set<std::string> names;
+    for (uint32_t i = 0; i < gfxrecon::kVulkanFuncTableSize; ++i)
+    {
+        // Look up a copy of the name, so the comparison is by content rather than by pointer.
+        const std::string name = gfxrecon::kVulkanFuncTableNames[i];
+        REQUIRE(names.insert(name).second);
+        REQUIRE(gfxrecon::GetVulkanFuncTableIndex(name.c_str()) == i);
+    }
+
+    for (const char* name : { "vkGetInstanceProcAddr",
+                              "vkGetDeviceProcAddr",
+                              "vk_layerGetPhysicalDeviceProcAddr",
+                              "vkCreateInstance",
+                              "vkCreateDevice",
+                              "vkQueueSubmit",
+                              "vkCmdDraw" })
+    {
+        REQUIRE(gfxrecon::GetVulkanFuncTableIndex(name) < gfxrecon::kVulkanFuncTableSize);
+    }
+}
+
+TEST_CASE("perfect_hash_index - unknown names are rejected by the layer function table", "[]")
+{
+    // Unknown names select an occupied slot, which is rejected by the name comparison.
+    for (const char* name : { "",
+                              "vk",
+                              "vkEnumerateInstanceVersion",
+                              "vkUnknownFunction",
+                              "vkCreateDeviceX",
+                              "vkCreateDevic",
+                              "vkcreatedevice",
+                              "CreateDevice" })
+    {
+        REQUIRE(gfxrecon::GetVulkanFuncTableIndex(name) == gfxrecon::kVulkanFuncTableSize);
+    }
+}
+
+// Startup lookup benchmark, comparing the perfect hash table used for the layer's GetInstanceProcAddr and
+// GetDeviceProcAddr with the previous std::unordered_map.  Hidden by default; run with the [benchmark] tag.
+TEST_CASE("perfect_hash_index - proc address lookup benchmark", "[.][benchmark]")
+{
+    constexpr uint32_t kIterations = 200;
+
+    std::vector<std::string> names(std::begin(gfxrecon::kVulkanFuncTableNames),
+                                   std::end(gfxrecon::kVulkanFuncTableNames));
+
+    std::unordered_map<std::string, size_t> map;
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+        map[names[i]] = i;
+    }
+
+    // Lookups are performed with const char* names, as provided to vkGet*ProcAddr.
+    size_t found      = 0;
+    auto   start_time = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kIterations; ++i)
+    {
+        for (const auto& name : names)
+        {
+            found += (map.find(name.c_str()) != map.end()) ? 1 : 0;
+        }
+    }
+    auto map_time = std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < kIterations; ++i)
+    {
+        for (const auto& name : names)
+        {
+            found += (gfxrecon::GetVulkanFuncTableIndex(name.c_str()) < gfxrecon::kVulkanFuncTableSize) ? 1 : 0;
+        }
+    }
+    auto table_time = std::chrono::steady_clock::now() - start_time;
+
+    REQUIRE(found == 2 * kIterations * names.size());
+
+    using nanoseconds = std::chrono::duration<double, std::nano>;
+
+    const double lookups  = static_cast<double>(kIterations * names.size());
+    const double map_ns   = std::chrono::duration_cast<nanoseconds>(map_time).count() / lookups;
+    const double table_ns = std::chrono::duration_cast<nanoseconds>(table_time).count() / lookups;
+    WARN("unordered_map: " << map_ns << " ns/lookup, perfect hash: " << table_ns << " ns/lookup");
+}
@@ -0,0 +1,143 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include <catch2/catch.hpp>
+#include "util/hash.h"
+#include "util/memory_hash_tracker.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using ModifiedRanges = std::vector<std::pair<size_t, size_t>>;
+
+static ModifiedRanges ProcessMemory(gfxrecon::util::MemoryHashTracker& tracker,
+                                    uint64_t                           memory_id,
+                                    const std::vector<uint8_t>&        data)
+{
+    ModifiedRanges ranges;
+    tracker.ProcessMemory(memory_id, data.data(), data.size(), [&ranges](uint64_t, size_t offset, size_t size) {
+        ranges.emplace_back(offset, size);
+    });
+    return ranges;
+}
+
+TEST_CASE("stripe_hash_64 - sizes and content", "[]")
+{
+    std::vector<uint8_t> data(1024);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+
+    // Sizes covering partial stripes and the accumulator scramble must produce distinct values.
+    std::vector<uint64_t> hashes;
+    for (size_t size = 0; size <= data.size(); size += 31)
+    {
+        uint64_t hash = gfxrecon::util::hash::stripe_hash_64(data.data(), size);
+        for (uint64_t previous : hashes)
+        {
+            REQUIRE(hash != previous);
+        }
+        hashes.push_back(hash);
+    }
+
+    // Trailing zero bytes are distinguished from the zero padding of the last stripe.
+    std::vector<uint8_t> zeros(65, 0);
+    REQUIRE(gfxrecon::util::hash::stripe_hash_64(zeros.data(), 64) !=
+            gfxrecon::util::hash::stripe_hash_64(zeros.data(), 65));
+
+    const uint64_t original = gfxrecon::util::hash::stripe_hash_64(data.data(), data.size());
+    data[1000] ^= 1;
+    REQUIRE(gfxrecon::util::hash::stripe_hash_64(data.data(), data.size()) != original);
+}
+
+TEST_CASE("MemoryHashTracker - reports modified blocks", "[]")
+{
+    const size_t                      block_size = 256;
+    gfxrecon::util::MemoryHashTracker tracker(block_size, 0);
+    std::vector<uint8_t>              data(block_size * 8 + 100, 0);
+
+    // The first call reports the entire region.
+    ModifiedRanges ranges = ProcessMemory(tracker, 1, data);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0] == std::pair<size_t, size_t>(0, data.size()));
+
+    REQUIRE(ProcessMemory(tracker, 1, data).empty());
+
+    // Consecutive modified blocks are merged, and the last block is clamped to the region size.
+    data[block_size + 1]     = 1;
+    data[block_size * 2 + 2] = 1;
+    data[block_size * 5]     = 1;
+    data[data.size() - 1]    = 1;
+    ranges                   = ProcessMemory(tracker, 1, data);
+    REQUIRE(ranges.size() == 3);
+    REQUIRE(ranges[0] == std::pair<size_t, size_t>(block_size, block_size * 2));
+    REQUIRE(ranges[1] == std::pair<size_t, size_t>(block_size * 5, block_size));
+    REQUIRE(ranges[2] == std::pair<size_t, size_t>(block_size * 8, 100));
+
+    // Removed memory is reported in full again.
+    tracker.RemoveMemory(1);
+    ranges = ProcessMemory(tracker, 1, data);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0].second == data.size());
+}
+
+TEST_CASE("MemoryHashTracker - clear reports all memory in full", "[]")
+{
+    const size_t                      block_size = 256;
+    gfxrecon::util::MemoryHashTracker tracker(block_size, 0);
+    std::vector<uint8_t>              first(block_size * 4, 1);
+    std::vector<uint8_t>              second(block_size * 2, 2);
+
+    ProcessMemory(tracker, 1, first);
+    ProcessMemory(tracker, 2, second);
+    REQUIRE(ProcessMemory(tracker, 1, first).empty());
+    REQUIRE(ProcessMemory(tracker, 2, second).empty());
+
+    tracker.Clear();
+
+    ModifiedRanges ranges = ProcessMemory(tracker, 1, first);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0] == std::pair<size_t, size_t>(0, first.size()));
+
+    ranges = ProcessMemory(tracker, 2, second);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0] == std::pair<size_t, size_t>(0, second.size()));
+}
+
+TEST_CASE("MemoryHashTracker - parallel hashing", "[]")
+{
+    gfxrecon::util::MemoryHashTracker tracker(gfxrecon::util::MemoryHashTracker::kDefaultBlockSize, 4);
+    std::vector<uint8_t>              data(gfxrecon::util::MemoryHashTracker::kParallelHashThreshold * 2, 0);
+
+    REQUIRE(ProcessMemory(tracker, 7, data).size() == 1);
+    REQUIRE(ProcessMemory(tracker, 7, data).empty());
+
+    const size_t offset = data.size() / 2 + 3;
+    data[offset]        = 0xff;
+
+    ModifiedRanges ranges = ProcessMemory(tracker, 7, data);
+    REQUIRE(ranges.size() == 1);
+    REQUIRE(ranges[0].first == (offset / gfxrecon::util::MemoryHashTracker::kDefaultBlockSize) *
+                                   gfxrecon::util::MemoryHashTracker::kDefaultBlockSize);
+    REQUIRE(ranges[0].second == gfxrecon::util::MemoryHashTracker::kDefaultBlockSize);
+}
@@ -306,12 +306,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance
     // the instance handle is null and we can't determine if it is available from the next level.
     if (has_implementation || (instance == VK_NULL_HANDLE))
     {
-        const auto entry = vulkan_func_table.find(pName);
-
-        if (entry != vulkan_func_table.end())
-        {
-            result = entry->second;
-        }
+        result = GetVulkanFuncTableEntry(pName);
     }
 
     // Lastly check custom GFXR exposed functions
@@ -360,11 +355,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
         // Only intercept the requested function if there is an implementation available
         if (has_implementation)
         {
-            const auto entry = vulkan_func_table.find(pName);
-            if (entry != vulkan_func_table.end())
-            {
-                result = entry->second;
-            }
+            result = GetVulkanFuncTableEntry(pName);
         }
     }
 
@@ -0,0 +1,204 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include PROJECT_VERSION_HEADER_FILE
+
+#include "util/argument_parser.h"
+#include "util/dump_archive.h"
+#include "util/file_path.h"
+#include "util/logging.h"
+
+#include <cinttypes>
+#include <cstdlib>
+#include <string>
+
+const char kHelpShortOption[]   = "-h";
+const char kHelpLongOption[]    = "--help";
+const char kVersionOption[]     = "--version";
+const char kListOption[]        = "--list";
+const char kNoDebugPopup[]      = "--no-debug-popup";
+const char kDirectoryArgument[] = "--dir";
+const char kFilterArgument[]    = "--filter";
+
+const char kOptions[]   = "-h|--help,--version,--list,--no-debug-popup";
+const char kArguments[] = "--dir,--filter";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - List or extract the entries of a dump resources archive.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--list] [--filter <text>] [--dir <dir>] <file>\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <file>\t\tThe archive written by gfxrecon-replay --dump-resources-archive.");
+    GFXRECON_WRITE_CONSOLE("Optional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --list\t\tPrint the name, size and content hash of each entry instead");
+    GFXRECON_WRITE_CONSOLE("        \t\tof extracting the entries.");
+    GFXRECON_WRITE_CONSOLE("  --filter <text>\tOnly process entries with names that contain <text>.");
+    GFXRECON_WRITE_CONSOLE("  --dir <dir>\t\tPlace extracted files into directory <dir>. Otherwise use");
+    GFXRECON_WRITE_CONSOLE("             \t\tthe archive file name without extension in the working");
+    GFXRECON_WRITE_CONSOLE("             \t\tdirectory. Create directory if necessary. Images are encoded");
+    GFXRECON_WRITE_CONSOLE("             \t\twith the image format that was selected for the dump.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+
+        return true;
+    }
+
+    return false;
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 1))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+    const std::string&              input_filename       = positional_arguments[0];
+    const std::string               filter               = arg_parser.GetArgumentValue(kFilterArgument);
+    gfxrecon::util::DumpArchiveReader archive;
+
+    if (!archive.Open(input_filename))
+    {
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    int return_code = 0;
+
+    if (arg_parser.IsOptionSet(kListOption))
+    {
+        for (const auto& entry : archive.GetEntries())
+        {
+            if (filter.empty() || (entry.name.find(filter) != std::string::npos))
+            {
+                GFXRECON_WRITE_CONSOLE("%016" PRIx64 "%016" PRIx64 " %12" PRIu64 " %s",
+                                       entry.data_hash.high,
+                                       entry.data_hash.low,
+                                       entry.data_size,
+                                       entry.name.c_str());
+            }
+        }
+    }
+    else
+    {
+        std::string extract_dir = arg_parser.GetArgumentValue(kDirectoryArgument);
+
+        // If no directory argument, use the archive file name, minus path and extension.
+        if (extract_dir.empty())
+        {
+            extract_dir = gfxrecon::util::filepath::GetFilenameStem(input_filename);
+        }
+
+        if (gfxrecon::util::filepath::Exists(extract_dir))
+        {
+            if (!gfxrecon::util::filepath::IsDirectory(extract_dir))
+            {
+                GFXRECON_WRITE_CONSOLE("Error while creating directory %s: Already exists as file",
+                                       extract_dir.c_str());
+                gfxrecon::util::Log::Release();
+                exit(-1);
+            }
+        }
+        else if (!gfxrecon::util::filepath::MakeDirectory(extract_dir))
+        {
+            GFXRECON_WRITE_CONSOLE("Error while creating directory %s: Could not open", extract_dir.c_str());
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        for (const auto& entry : archive.GetEntries())
+        {
+            if ((filter.empty() || (entry.name.find(filter) != std::string::npos)) &&
+                !archive.ExtractEntry(entry, extract_dir))
+            {
+                GFXRECON_WRITE_CONSOLE("Error while extracting %s", entry.name.c_str());
+                return_code = -1;
+            }
+        }
+    }
+
+    archive.Close();
+
+    gfxrecon::util::Log::Release();
+    return return_code;
+}
@@ -25,7 +25,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|convert|extract|info|optimize|replay] [<args>]
+#     gfxrecon.py [capture|compress|convert|dump-archive|extract|info|optimize|replay] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -47,6 +47,7 @@ valid_commands = [
     'capture-vulkan',
     'compress',
     'convert',
+    'dump-archive',
     'extract',
     'info',
     'optimize',
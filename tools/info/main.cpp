@@ -50,12 +50,16 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <cstdlib>
 #include <limits>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -66,13 +70,20 @@ const char kNoDebugPopup[]      = "--no-debug-popup";
 const char kExeInfoOnlyOption[] = "--exe-info-only";
 const char kEnvVarsOnlyOption[] = "--env-vars-only";
 const char kEnumGpuIndices[]    = "--enum-gpu-indices";
+const char kBlockStatsOption[]  = "--block-stats";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices";
+const char kOptions[] =
+    "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices,--block-stats";
 
 const char kUnrecognizedFormatString[] = "<unrecognized-format>";
 
 const int kDefaultIndent = 12;
 
+const size_t kMaxBlockStatsEntries = 20;
+
+typedef std::unordered_map<uint32_t, gfxrecon::decode::FileProcessor::BlockScanCount> BlockScanCountMap;
+typedef std::pair<uint32_t, gfxrecon::decode::FileProcessor::BlockScanCount>           BlockScanCountEntry;
+
 struct AnnotationInfo
 {
     std::string desc;
@@ -128,6 +139,33 @@ std::string AdapterTypeToString(gfxrecon::format::AdapterType type)
     }
 }
 
+std::string BlockTypeToString(uint32_t type)
+{
+    switch (type)
+    {
+        case gfxrecon::format::BlockType::kFrameMarkerBlock:
+            return "Frame marker";
+        case gfxrecon::format::BlockType::kStateMarkerBlock:
+            return "State marker";
+        case gfxrecon::format::BlockType::kMetaDataBlock:
+            return "Meta-data";
+        case gfxrecon::format::BlockType::kFunctionCallBlock:
+            return "Function call";
+        case gfxrecon::format::BlockType::kAnnotation:
+            return "Annotation";
+        case gfxrecon::format::BlockType::kMethodCallBlock:
+            return "Method call";
+        case gfxrecon::format::BlockType::kCompressedMetaDataBlock:
+            return "Compressed meta-data";
+        case gfxrecon::format::BlockType::kCompressedFunctionCallBlock:
+            return "Compressed function call";
+        case gfxrecon::format::BlockType::kCompressedMethodCallBlock:
+            return "Compressed method call";
+        default:
+            return "Unknown block type " + std::to_string(type);
+    }
+}
+
 static void PrintUsage(const char* exe_name)
 {
     std::string app_name     = exe_name;
@@ -138,7 +176,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--exe-info-only] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--exe-info-only] [--block-stats] <file>\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
@@ -147,6 +186,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --exe-info-only\tQuickly exit after extracting captured application's executable name");
     GFXRECON_WRITE_CONSOLE(
         "  --env-vars-only\tQuickly exit after extracting captured application's environment variables");
+    GFXRECON_WRITE_CONSOLE("  --block-stats\t\tPrint block, API call, and meta-data counts and sizes, gathered from");
+    GFXRECON_WRITE_CONSOLE("        \t\tthe block headers without decoding the capture file.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -757,6 +798,91 @@ void GatherAndPrintEnvVars(const std::string& input_filename)
     }
 }
 
+// Prints the entries with the largest total size, with names formed from the prefix and the hexadecimal ID.
+void PrintBlockScanCounts(const char* title, const char* name_prefix, const BlockScanCountMap& counts)
+{
+    std::vector<BlockScanCountEntry> entries(counts.begin(), counts.end());
+    std::sort(entries.begin(), entries.end(), [](const BlockScanCountEntry& lhs, const BlockScanCountEntry& rhs) {
+        return (lhs.second.bytes != rhs.second.bytes) ? (lhs.second.bytes > rhs.second.bytes) : (lhs.first < rhs.first);
+    });
+
+    GFXRECON_WRITE_CONSOLE("");
+    GFXRECON_WRITE_CONSOLE("%s (%" PRIu64 " total, sorted by size):", title, static_cast<uint64_t>(entries.size()));
+
+    const size_t entry_count = std::min(entries.size(), kMaxBlockStatsEntries);
+    for (size_t i = 0; i < entry_count; ++i)
+    {
+        GFXRECON_WRITE_CONSOLE("\t%s0x%08x: %" PRIu64 " blocks, %" PRIu64 " bytes",
+                               name_prefix,
+                               entries[i].first,
+                               entries[i].second.count,
+                               entries[i].second.bytes);
+    }
+
+    if (entries.size() > entry_count)
+    {
+        GFXRECON_WRITE_CONSOLE("\t... %" PRIu64 " more", static_cast<uint64_t>(entries.size() - entry_count));
+    }
+}
+
+// A fast pass that only reads the block headers, for statistics that do not require decoding.
+void GatherAndPrintBlockStats(const std::string& input_filename)
+{
+    gfxrecon::decode::FileProcessor                  file_processor;
+    gfxrecon::decode::FileProcessor::BlockScanResult scan_result;
+
+    if (!file_processor.Initialize(input_filename) || !file_processor.ScanBlocks(&scan_result))
+    {
+        GFXRECON_WRITE_CONSOLE("Encountered error while reading capture. Block stats unavailable.");
+        return;
+    }
+
+    gfxrecon::format::CompressionType compression_type = gfxrecon::format::CompressionType::kNone;
+    for (const auto& option : file_processor.GetFileOptions())
+    {
+        if (option.key == gfxrecon::format::FileOption::kCompressionType)
+        {
+            compression_type = static_cast<gfxrecon::format::CompressionType>(option.value);
+        }
+    }
+
+    std::string compression_type_name = gfxrecon::format::GetCompressionTypeName(compression_type);
+
+    GFXRECON_WRITE_CONSOLE("File info:");
+    GFXRECON_WRITE_CONSOLE("\tCompression format: %s",
+                           compression_type_name.empty() ? kUnrecognizedFormatString : compression_type_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\tTotal frames: %" PRIu64 "%s",
+                           static_cast<uint64_t>(scan_result.frame_end_offsets.size()),
+                           scan_result.uses_frame_markers ? " (frame markers)" : "");
+    GFXRECON_WRITE_CONSOLE("\tTrimmed state snapshot: %s", (scan_result.state_end_offset != 0) ? "yes" : "no");
+    GFXRECON_WRITE_CONSOLE("\tTotal blocks: %" PRIu64, scan_result.block_count);
+    GFXRECON_WRITE_CONSOLE("\tFile size: %" PRIu64 " bytes", scan_result.file_size);
+
+    if (scan_result.blocks_end_offset < scan_result.file_size)
+    {
+        GFXRECON_WRITE_CONSOLE("\tIncomplete trailing data: %" PRIu64 " bytes",
+                               scan_result.file_size - scan_result.blocks_end_offset);
+    }
+
+    std::vector<BlockScanCountEntry> block_types(scan_result.block_types.begin(), scan_result.block_types.end());
+    std::sort(block_types.begin(),
+              block_types.end(),
+              [](const BlockScanCountEntry& lhs, const BlockScanCountEntry& rhs) { return lhs.first < rhs.first; });
+
+    GFXRECON_WRITE_CONSOLE("");
+    GFXRECON_WRITE_CONSOLE("Block types:");
+    for (const auto& entry : block_types)
+    {
+        GFXRECON_WRITE_CONSOLE("\t%s: %" PRIu64 " blocks, %" PRIu64 " bytes",
+                               BlockTypeToString(entry.first).c_str(),
+                               entry.second.count,
+                               entry.second.bytes);
+    }
+
+    PrintBlockScanCounts("API calls", "ApiCall_", scan_result.api_calls);
+    PrintBlockScanCounts("Meta-data commands", "MetaData_", scan_result.meta_data);
+}
+
 void GatherAndPrintAllInfo(const std::string& input_filename)
 {
     gfxrecon::decode::FileProcessor file_processor;
@@ -893,6 +1019,10 @@ int main(int argc, const char** argv)
     {
         GatherAndPrintEnvVars(input_filename);
     }
+    else if (arg_parser.IsOptionSet(kBlockStatsOption))
+    {
+        GatherAndPrintBlockStats(input_filename);
+    }
     else
     {
         GatherAndPrintAllInfo(input_filename);
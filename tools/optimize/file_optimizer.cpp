@@ -28,10 +28,17 @@
 #include "util/platform.h"
 
 #include <cassert>
+#include <cstring>
 #include <string>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+static void AppendCommandData(const void* data, size_t size, std::vector<uint8_t>* command_data)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    command_data->insert(command_data->end(), bytes, bytes + size);
+}
+
 FileOptimizer::FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids) :
     unreferenced_ids_(unreferenced_ids)
 {}
@@ -61,6 +68,14 @@ bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, for
     {
         return FilterInitImageMetaData(block_header, meta_data_id);
     }
+    else if (deduplicate_data_ && (meta_data_type == format::MetaDataType::kFillMemoryCommand))
+    {
+        return DeduplicateFillMemoryMetaData(block_header, meta_data_id);
+    }
+    else if (deduplicate_data_ && (meta_data_type == format::MetaDataType::kDataReferenceCommand))
+    {
+        return DeduplicateDataReference(block_header);
+    }
     else
     {
         // Copy the meta data block, if it was not filtered.
@@ -133,6 +148,16 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
                 return false;
             }
         }
+        else if (deduplicate_data_ && (header.data_size >= kMinDeduplicatedDataSize))
+        {
+            command_data_.clear();
+            AppendCommandData(&header.device_id, sizeof(header.device_id), &command_data_);
+            AppendCommandData(&header.buffer_id, sizeof(header.buffer_id), &command_data_);
+            AppendCommandData(&header.data_size, sizeof(header.data_size), &command_data_);
+
+            return DeduplicateCommandData(
+                block_header, meta_data_id, header.thread_id, command_data_, header.data_size);
+        }
         else
         {
             // Copy the block from the input file to the output file.
@@ -214,6 +239,29 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
                 return false;
             }
         }
+        else if (deduplicate_data_ && (header.data_size >= kMinDeduplicatedDataSize))
+        {
+            command_data_.clear();
+            AppendCommandData(&header.device_id, sizeof(header.device_id), &command_data_);
+            AppendCommandData(&header.image_id, sizeof(header.image_id), &command_data_);
+            AppendCommandData(&header.data_size, sizeof(header.data_size), &command_data_);
+            AppendCommandData(&header.aspect, sizeof(header.aspect), &command_data_);
+            AppendCommandData(&header.layout, sizeof(header.layout), &command_data_);
+            AppendCommandData(&header.level_count, sizeof(header.level_count), &command_data_);
+
+            // The mip level sizes are part of the command, not of the deduplicated data.
+            size_t level_sizes_size = header.level_count * sizeof(uint64_t);
+            size_t level_sizes_pos  = command_data_.size();
+            command_data_.resize(level_sizes_pos + level_sizes_size);
+            if ((level_sizes_size > 0) && !ReadBytes(command_data_.data() + level_sizes_pos, level_sizes_size))
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to read init image data meta-data block data");
+                return false;
+            }
+
+            return DeduplicateCommandData(
+                block_header, meta_data_id, header.thread_id, command_data_, header.data_size);
+        }
         else
         {
             // Copy the block from the input file to the output file.
@@ -272,4 +320,215 @@ bool FileOptimizer::FilterMethodCall(const format::BlockHeader& block_header,
     return true;
 }
 
+bool FileOptimizer::DeduplicateFillMemoryMetaData(const format::BlockHeader& block_header,
+                                                  format::MetaDataId         meta_data_id)
+{
+    GFXRECON_ASSERT(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
+
+    format::FillMemoryCommandHeader header;
+
+    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+    success      = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
+    success      = success && ReadBytes(&header.memory_offset, sizeof(header.memory_offset));
+    success      = success && ReadBytes(&header.memory_size, sizeof(header.memory_size));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
+        return false;
+    }
+
+    if (header.memory_size < kMinDeduplicatedDataSize)
+    {
+        header.meta_header.block_header = block_header;
+        header.meta_header.meta_data_id = meta_data_id;
+
+        if (!WriteBytes(&header, sizeof(header)))
+        {
+            HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write fill memory meta-data block header");
+            return false;
+        }
+
+        if (!CopyBytes(block_header.size - (sizeof(header) - sizeof(block_header))))
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy fill memory meta-data block data");
+            return false;
+        }
+
+        return true;
+    }
+
+    command_data_.clear();
+    AppendCommandData(&header.memory_id, sizeof(header.memory_id), &command_data_);
+    AppendCommandData(&header.memory_offset, sizeof(header.memory_offset), &command_data_);
+    AppendCommandData(&header.memory_size, sizeof(header.memory_size), &command_data_);
+
+    return DeduplicateCommandData(block_header, meta_data_id, header.thread_id, command_data_, header.memory_size);
+}
+
+bool FileOptimizer::DeduplicateDataReference(const format::BlockHeader& block_header)
+{
+    // References from an earlier pass point into the input file, so they are resolved and deduplicated again against
+    // the data of the output file.
+    format::DataReferenceCommandHeader header;
+
+    if (!ReadDataReference(block_header, &header, &command_data_))
+    {
+        return false;
+    }
+
+    return WriteDeduplicatedCommand(
+        header.command_id, header.thread_id, command_data_, header.data_size, header.data_size, false);
+}
+
+bool FileOptimizer::DeduplicateCommandData(const format::BlockHeader&  block_header,
+                                           format::MetaDataId          meta_data_id,
+                                           format::ThreadId            thread_id,
+                                           const std::vector<uint8_t>& command_data,
+                                           uint64_t                    data_size)
+{
+    // The resource data makes up the rest of the block.
+    uint64_t stored_size = block_header.size - sizeof(meta_data_id) - sizeof(thread_id) - command_data.size();
+    bool     compressed  = format::IsBlockCompressed(block_header.type);
+    bool     success     = false;
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, stored_size);
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_size);
+
+    if (compressed)
+    {
+        size_t uncompressed_size = 0;
+        success                  = ReadCompressedParameterBuffer(
+            static_cast<size_t>(stored_size), static_cast<size_t>(data_size), &uncompressed_size);
+    }
+    else
+    {
+        success = (stored_size == data_size) && ReadParameterBuffer(static_cast<size_t>(stored_size));
+    }
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read resource data meta-data block data");
+        return false;
+    }
+
+    return WriteDeduplicatedCommand(meta_data_id, thread_id, command_data, data_size, stored_size, compressed);
+}
+
+bool FileOptimizer::WriteDeduplicatedCommand(format::MetaDataId          meta_data_id,
+                                             format::ThreadId            thread_id,
+                                             const std::vector<uint8_t>& command_data,
+                                             uint64_t                    data_size,
+                                             uint64_t                    stored_size,
+                                             bool                        compressed)
+{
+    const std::vector<uint8_t>& data = GetParameterBuffer();
+    util::hash::Hash128         hash = util::hash::murmur3_128(data.data(), static_cast<size_t>(data_size));
+    auto                        entry = written_data_.find(hash);
+    bool                        match = false;
+
+    if ((entry != written_data_.end()) && (entry->second.data_size == data_size))
+    {
+        if (!MatchesWrittenData(entry->second, data_size, &match))
+        {
+            HandleBlockWriteError(kErrorReadingFile, "Failed to read resource data back from the output file");
+            return false;
+        }
+    }
+
+    if (match)
+    {
+        format::DataReferenceCommandHeader reference;
+        reference.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        reference.meta_header.block_header.size =
+            (sizeof(reference) - sizeof(reference.meta_header.block_header)) + command_data.size();
+        reference.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::GetMetaDataApi(meta_data_id), format::MetaDataType::kDataReferenceCommand);
+        reference.thread_id   = thread_id;
+        reference.command_id  = meta_data_id;
+        reference.data_offset = entry->second.data_offset;
+        reference.stored_size = entry->second.stored_size;
+        reference.data_size   = entry->second.data_size;
+        reference.compressed  = entry->second.compressed ? 1 : 0;
+
+        if (!WriteBytes(&reference, sizeof(reference)) || !WriteBytes(command_data.data(), command_data.size()))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write data reference meta-data block");
+            return false;
+        }
+
+        ++deduplicated_block_count_;
+        deduplicated_data_size_ += stored_size;
+        return true;
+    }
+
+    format::BlockHeader block_header;
+    block_header.type = compressed ? format::BlockType::kCompressedMetaDataBlock : format::BlockType::kMetaDataBlock;
+    block_header.size = sizeof(meta_data_id) + sizeof(thread_id) + command_data.size() + stored_size;
+
+    bool success = WriteBlockHeader(block_header);
+    success      = success && WriteBytes(&meta_data_id, sizeof(meta_data_id));
+    success      = success && WriteBytes(&thread_id, sizeof(thread_id));
+    success      = success && WriteBytes(command_data.data(), command_data.size());
+
+    if (success)
+    {
+        WrittenData written;
+        written.data_offset = static_cast<int64_t>(GetNumBytesWritten());
+        written.stored_size = stored_size;
+        written.data_size   = data_size;
+        written.compressed  = compressed;
+
+        const std::vector<uint8_t>& stored_data = compressed ? GetCompressedParameterBuffer() : data;
+        success = WriteBytes(stored_data.data(), static_cast<size_t>(stored_size));
+
+        if (success)
+        {
+            written_data_.emplace(hash, written);
+        }
+    }
+
+    if (!success)
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write resource data meta-data block");
+    }
+
+    return success;
+}
+
+bool FileOptimizer::MatchesWrittenData(const WrittenData& written, uint64_t data_size, bool* matches)
+{
+    assert(matches != nullptr);
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, written.stored_size);
+
+    size_t stored_size = static_cast<size_t>(written.stored_size);
+    size_t size        = static_cast<size_t>(data_size);
+
+    written_stored_data_.resize(stored_size);
+    if (!ReadOutputBytes(static_cast<uint64_t>(written.data_offset), written_stored_data_.data(), stored_size))
+    {
+        return false;
+    }
+
+    const std::vector<uint8_t>* written_data = &written_stored_data_;
+
+    if (written.compressed)
+    {
+        written_uncompressed_data_.resize(size);
+        if ((GetCompressor() == nullptr) ||
+            (GetCompressor()->Decompress(stored_size, written_stored_data_, size, &written_uncompressed_data_) != size))
+        {
+            return false;
+        }
+
+        written_data = &written_uncompressed_data_;
+    }
+
+    (*matches) =
+        (written_data->size() >= size) && (memcmp(written_data->data(), GetParameterBuffer().data(), size) == 0);
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
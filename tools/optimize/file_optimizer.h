@@ -25,8 +25,11 @@
 
 #include "decode/file_transformer.h"
 #include "util/defines.h"
+#include "util/hash.h"
 
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
@@ -43,6 +46,13 @@ class FileOptimizer : public decode::FileTransformer
 
     uint64_t GetUnreferencedBlocksSize();
 
+    // Replace resource data that repeats data written earlier in the file with references to the first copy.
+    void SetDeduplicateData(bool deduplicate_data) { deduplicate_data_ = deduplicate_data; }
+
+    uint64_t GetDeduplicatedBlockCount() const { return deduplicated_block_count_; }
+
+    uint64_t GetDeduplicatedDataSize() const { return deduplicated_data_size_; }
+
   protected:
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
@@ -50,6 +60,15 @@ class FileOptimizer : public decode::FileTransformer
                                    format::ApiCallId          call_id,
                                    uint64_t                   block_index = 0) override;
 
+  private:
+    struct WrittenData
+    {
+        int64_t  data_offset{ 0 };
+        uint64_t stored_size{ 0 };
+        uint64_t data_size{ 0 };
+        bool     compressed{ false };
+    };
+
   private:
     bool FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
@@ -57,9 +76,46 @@ class FileOptimizer : public decode::FileTransformer
 
     bool FilterMethodCall(const format::BlockHeader& block_header, format::ApiCallId api_call_id, uint64_t block_index);
 
+    bool DeduplicateFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool DeduplicateDataReference(const format::BlockHeader& block_header);
+
+    // Reads the resource data that follows the command fields of the current block into the parameter buffer and
+    // writes it with WriteDeduplicatedCommand.
+    bool DeduplicateCommandData(const format::BlockHeader&  block_header,
+                                format::MetaDataId          meta_data_id,
+                                format::ThreadId            thread_id,
+                                const std::vector<uint8_t>& command_data,
+                                uint64_t                    data_size);
+
+    // Writes a command whose resource data is in the parameter buffer, and its compressed form in the compressed
+    // parameter buffer when compressed is true.  The command is written as a kDataReferenceCommand block if the same
+    // data was written before.
+    bool WriteDeduplicatedCommand(format::MetaDataId          meta_data_id,
+                                  format::ThreadId            thread_id,
+                                  const std::vector<uint8_t>& command_data,
+                                  uint64_t                    data_size,
+                                  uint64_t                    stored_size,
+                                  bool                        compressed);
+
+    // Compares the resource data in the parameter buffer with the data that was written to the output file for a
+    // previous block with the same hash, so that a hash collision is never written as a data reference.
+    bool MatchesWrittenData(const WrittenData& written, uint64_t data_size, bool* matches);
+
   private:
+    // Resource data smaller than this is always written inline, as a reference block would not be much smaller.
+    static constexpr uint64_t kMinDeduplicatedDataSize = 256;
+
     std::unordered_set<format::HandleId> unreferenced_ids_;
     std::unordered_set<uint64_t>         unreferenced_blocks_;
+    bool                                 deduplicate_data_{ false };
+    uint64_t                             deduplicated_block_count_{ 0 };
+    uint64_t                             deduplicated_data_size_{ 0 };
+    std::vector<uint8_t>                 command_data_;
+    std::vector<uint8_t>                 written_stored_data_;
+    std::vector<uint8_t>                 written_uncompressed_data_;
+
+    std::unordered_map<util::hash::Hash128, WrittenData, util::hash::Hash128Hasher> written_data_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -60,12 +60,14 @@ extern "C"
 }
 #endif
 
-const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--d3d12-pso-removal,--dxr,--dxr-experimental";
+const char kOptions[] =
+    "-h|--help,--version,--no-debug-popup,--d3d12-pso-removal,--dxr,--dxr-experimental,--dedup-data";
 const char kArguments[] = "--gpu";
 
 const char kD3d12PsoRemoval[]             = "--d3d12-pso-removal";
 const char kDx12OptimizeDxr[]             = "--dxr";
 const char kDx12OptimizeDxrExperimental[] = "--dxr-experimental";
+const char kDeduplicateData[]             = "--dedup-data";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -84,7 +86,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("");
     GFXRECON_WRITE_CONSOLE("Usage:");
     GFXRECON_WRITE_CONSOLE(
-        "  %s [-h | --help] [--version] [--d3d12-pso-removal] [--dxr] [--gpu <index>] <input-file> <output-file>",
+        "  %s [-h | --help] [--version] [--d3d12-pso-removal] [--dxr] [--dedup-data] [--gpu <index>] <input-file> "
+        "<output-file>",
         app_name.c_str());
     GFXRECON_WRITE_CONSOLE("");
     GFXRECON_WRITE_CONSOLE("Required arguments:");
@@ -94,6 +97,10 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("Optional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --dedup-data\t\tVulkan-only: Replace buffer, image, and mapped memory data that");
+    GFXRECON_WRITE_CONSOLE("          \t\trepeats data written earlier in the file with references to");
+    GFXRECON_WRITE_CONSOLE("          \t\tthe first copy.  Files written with this option cannot be");
+    GFXRECON_WRITE_CONSOLE("          \t\treplayed by older versions of gfxrecon-replay.");
 #if defined(WIN32)
 #if defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -113,15 +120,30 @@ static void PrintUsage(const char* exe_name)
 #endif
 }
 
+// Decoder for the unreferenced resource scan, which only tracks object relationships.  Resource and memory content
+// blocks are reported as unsupported so that the file processor skips their data instead of reading and decompressing
+// it, which makes up most of the size of a trimmed capture.
+class ReferencedResourceDecoder : public gfxrecon::decode::VulkanDecoder
+{
+  public:
+    virtual bool SupportsMetaDataId(gfxrecon::format::MetaDataId meta_data_id) override
+    {
+        return VulkanDecoder::SupportsMetaDataId(meta_data_id) &&
+               !gfxrecon::decode::FileProcessor::IsResourceDataCommand(
+                   gfxrecon::format::GetMetaDataType(meta_data_id));
+    }
+};
+
 void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids,
+                              bool                                            deduplicate_data)
 {
     GFXRECON_ASSERT(unreferenced_ids != nullptr);
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder                    decoder;
+        ReferencedResourceDecoder                          decoder;
         gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
 
         decoder.AddConsumer(&resref_consumer);
@@ -129,7 +151,12 @@ void GetUnreferencedResources(const std::string&                              in
         file_processor.AddDecoder(&decoder);
         file_processor.ProcessAllFrames();
 
-        if (resref_consumer.WasNotOptimizable())
+        if (resref_consumer.WasNotOptimizable() && deduplicate_data)
+        {
+            // Data deduplication does not depend on trim state setup.
+            GFXRECON_WRITE_CONSOLE("File did not contain trim state setup - unused resources will not be removed");
+        }
+        else if (resref_consumer.WasNotOptimizable())
         {
             GFXRECON_WRITE_CONSOLE("File did not contain trim state setup - no optimization was performed");
             gfxrecon::util::Log::Release();
@@ -158,9 +185,12 @@ void GetUnreferencedResources(const std::string&                              in
 
 void FilterUnreferencedResources(const std::string&                               input_filename,
                                  const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids,
+                                 bool                                             deduplicate_data)
 {
     gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+    file_processor.SetDeduplicateData(deduplicate_data);
+
     if (file_processor.Initialize(input_filename, output_filename))
     {
         file_processor.Process();
@@ -175,21 +205,28 @@ void FilterUnreferencedResources(const std::string&
         GFXRECON_WRITE_CONSOLE("Resource filtering complete.");
         GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", file_processor.GetNumBytesRead());
         GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", file_processor.GetNumBytesWritten());
+
+        if (deduplicate_data)
+        {
+            GFXRECON_WRITE_CONSOLE("\tDeduplicated %" PRIu64 " resource data blocks, saving %" PRIu64 " bytes",
+                                   file_processor.GetDeduplicatedBlockCount(),
+                                   file_processor.GetDeduplicatedDataSize());
+        }
     }
 }
 
-void VkRemoveRedundantResources(std::string input_filename, std::string output_filename)
+void VkRemoveRedundantResources(std::string input_filename, std::string output_filename, bool deduplicate_data)
 {
     GFXRECON_WRITE_CONSOLE("Scanning Vulkan file %s for unreferenced resources.", input_filename.c_str());
     std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-    GetUnreferencedResources(input_filename, &unreferenced_ids);
+    GetUnreferencedResources(input_filename, &unreferenced_ids, deduplicate_data);
 
-    if (!unreferenced_ids.empty())
+    if (!unreferenced_ids.empty() || deduplicate_data)
     {
         // Filter unreferenced ids.
         GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64 " unused resources.",
                                unreferenced_ids.size());
-        FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+        FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids), deduplicate_data);
     }
     else
     {
@@ -254,6 +291,7 @@ int main(int argc, const char** argv)
         dx12_options.optimize_resource_values              = arg_parser.IsOptionSet(kDx12OptimizeDxr);
         dx12_options.optimize_resource_values_experimental = arg_parser.IsOptionSet(kDx12OptimizeDxrExperimental);
         dx12_options.remove_redundant_psos                 = arg_parser.IsOptionSet(kD3d12PsoRemoval);
+        bool deduplicate_data                              = arg_parser.IsOptionSet(kDeduplicateData);
         const auto& override_gpu                           = arg_parser.GetArgumentValue(kOverrideGpuArgument);
         if (!override_gpu.empty())
         {
@@ -288,7 +326,7 @@ int main(int argc, const char** argv)
             }
             else if (detected_vulkan)
             {
-                VkRemoveRedundantResources(input_filename, output_filename);
+                VkRemoveRedundantResources(input_filename, output_filename, deduplicate_data);
             }
             else
             {
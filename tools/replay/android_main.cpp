@@ -117,7 +117,8 @@ void android_main(struct android_app* app)
 
         try
         {
-            file_processor = arg_parser.IsOptionSet(kPreloadMeasurementRangeOption)
+            file_processor = (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption) ||
+                              (GetMeasurementRangeLoopCount(arg_parser) > 1))
                                  ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>()
                                  : std::make_unique<gfxrecon::decode::FileProcessor>();
 
@@ -176,12 +177,27 @@ void android_main(struct android_app* app)
                                                      replay_options.preload_measurement_range,
                                                      measurement_file_name,
                                                      quit_after_frame,
-                                                     quit_frame);
+                                                     quit_frame,
+                                                     arg_parser.GetArgumentValue(kFrameTimeFileArgument));
 
                 vulkan_replay_consumer.SetFatalErrorHandler(
                     [](const char* message) { throw std::runtime_error(message); });
                 vulkan_replay_consumer.SetFpsInfo(&fps_info);
 
+                if (replay_options.measurement_range_loop_count > 1)
+                {
+                    auto* preload_processor =
+                        dynamic_cast<gfxrecon::decode::PreloadFileProcessor*>(file_processor.get());
+                    GFXRECON_ASSERT(preload_processor != nullptr);
+
+                    fps_info.SetMeasurementLoopCount(replay_options.measurement_range_loop_count);
+                    preload_processor->SetReplayLoop(
+                        replay_options.measurement_range_loop_count,
+                        [&vulkan_replay_consumer](uint32_t iteration) {
+                            vulkan_replay_consumer.BeginReplayLoopIteration(iteration);
+                        });
+                }
+
                 vulkan_decoder.AddConsumer(&vulkan_replay_consumer);
 
                 file_processor->AddDecoder(&vulkan_decoder);
@@ -198,10 +214,19 @@ void android_main(struct android_app* app)
                 app->userData = application.get();
                 application->SetFpsInfo(&fps_info);
 
+                std::unique_ptr<gfxrecon::util::CallProfiler> cpu_profiler = CreateCpuProfiler(arg_parser);
+                file_processor->SetCallProfiler(cpu_profiler.get());
+
+                CreateReplayMemoryTracker(arg_parser);
+
                 fps_info.BeginFile();
 
                 application->Run();
 
+                file_processor->SetCallProfiler(nullptr);
+                WriteCpuProfile(arg_parser, cpu_profiler.get());
+                WriteReplayMemoryReport(arg_parser);
+
                 // Add one so that it matches the trim range frame number semantic
                 fps_info.EndFile(file_processor->GetCurrentFrameNumber() + 1);
 
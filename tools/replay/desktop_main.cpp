@@ -152,7 +152,7 @@ int main(int argc, const char** argv)
 
         std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor;
 
-        if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
+        if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption) || (GetMeasurementRangeLoopCount(arg_parser) > 1))
         {
             file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
         }
@@ -225,7 +225,8 @@ int main(int argc, const char** argv)
                                                  preload_measurement_frame_range,
                                                  measurement_file_name,
                                                  quit_after_frame,
-                                                 quit_frame);
+                                                 quit_frame,
+                                                 arg_parser.GetArgumentValue(kFrameTimeFileArgument));
 
             gfxrecon::decode::VulkanReplayConsumer vulkan_replay_consumer(application, vulkan_replay_options);
             gfxrecon::decode::VulkanDecoder        vulkan_decoder;
@@ -236,6 +237,20 @@ int main(int argc, const char** argv)
                     [](const char* message) { throw std::runtime_error(message); });
                 vulkan_replay_consumer.SetFpsInfo(&fps_info);
 
+                if (vulkan_replay_options.measurement_range_loop_count > 1)
+                {
+                    auto* preload_processor =
+                        dynamic_cast<gfxrecon::decode::PreloadFileProcessor*>(file_processor.get());
+                    GFXRECON_ASSERT(preload_processor != nullptr);
+
+                    fps_info.SetMeasurementLoopCount(vulkan_replay_options.measurement_range_loop_count);
+                    preload_processor->SetReplayLoop(
+                        vulkan_replay_options.measurement_range_loop_count,
+                        [&vulkan_replay_consumer](uint32_t iteration) {
+                            vulkan_replay_consumer.BeginReplayLoopIteration(iteration);
+                        });
+                }
+
                 vulkan_decoder.AddConsumer(&vulkan_replay_consumer);
                 file_processor->AddDecoder(&vulkan_decoder);
             }
@@ -305,12 +320,21 @@ int main(int argc, const char** argv)
             // Warn if the capture layer is active.
             CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
 
+            std::unique_ptr<gfxrecon::util::CallProfiler> cpu_profiler = CreateCpuProfiler(arg_parser);
+            file_processor->SetCallProfiler(cpu_profiler.get());
+
+            CreateReplayMemoryTracker(arg_parser);
+
             fps_info.BeginFile();
 
             application->SetPauseFrame(GetPauseFrame(arg_parser));
             application->SetFpsInfo(&fps_info);
             application->Run();
 
+            file_processor->SetCallProfiler(nullptr);
+            WriteCpuProfile(arg_parser, cpu_profiler.get());
+            WriteReplayMemoryReport(arg_parser);
+
             // XXX if the final frame ended with a Present, this would be the *next* frame
             // Add one so that it matches the trim range frame number semantic
             fps_info.EndFile(file_processor->GetCurrentFrameNumber() + 1);
@@ -36,7 +36,8 @@ const char kOptions[] =
     "--dump-resources-dump-depth-attachment,--dump-"
     "resources-dump-vertex-index-buffers,--dump-resources-json-output-per-command,--dump-resources-dump-immutable-"
     "resources,--dump-resources-dump-all-image-subresources,--dump-resources-dump-raw-images,--dump-resources-dump-"
-    "separate-alpha,--pbi-all,--preload-measurement-range, --add-new-pipeline-caches";
+    "separate-alpha,--dump-resources-archive,--dump-resources-skip-unchanged,--pbi-all,--preload-measurement-range, "
+    "--add-new-pipeline-caches";
 const char kArguments[] =
     "--log-level,--log-file,--gpu,--gpu-group,--pause-frame,--wsi,--surface-index,-m|--memory-translation,"
     "--replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
@@ -45,7 +46,8 @@ const char kArguments[] =
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
     "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs,--save-pipeline-cache,--load-"
-    "pipeline-cache,--quit-after-frame";
+    "pipeline-cache,--quit-after-frame,--cpu-profile-trace,--cpu-profile-histograms,--memory-report,--memory-soft-"
+    "limit,--frame-time-file,--loop-measurement-range";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -78,11 +80,14 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--offscreen-swapchain-frame-boundary]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--mfr|--measurement-frame-range <start-frame>-<end-frame>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--quit-after-measurement-range]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--frame-time-file <file>] [--loop-measurement-range <count>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--flush-measurement-range]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fw <width,height> | --force-windowed <width,height>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--cpu-profile-trace <file>] [--cpu-profile-histograms <file>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--memory-report <file>] [--memory-soft-limit <MiB>]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources <submit-index,command-index,drawcall-index>]");
 #endif
@@ -95,6 +100,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources-json-output-per-command]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources-dump-immutable-resources]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources-dump-all-image-subresources]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources-archive]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources-skip-unchanged]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--fwo <x,y> | --force-windowed-origin <x,y>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-debugview]");
@@ -167,6 +174,27 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --pbi-all\t\tPrint all block information.");
     GFXRECON_WRITE_CONSOLE(
         "  --pbis <index1,index2>\t\tPrint block information between block index1 and block index2.");
+    GFXRECON_WRITE_CONSOLE("  --cpu-profile-trace <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRecord CPU timings for the read, decompress, and decode/dispatch");
+    GFXRECON_WRITE_CONSOLE("          \t\tstages of every replayed block and write them to <file> in the");
+    GFXRECON_WRITE_CONSOLE("          \t\tChrome trace event format when replay ends. The most recent");
+    GFXRECON_WRITE_CONSOLE("          \t\t1048576 events per thread are kept. A summary of the most");
+    GFXRECON_WRITE_CONSOLE("          \t\texpensive API calls is printed to the console.");
+    GFXRECON_WRITE_CONSOLE("  --cpu-profile-histograms <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tRecord CPU timings as with --cpu-profile-trace and write per");
+    GFXRECON_WRITE_CONSOLE("          \t\tstage and API call ID duration statistics and histograms to");
+    GFXRECON_WRITE_CONSOLE("          \t\t<file> in JSON format when replay ends.");
+    GFXRECON_WRITE_CONSOLE("  --memory-report <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tTrack the host memory held by the decode arena, file buffers,");
+    GFXRECON_WRITE_CONSOLE("          \t\tpreload buffers, object info tables, resource staging, and");
+    GFXRECON_WRITE_CONSOLE("          \t\tdump resources readbacks, and write the overall and per frame");
+    GFXRECON_WRITE_CONSOLE("          \t\tpeaks to <file> in JSON format when replay ends. A summary is");
+    GFXRECON_WRITE_CONSOLE("          \t\tprinted to the console.");
+    GFXRECON_WRITE_CONSOLE("  --memory-soft-limit <MiB>");
+    GFXRECON_WRITE_CONSOLE("          \t\tTrack host memory as with --memory-report and, at the end of");
+    GFXRECON_WRITE_CONSOLE("          \t\tany frame where the decode arena and file read buffers hold");
+    GFXRECON_WRITE_CONSOLE("          \t\tmore than <MiB>, release them. They are not released again");
+    GFXRECON_WRITE_CONSOLE("          \t\tuntil a frame ends with them at or below 3/4 of <MiB>.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("Windows only:")
@@ -255,6 +283,21 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tWrite measurements to a file at the specified path.");
     GFXRECON_WRITE_CONSOLE("          \t\tDefault is: '/sdcard/gfxrecon-measurements.json' on android and");
     GFXRECON_WRITE_CONSOLE("          \t\t'./gfxrecon-measurements.json' on desktop.");
+    GFXRECON_WRITE_CONSOLE("  --frame-time-file <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite the duration of every measured frame to a file at the");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified path when replay ends. Files with a .csv extension");
+    GFXRECON_WRITE_CONSOLE("          \t\tcontain one frame per line; other files are written as JSON");
+    GFXRECON_WRITE_CONSOLE("          \t\tand also contain min/max/mean, p50/p90/p99/p99.9 and the");
+    GFXRECON_WRITE_CONSOLE("          \t\tlongest frames.");
+    GFXRECON_WRITE_CONSOLE("  --loop-measurement-range <count>");
+    GFXRECON_WRITE_CONSOLE("          \t\tPreload the measurement frame range into memory and replay it");
+    GFXRECON_WRITE_CONSOLE("          \t\t<count> times before continuing with the rest of the file.");
+    GFXRECON_WRITE_CONSOLE("          \t\tBefore each repeated iteration, replay waits for all devices");
+    GFXRECON_WRITE_CONSOLE("          \t\tto idle, restores fences to the status they had when the");
+    GFXRECON_WRITE_CONSOLE("          \t\trange started, offsets timeline semaphore values past the");
+    GFXRECON_WRITE_CONSOLE("          \t\tvalues reached by the previous iteration, and resets query");
+    GFXRECON_WRITE_CONSOLE("          \t\tpools. Measurements cover all iterations. The range should");
+    GFXRECON_WRITE_CONSOLE("          \t\tnot create objects that outlive it. Vulkan only.");
     GFXRECON_WRITE_CONSOLE("  --quit-after-measurement-range");
     GFXRECON_WRITE_CONSOLE("          \t\tIf this is specified the replayer will abort");
     GFXRECON_WRITE_CONSOLE("          \t\twhen it reaches the <end_frame> specified in");
@@ -328,6 +371,16 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tDump immutable shader resources.");
     GFXRECON_WRITE_CONSOLE("  --dump-resources-dump-all-image-subresources");
     GFXRECON_WRITE_CONSOLE("          \t\tDump all available mip levels and layers when dumping images.");
+    GFXRECON_WRITE_CONSOLE("  --dump-resources-archive");
+    GFXRECON_WRITE_CONSOLE("          \t\tStore dumped buffers and images in a single indexed archive file,");
+    GFXRECON_WRITE_CONSOLE("          \t\t<capture>_dr.gfxa, instead of one file per resource. Identical");
+    GFXRECON_WRITE_CONSOLE("          \t\tresources are stored once. Use gfxrecon-dump-archive to list or");
+    GFXRECON_WRITE_CONSOLE("          \t\textract the archive entries.");
+    GFXRECON_WRITE_CONSOLE("  --dump-resources-skip-unchanged");
+    GFXRECON_WRITE_CONSOLE("          \t\tHash the content of images and buffers on the GPU before reading");
+    GFXRECON_WRITE_CONSOLE("          \t\tthem back, and skip the readback and file output of resources that");
+    GFXRECON_WRITE_CONSOLE("          \t\tdid not change since they were last dumped. The json output");
+    GFXRECON_WRITE_CONSOLE("          \t\treferences the file written for the earlier dump.");
     GFXRECON_WRITE_CONSOLE("  --pipeline-creation-jobs <num_jobs>");
     GFXRECON_WRITE_CONSOLE("          \t\tSpecify the number of asynchronous pipeline-creation jobs as integer.");
     GFXRECON_WRITE_CONSOLE("          \t\tIf <num_jobs> is negative it will be added to the number of cpu-cores");
@@ -29,6 +29,7 @@
 #include "generated/generated_dx12_decoder.h"
 #endif
 #include "decode/file_processor.h"
+#include "decode/replay_memory_tracker.h"
 #include "decode/vulkan_default_allocator.h"
 #include "decode/vulkan_realign_allocator.h"
 #include "decode/vulkan_rebind_allocator.h"
@@ -38,6 +39,7 @@
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
+#include "util/call_profiler.h"
 #include "util/logging.h"
 #include "util/platform.h"
 #include "util/options.h"
@@ -47,6 +49,7 @@
 
 #include <cstdlib>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -103,6 +106,7 @@ const char kForceWindowWithOriginLongArgument[]  = "--force-windowed-origin";
 const char kOutput[]                             = "--output";
 const char kMeasurementRangeArgument[]           = "--measurement-frame-range";
 const char kMeasurementFileArgument[]            = "--measurement-file";
+const char kFrameTimeFileArgument[]              = "--frame-time-file";
 const char kQuitAfterMeasurementRangeOption[]    = "--quit-after-measurement-range";
 const char kQuitAfterFrameArgument[]             = "--quit-after-frame";
 const char kFlushMeasurementRangeOption[]        = "--flush-measurement-range";
@@ -125,9 +129,14 @@ const char kPrintBlockInfoAllOption[]             = "--pbi-all";
 const char kPrintBlockInfosArgument[]             = "--pbis";
 const char kNumPipelineCreationJobs[]             = "--pipeline-creation-jobs";
 const char kPreloadMeasurementRangeOption[]       = "--preload-measurement-range";
+const char kLoopMeasurementRangeArgument[]        = "--loop-measurement-range";
 const char kSavePipelineCacheArgument[]           = "--save-pipeline-cache";
 const char kLoadPipelineCacheArgument[]           = "--load-pipeline-cache";
 const char kCreateNewPipelineCacheOption[]        = "--add-new-pipeline-caches";
+const char kCpuProfileTraceArgument[]             = "--cpu-profile-trace";
+const char kCpuProfileHistogramsArgument[]        = "--cpu-profile-histograms";
+const char kMemoryReportArgument[]                = "--memory-report";
+const char kMemorySoftLimitArgument[]             = "--memory-soft-limit";
 #if defined(WIN32)
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
 const char kDxOverrideObjectNames[]       = "--dx12-override-object-names";
@@ -147,6 +156,8 @@ const char kDumpResourcesDumpImmutableResources[] = "--dump-resources-dump-immut
 const char kDumpResourcesDumpImageSubresources[]  = "--dump-resources-dump-all-image-subresources";
 const char kDumpResourcesDumpRawImages[]          = "--dump-resources-dump-raw-images";
 const char kDumpResourcesDumpSeparateAlpha[]      = "--dump-resources-dump-separate-alpha";
+const char kDumpResourcesArchive[]                = "--dump-resources-archive";
+const char kDumpResourcesSkipUnchanged[]          = "--dump-resources-skip-unchanged";
 
 enum class WsiPlatform
 {
@@ -510,6 +521,88 @@ static void GetMeasurementFilename(const gfxrecon::util::ArgumentParser& arg_par
     }
 }
 
+static std::unique_ptr<gfxrecon::util::CallProfiler> CreateCpuProfiler(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsArgumentSet(kCpuProfileTraceArgument))
+    {
+        return std::make_unique<gfxrecon::util::CallProfiler>(gfxrecon::decode::FileProcessor::GetProfilerStageNames());
+    }
+    else if (arg_parser.IsArgumentSet(kCpuProfileHistogramsArgument))
+    {
+        // Histograms only need the per call statistics, so no event ring buffers are allocated.
+        return std::make_unique<gfxrecon::util::CallProfiler>(gfxrecon::decode::FileProcessor::GetProfilerStageNames(),
+                                                              0);
+    }
+
+    return nullptr;
+}
+
+static void WriteCpuProfile(const gfxrecon::util::ArgumentParser& arg_parser,
+                            const gfxrecon::util::CallProfiler*   profiler)
+{
+    const size_t kSummaryEntries = 20;
+
+    if (profiler != nullptr)
+    {
+        const std::string& trace_file     = arg_parser.GetArgumentValue(kCpuProfileTraceArgument);
+        const std::string& histogram_file = arg_parser.GetArgumentValue(kCpuProfileHistogramsArgument);
+
+        if (!trace_file.empty())
+        {
+            profiler->WriteChromeTrace(trace_file, gfxrecon::decode::FileProcessor::GetProfilerEventName);
+        }
+
+        if (!histogram_file.empty())
+        {
+            profiler->WriteHistograms(histogram_file, gfxrecon::decode::FileProcessor::GetProfilerEventName);
+        }
+
+        profiler->LogSummary(gfxrecon::decode::FileProcessor::GetProfilerEventName, kSummaryEntries);
+    }
+}
+
+static void CreateReplayMemoryTracker(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    const std::string& limit_value = arg_parser.GetArgumentValue(kMemorySoftLimitArgument);
+    uint64_t           soft_limit  = 0;
+
+    if (!limit_value.empty())
+    {
+        if ((std::count_if(limit_value.begin(), limit_value.end(), ::isdigit) != limit_value.length()) ||
+            (std::stoull(limit_value) == 0))
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid memory soft limit \"%s\", which must be a positive integer",
+                                 limit_value.c_str());
+        }
+        else
+        {
+            // The limit is specified in MiB.
+            soft_limit = std::stoull(limit_value) * 1024 * 1024;
+        }
+    }
+
+    if (arg_parser.IsArgumentSet(kMemoryReportArgument) || (soft_limit > 0))
+    {
+        gfxrecon::decode::ReplayMemoryTracker::CreateInstance(soft_limit);
+    }
+}
+
+static void WriteReplayMemoryReport(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (gfxrecon::decode::ReplayMemoryTracker::IsEnabled())
+    {
+        const std::string& report_file = arg_parser.GetArgumentValue(kMemoryReportArgument);
+
+        if (!report_file.empty())
+        {
+            gfxrecon::decode::ReplayMemoryTracker::WriteReport(report_file);
+        }
+
+        gfxrecon::decode::ReplayMemoryTracker::LogSummary();
+        gfxrecon::decode::ReplayMemoryTracker::DestroyInstance();
+    }
+}
+
 static gfxrecon::util::ScreenshotFormat GetScreenshotFormat(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     gfxrecon::util::ScreenshotFormat format = gfxrecon::util::ScreenshotFormat::kBmp;
@@ -700,6 +793,28 @@ GetScreenshotRanges(const gfxrecon::util::ArgumentParser& arg_parser)
     return ranges;
 }
 
+static uint32_t GetMeasurementRangeLoopCount(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t           loop_count = 1;
+    const std::string& value      = arg_parser.GetArgumentValue(kLoopMeasurementRangeArgument);
+
+    if (!value.empty())
+    {
+        if ((std::count_if(value.begin(), value.end(), ::isdigit) != value.length()) || (std::stoi(value) == 0))
+        {
+            GFXRECON_LOG_WARNING(
+                "Ignoring invalid measurement range loop count \"%s\", which must be a positive integer",
+                value.c_str());
+        }
+        else
+        {
+            loop_count = std::stoi(value);
+        }
+    }
+
+    return loop_count;
+}
+
 static bool GetQuitAfterFrame(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t& quit_frame)
 {
     const std::string& value = arg_parser.GetArgumentValue(kQuitAfterFrameArgument);
@@ -1114,6 +1229,13 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
         replay_options.preload_measurement_range = true;
     }
 
+    // Looping replays the measurement range from memory, so it requires preloading.
+    replay_options.measurement_range_loop_count = GetMeasurementRangeLoopCount(arg_parser);
+    if (replay_options.measurement_range_loop_count > 1)
+    {
+        replay_options.preload_measurement_range = true;
+    }
+
     replay_options.dump_resources              = arg_parser.GetArgumentValue(kDumpResourcesArgument);
     replay_options.dump_resources_before       = arg_parser.IsOptionSet(kDumpResourcesBeforeDrawOption);
     replay_options.dump_resources_dump_depth   = arg_parser.IsOptionSet(kDumpResourcesDepth);
@@ -1130,6 +1252,8 @@ GetVulkanReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parse
         arg_parser.IsOptionSet(kDumpResourcesDumpImageSubresources);
     replay_options.dump_resources_dump_raw_images     = arg_parser.IsOptionSet(kDumpResourcesDumpRawImages);
     replay_options.dump_resources_dump_separate_alpha = arg_parser.IsOptionSet(kDumpResourcesDumpSeparateAlpha);
+    replay_options.dump_resources_archive             = arg_parser.IsOptionSet(kDumpResourcesArchive);
+    replay_options.dump_resources_skip_unchanged      = arg_parser.IsOptionSet(kDumpResourcesSkipUnchanged);
 
     std::string dr_color_att_idx = arg_parser.GetArgumentValue(kDumpResourcesColorAttIdxArg);
     if (!dr_color_att_idx.empty())